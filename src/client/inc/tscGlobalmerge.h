@@ -79,6 +79,23 @@ int32_t tscCreateGlobalMerger(tExtMemBuffer **pMemBuffer, int32_t numOfBuffer, t
 
 void tscDestroyGlobalMerger(SGlobalMerger* pMerger);
 
+typedef struct SExplainInfo {
+  int32_t      numOfVnodes;
+  SExplainMsg *pMsg;  // execution statistics merged from the vnodes, in host byte order
+} SExplainInfo;
+
+/*
+ * create the explain info from the SExplainMsg appended to the last retrieve rsp of a vnode
+ */
+SExplainInfo* tscCreateExplainInfo(const char* pMsg, int32_t len);
+
+/*
+ * merge the explain info of a vnode into the one of the query, the operators are matched by depth and name
+ */
+int32_t tscMergeExplainInfo(SExplainInfo** pDst, const SExplainInfo* pSrc);
+
+void tscDestroyExplainInfo(SExplainInfo* pInfo);
+
 #ifdef __cplusplus
 }
 #endif
@@ -58,22 +58,6 @@ typedef enum {
   SML_TIME_STAMP_NOW
 } SMLTimeStampType;
 
-typedef struct SSmlSqlInsertBatch {
-  uint64_t id;
-  int32_t index;
-
-  char* sql;
-  int32_t code;
-  int32_t tryTimes;
-  tsem_t sem;
-  int32_t affectedRows;
-  bool tryAgain;
-  bool resetQueryCache;
-  bool sleep;
-} SSmlSqlInsertBatch;
-
-#define MAX_SML_SQL_INSERT_BATCHES 512
-
 typedef struct {
   uint64_t id;
   SMLProtocolType protocol;
@@ -81,11 +65,6 @@ typedef struct {
   SHashObj* smlDataToSchema;
 
   int32_t affectedRows;
-
-  pthread_mutex_t batchMutex;
-  pthread_cond_t batchCond;
-  int32_t numBatches;
-  SSmlSqlInsertBatch batches[MAX_SML_SQL_INSERT_BATCHES];
 } SSmlLinesInfo;
 
 char* addEscapeCharToString(char *str, int32_t len);
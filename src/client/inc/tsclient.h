@@ -147,6 +147,9 @@ typedef struct {
   void *tableMetaMap;
   void *vgroupListBuf; 
   int64_t ref;
+  int64_t metaInstanceId;  // mnode instance that assigned metaVersion, 0 if no version is known
+  int64_t metaVersion;     // version of the last metadata change applied to the cache, reported by heartbeat
+  int32_t metaCacheLoad;   // 1 if the metas kept by the last process are waiting for the validation of heartbeat
 } SClusterInfo;
 
 int tsParseTime(SStrToken *pToken, int64_t *time, char **next, char *error, int16_t timePrec);
@@ -261,6 +264,7 @@ typedef struct SInsertStatementParam {
   uint32_t     insertType;              // insert data from [file|sql statement| bound statement]
   uint64_t     objectId;                // sql object id
   char        *sql;                     // current sql statement position
+  char        *prefetchEnd;             // sql statement position up to which the table metas have been prefetched
 } SInsertStatementParam;
 
 typedef enum {
@@ -316,10 +320,14 @@ typedef struct {
   int32_t*       length;  // length for each field for current row
   char **        buffer;  // Buffer used to put multibytes encoded using unicode (wchar_t)
   SColumnIndex*  pColumnIndex;
+  TAOS_COLUMN*   pColumns;    // column view of the current block, see taos_fetch_block_columns
+  char*          pColumnBuf;  // validity bitmaps and var-length offsets of pColumns
+  int32_t        colBufLen;
 
   TAOS_FIELD*    final;
   struct SGlobalMerger *pMerger;
   int32_t        numOfTables;
+  struct SExplainInfo  *pExplain;  // execution statistics of an explain analyze query
 } SSqlRes;
 
 typedef struct {
@@ -439,6 +447,7 @@ void tscInitMsgsFp();
 
 void *tscAcquireClusterInfo(const char *clusterId);
 void tscReleaseClusterInfo(const char *clusterId);
+void tscLoadMetaCache(SClusterInfo *pObj, const char *clusterId);
 
 int tsParseSql(SSqlObj *pSql, bool initial);
 
@@ -501,6 +510,7 @@ struct SGlobalMerger* tscInitResObjForLocalQuery(int32_t numOfRes, int32_t rowLe
 bool tscIsUpdateQuery(SSqlObj* pSql);
 bool tscIsDeleteQuery(SSqlObj* pSql);
 char* tscGetSqlStr(SSqlObj* pSql);
+SExplainMsg* tscGetExplainMsg(SSqlObj* pSql, int32_t* numOfVnodes);
 bool tscIsQueryWithLimit(SSqlObj* pSql);
 
 bool tscHasReachLimitation(SQueryInfo *pQueryInfo, SSqlRes *pRes);
@@ -335,6 +335,137 @@ void tscDestroyGlobalMerger(SGlobalMerger* pMerger) {
   free(pMerger);
 }
 
+SExplainInfo* tscCreateExplainInfo(const char* pMsg, int32_t len) {
+  if (len < (int32_t)sizeof(SExplainMsg)) {
+    return NULL;
+  }
+
+  const SExplainMsg* pSrc = (const SExplainMsg*)pMsg;
+  int32_t numOfOperators = htonl(pSrc->numOfOperators);
+  if (numOfOperators < 0 || len < (int32_t)(sizeof(SExplainMsg) + numOfOperators * sizeof(SExplainOperatorMsg))) {
+    return NULL;
+  }
+
+  SExplainInfo* pInfo = calloc(1, sizeof(SExplainInfo));
+  if (pInfo == NULL) {
+    return NULL;
+  }
+
+  pInfo->pMsg = malloc(sizeof(SExplainMsg) + numOfOperators * sizeof(SExplainOperatorMsg));
+  if (pInfo->pMsg == NULL) {
+    free(pInfo);
+    return NULL;
+  }
+
+  SExplainMsg* pDst = pInfo->pMsg;
+  pDst->vgId            = htonl(pSrc->vgId);
+  pDst->numOfOperators  = numOfOperators;
+  pDst->elapsed         = htobe64(pSrc->elapsed);
+  pDst->totalBlocks     = htonl(pSrc->totalBlocks);
+  pDst->loadBlocks      = htonl(pSrc->loadBlocks);
+  pDst->loadBlockStatis = htonl(pSrc->loadBlockStatis);
+  pDst->discardBlocks   = htonl(pSrc->discardBlocks);
+  pDst->totalRows       = htobe64(pSrc->totalRows);
+  pDst->checkedRows     = htobe64(pSrc->checkedRows);
+  pDst->readBytes       = htobe64(pSrc->readBytes);
+  pDst->decompBytes     = htobe64(pSrc->decompBytes);
+  pDst->cacheHits       = htobe64(pSrc->cacheHits);
+
+  for (int32_t i = 0; i < numOfOperators; ++i) {
+    const SExplainOperatorMsg* pSrcOp = &pSrc->operators[i];
+    SExplainOperatorMsg*       pDstOp = &pDst->operators[i];
+
+    tstrncpy(pDstOp->name, pSrcOp->name, sizeof(pDstOp->name));
+    pDstOp->depth       = htonl(pSrcOp->depth);
+    pDstOp->execs       = htobe64(pSrcOp->execs);
+    pDstOp->selfTime    = htobe64(pSrcOp->selfTime);
+    pDstOp->maxSelfTime = htobe64(pSrcOp->maxSelfTime);
+    pDstOp->rows        = htobe64(pSrcOp->rows);
+  }
+
+  pInfo->numOfVnodes = 1;
+  return pInfo;
+}
+
+static SExplainOperatorMsg* doFindExplainOperator(SExplainMsg* pMsg, const SExplainOperatorMsg* pOp) {
+  for (int32_t i = 0; i < pMsg->numOfOperators; ++i) {
+    SExplainOperatorMsg* p = &pMsg->operators[i];
+    if (p->depth == pOp->depth && strncmp(p->name, pOp->name, sizeof(p->name)) == 0) {
+      return p;
+    }
+  }
+
+  return NULL;
+}
+
+int32_t tscMergeExplainInfo(SExplainInfo** pDst, const SExplainInfo* pSrc) {
+  if (pSrc == NULL) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (*pDst == NULL) {
+    *pDst = calloc(1, sizeof(SExplainInfo));
+    if (*pDst == NULL) {
+      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    }
+
+    (*pDst)->pMsg = calloc(1, sizeof(SExplainMsg));
+    if ((*pDst)->pMsg == NULL) {
+      tfree(*pDst);
+      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    }
+  }
+
+  // the operators only appear in the plans of some vnodes are appended, so reserve the room for them first
+  SExplainMsg* pMsg = (*pDst)->pMsg;
+  size_t size = sizeof(SExplainMsg) + (pMsg->numOfOperators + pSrc->pMsg->numOfOperators) * sizeof(SExplainOperatorMsg);
+  pMsg = realloc(pMsg, size);
+  if (pMsg == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  }
+
+  (*pDst)->pMsg = pMsg;
+
+  const SExplainMsg* p = pSrc->pMsg;
+  pMsg->elapsed          = MAX(pMsg->elapsed, p->elapsed);
+  pMsg->totalBlocks     += p->totalBlocks;
+  pMsg->loadBlocks      += p->loadBlocks;
+  pMsg->loadBlockStatis += p->loadBlockStatis;
+  pMsg->discardBlocks   += p->discardBlocks;
+  pMsg->totalRows       += p->totalRows;
+  pMsg->checkedRows     += p->checkedRows;
+  pMsg->readBytes       += p->readBytes;
+  pMsg->decompBytes     += p->decompBytes;
+  pMsg->cacheHits       += p->cacheHits;
+
+  for (int32_t i = 0; i < p->numOfOperators; ++i) {
+    const SExplainOperatorMsg* pOp = &p->operators[i];
+
+    SExplainOperatorMsg* pTarget = doFindExplainOperator(pMsg, pOp);
+    if (pTarget == NULL) {
+      pMsg->operators[pMsg->numOfOperators++] = *pOp;
+      continue;
+    }
+
+    pTarget->execs      += pOp->execs;
+    pTarget->selfTime   += pOp->selfTime;
+    pTarget->rows       += pOp->rows;
+    pTarget->maxSelfTime = MAX(pTarget->maxSelfTime, pOp->maxSelfTime);
+  }
+
+  (*pDst)->numOfVnodes += pSrc->numOfVnodes;
+  return TSDB_CODE_SUCCESS;
+}
+
+void tscDestroyExplainInfo(SExplainInfo* pInfo) {
+  if (pInfo == NULL) {
+    return;
+  }
+
+  tfree(pInfo->pMsg);
+  free(pInfo);
+}
+
 static int32_t createOrderDescriptor(tOrderDescriptor **pOrderDesc, SQueryInfo* pQueryInfo, SColumnModel *pModel) {
   int32_t numOfGroupByCols = 0;
 
@@ -942,9 +1073,9 @@ SSDataBlock* doGlobalAggregate(void* param, bool* newgroup) {
   SSDataBlock* pBlock = NULL;
   while(1) {
     bool prev = *newgroup;
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
     if (pBlock == NULL) {
       *newgroup = prev;
       break;
@@ -1143,9 +1274,9 @@ SSDataBlock* doSLimit(void* param, bool* newgroup) {
   assert(pInfo->currentGroupOffset >= 0);
 
   while(1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock *pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       return pInfo->pRes->info.rows == 0 ? NULL : pInfo->pRes;
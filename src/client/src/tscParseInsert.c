@@ -1366,6 +1366,189 @@ static int32_t getFileFullPath(SStrToken* pToken, char* output) {
   return TSDB_CODE_SUCCESS;
 }
 
+// maximum number of table metas that are prefetched from mnode in one request for a multi-table insert
+#define INSERT_META_PREFETCH_NUM 1000
+
+static void tscSkipBracketedTokens(char **sqlstr) {
+  int32_t depth = 0;
+  char   *sql = *sqlstr;
+
+  while (1) {
+    int32_t   index = 0;
+    SStrToken sToken = tStrGetToken(sql, &index, false);
+    if (sToken.n == 0 || sToken.type == TK_ILLEGAL) {
+      break;
+    }
+
+    sql += index;
+    if (sToken.type == TK_LP) {
+      ++depth;
+    } else if (sToken.type == TK_RP && (--depth) <= 0) {
+      break;
+    }
+  }
+
+  *sqlstr = sql;
+}
+
+static void freePrefetchName(void* p) {
+  tfree(*(char**)p);
+}
+
+static bool tscAddPrefetchTableName(SSqlObj *pSql, SStrToken *pToken, SHashObj *pSet, SArray *pNameList) {
+  char      buf[TSDB_TABLE_FNAME_LEN];
+  SStrToken sTblToken;
+  sTblToken.z = buf;
+  bool dbIncluded = false;
+
+  if (pToken->n == 0 || pToken->n >= TSDB_TABLE_FNAME_LEN ||
+      validateTableName(pToken->z, pToken->n, &sTblToken, &dbIncluded) != TSDB_CODE_SUCCESS) {
+    return false;
+  }
+
+  SName sname = {0};
+  if (tscSetTableFullName(&sname, &sTblToken, pSql, dbIncluded) != TSDB_CODE_SUCCESS) {
+    return false;
+  }
+
+  char name[TSDB_TABLE_FNAME_LEN] = {0};
+  tNameExtractFullName(&sname, name);
+  size_t len = strlen(name);
+
+  SHashObj *pTableMetaMap = pSql->cmd.pTableMetaMap;
+  if (taosHashGet(pSet, name, len) != NULL || taosHashGet(UTIL_GET_TABLEMETA(pSql), name, len) != NULL ||
+      (pTableMetaMap != NULL && taosHashGet(pTableMetaMap, name, len) != NULL)) {
+    return true;
+  }
+
+  int8_t dummy = 1;
+  taosHashPut(pSet, name, len, &dummy, sizeof(dummy));
+  char *p = strdup(name);
+  taosArrayPush(pNameList, &p);
+  return true;
+}
+
+void tscTableMetaCallBack(void *param, TAOS_RES *res, int code);
+
+static void tscPrefetchTableMetaCallBack(void *param, TAOS_RES *res, int code) {
+  if (code != TSDB_CODE_SUCCESS) {
+    // not fatal, the table metas are retrieved one by one during the parse instead
+    tscDebug("0x%"PRIx64" failed to prefetch table meta, code:%s", (uint64_t)param, tstrerror(code));
+  }
+
+  tscTableMetaCallBack(param, res, TSDB_CODE_SUCCESS);
+}
+
+/*
+ * Look ahead in the insert statement from the current table, and retrieve the metas of at most
+ * INSERT_META_PREFETCH_NUM tables that are not cached yet from mnode by one request, instead of one request for each
+ * table. The tables that do not exist, e.g., the ones created automatically by the USING clause, are skipped by mnode.
+ */
+static int32_t tscPrefetchInsertTableMeta(SSqlObj *pSql, char *sql) {
+  SInsertStatementParam *pInsertParam = &pSql->cmd.insertParam;
+
+  SArray   *pNameList = taosArrayInit(4, POINTER_BYTES);
+  SHashObj *pSet = taosHashInit(64, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), false, HASH_NO_LOCK);
+  if (pNameList == NULL || pSet == NULL) {
+    taosArrayDestroy(&pNameList);
+    taosHashCleanup(pSet);
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  }
+
+  while (taosArrayGetSize(pNameList) < INSERT_META_PREFETCH_NUM) {
+    int32_t   index = 0;
+    SStrToken sToken = tStrGetToken(sql, &index, false);
+    if (!tscAddPrefetchTableName(pSql, &sToken, pSet, pNameList)) {
+      break;
+    }
+
+    // the meta of current table is cached, no need to look ahead
+    if (taosArrayGetSize(pNameList) == 0) {
+      taosHashCleanup(pSet);
+      taosArrayDestroy(&pNameList);
+      return TSDB_CODE_SUCCESS;
+    }
+
+    sql += index;
+
+    index = 0;
+    sToken = tStrGetToken(sql, &index, false);
+    if (sToken.type == TK_LP) {
+      tscSkipBracketedTokens(&sql);
+      index = 0;
+      sToken = tStrGetToken(sql, &index, false);
+    }
+
+    // tbname using stbname [(tag1, tag2, ...)] tags(...) [(col1, col2, ...)]
+    if (sToken.type == TK_USING) {
+      sql += index;
+
+      index = 0;
+      sToken = tStrGetToken(sql, &index, false);
+      if (!tscAddPrefetchTableName(pSql, &sToken, pSet, pNameList)) {
+        break;
+      }
+
+      sql += index;
+
+      index = 0;
+      sToken = tStrGetToken(sql, &index, false);
+      if (sToken.type == TK_LP) {
+        tscSkipBracketedTokens(&sql);
+        index = 0;
+        sToken = tStrGetToken(sql, &index, false);
+      }
+
+      if (sToken.type != TK_TAGS) {
+        break;
+      }
+
+      sql += index;
+      tscSkipBracketedTokens(&sql);
+
+      index = 0;
+      sToken = tStrGetToken(sql, &index, false);
+      if (sToken.type == TK_LP) {
+        tscSkipBracketedTokens(&sql);
+        index = 0;
+        sToken = tStrGetToken(sql, &index, false);
+      }
+    }
+
+    sql += index;
+    if (sToken.type == TK_FILE) {
+      index = 0;
+      tStrGetToken(sql, &index, false);
+      sql += index;
+    } else if (sToken.type == TK_VALUES) {
+      while (1) {
+        index = 0;
+        sToken = tStrGetToken(sql, &index, false);
+        if (sToken.type != TK_LP) {
+          break;
+        }
+
+        tscSkipBracketedTokens(&sql);
+      }
+    } else {
+      break;
+    }
+  }
+
+  // the rest of the tables are fetched one by one, or prefetched again when the parse arrives here
+  pInsertParam->prefetchEnd = sql;
+  taosHashCleanup(pSet);
+
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (taosArrayGetSize(pNameList) > 1) {
+    tscDebug("0x%"PRIx64" prefetch %d table metas for insert", pSql->self, (int32_t) taosArrayGetSize(pNameList));
+    code = getMultiTableMetaFromMnode(pSql, pNameList, NULL, NULL, tscPrefetchTableMetaCallBack, false, true);
+  }
+
+  taosArrayDestroyEx(&pNameList, freePrefetchName);
+  return code;
+}
+
 /**
  * parse insert sql
  * @param pSql
@@ -1449,6 +1632,15 @@ int tsParseInsertSql(SSqlObj *pSql) {
       goto _clean;
     }
 
+    if (pInsertParam->prefetchEnd == NULL || sToken.z >= pInsertParam->prefetchEnd) {
+      code = tscPrefetchInsertTableMeta(pSql, sToken.z);
+      if (code == TSDB_CODE_TSC_ACTION_IN_PROGRESS) {
+        return code;
+      } else if (code != TSDB_CODE_SUCCESS) {
+        goto _clean;
+      }
+    }
+
     char *bindedColumns = NULL;
     if ((code = tscCheckIfCreateTable(&str, pSql, &bindedColumns)) != TSDB_CODE_SUCCESS) {
       /*
@@ -1606,6 +1798,7 @@ int tsInsertInitialCheck(SSqlObj *pSql) {
   }
 
   pInsertParam->sql = sToken.z + sToken.n;
+  pInsertParam->prefetchEnd = NULL;
   return TSDB_CODE_SUCCESS;
 }
 
@@ -1644,7 +1837,15 @@ int tsParseSql(SSqlObj *pSql, bool initial) {
       strncpy(pCmd->payload, pCmd->insertParam.msg, TSDB_DEFAULT_PAYLOAD_SIZE);
     }
   } else {
-    SSqlInfo sqlInfo = qSqlParse(pSql->sqlstr);
+    // "explain analyze" runs the select statement following it, and returns its execution statistics as well
+    int32_t  explainLen = tscGetExplainPrefixLen(pSql->sqlstr);
+    SSqlInfo sqlInfo = qSqlParse(pSql->sqlstr + explainLen);
+    if (explainLen > 0 && sqlInfo.valid && sqlInfo.type != TSDB_SQL_SELECT) {
+      ret = tscInvalidOperationMsg(tscGetErrorMsgPayload(pCmd), "only select statement can be explained", NULL);
+      SqlInfoDestroy(&sqlInfo);
+      return ret;
+    }
+
     ret = tscValidateSqlInfo(pSql, &sqlInfo);
     if (ret == TSDB_CODE_TSC_INVALID_OPERATION && pSql->parseRetry < 1 && sqlInfo.type == TSDB_SQL_SELECT) {
       tscDebug("0x%"PRIx64 " parse query sql statement failed, code:%s, clear meta cache and retry ", pSql->self, tstrerror(ret));
@@ -1655,6 +1856,12 @@ int tsParseSql(SSqlObj *pSql, bool initial) {
       ret = tscValidateSqlInfo(pSql, &sqlInfo);
     }
 
+    if (ret == TSDB_CODE_SUCCESS && explainLen > 0) {
+      for (SQueryInfo* pQueryInfo = pCmd->pQueryInfo; pQueryInfo != NULL; pQueryInfo = pQueryInfo->sibling) {
+        TSDB_QUERY_SET_TYPE(pQueryInfo->type, TSDB_QUERY_TYPE_EXPLAIN);
+      }
+    }
+
     SqlInfoDestroy(&sqlInfo);
   }
 
@@ -15,6 +15,7 @@
 #include "tscUtil.h"
 #include "tsclient.h"
 #include "tscLog.h"
+#include "tscSubquery.h"
 
 #include "taos.h"
 #include "tscParseLine.h"
@@ -789,426 +790,555 @@ static int32_t arrangePointsByChildTableName(TAOS_SML_DATA_POINT* points, int nu
   return 0;
 }
 
-static int smlSnprintf(char* buf, int32_t *total, int32_t cap, char* fmt, ...) {
-  if (*total > cap) {
-    return -1;
+// maximum number of child table metas that are retrieved from mnode by one request
+#define SML_META_BATCH_NUM 1000
+
+typedef struct {
+  SArray*     points;     // SArray<TAOS_SML_DATA_POINT*> of the child table
+  SName       name;
+  STableMeta* pTableMeta;
+  int32_t*    colIndex;   // column index in the table schema of each field of the super table point schema
+  int32_t*    colOffset;  // offset of each column in a row of the raw payload
+  int32_t     nextPoint;  // the first point that is not submitted yet
+  int32_t     roundPoint; // the first point of the current submit round, to resume from when the round fails
+} SSmlChildTableInfo;
+
+static int32_t getSmlColumnIndex(SSchema* pSchema, int32_t numOfCols, const char* escapedName) {
+  size_t len = strlen(escapedName) - TS_BACKQUOTE_CHAR_SIZE;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    if (strlen(pSchema[i].name) == len && strncmp(pSchema[i].name, escapedName + 1, len) == 0) {
+      return i;
+    }
   }
 
-  va_list argp;
-  va_start(argp, fmt);
-  int len = vsnprintf(buf + *total, cap - *total, fmt, argp);
-  if (len < 0 || len >= cap - *total) {
-    return -2;
+  return -1;
+}
+
+static int32_t smlSetTableName(SSqlObj* pSql, const char* tableName, SName* pName) {
+  char tableNameBuf[TSDB_TABLE_NAME_LEN + TS_BACKQUOTE_CHAR_SIZE] = {0};
+  tstrncpy(tableNameBuf, tableName, sizeof(tableNameBuf));
+
+  SStrToken tableToken = {.z = tableNameBuf, .n = (uint32_t)strlen(tableNameBuf), .type = TK_ID};
+  tGetToken(tableNameBuf, &tableToken.type);
+
+  bool dbIncluded = false;
+  if (tscValidateName(&tableToken, true, &dbIncluded) != TSDB_CODE_SUCCESS) {
+    return TSDB_CODE_TSC_INVALID_TABLE_ID_LENGTH;
   }
-  *total += len;
-  return 0;
+
+  return tscSetTableFullName(pName, &tableToken, pSql, dbIncluded);
 }
 
-static int32_t addChildTableDataPointsToInsertSql(char* cTableName, char* sTableName, SSmlSTableSchema* sTableSchema, SArray* cTablePoints,
-                                                  char* sql, int32_t capacity, int32_t* cTableSqlLen, int fromIndex, int* nextIndex, SSmlLinesInfo* info) {
-  size_t  numTags = taosArrayGetSize(sTableSchema->tags);
-  size_t  numCols = taosArrayGetSize(sTableSchema->fields);
-  size_t  rows = taosArrayGetSize(cTablePoints);
-  SArray* tagsSchema = sTableSchema->tags;
-  SArray* colsSchema = sTableSchema->fields;
+/**
+ * write the value of a data point key-value into the payload in the column format, the variable length value is
+ * prefixed by its length
+ */
+static int32_t writeSmlKvToPayload(TAOS_SML_KV* kv, SSchema* pSchema, char* payload) {
+  if (IS_VAR_DATA_TYPE(pSchema->type)) {
+    if (!IS_VAR_DATA_TYPE(kv->type)) {
+      return TSDB_CODE_TSC_INVALID_VALUE;
+    }
 
-  TAOS_SML_KV* tagKVs[TSDB_MAX_TAGS] = {0};
-  for (int i = 0; i < rows; ++i) {
-    TAOS_SML_DATA_POINT* pDataPoint = taosArrayGetP(cTablePoints, i);
-    for (int j = 0; j < pDataPoint->tagNum; ++j) {
-      TAOS_SML_KV* kv = pDataPoint->tags + j;
-      tagKVs[kv->fieldSchemaIdx] = kv;
+    int32_t len = kv->length;
+    if (pSchema->type == TSDB_DATA_TYPE_NCHAR) {
+      if (!taosMbsToUcs4(kv->value, kv->length, varDataVal(payload), pSchema->bytes - VARSTR_HEADER_SIZE, &len)) {
+        return TSDB_CODE_TSC_INVALID_VALUE;
+      }
+    } else {
+      if (len > pSchema->bytes - VARSTR_HEADER_SIZE) {
+        return TSDB_CODE_TSC_INVALID_VALUE;
+      }
+      memcpy(varDataVal(payload), kv->value, len);
     }
+
+    varDataSetLen(payload, len);
+    return TSDB_CODE_SUCCESS;
   }
 
-  TAOS_SML_KV** colKVs = malloc(numCols * sizeof(TAOS_SML_KV*));
-  int r = fromIndex;
+  if (kv->type == pSchema->type) {
+    memcpy(payload, kv->value, pSchema->bytes);
+    return TSDB_CODE_SUCCESS;
+  }
 
-  int32_t totalLen = 0;
-  int ret = 0;
-  ret = smlSnprintf(sql, &totalLen, capacity, " %s using %s (", cTableName, sTableName);
-  if (ret != 0) {
-    goto _cleanup;
+  if (IS_VAR_DATA_TYPE(kv->type)) {
+    return TSDB_CODE_TSC_INVALID_VALUE;
   }
 
-  for (int i = 0; i < numTags; ++i) {
-    SSchema* tagSchema = taosArrayGet(tagsSchema, i);
-    ret = smlSnprintf(sql, &totalLen, capacity, "%s,", tagSchema->name);
-    if (ret != 0) {
-      goto _cleanup;
+  // numeric value of another type, e.g. an integer written into a double column
+  tVariant var = {0};
+  tVariantCreateFromBinary(&var, kv->value, kv->length, kv->type);
+  int32_t ret = tVariantDump(&var, payload, pSchema->type, false);
+  tVariantDestroy(&var);
+
+  return (ret == 0) ? TSDB_CODE_SUCCESS : TSDB_CODE_TSC_INVALID_VALUE;
+}
+
+static int32_t buildSmlTagData(SSmlChildTableInfo* pTable, SSmlSTableSchema* pSchema, STableMeta* pSTableMeta,
+                               STagData* pTagData, SSmlLinesInfo* info) {
+  int32_t  numOfTags = tscGetNumOfTags(pSTableMeta);
+  SSchema* pTagSchema = tscGetTableTagSchema(pSTableMeta);
+
+  TAOS_SML_KV* tagKVs[TSDB_MAX_TAGS] = {0};
+  size_t rows = taosArrayGetSize(pTable->points);
+  for (int32_t i = 0; i < rows; ++i) {
+    TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, i);
+    for (int32_t j = 0; j < point->tagNum; ++j) {
+      TAOS_SML_KV* kv = point->tags + j;
+      SSchema*     pPointTag = taosArrayGet(pSchema->tags, kv->fieldSchemaIdx);
+
+      int32_t index = getSmlColumnIndex(pTagSchema, numOfTags, pPointTag->name);
+      if (index < 0) {
+        tscError("SML:0x%"PRIx64" tag %s not found in super table %s", info->id, pPointTag->name, pSchema->sTableName);
+        return TSDB_CODE_TSC_INVALID_VALUE;
+      }
+      tagKVs[index] = kv;
     }
   }
-  --totalLen;
 
-  ret = smlSnprintf(sql, &totalLen, capacity, ") tags (");
-  if (ret != 0) {
-    goto _cleanup;
+  SKVRowBuilder kvRowBuilder = {0};
+  if (tdInitKVRowBuilder(&kvRowBuilder) < 0) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
 
-  for (int i = 0; i < numTags; ++i) {
-    if (capacity - totalLen < TSDB_MAX_BYTES_PER_ROW) {
-      goto _cleanup;
-    }
+  char tagVal[TSDB_MAX_TAGS_LEN] = {0};
+  for (int32_t i = 0; i < numOfTags; ++i) {
+    SSchema* pTag = &pTagSchema[i];
     if (tagKVs[i] == NULL) {
-      ret = smlSnprintf(sql, &totalLen, capacity, "NULL,");
-      if (ret != 0) {
-        goto _cleanup;
-      }
+      setNull(tagVal, pTag->type, pTag->bytes);
     } else {
-      TAOS_SML_KV* kv = tagKVs[i];
-      size_t       beforeLen = totalLen;
-      int32_t      len = 0;
-      converToStr(sql + beforeLen, kv->type, kv->value, kv->length, &len);
-      totalLen += len;
-
-      ret = smlSnprintf(sql, &totalLen, capacity, ",");
-      if (ret != 0) {
-        goto _cleanup;
+      int32_t code = writeSmlKvToPayload(tagKVs[i], pTag, tagVal);
+      if (code != TSDB_CODE_SUCCESS) {
+        tscError("SML:0x%"PRIx64" invalid value of tag %s, type:%d", info->id, pTag->name, tagKVs[i]->type);
+        tdDestroyKVRowBuilder(&kvRowBuilder);
+        return code;
       }
     }
+
+    tdAddColToKVRow(&kvRowBuilder, pTag->colId, pTag->type, tagVal, false);
   }
-  --totalLen;
-  ret = smlSnprintf(sql, &totalLen, capacity, ") (");
-  if (ret != 0) {
-    goto _cleanup;
+
+  SKVRow row = tdGetKVRowFromBuilder(&kvRowBuilder);
+  tdDestroyKVRowBuilder(&kvRowBuilder);
+  if (row == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
+  tdSortKVRowByColIdx(row);
 
-  for (int i = 0; i < numCols; ++i) {
-    SSchema* colSchema = taosArrayGet(colsSchema, i);
-    ret = smlSnprintf(sql, &totalLen, capacity, "%s,", colSchema->name);
-    if (ret != 0) {
-      goto _cleanup;
-    }
+  char* pTag = realloc(pTagData->data, kvRowLen(row));
+  if (pTag == NULL) {
+    free(row);
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
-  --totalLen;
-  ret = smlSnprintf(sql, &totalLen, capacity, ") values ");
-  if (ret != 0) {
-    goto _cleanup;
+
+  kvRowCpy(pTag, row);
+  pTagData->data = pTag;
+  pTagData->dataLen = kvRowLen(row);
+  free(row);
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t buildSmlColumnIndex(SSmlChildTableInfo* pTable, SSmlSTableSchema* pSchema, SSmlLinesInfo* info) {
+  int32_t  numOfCols = tscGetNumOfColumns(pTable->pTableMeta);
+  SSchema* pColSchema = tscGetTableSchema(pTable->pTableMeta);
+  size_t   numOfFields = taosArrayGetSize(pSchema->fields);
+
+  tfree(pTable->colIndex);
+  tfree(pTable->colOffset);
+  pTable->colIndex = malloc(numOfFields * sizeof(int32_t));
+  pTable->colOffset = malloc(numOfCols * sizeof(int32_t));
+  if (pTable->colIndex == NULL || pTable->colOffset == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
 
-  for (; r < rows; ++r) {
-    if (capacity - totalLen < TSDB_MAX_BYTES_PER_ROW) {
-      break;
-    }
-    ret = smlSnprintf(sql, &totalLen, capacity, "(");
-    if (ret != 0) {
-      goto _cleanup;
-    }
-    memset(colKVs, 0, numCols * sizeof(TAOS_SML_KV*));
+  int32_t offset = 0;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    pTable->colOffset[i] = offset;
+    offset += pColSchema[i].bytes;
+  }
 
-    TAOS_SML_DATA_POINT* point = taosArrayGetP(cTablePoints, r);
-    for (int i = 0; i < point->fieldNum; ++i) {
-      TAOS_SML_KV* kv = point->fields + i;
-      colKVs[kv->fieldSchemaIdx] = kv;
+  for (int32_t i = 0; i < numOfFields; ++i) {
+    SSchema* pField = taosArrayGet(pSchema->fields, i);
+    pTable->colIndex[i] = getSmlColumnIndex(pColSchema, numOfCols, pField->name);
+    if (pTable->colIndex[i] < 0) {
+      tscError("SML:0x%"PRIx64" column %s not found in super table %s", info->id, pField->name, pSchema->sTableName);
+      return TSDB_CODE_TSC_INVALID_VALUE;
     }
+  }
 
-    for (int i = 0; i < numCols; ++i) {
-      if (colKVs[i] == NULL) {
-        ret = smlSnprintf(sql, &totalLen, capacity, "NULL,");
-        if (ret != 0) {
-          goto _cleanup;
-        }
-      } else {
-        TAOS_SML_KV* kv = colKVs[i];
-        size_t       beforeLen = totalLen;
-        int32_t      len = 0;
-        converToStr(sql + beforeLen, kv->type, kv->value, kv->length, &len);
-        totalLen += len;
-        ret = smlSnprintf(sql, &totalLen, capacity, ",");
-        if (ret != 0) {
-          goto _cleanup;
-        }
-      }
-    }
-    --totalLen;
-    ret = smlSnprintf(sql, &totalLen, capacity, ")");
-    if (ret != 0) {
-      goto _cleanup;
-    }
+  return TSDB_CODE_SUCCESS;
+}
+
+/**
+ * create the child table by the meta request to mnode, with the tags of the data points
+ */
+static int32_t createSmlChildTable(SSqlObj* pSql, SSmlChildTableInfo* pTable, SSmlSTableSchema* pSchema, SName* pName,
+                                   SSmlLinesInfo* info) {
+  TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, 0);
+  STableMetaInfo*      pTableMetaInfo = tscGetTableMetaInfoFromCmd(&pSql->cmd, 0);
+
+  int32_t code = smlSetTableName(pSql, point->stableName, &pTableMetaInfo->name);
+  if (code == TSDB_CODE_SUCCESS) {
+    code = tscGetTableMetaSync(pSql, pTableMetaInfo, false);
+  }
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
   }
-_cleanup:
-  free(colKVs);
 
-  if (r == fromIndex) {
-    tscError("buffer can not fit one line");
-    *cTableSqlLen = 0;
-  } else {
-    *cTableSqlLen = totalLen;
+  if (!UTIL_TABLE_IS_SUPER_TABLE(pTableMetaInfo)) {
+    tscError("SML:0x%"PRIx64" %s is not a super table", info->id, point->stableName);
+    return TSDB_CODE_TSC_INVALID_OPERATION;
   }
-  *nextIndex = r;
 
-  return 0;
+  STagData* pTagData = &pSql->cmd.insertParam.tagData;
+  tNameExtractFullName(&pTableMetaInfo->name, pTagData->name);
+  code = buildSmlTagData(pTable, pSchema, pTableMetaInfo->pTableMeta, pTagData, info);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  tNameAssign(&pTableMetaInfo->name, pName);
+  return tscGetTableMetaSync(pSql, pTableMetaInfo, true);
 }
 
-static void insertCallback(void *param, TAOS_RES *res, int32_t notUsedCode) {
-  SSmlSqlInsertBatch *batch = (SSmlSqlInsertBatch *)param;
-  batch->code = taos_errno(res);
+/**
+ * get the meta of the child table, it is created when it does not exist yet
+ */
+static int32_t resolveSmlChildTable(SSqlObj* pSql, SSmlChildTableInfo* pTable, SSmlSTableSchema* pSchema, SSmlLinesInfo* info) {
+  TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, 0);
+  STableMetaInfo*      pTableMetaInfo = tscGetTableMetaInfoFromCmd(&pSql->cmd, 0);
+
+  char fullName[TSDB_TABLE_FNAME_LEN] = {0};
+  tNameExtractFullName(&pTable->name, fullName);
 
-  if (batch->code != 0) {
-    tscError("SML:0x%"PRIx64 " batch %d , taos_query_a return %d:%s", batch->id, batch->index, batch->code, taos_errstr(res));
+  // the tables that exist have been put into the local cache, the tags are only needed to create the others
+  int32_t code = TSDB_CODE_MND_INVALID_TABLE_NAME;
+  if (taosHashGet(UTIL_GET_TABLEMETA(pSql), fullName, strlen(fullName)) != NULL) {
+    tNameAssign(&pTableMetaInfo->name, &pTable->name);
+    code = tscGetTableMetaSync(pSql, pTableMetaInfo, false);
   }
-  tscDebug("SML:0x%"PRIx64 " batch %d, taos_query inserted %d rows", batch->id, batch->index, taos_affected_rows(res));
-  batch->affectedRows = taos_affected_rows(res);
-  taos_free_result(res);
 
-  int32_t code = batch->code;
-  batch->tryAgain = false;
-  batch->resetQueryCache = false;
-  batch->sleep = false;
-  if ((code == TSDB_CODE_TDB_INVALID_TABLE_ID
-       || code == TSDB_CODE_VND_INVALID_VGROUP_ID
-       || code == TSDB_CODE_TDB_TABLE_RECONFIGURE
-       || code == TSDB_CODE_APP_NOT_READY
-       || code == TSDB_CODE_RPC_NETWORK_UNAVAIL) && batch->tryTimes < TSDB_MAX_REPLICA) {
-    batch->tryAgain = true;
+  if (code == TSDB_CODE_MND_INVALID_TABLE_NAME) {
+    code = createSmlChildTable(pSql, pTable, pSchema, &pTable->name, info);
   }
 
-  if (code == TSDB_CODE_TDB_INVALID_TABLE_ID || code == TSDB_CODE_VND_INVALID_VGROUP_ID) {
-    batch->resetQueryCache = true;
-    if (batch->tryAgain) {
-      batch->sleep = true;
-    }
+  if (code != TSDB_CODE_SUCCESS) {
+    tscError("SML:0x%"PRIx64" failed to get the meta of child table %s, code:%s", info->id, point->childTableName,
+             tstrerror(code));
+    return code;
   }
 
-  if (code == TSDB_CODE_APP_NOT_READY || code == TSDB_CODE_RPC_NETWORK_UNAVAIL) {
-    if (batch->tryAgain) {
-      batch->sleep = true;
-    }
+  tfree(pTable->pTableMeta);
+  pTable->pTableMeta = tscTableMetaDup(pTableMetaInfo->pTableMeta);
+  if (pTable->pTableMeta == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
 
-  tsem_post(&batch->sem);
+  return buildSmlColumnIndex(pTable, pSchema, info);
 }
 
-static int32_t applyDataPointsWithSqlInsert(TAOS* taos, TAOS_SML_DATA_POINT* points, int32_t numPoints, SArray* stableSchemas, SSmlLinesInfo* info) {
+static int32_t fetchSmlChildTableMetaBatch(SSqlObj* pSql, SArray* pNameList, SSmlLinesInfo* info) {
+  size_t numOfNames = taosArrayGetSize(pNameList);
+  if (numOfNames == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  tscDebug("SML:0x%"PRIx64" get the meta of %d child tables", info->id, (int32_t)numOfNames);
+  int32_t code = tscGetMultiTableMetaSync(pSql, pNameList);
+
+  for (int32_t i = 0; i < numOfNames; ++i) {
+    tfree(*(char**)taosArrayGet(pNameList, i));
+  }
+  taosArrayClear(pNameList);
+
+  return code;
+}
+
+/**
+ * get the metas of the child tables not in the local cache from mnode, SML_META_BATCH_NUM tables by one request, the
+ * tables that do not exist are skipped by mnode
+ */
+static int32_t fetchSmlChildTableMetas(SSqlObj* pSql, SArray* cTables, SSmlLinesInfo* info) {
+  SArray* pNameList = taosArrayInit(4, POINTER_BYTES);
+  if (pNameList == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  }
+
   int32_t code = TSDB_CODE_SUCCESS;
+  size_t  numOfTables = taosArrayGetSize(cTables);
+  for (int32_t i = 0; i < numOfTables && code == TSDB_CODE_SUCCESS; ++i) {
+    SSmlChildTableInfo*  pTable = taosArrayGet(cTables, i);
+    TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, 0);
 
-  SHashObj* cname2points = taosHashInit(128, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, false);
-  arrangePointsByChildTableName(points, numPoints, cname2points, stableSchemas, info);
+    code = smlSetTableName(pSql, point->childTableName, &pTable->name);
+    if (code != TSDB_CODE_SUCCESS) {
+      tscError("SML:0x%"PRIx64" invalid child table name %s", info->id, point->childTableName);
+      break;
+    }
 
-  for (int i = 0; i < MAX_SML_SQL_INSERT_BATCHES; ++i) {
-    info->batches[i].id = info->id;
-    info->batches[i].index = i;
-    info->batches[i].sql = NULL;
-    info->batches[i].tryTimes = 0;
-    tsem_init(&info->batches[i].sem, 0, 0);
+    char fullName[TSDB_TABLE_FNAME_LEN] = {0};
+    tNameExtractFullName(&pTable->name, fullName);
+    if (taosHashGet(UTIL_GET_TABLEMETA(pSql), fullName, strlen(fullName)) != NULL) {
+      continue;
+    }
+
+    char* p = strdup(fullName);
+    if (p == NULL || taosArrayPush(pNameList, &p) == NULL) {
+      tfree(p);
+      code = TSDB_CODE_TSC_OUT_OF_MEMORY;
+      break;
+    }
+
+    if (taosArrayGetSize(pNameList) >= SML_META_BATCH_NUM) {
+      code = fetchSmlChildTableMetaBatch(pSql, pNameList, info);
+    }
+  }
+
+  if (code == TSDB_CODE_SUCCESS) {
+    code = fetchSmlChildTableMetaBatch(pSql, pNameList, info);
   }
 
-  info->numBatches = 0;
-  SSmlSqlInsertBatch *batch = info->batches;
-  batch->sql = malloc(tsMaxSQLStringLen + 1);
-  int32_t freeBytes = tsMaxSQLStringLen;
-  int32_t usedBytes = sprintf(batch->sql, "insert into");
-  freeBytes -= usedBytes;
+  for (int32_t i = 0; i < taosArrayGetSize(pNameList); ++i) {
+    tfree(*(char**)taosArrayGet(pNameList, i));
+  }
+  taosArrayDestroy(&pNameList);
+  return code;
+}
 
-  int32_t cTableSqlLen = 0;
+static int32_t resolveSmlChildTables(SSqlObj* pSql, SArray* cTables, SArray* stableSchemas, SSmlLinesInfo* info) {
+  int32_t code = fetchSmlChildTableMetas(pSql, cTables, info);
+  if (code != TSDB_CODE_SUCCESS) {
+    tscError("SML:0x%"PRIx64" failed to get the meta of child tables, code:%s", info->id, tstrerror(code));
+    return code;
+  }
 
-  SArray** pCTablePoints = taosHashIterate(cname2points, NULL);
-  while (pCTablePoints) {
-    SArray* cTablePoints = *pCTablePoints;
-
-    TAOS_SML_DATA_POINT* point = taosArrayGetP(cTablePoints, 0);
-    SSmlSTableSchema*    sTableSchema = taosArrayGet(stableSchemas, point->schemaIdx);
-
-    int32_t nextIndex = 0;
-    int32_t fromIndex = nextIndex;
-
-    while (nextIndex != taosArrayGetSize(cTablePoints)) {
-      fromIndex = nextIndex;
-      code = addChildTableDataPointsToInsertSql(point->childTableName, point->stableName, sTableSchema, cTablePoints,
-                                                batch->sql + usedBytes, freeBytes, &cTableSqlLen, fromIndex, &nextIndex,
-                                                info);
-      tscDebug("SML:0x%"PRIx64" add child table points to SQL. child table: %s of super table %s. range[%d-%d).",
-               info->id, point->childTableName, point->stableName, fromIndex, nextIndex);
-      usedBytes += cTableSqlLen;
-      freeBytes -= cTableSqlLen;
-      if (nextIndex != taosArrayGetSize(cTablePoints)) {
-        batch->sql[usedBytes] = '\0';
-        info->numBatches++;
-        tscDebug("SML:0x%"PRIx64" sql: %s" , info->id, batch->sql);
-
-        if (info->numBatches >= MAX_SML_SQL_INSERT_BATCHES) {
-          tscError("SML:0x%"PRIx64" Apply points failed. exceeds max sql insert batches", info->id);
-          code = TSDB_CODE_TSC_OUT_OF_MEMORY;
-          goto cleanup;
-        }
+  size_t numOfTables = taosArrayGetSize(cTables);
+  for (int32_t i = 0; i < numOfTables; ++i) {
+    SSmlChildTableInfo*  pTable = taosArrayGet(cTables, i);
+    TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, 0);
 
-        batch = &info->batches[info->numBatches];
-        batch->sql = malloc(tsMaxSQLStringLen + 1);
-        freeBytes = tsMaxSQLStringLen;
-        usedBytes = sprintf(batch->sql, "insert into");
-        freeBytes -= usedBytes;
-      }
+    code = resolveSmlChildTable(pSql, pTable, taosArrayGet(stableSchemas, point->schemaIdx), info);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
+  }
 
-    pCTablePoints = taosHashIterate(cname2points, pCTablePoints);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t writeSmlRow(TAOS_SML_DATA_POINT* point, SSmlChildTableInfo* pTable, char* row, SSmlLinesInfo* info) {
+  int32_t  numOfCols = tscGetNumOfColumns(pTable->pTableMeta);
+  SSchema* pSchema = tscGetTableSchema(pTable->pTableMeta);
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    setNull(row + pTable->colOffset[i], pSchema[i].type, pSchema[i].bytes);
   }
-  batch->sql[usedBytes] = '\0';
-  info->numBatches++;
-  tscDebug("SML:0x%"PRIx64" sql: %s" , info->id, batch->sql);
-  if (info->numBatches >= MAX_SML_SQL_INSERT_BATCHES) {
-    tscError("SML:0x%"PRIx64" Apply points failed. exceeds max sql insert batches", info->id);
-    code = TSDB_CODE_TSC_OUT_OF_MEMORY;
-    goto cleanup;
+
+  for (int32_t i = 0; i < point->fieldNum; ++i) {
+    TAOS_SML_KV* kv = point->fields + i;
+    int32_t      index = pTable->colIndex[kv->fieldSchemaIdx];
+
+    int32_t code = writeSmlKvToPayload(kv, &pSchema[index], row + pTable->colOffset[index]);
+    if (code != TSDB_CODE_SUCCESS) {
+      tscError("SML:0x%"PRIx64" invalid value of column %s, type:%d", info->id, pSchema[index].name, kv->type);
+      return code;
+    }
   }
-  bool batchesExecuted[MAX_SML_SQL_INSERT_BATCHES] = {false};
 
-  for (int i = 0; i < info->numBatches; ++i) {
-    SSmlSqlInsertBatch* insertBatch = &info->batches[i];
-    insertBatch->tryTimes = 1;
-    taos_query_a(taos, insertBatch->sql, insertCallback, insertBatch);
-    batchesExecuted[i] = true;
+  return TSDB_CODE_SUCCESS;
+}
+
+/**
+ * encode the points of the child tables into the raw payload of their data blocks, at most tsMaxSQLStringLen bytes of
+ * rows in a round, like the sql statements built for the points before.
+ */
+static int32_t buildSmlDataBlocks(SSqlObj* pSql, SArray* cTables, SSmlLinesInfo* info) {
+  SInsertStatementParam* pInsertParam = &pSql->cmd.insertParam;
+  pInsertParam->pTableBlockHashList = taosHashInit(16, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BIGINT), true, false);
+  if (pInsertParam->pTableBlockHashList == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
   }
-  int32_t triedBatches = info->numBatches;
 
-  while (triedBatches > 0) {
-    for (int i = 0; i < info->numBatches; ++i) {
-      if (batchesExecuted[i]) {
-        tsem_wait(&info->batches[i].sem);
-        info->affectedRows += info->batches[i].affectedRows;
-      }
+  int64_t totalBytes = 0;
+  size_t  numOfTables = taosArrayGetSize(cTables);
+  for (int32_t i = 0; i < numOfTables; ++i) {
+    SSmlChildTableInfo* pTable = taosArrayGet(cTables, i);
+    pTable->roundPoint = pTable->nextPoint;
+
+    int32_t remain = (int32_t)taosArrayGetSize(pTable->points) - pTable->nextPoint;
+    if (remain == 0 || totalBytes >= tsMaxSQLStringLen) {
+      continue;
     }
 
-    for (int i = 0; i < info->numBatches; ++i) {
-      SSmlSqlInsertBatch* b = info->batches + i;
-      if (b->resetQueryCache) {
-        TAOS_RES* res = taos_query(taos, "RESET QUERY CACHE");
-        taos_free_result(res);
-        break;
-      }
+    STableMeta*       pTableMeta = pTable->pTableMeta;
+    int32_t           rowSize = pTableMeta->tableInfo.rowSize;
+    STableDataBlocks* pBlock = NULL;
+
+    int32_t code = tscGetDataBlockFromList(pInsertParam->pTableBlockHashList, pTableMeta->id.uid, TSDB_PAYLOAD_SIZE,
+                                           sizeof(SSubmitBlk), rowSize, &pTable->name, pTableMeta, &pBlock, NULL);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
 
-    for (int i = 0; i < info->numBatches; ++i) {
-      SSmlSqlInsertBatch* b = info->batches + i;
-      if (b->sleep) {
-        taosMsleep(100 * (2 << b->tryTimes));
-        break;
+    int32_t maxRows = MAX(1, (int32_t)((tsMaxSQLStringLen - totalBytes) / rowSize));
+    int32_t numOfRows = MIN(remain, INT16_MAX - 1);
+    numOfRows = MIN(numOfRows, maxRows);
+
+    uint32_t size = (uint32_t)(sizeof(SSubmitBlk) + (int64_t)numOfRows * rowSize);
+    if (size > pBlock->nAllocSize) {
+      char* tmp = realloc(pBlock->pData, size);
+      if (tmp == NULL) {
+        return TSDB_CODE_TSC_OUT_OF_MEMORY;
       }
+
+      pBlock->pData = tmp;
+      pBlock->nAllocSize = size;
     }
 
-    memset(batchesExecuted, 0, sizeof(batchesExecuted));
-    triedBatches = 0;
-    for (int i = 0; i < info->numBatches; ++i) {
-      SSmlSqlInsertBatch* insertBatch = &info->batches[i];
-      if (insertBatch->tryAgain) {
-        insertBatch->tryTimes++;
-        taos_query_a(taos, insertBatch->sql, insertCallback, insertBatch);
-        batchesExecuted[i] = true;
-        triedBatches++;
+    char* row = pBlock->pData + sizeof(SSubmitBlk);
+    for (int32_t j = 0; j < numOfRows; ++j, row += rowSize) {
+      TAOS_SML_DATA_POINT* point = taosArrayGetP(pTable->points, pTable->nextPoint + j);
+      code = writeSmlRow(point, pTable, row, info);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
+
+      TSKEY ts = *(TSKEY*)row;
+      if (ts <= pBlock->prevTS) {
+        pBlock->ordered = false;
       }
+      pBlock->prevTS = ts;
     }
-  }
 
-  code = 0;
-  for (int i = 0; i < info->numBatches; ++i) {
-    SSmlSqlInsertBatch* b = info->batches + i;
-    if (b->code != 0) {
-      code = b->code;
+    pBlock->size = size;
+    code = tsSetBlockInfo((SSubmitBlk*)pBlock->pData, pTableMeta, numOfRows);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
+
+    pTable->nextPoint += numOfRows;
+    totalBytes += (int64_t)numOfRows * rowSize;
   }
 
-cleanup:
-  for (int i = 0; i < MAX_SML_SQL_INSERT_BATCHES; ++i) {
-    free(info->batches[i].sql);
-    info->batches[i].sql = NULL;
-    tsem_destroy(&info->batches[i].sem);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t submitSmlDataBlocks(SSqlObj* pSql, SArray* cTables, int32_t* affectedRows, SSmlLinesInfo* info) {
+  SInsertStatementParam* pInsertParam = &pSql->cmd.insertParam;
+
+  int32_t code = buildSmlDataBlocks(pSql, cTables, info);
+  if (code == TSDB_CODE_SUCCESS) {
+    code = tscMergeTableDataBlocks(pSql, pInsertParam, true);
   }
 
-  pCTablePoints = taosHashIterate(cname2points, NULL);
-  while (pCTablePoints) {
-    SArray* pPoints = *pCTablePoints;
-    taosArrayDestroy(&pPoints);
-    pCTablePoints = taosHashIterate(cname2points, pCTablePoints);
+  if (code == TSDB_CODE_SUCCESS) {
+    pSql->res.code = TSDB_CODE_SUCCESS;
+    pSql->res.numOfRows = 0;
+    pSql->retry = pSql->maxRetry + 1;  // the failed round is retried here, rather than by re-parsing the sql
+
+    code = tscHandleMultivnodeInsert(pSql);
+    if (code == TSDB_CODE_SUCCESS) {
+      tsem_wait(&pSql->rspSem);
+      code = pSql->res.code;
+    }
   }
-  taosHashCleanup(cname2points);
+
+  if (code == TSDB_CODE_SUCCESS) {
+    *affectedRows += pSql->res.numOfRows;
+  } else {
+    size_t numOfTables = taosArrayGetSize(cTables);
+    for (int32_t i = 0; i < numOfTables; ++i) {
+      SSmlChildTableInfo* pTable = taosArrayGet(cTables, i);
+      pTable->nextPoint = pTable->roundPoint;
+    }
+  }
+
+  destroyTableNameList(pInsertParam);
+  pInsertParam->pDataBlocks = tscDestroyBlockArrayList(pSql, pInsertParam->pDataBlocks);
+  pInsertParam->pTableBlockHashList = tscDestroyBlockHashTable(pSql, pInsertParam->pTableBlockHashList, false);
+  tscFreeSubobj(pSql);
+  tfree(pSql->pSubs);
+
   return code;
 }
 
-static int doSmlInsertOneDataPoint(TAOS* taos, TAOS_SML_DATA_POINT* point, SSmlLinesInfo* info) {
+static bool isSmlInsertRetryCode(int32_t code) {
+  return code == TSDB_CODE_TDB_INVALID_TABLE_ID || code == TSDB_CODE_VND_INVALID_VGROUP_ID ||
+         code == TSDB_CODE_TDB_TABLE_RECONFIGURE || code == TSDB_CODE_APP_NOT_READY ||
+         code == TSDB_CODE_RPC_NETWORK_UNAVAIL;
+}
+
+/**
+ * Encode the data points into the submit blocks of their child tables directly, the blocks are merged by vgroup and
+ * sent to the vnodes, so no insert sql statement is rendered and parsed again.
+ */
+static int32_t applyDataPointsWithSubmitBlocks(TAOS* taos, TAOS_SML_DATA_POINT* points, int32_t numPoints, SArray* stableSchemas, SSmlLinesInfo* info) {
   int32_t code = TSDB_CODE_SUCCESS;
 
-  if (!point->childTableName) {
-    int tableNameLen = TSDB_TABLE_NAME_LEN;
-    point->childTableName = calloc(1, tableNameLen + 1);
-    getSmlMd5ChildTableName(point, point->childTableName, &tableNameLen, info);
-    point->childTableName[tableNameLen] = '\0';
-  }
+  SHashObj* cname2points = taosHashInit(128, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, false);
+  arrangePointsByChildTableName(points, numPoints, cname2points, stableSchemas, info);
 
-  STableMeta* tableMeta = NULL;
-  int32_t ret = getSuperTableMetaFromLocalCache(taos, point->stableName, &tableMeta, info);
-  if (ret != TSDB_CODE_SUCCESS) {
-    return ret;
+  SArray* cTables = taosArrayInit(taosHashGetSize(cname2points), sizeof(SSmlChildTableInfo));
+  SArray** pCTablePoints = taosHashIterate(cname2points, NULL);
+  while (pCTablePoints) {
+    SSmlChildTableInfo table = {.points = *pCTablePoints};
+    taosArrayPush(cTables, &table);
+    pCTablePoints = taosHashIterate(cname2points, pCTablePoints);
   }
-  uint8_t precision = tableMeta->tableInfo.precision;
-  free(tableMeta);
+  taosHashCleanup(cname2points);
 
-  char* sql = malloc(tsMaxSQLStringLen + 1);
-  if (sql == NULL) {
-    tscError("SML:0x%" PRIx64 " failed to allocate memory for sql", info->id);
-    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  SSqlObj* pSql = tscCreateInsertObj(taos);
+  if (pSql == NULL) {
+    code = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    goto _clean;
   }
-  int   freeBytes = tsMaxSQLStringLen;
-  int   sqlLen = 0;
-  int   retLen;
-  sqlLen += snprintf(sql + sqlLen, freeBytes - sqlLen, "insert into %s(", point->childTableName);
-  for (int col = 0; col < point->fieldNum; ++col) {
-    TAOS_SML_KV* kv = point->fields + col;
-    retLen = snprintf(sql + sqlLen, freeBytes - sqlLen, "%s,", kv->key);
-    if (retLen >= freeBytes - sqlLen) {
-      tscError("SML:0x%" PRIx64 " no free space for building sql key", info->id);
-      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+
+  code = resolveSmlChildTables(pSql, cTables, stableSchemas, info);
+
+  int32_t tryTimes = 1;
+  int32_t i = 0;
+  size_t  numOfTables = taosArrayGetSize(cTables);
+  while (code == TSDB_CODE_SUCCESS && i < numOfTables) {
+    SSmlChildTableInfo* pTable = taosArrayGet(cTables, i);
+    if (pTable->nextPoint == taosArrayGetSize(pTable->points)) {
+      ++i;
+      continue;
     }
-    sqlLen += retLen;
-  }
-  --sqlLen;
-  retLen += snprintf(sql + sqlLen, freeBytes - sqlLen, ") values (");
-  if (retLen >= freeBytes - sqlLen) {
-    tscError("SML:0x%" PRIx64 " no free space for building sql", info->id);
-    return TSDB_CODE_TSC_OUT_OF_MEMORY;
-  }
-  sqlLen += retLen;
-  TAOS_SML_KV* tsField = point->fields + 0;
-  int64_t      ts = *(int64_t*)(tsField->value);
-  ts = convertTimePrecision(ts, TSDB_TIME_PRECISION_NANO, precision);
-  retLen = snprintf(sql + sqlLen, freeBytes - sqlLen, "%" PRId64 ",", ts);
-  if (retLen >= freeBytes - sqlLen) {
-    tscError("SML:0x%" PRIx64 " no free space for building timestamp", info->id);
-    return TSDB_CODE_TSC_OUT_OF_MEMORY;
-  }
-  sqlLen += retLen;
-  for (int col = 1; col < point->fieldNum; ++col) {
-    TAOS_SML_KV* kv = point->fields + col;
-    int32_t      len = 0;
 
-    if (freeBytes - sqlLen <= kv->length) {
-      tscError("SML:0x%" PRIx64 " no free space for converToStr", info->id);
-      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    code = submitSmlDataBlocks(pSql, cTables, &info->affectedRows, info);
+    if (code == TSDB_CODE_SUCCESS || !isSmlInsertRetryCode(code) || tryTimes >= TSDB_MAX_REPLICA) {
+      continue;
     }
-    converToStr(sql + sqlLen, kv->type, kv->value, kv->length, &len);
-    sqlLen += len;
-    retLen = snprintf(sql + sqlLen, freeBytes - sqlLen, ",");
-    if (retLen >= freeBytes - sqlLen) {
-      tscError("SML:0x%" PRIx64 " no free space for building sql comma", info->id);
-      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+
+    tscDebug("SML:0x%"PRIx64" submit data points failed, code:%s, try again:%d", info->id, tstrerror(code), tryTimes);
+    tryTimes++;
+
+    if (code == TSDB_CODE_TDB_INVALID_TABLE_ID || code == TSDB_CODE_VND_INVALID_VGROUP_ID) {
+      for (int32_t j = 0; j < numOfTables; ++j) {
+        char name[TSDB_TABLE_FNAME_LEN] = {0};
+        tNameExtractFullName(&((SSmlChildTableInfo*)taosArrayGet(cTables, j))->name, name);
+        taosHashRemove(UTIL_GET_TABLEMETA(pSql), name, strnlen(name, TSDB_TABLE_FNAME_LEN));
+      }
     }
-    sqlLen += retLen;
-  }
-  --sqlLen;
-  retLen = snprintf(sql + sqlLen, freeBytes - sqlLen, ")");
-  if (retLen >= freeBytes - sqlLen) {
-    tscError("SML:0x%" PRIx64 " no free space for building the last right parenthesis", info->id);
-    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+
+    if (code != TSDB_CODE_TDB_TABLE_RECONFIGURE) {
+      taosMsleep(100 * (2 << tryTimes));
+    }
+
+    code = resolveSmlChildTables(pSql, cTables, stableSchemas, info);
   }
-  sqlLen += retLen;
-  sql[sqlLen] = 0;
 
-  tscDebug("SML:0x%" PRIx64 " insert child table table %s of super table %s sql: %s", info->id,
-           point->childTableName, point->stableName, sql);
-  TAOS_RES* res = taos_query(taos, sql);
-  free(sql);
-  code = taos_errno(res);
-  info->affectedRows = taos_affected_rows(res);
-  taos_free_result(res);
+  taosReleaseRef(tscObjRef, pSql->self);
 
+_clean:
+  for (int32_t j = 0; j < taosArrayGetSize(cTables); ++j) {
+    SSmlChildTableInfo* pTable = taosArrayGet(cTables, j);
+    taosArrayDestroy(&pTable->points);
+    tfree(pTable->pTableMeta);
+    tfree(pTable->colIndex);
+    tfree(pTable->colOffset);
+  }
+  taosArrayDestroy(&cTables);
   return code;
 }
 
@@ -1219,14 +1349,6 @@ int tscSmlInsert(TAOS* taos, TAOS_SML_DATA_POINT* points, int numPoint, SSmlLine
 
   info->affectedRows = 0;
 
-  if (numPoint == 1) {
-    TAOS_SML_DATA_POINT* point = points + 0;
-    code = doSmlInsertOneDataPoint(taos, point, info);
-    if (code == TSDB_CODE_SUCCESS) {
-      return code;
-    }
-  }
-
   tscDebug("SML:0x%"PRIx64" build data point schemas", info->id);
   SArray* stableSchemas = taosArrayInit(32, sizeof(SSmlSTableSchema)); // SArray<STableColumnsSchema>
   code = buildDataPointSchemas(points, numPoint, stableSchemas, info);
@@ -1243,7 +1365,7 @@ int tscSmlInsert(TAOS* taos, TAOS_SML_DATA_POINT* points, int numPoint, SSmlLine
   }
 
   tscDebug("SML:0x%"PRIx64" apply data points", info->id);
-  code = applyDataPointsWithSqlInsert(taos, points, numPoint, stableSchemas, info);
+  code = applyDataPointsWithSubmitBlocks(taos, points, numPoint, stableSchemas, info);
   if (code != 0) {
     tscError("SML:0x%"PRIx64" error apply data points : %s", info->id, tstrerror(code));
   }
@@ -35,6 +35,12 @@ typedef struct SNormalStmtPart {
   char* str;
 } SNormalStmtPart;
 
+typedef enum {
+  NORMAL_STMT_PLAN_UNKNOWN = 0,  // try to cache the plan at the next execution
+  NORMAL_STMT_PLAN_CACHED,
+  NORMAL_STMT_PLAN_NONE,         // the statement can not be executed with a cached plan
+} NORMAL_STMT_PLAN_ST;
+
 typedef struct SNormalStmt {
   uint16_t         sizeParts;
   uint16_t         numParts;
@@ -42,6 +48,11 @@ typedef struct SNormalStmt {
   char* sql;
   SNormalStmtPart* parts;
   tVariant*        params;
+
+  int8_t           planState;
+  int64_t          planTime;  // super table plans expire to pick up the vgroups created later
+  int16_t*         tsOptrs;   // the operator each parameter bounds the primary timestamp with
+  SQueryInfo*      pPlan;     // validated query of a previous execution
 } SNormalStmt;
 
 typedef struct SMultiTbStmt {
@@ -82,6 +93,7 @@ typedef struct STscStmt {
   SNormalStmt normal;
 
   int numOfRows;
+  bool resUsed;  // the result of the last execution is taken by taos_stmt_use_result
 } STscStmt;
 
 #define STMT_RET(c) do {          \
@@ -210,9 +222,15 @@ static int normalStmtBindParam(STscStmt* stmt, TAOS_BIND* bind) {
 
 static int normalStmtPrepare(STscStmt* stmt) {
   SNormalStmt* normal = &stmt->normal;
-  char* sql = stmt->pSql->sqlstr;
   uint32_t i = 0, start = 0;
 
+  // the parts refer to a copy of the sql string, the sql object is replaced by each execution
+  char* sql = strdup(stmt->pSql->sqlstr);
+  if (sql == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  }
+  normal->sql = sql;
+
   while (sql[i] != 0) {
     SStrToken token = {0};
     token.n = tGetToken(sql + i, &token.type);
@@ -327,6 +345,401 @@ static char* normalStmtBuildSql(STscStmt* stmt) {
   return taosStringBuilderGetResult(&sb, NULL);
 }
 
+// the validated plan of a normal statement is kept and only the query time window is patched on execution. It is
+// applicable when all parameters bound the primary timestamp in a plain where clause, like "ts >= ? and ts < ?" or
+// "ts between ? and ?", since other parameters are folded into the serialized filters by the validation.
+#define NORMAL_STMT_STABLE_PLAN_KEEP_MS 5000
+
+static bool normalStmtIsTsToken(const char* z, uint32_t n, uint32_t type, const char* tsName) {
+  if (type != TK_ID) {
+    return false;
+  }
+
+  if (n >= TS_BACKQUOTE_CHAR_SIZE && z[0] == TS_BACKQUOTE_CHAR && z[n - 1] == TS_BACKQUOTE_CHAR) {
+    z += 1;
+    n -= TS_BACKQUOTE_CHAR_SIZE;
+  }
+
+  return strlen(tsName) == n && strncasecmp(z, tsName, n) == 0;
+}
+
+static bool normalStmtIsCompareOptr(uint32_t type) {
+  switch (type) {
+    case TK_LT: case TK_LE: case TK_GT: case TK_GE: case TK_EQ: case TK_NE:
+    case TK_BETWEEN: case TK_IN: case TK_IS: case TK_LIKE: case TK_MATCH: case TK_NMATCH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool normalStmtGetTsParams(SNormalStmt* normal, const char* tsName, int16_t* optrs) {
+  int32_t  numOfSelect = 0;
+  bool     where = false;
+  bool     between = false;  // expect the "and" of "between ? and ?"
+  bool     prevTs = false;
+  uint32_t prev = 0;
+  int16_t  expect = 0;       // operator of the primary timestamp waiting for a parameter
+  uint16_t idx = 0;
+
+  for (uint16_t i = 0; i < normal->numParts; ++i) {
+    SNormalStmtPart* part = normal->parts + i;
+    if (part->isParam) {
+      if (!where || expect == 0) {
+        return false;
+      }
+
+      between = (expect == TK_BETWEEN);
+      optrs[idx++] = between ? TK_GE : expect;
+
+      expect = 0;
+      prev = TK_QUESTION;
+      prevTs = false;
+      continue;
+    }
+
+    for (uint32_t j = 0; j < part->len;) {
+      uint32_t type = 0;
+      char*    z = part->str + j;
+      uint32_t n = tGetToken(z, &type);
+      if (n == 0) {
+        return false;
+      }
+
+      j += n;
+      if (type == TK_SPACE || type == TK_COMMENT) {
+        continue;
+      }
+
+      // a literal bounds the primary timestamp, or the time range is not a plain conjunction
+      if (expect != 0 || type == TK_OR || type == TK_UNION || type == TK_NOW || type == TK_TODAY) {
+        return false;
+      }
+
+      if (between) {
+        if (type != TK_AND) {
+          return false;
+        }
+
+        between = false;
+        expect = TK_LE;
+        prev = type;
+        continue;
+      }
+
+      bool isTs = normalStmtIsTsToken(z, n, type, tsName);
+      if (where && isTs && normalStmtIsCompareOptr(prev)) {
+        return false;
+      }
+
+      if (where && prevTs && normalStmtIsCompareOptr(type)) {
+        if (type == TK_NE || type == TK_IN || type == TK_IS || type == TK_LIKE || type == TK_MATCH || type == TK_NMATCH) {
+          return false;
+        }
+
+        expect = (int16_t)type;
+      }
+
+      numOfSelect += (type == TK_SELECT);
+      where |= (type == TK_WHERE);
+      prev = type;
+      prevTs = isTs;
+    }
+  }
+
+  return numOfSelect == 1 && expect == 0 && !between;
+}
+
+// the time window from the parameters, the same way as getTimeRange does with the literal values
+static bool normalStmtGetTimeWindow(SNormalStmt* normal, STimeWindow* win) {
+  *win = TSWINDOW_INITIALIZER;
+
+  for (uint16_t i = 0; i < normal->numParams; ++i) {
+    tVariant* var = normal->params + i;
+    int64_t   val = 0;
+
+    switch (var->nType) {
+      case TSDB_DATA_TYPE_TINYINT:
+      case TSDB_DATA_TYPE_SMALLINT:
+      case TSDB_DATA_TYPE_INT:
+      case TSDB_DATA_TYPE_BIGINT:
+      case TSDB_DATA_TYPE_TIMESTAMP:
+        val = var->i64;
+        break;
+      case TSDB_DATA_TYPE_UTINYINT:
+      case TSDB_DATA_TYPE_USMALLINT:
+      case TSDB_DATA_TYPE_UINT:
+      case TSDB_DATA_TYPE_UBIGINT:
+        if (var->u64 > INT64_MAX) {
+          return false;
+        }
+        val = (int64_t)var->u64;
+        break;
+      default:  // timestamp strings are parsed by the validation
+        return false;
+    }
+
+    STimeWindow w = TSWINDOW_INITIALIZER;
+    switch (normal->tsOptrs[i]) {
+      case TK_LE: w.ekey = val; break;
+      case TK_LT: w.ekey = val - 1; break;
+      case TK_GT: w.skey = val + 1; break;
+      case TK_GE: w.skey = val; break;
+      case TK_EQ: w.skey = w.ekey = val; break;
+      default:
+        return false;
+    }
+
+    win->skey = MAX(win->skey, w.skey);
+    win->ekey = MIN(win->ekey, w.ekey);
+  }
+
+  return true;
+}
+
+static int32_t normalStmtCopyPlan(SQueryInfo* pQueryInfo, const SQueryInfo* pSrc) {
+  int32_t code = tscQueryInfoCopy(pQueryInfo, pSrc);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  // derived by the validation of the top level query, not by tscQueryInfoCopy
+  pQueryInfo->udColumnId      = pSrc->udColumnId;
+  pQueryInfo->distinct        = pSrc->distinct;
+  pQueryInfo->onlyHasTagCond  = pSrc->onlyHasTagCond;
+  pQueryInfo->havingFieldNum  = pSrc->havingFieldNum;
+  pQueryInfo->stableQuery     = pSrc->stableQuery;
+  pQueryInfo->groupbyColumn   = pSrc->groupbyColumn;
+  pQueryInfo->groupbyTag      = pSrc->groupbyTag;
+  pQueryInfo->simpleAgg       = pSrc->simpleAgg;
+  pQueryInfo->projectionQuery = pSrc->projectionQuery;
+  pQueryInfo->hasFilter       = pSrc->hasFilter;
+  pQueryInfo->onlyTagQuery    = pSrc->onlyTagQuery;
+  pQueryInfo->globalMerge     = pSrc->globalMerge;
+  pQueryInfo->isStddev        = pSrc->isStddev;
+
+  if (pQueryInfo->exprList1 == NULL && pSrc->exprList1 != NULL) {
+    pQueryInfo->exprList1 = taosArrayInit(4, POINTER_BYTES);
+    if (pQueryInfo->exprList1 == NULL || tscExprCopyAll(pQueryInfo->exprList1, pSrc->exprList1, true) != 0) {
+      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static void normalStmtDestroyPlan(SNormalStmt* normal) {
+  if (normal->pPlan != NULL) {
+    SSqlCmd cmd = {0};
+    cmd.pQueryInfo = normal->pPlan;
+    tscFreeQueryInfo(&cmd, false, 0);
+    normal->pPlan = NULL;
+  }
+
+  if (normal->planState == NORMAL_STMT_PLAN_CACHED) {
+    normal->planState = NORMAL_STMT_PLAN_UNKNOWN;
+  }
+}
+
+// keep the query just validated for the statement, before it is modified by the execution
+static void normalStmtCachePlan(STscStmt* pStmt, SSqlObj* pSql) {
+  SNormalStmt* normal = &pStmt->normal;
+  SSqlCmd*     pCmd = &pSql->cmd;
+
+  if (pCmd->command == TSDB_SQL_RETRIEVE_EMPTY_RESULT) {  // validation stops early for an empty time window
+    return;
+  }
+
+  SQueryInfo* pQueryInfo = pCmd->pQueryInfo;
+  if (pCmd->command != TSDB_SQL_SELECT || pQueryInfo == NULL || pQueryInfo->sibling != NULL ||
+      taosArrayGetSize(pQueryInfo->pUpstream) > 0 || pQueryInfo->numOfTables != 1 ||
+      QUERY_IS_JOIN_QUERY(pQueryInfo->type) || pQueryInfo->fillType != TSDB_FILL_NONE ||
+      tscIsPointInterpQuery(pQueryInfo) || tscQueryTags(pQueryInfo) || (pQueryInfo->pUdfInfo != NULL && taosArrayGetSize(pQueryInfo->pUdfInfo) > 0)) {
+    normal->planState = NORMAL_STMT_PLAN_NONE;
+    return;
+  }
+
+  STableMetaInfo* pTableMetaInfo = tscGetMetaInfo(pQueryInfo, 0);
+  SSchema*        pSchema = tscGetTableSchema(pTableMetaInfo->pTableMeta);
+
+  if (normal->tsOptrs == NULL && normal->numParams > 0) {
+    normal->tsOptrs = calloc(normal->numParams, sizeof(int16_t));
+    if (normal->tsOptrs == NULL) {
+      return;
+    }
+  }
+
+  if (!normalStmtGetTsParams(normal, pSchema[PRIMARYKEY_TIMESTAMP_COL_INDEX].name, normal->tsOptrs)) {
+    normal->planState = NORMAL_STMT_PLAN_NONE;
+    return;
+  }
+
+  STimeWindow win = {0};
+  if (!normalStmtGetTimeWindow(normal, &win)) {
+    return;
+  }
+
+  if (win.skey != pQueryInfo->window.skey || win.ekey != pQueryInfo->window.ekey) {
+    tscDebug("0x%"PRIx64" time window of parameters [%"PRId64", %"PRId64"] differs from [%"PRId64", %"PRId64"], no plan cached",
+             pSql->self, win.skey, win.ekey, pQueryInfo->window.skey, pQueryInfo->window.ekey);
+    normal->planState = NORMAL_STMT_PLAN_NONE;
+    return;
+  }
+
+  SQueryInfo* pPlan = calloc(1, sizeof(SQueryInfo));
+  if (pPlan == NULL) {
+    return;
+  }
+
+  tscInitQueryInfo(pPlan);
+  normal->pPlan = pPlan;
+  if (normalStmtCopyPlan(pPlan, pQueryInfo) != TSDB_CODE_SUCCESS) {
+    normalStmtDestroyPlan(normal);
+    return;
+  }
+
+  normal->planState = NORMAL_STMT_PLAN_CACHED;
+  normal->planTime = taosGetTimestampMs();
+  tscDebug("0x%"PRIx64" plan of statement cached, %d timestamp parameters", pSql->self, normal->numParams);
+}
+
+static int32_t normalStmtSetPlan(SSqlObj* pSql, SQueryInfo* pPlan, STimeWindow* win) {
+  SSqlCmd* pCmd = &pSql->cmd;
+
+  int32_t code = tscAddQueryInfo(pCmd);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  SQueryInfo* pQueryInfo = tscGetQueryInfo(pCmd);
+  if ((code = normalStmtCopyPlan(pQueryInfo, pPlan)) != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  pQueryInfo->window = *win;
+  pQueryInfo->command = (win->skey > win->ekey) ? TSDB_SQL_RETRIEVE_EMPTY_RESULT : TSDB_SQL_SELECT;
+  pCmd->command = pQueryInfo->command;
+
+  STableMetaInfo* pTableMetaInfo = tscGetMetaInfo(pQueryInfo, 0);
+  pSql->res.precision = tscGetTableInfo(pTableMetaInfo->pTableMeta).precision;
+  return TSDB_CODE_SUCCESS;
+}
+
+// run a query the same way as taos_query, either with the cached plan, or by validating the sql string and
+// caching the plan if possible
+static SSqlObj* normalStmtQuery(STscStmt* pStmt, char* sql, STimeWindow* win) {
+  SNormalStmt* normal = &pStmt->normal;
+  STscObj*     pObj = pStmt->taos;
+
+  SSqlObj* pSql = calloc(1, sizeof(SSqlObj));
+  if (pSql == NULL) {
+    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  SSqlCmd* pCmd = &pSql->cmd;
+
+  tsem_init(&pSql->rspSem, 0, 0);
+  pSql->signature = pSql;
+  pSql->param     = pObj;
+  pSql->pTscObj   = pObj;
+  pSql->maxRetry  = TSDB_MAX_REPLICA;
+  pSql->fp        = waitForQueryRsp;
+  pSql->fetchFp   = waitForQueryRsp;
+  pSql->rootObj   = pSql;
+  pCmd->resColumnId = TSDB_RES_COL_ID;
+
+  registerSqlObj(pSql);
+
+  size_t sqlLen = strlen(sql);
+  pSql->sqlstr = calloc(1, sqlLen + 1);
+  if (pSql->sqlstr == NULL) {
+    pSql->res.code = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    tscAsyncResultOnError(pSql);
+    tsem_wait(&pSql->rspSem);
+    return pSql;
+  }
+
+  strntolower(pSql->sqlstr, sql, (int32_t)sqlLen);
+  tscDebugL("0x%"PRIx64" SQL: %s", pSql->self, pSql->sqlstr);
+
+  taosAcquireRef(tscObjRef, pSql->self);
+
+  int32_t code = tscAllocPayload(pCmd, TSDB_DEFAULT_PAYLOAD_SIZE);
+  if (code == TSDB_CODE_SUCCESS) {
+    if (win != NULL) {
+      code = normalStmtSetPlan(pSql, normal->pPlan, win);
+    } else {
+      code = tsParseSql(pSql, true);
+      if (code == TSDB_CODE_SUCCESS && normal->planState == NORMAL_STMT_PLAN_UNKNOWN) {
+        normalStmtCachePlan(pStmt, pSql);
+      }
+    }
+  }
+
+  if (code == TSDB_CODE_TSC_ACTION_IN_PROGRESS) {  // executed once the table meta is retrieved
+    taosReleaseRef(tscObjRef, pSql->self);
+    tsem_wait(&pSql->rspSem);
+    return pSql;
+  }
+
+  if (code != TSDB_CODE_SUCCESS) {
+    pSql->res.code = code;
+    tscAsyncResultOnError(pSql);
+  } else {
+    executeQuery(pSql, tscGetQueryInfo(pCmd));
+  }
+
+  taosReleaseRef(tscObjRef, pSql->self);
+  tsem_wait(&pSql->rspSem);
+  return pSql;
+}
+
+static int normalStmtExecute(STscStmt* pStmt) {
+  SNormalStmt* normal = &pStmt->normal;
+
+  char* sql = normalStmtBuildSql(pStmt);
+  if (sql == NULL) {
+    return TSDB_CODE_TSC_OUT_OF_MEMORY;
+  }
+
+  if (normal->planState == NORMAL_STMT_PLAN_CACHED) {
+    STableMetaInfo* pTableMetaInfo = tscGetMetaInfo(normal->pPlan, 0);
+    if (UTIL_TABLE_IS_SUPER_TABLE(pTableMetaInfo) &&
+        taosGetTimestampMs() - normal->planTime > NORMAL_STMT_STABLE_PLAN_KEEP_MS) {
+      normalStmtDestroyPlan(normal);
+    }
+  }
+
+  taosReleaseRef(tscObjRef, pStmt->pSql->self);
+
+  STimeWindow win = {0};
+  if (normal->planState == NORMAL_STMT_PLAN_NONE || strlen(sql) > (size_t)tsMaxSQLStringLen) {
+    pStmt->pSql = taos_query((TAOS*)pStmt->taos, sql);
+  } else if (normal->planState == NORMAL_STMT_PLAN_CACHED && normalStmtGetTimeWindow(normal, &win)) {
+    STableMeta* pMeta = tscGetMetaInfo(normal->pPlan, 0)->pTableMeta;
+    pStmt->pSql = normalStmtQuery(pStmt, sql, &win);
+
+    // the table meta is renewed and the sql string validated again during the execution
+    SSqlObj* pSql = pStmt->pSql;
+    if (pSql != NULL) {
+      STableMetaInfo* pTableMetaInfo = tscGetTableMetaInfoFromCmd(&pSql->cmd, 0);
+      if (pSql->res.code != TSDB_CODE_SUCCESS || pTableMetaInfo == NULL || pTableMetaInfo->pTableMeta == NULL ||
+          pTableMetaInfo->pTableMeta->sversion != pMeta->sversion ||
+          pTableMetaInfo->pTableMeta->tversion != pMeta->tversion) {
+        normalStmtDestroyPlan(normal);
+      }
+    }
+  } else {
+    pStmt->pSql = normalStmtQuery(pStmt, sql, NULL);
+  }
+
+  free(sql);
+
+  pStmt->numOfRows += taos_affected_rows(pStmt->pSql);
+  return taos_errno(pStmt->pSql);
+}
+
 static int fillColumnsNull(STableDataBlocks* pBlock, int32_t rowNum) {
   SParsedDataColInfo* spd = &pBlock->boundColumnInfo;
   int32_t offset = 0;
@@ -1571,6 +1984,30 @@ int32_t stmtValidateValuesFields(SSqlCmd *pCmd, char * sql) {
 ////////////////////////////////////////////////////////////////////////////////
 // interface functions
 
+static SSqlObj* stmtCreateSqlObj(STscObj* pObj) {
+  SSqlObj* pSql = calloc(1, sizeof(SSqlObj));
+  if (pSql == NULL) {
+    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    tscError("failed to allocate memory for statement");
+    return NULL;
+  }
+
+  if (TSDB_CODE_SUCCESS != tscAllocPayload(&pSql->cmd, TSDB_DEFAULT_PAYLOAD_SIZE)) {
+    free(pSql);
+    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    tscError("failed to malloc payload buffer");
+    return NULL;
+  }
+
+  tsem_init(&pSql->rspSem, 0, 0);
+  pSql->signature   = pSql;
+  pSql->pTscObj     = pObj;
+  pSql->maxRetry    = TSDB_MAX_REPLICA;
+  registerSqlObj(pSql);
+
+  return pSql;
+}
+
 TAOS_STMT* taos_stmt_init(TAOS* taos) {
   STscObj* pObj = (STscObj*)taos;
   STscStmt* pStmt = NULL;
@@ -1589,31 +2026,15 @@ TAOS_STMT* taos_stmt_init(TAOS* taos) {
   }
   pStmt->taos = pObj;
 
-  SSqlObj* pSql = calloc(1, sizeof(SSqlObj));
-
+  SSqlObj* pSql = stmtCreateSqlObj(pObj);
   if (pSql == NULL) {
     free(pStmt);
-    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
-    tscError("failed to allocate memory for statement");
-    return NULL;
-  }
-
-  if (TSDB_CODE_SUCCESS != tscAllocPayload(&pSql->cmd, TSDB_DEFAULT_PAYLOAD_SIZE)) {
-    free(pSql);
-    free(pStmt);
-    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
-    tscError("failed to malloc payload buffer");
     return NULL;
   }
 
-  tsem_init(&pSql->rspSem, 0, 0);
-  pSql->signature   = pSql;
-  pSql->pTscObj     = pObj;
-  pSql->maxRetry    = TSDB_MAX_REPLICA;
   pStmt->pSql       = pSql;
   pStmt->last       = STMT_INIT;
   pStmt->numOfRows  = 0;
-  registerSqlObj(pSql);
 
   return pStmt;
 }
@@ -1920,6 +2341,8 @@ int taos_stmt_close(TAOS_STMT* stmt) {
     }
     free(normal->parts);
     free(normal->sql);
+    free(normal->tsOptrs);
+    normalStmtDestroyPlan(normal);
   } else {
     if (pStmt->multiTbInsert) {
       taosHashCleanup(pStmt->mtb.pTableHash);
@@ -2094,16 +2517,8 @@ int taos_stmt_execute(TAOS_STMT* stmt) {
       ret = insertStmtExecute(pStmt);
     }
   } else { // normal stmt query
-    char* sql = normalStmtBuildSql(pStmt);
-    if (sql == NULL) {
-      ret = TSDB_CODE_TSC_OUT_OF_MEMORY;
-    } else {
-      taosReleaseRef(tscObjRef, pStmt->pSql->self);
-      pStmt->pSql = taos_query((TAOS*)pStmt->taos, sql);
-      pStmt->numOfRows += taos_affected_rows(pStmt->pSql);
-      ret = taos_errno(pStmt->pSql);
-      free(sql);
-    }
+    ret = normalStmtExecute(pStmt);
+    pStmt->resUsed = false;
   }
 
   STMT_RET(ret);
@@ -2131,8 +2546,20 @@ TAOS_RES *taos_stmt_use_result(TAOS_STMT* stmt) {
     tscError("result has been used already.");
     return NULL;
   }
+  if (pStmt->resUsed) {
+    tscError("result has been used already.");
+    return NULL;
+  }
+
   TAOS_RES* result = pStmt->pSql;
   pStmt->pSql = NULL;
+
+  // a query statement is executed again with the result left to the caller
+  if (!pStmt->isInsert) {
+    pStmt->pSql = stmtCreateSqlObj(pStmt->taos);
+    pStmt->resUsed = (pStmt->pSql != NULL);
+  }
+
   return result;
 }
 
@@ -2226,3 +2653,336 @@ const char *taos_data_type(int type) {
     default: return "UNKNOWN";
   }
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// columnar insert
+
+#define COLUMNAR_INSERT_HEAD_SIZE (sizeof(SMsgDesc) + sizeof(SSubmitMsg))
+#define COLUMNAR_BLOCK_MAX_ROWS   INT16_MAX
+
+static int32_t setColumnarTableName(SSqlObj* pSql, const char* table, SName* pName) {
+  char name[TSDB_TABLE_FNAME_LEN] = {0};
+  tstrncpy(name, table, sizeof(name));
+
+  SStrToken token = {.z = name, .n = (uint32_t)strlen(name), .type = TK_ID};
+  tGetToken(name, &token.type);
+
+  bool dbIncluded = false;
+  if (tscValidateName(&token, true, &dbIncluded) != TSDB_CODE_SUCCESS) {
+    return TSDB_CODE_TSC_INVALID_TABLE_ID_LENGTH;
+  }
+
+  return tscSetTableFullName(pName, &token, pSql, dbIncluded);
+}
+
+static int32_t checkColumnarBind(STableMeta* pTableMeta, TAOS_MULTI_BIND* bind, int32_t numOfCols) {
+  SSchema* pSchema = tscGetTableSchema(pTableMeta);
+
+  if (numOfCols != tscGetNumOfColumns(pTableMeta) || bind[0].num <= 0) {
+    tscError("columns mismatch or no rows, columns:%d, table columns:%d", numOfCols, tscGetNumOfColumns(pTableMeta));
+    return TSDB_CODE_TSC_INVALID_VALUE;
+  }
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    TAOS_MULTI_BIND* pBind = &bind[i];
+    if (pBind->buffer_type != pSchema[i].type || pBind->num != bind[0].num || pBind->buffer == NULL) {
+      tscError("column %d mismatch or invalid", i);
+      return TSDB_CODE_TSC_INVALID_VALUE;
+    }
+
+    if (IS_VAR_DATA_TYPE(pSchema[i].type) ? (pBind->length == NULL) : (pBind->buffer_length < pSchema[i].bytes)) {
+      tscError("column %d no length or buffer length too short", i);
+      return TSDB_CODE_TSC_INVALID_VALUE;
+    }
+  }
+
+  for (int32_t j = 0; bind[0].is_null != NULL && j < bind[0].num; ++j) {
+    if (bind[0].is_null[j]) {
+      tscError("null timestamp at row %d", j);
+      return TSDB_CODE_TSC_INVALID_VALUE;
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t getColumnarTableMeta(SSqlObj* pSql, STableMetaInfo* pTableMetaInfo, TAOS_MULTI_BIND* bind,
+                                    int32_t numOfCols) {
+  int32_t code = tscGetTableMetaSync(pSql, pTableMetaInfo, false);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  if (UTIL_TABLE_IS_SUPER_TABLE(pTableMetaInfo)) {
+    tscError("0x%"PRIx64" can not insert into super table %s", pSql->self, tNameGetTableName(&pTableMetaInfo->name));
+    return TSDB_CODE_TSC_INVALID_OPERATION;
+  }
+
+  return checkColumnarBind(pTableMetaInfo->pTableMeta, bind, numOfCols);
+}
+
+// the bytes of a row in a columnar block, at most, except the null bitmap
+static int32_t getColumnarRowSize(SSchema* pSchema, TAOS_MULTI_BIND* bind, int32_t numOfCols, int32_t idx) {
+  int32_t size = 0;
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    if (!IS_VAR_DATA_TYPE(pSchema[i].type)) {
+      size += pSchema[i].bytes;
+      continue;
+    }
+
+    size += sizeof(VarDataOffsetT);
+    if (bind[i].is_null == NULL || !bind[i].is_null[idx]) {
+      int32_t len = bind[i].length[idx] * ((pSchema[i].type == TSDB_DATA_TYPE_NCHAR) ? TSDB_NCHAR_SIZE : 1);
+      size += VARSTR_HEADER_SIZE + MIN(len, pSchema[i].bytes - VARSTR_HEADER_SIZE);
+    }
+  }
+
+  return size;
+}
+
+/**
+ * Write rows [start, start + rows) of the column arrays into a columnar submit block, see SSubmitColumn. The values of
+ * fixed length columns are copied as a whole run, only binary and nchar values are written one by one.
+ */
+static int32_t writeColumnarSubmitBlk(STableMeta* pTableMeta, TAOS_MULTI_BIND* bind, int32_t start, int32_t rows,
+                                      SSubmitBlk* pBlk, int32_t* pLen) {
+  SSchema* pSchema = tscGetTableSchema(pTableMeta);
+  int32_t  numOfCols = tscGetNumOfColumns(pTableMeta);
+  int32_t  bmLen = SUBMIT_COL_BITMAP_LEN(rows);
+  char*    p = pBlk->data;
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    TAOS_MULTI_BIND* pBind = &bind[i];
+    SSubmitColumn*   pCol = (SSubmitColumn*)p;
+    char*            pVal = pCol->data + bmLen;
+    int16_t          bytes = pSchema[i].bytes;
+
+    pCol->colId = pSchema[i].colId;
+    pCol->type = pSchema[i].type;
+
+    memset(pCol->data, 0, bmLen);
+    for (int32_t j = 0; pBind->is_null != NULL && j < rows; ++j) {
+      if (pBind->is_null[start + j]) SUBMIT_COL_SET_NULL(pCol->data, j);
+    }
+
+    if (!IS_VAR_DATA_TYPE(pCol->type)) {
+      if (pBind->buffer_length == (uintptr_t)bytes) {
+        memcpy(pVal, (char*)pBind->buffer + (size_t)start * bytes, (size_t)rows * bytes);
+      } else {
+        for (int32_t j = 0; j < rows; ++j) {
+          memcpy(pVal + (size_t)j * bytes, (char*)pBind->buffer + pBind->buffer_length * (start + j), bytes);
+        }
+      }
+
+      pCol->len = bmLen + rows * bytes;
+      p += sizeof(SSubmitColumn) + pCol->len;
+      continue;
+    }
+
+    VarDataOffsetT* offsets = (VarDataOffsetT*)pVal;
+    char*           pVarData = pVal + sizeof(VarDataOffsetT) * rows;
+    int32_t         varLen = 0;
+    for (int32_t j = 0; j < rows; ++j) {
+      offsets[j] = varLen;
+      if (SUBMIT_COL_IS_NULL(pCol->data, j)) {
+        continue;
+      }
+
+      char*   src = (char*)pBind->buffer + pBind->buffer_length * (start + j);
+      int32_t len = pBind->length[start + j];
+      char*   dst = pVarData + varLen;
+
+      if (pCol->type == TSDB_DATA_TYPE_BINARY) {
+        if (len < 0 || len > bytes - VARSTR_HEADER_SIZE) {
+          tscError("binary length too long, max:%d, actual:%d", (int32_t)(bytes - VARSTR_HEADER_SIZE), len);
+          return TSDB_CODE_TSC_INVALID_VALUE;
+        }
+        STR_WITH_SIZE_TO_VARSTR(dst, src, len);
+      } else {
+        int32_t output = 0;
+        if (len < 0 || !taosMbsToUcs4(src, len, varDataVal(dst), bytes - VARSTR_HEADER_SIZE, &output)) {
+          tscError("convert nchar string to UCS4_LE failed, column:%d row:%d", i, start + j);
+          return TSDB_CODE_TSC_INVALID_VALUE;
+        }
+        varDataSetLen(dst, output);
+      }
+
+      varLen += varDataTLen(dst);
+    }
+
+    pCol->len = bmLen + sizeof(VarDataOffsetT) * rows + varLen;
+    p += sizeof(SSubmitColumn) + pCol->len;
+  }
+
+  int32_t len = (int32_t)(p - pBlk->data);
+  pBlk->uid = htobe64(pTableMeta->id.uid);
+  pBlk->tid = htonl(pTableMeta->id.tid);
+  pBlk->flag = FLAG_BLK_COLUMNAR;
+  pBlk->sversion = htonl(pTableMeta->sversion);
+  pBlk->dataLen = htonl(len);
+  pBlk->schemaLen = 0;
+  pBlk->numOfRows = htons((int16_t)rows);
+
+  *pLen = len;
+  return TSDB_CODE_SUCCESS;
+}
+
+/**
+ * Build the submit message of the rows from *pStart, in columnar blocks of at most COLUMNAR_BLOCK_MAX_ROWS rows, and
+ * bounded by tsMaxSQLStringLen bytes like a sql statement. *pStart is moved after the rows in the message.
+ */
+static int32_t buildColumnarDataBlocks(SSqlObj* pSql, STableMetaInfo* pTableMetaInfo, TAOS_MULTI_BIND* bind,
+                                       int32_t* pStart) {
+  STableMeta* pTableMeta = pTableMetaInfo->pTableMeta;
+  SSchema*    pSchema = tscGetTableSchema(pTableMeta);
+  int32_t     numOfCols = tscGetNumOfColumns(pTableMeta);
+  int32_t     blkHeadSize = sizeof(SSubmitBlk) + numOfCols * (sizeof(SSubmitColumn) + 1);
+  int32_t     rowBitmapSize = (numOfCols + 7) / 8;
+
+  int64_t size = COLUMNAR_INSERT_HEAD_SIZE;
+  int32_t end = *pStart;
+  while (end < bind[0].num) {
+    int64_t rowSize = getColumnarRowSize(pSchema, bind, numOfCols, end) + rowBitmapSize;
+    if ((end - *pStart) % COLUMNAR_BLOCK_MAX_ROWS == 0) {
+      rowSize += blkHeadSize;
+    }
+
+    if (end > *pStart && size + rowSize > tsMaxSQLStringLen) {
+      break;
+    }
+
+    size += rowSize;
+    end += 1;
+  }
+
+  STableDataBlocks* pBlock = NULL;
+  int32_t code = tscCreateDataBlock((size_t)size, 0, COLUMNAR_INSERT_HEAD_SIZE, &pTableMetaInfo->name, pTableMeta,
+                                    &pBlock);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  int32_t rows = 0;
+  for (int32_t start = *pStart; start < end; start += rows) {
+    rows = MIN(end - start, COLUMNAR_BLOCK_MAX_ROWS);
+
+    int32_t len = 0;
+    code = writeColumnarSubmitBlk(pTableMeta, bind, start, rows, (SSubmitBlk*)(pBlock->pData + pBlock->size), &len);
+    if (code != TSDB_CODE_SUCCESS) {
+      tscDestroyDataBlock(pSql, pBlock, false);
+      return code;
+    }
+
+    pBlock->size += sizeof(SSubmitBlk) + len;
+    pBlock->numOfTables += 1;
+  }
+  assert(pBlock->size <= pBlock->nAllocSize);
+
+  pSql->cmd.insertParam.pDataBlocks = taosArrayInit(1, POINTER_BYTES);
+  taosArrayPush(pSql->cmd.insertParam.pDataBlocks, &pBlock);
+
+  *pStart = end;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t submitColumnarDataBlocks(SSqlObj* pSql, STableMetaInfo* pTableMetaInfo, TAOS_MULTI_BIND* bind,
+                                        int32_t* pStart, int32_t* affectedRows) {
+  int32_t start = *pStart;
+  int32_t code = buildColumnarDataBlocks(pSql, pTableMetaInfo, bind, &start);
+
+  if (code == TSDB_CODE_SUCCESS) {
+    pSql->res.code = TSDB_CODE_SUCCESS;
+    pSql->res.numOfRows = 0;
+    pSql->retry = pSql->maxRetry + 1;  // the failed message is retried by the caller with the table meta refreshed
+
+    code = tscHandleMultivnodeInsert(pSql);
+    if (code == TSDB_CODE_SUCCESS) {
+      tsem_wait(&pSql->rspSem);
+      code = pSql->res.code;
+    }
+  }
+
+  if (code == TSDB_CODE_SUCCESS) {
+    *affectedRows += pSql->res.numOfRows;
+    *pStart = start;
+  }
+
+  pSql->cmd.insertParam.pDataBlocks = tscDestroyBlockArrayList(pSql, pSql->cmd.insertParam.pDataBlocks);
+  tscFreeSubobj(pSql);
+  tfree(pSql->pSubs);
+
+  return code;
+}
+
+static bool isColumnarInsertRetryCode(int32_t code) {
+  return code == TSDB_CODE_TDB_INVALID_TABLE_ID || code == TSDB_CODE_VND_INVALID_VGROUP_ID ||
+         code == TSDB_CODE_TDB_TABLE_RECONFIGURE || code == TSDB_CODE_APP_NOT_READY ||
+         code == TSDB_CODE_RPC_NETWORK_UNAVAIL;
+}
+
+/**
+ * Insert the column arrays of a table without transposing them into rows: every column of the table is bound by one
+ * TAOS_MULTI_BIND in schema order, whose buffer type must be the column type, and the arrays are copied into
+ * column-major submit blocks, which are appended to the column chunks of the vnode memtable as they are.
+ */
+TAOS_RES* taos_insert_columns(TAOS* taos, const char* table, TAOS_MULTI_BIND* bind, int numOfCols) {
+  STscObj* pObj = (STscObj*)taos;
+  if (pObj == NULL || pObj->signature != pObj) {
+    terrno = TSDB_CODE_TSC_DISCONNECTED;
+    tscError("connection disconnected");
+    return NULL;
+  }
+
+  if (table == NULL || bind == NULL) {
+    terrno = TSDB_CODE_TSC_INVALID_VALUE;
+    return NULL;
+  }
+
+  SSqlObj* pSql = tscCreateInsertObj(pObj);
+  if (pSql == NULL) {
+    terrno = TSDB_CODE_TSC_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  STableMetaInfo* pTableMetaInfo = tscGetTableMetaInfoFromCmd(&pSql->cmd, 0);
+  int32_t         affectedRows = 0;
+
+  int32_t code = setColumnarTableName(pSql, table, &pTableMetaInfo->name);
+  if (code == TSDB_CODE_SUCCESS) {
+    code = getColumnarTableMeta(pSql, pTableMetaInfo, bind, numOfCols);
+  }
+
+  int32_t start = 0;
+  int32_t tryTimes = 1;
+  while (code == TSDB_CODE_SUCCESS && start < bind[0].num) {
+    code = submitColumnarDataBlocks(pSql, pTableMetaInfo, bind, &start, &affectedRows);
+    if (code == TSDB_CODE_SUCCESS || !isColumnarInsertRetryCode(code) || tryTimes >= TSDB_MAX_REPLICA) {
+      continue;
+    }
+
+    tscDebug("0x%"PRIx64" submit columns failed, code:%s, try again:%d", pSql->self, tstrerror(code), tryTimes);
+    tryTimes++;
+
+    if (code == TSDB_CODE_TDB_INVALID_TABLE_ID || code == TSDB_CODE_VND_INVALID_VGROUP_ID) {
+      char name[TSDB_TABLE_FNAME_LEN] = {0};
+      tNameExtractFullName(&pTableMetaInfo->name, name);
+      taosHashRemove(UTIL_GET_TABLEMETA(pSql), name, strnlen(name, TSDB_TABLE_FNAME_LEN));
+    }
+
+    if (code != TSDB_CODE_TDB_TABLE_RECONFIGURE) {
+      taosMsleep(100 * (2 << tryTimes));
+    }
+
+    code = getColumnarTableMeta(pSql, pTableMetaInfo, bind, numOfCols);
+  }
+
+  if (code != TSDB_CODE_SUCCESS) {
+    tscError("0x%"PRIx64" failed to insert columns of %s, code:%s", pSql->self, table, tstrerror(code));
+    pSql->cmd.payload[0] = 0;
+  }
+
+  pSql->res.code = code;
+  pSql->res.numOfRows = affectedRows;
+  return pSql;
+}
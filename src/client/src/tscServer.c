@@ -27,6 +27,11 @@
 #include "tsclient.h"
 #include "ttimer.h"
 
+// lifetime of the cached vgroup list of super table, if mnode does or does not report its change in heartbeat
+#define VGROUP_LIST_KEEP_MS           5000
+#define VERSIONED_VGROUP_LIST_KEEP_MS (10 * 60 * 1000)
+#define FIRST_HEARTBEAT_DELAY_MS      50
+
 int (*tscBuildMsg[TSDB_SQL_MAX])(SSqlObj *pSql, SSqlInfo *pInfo) = {0};
 
 int (*tscProcessMsgRsp[TSDB_SQL_MAX])(SSqlObj *pSql);
@@ -200,6 +205,49 @@ int32_t extractSTableQueryVgroupId(STableMetaInfo* pTableMetaInfo) {
   return vgId;
 }
 
+static void tscProcessMetaChangeRsp(SSqlObj *pSql, SMetaChangeRsp *pRsp, int32_t len) {
+  SClusterInfo *pInfo = pSql->pTscObj->pClusterInfo;
+
+  int32_t numOfTables = htonl(pRsp->numOfTables);
+  if (len < (int32_t)sizeof(SMetaChangeRsp) + numOfTables * TSDB_TABLE_FNAME_LEN) {
+    tscError("0x%"PRIx64" HB, invalid metadata change rsp, len:%d, numOfTables:%d", pSql->self, len, numOfTables);
+    return;
+  }
+
+  int64_t instanceId  = htobe64(pRsp->instanceId);
+  int64_t metaVersion = htobe64(pRsp->version);
+
+  if (pRsp->reset) {
+    tscDebug("0x%"PRIx64" HB, metadata version:%"PRId64" is unknown to mnode, drop all cached metadata", pSql->self,
+             atomic_load_64(&pInfo->metaVersion));
+    atomic_store_32(&pInfo->metaCacheLoad, 0);
+    taosHashClear(pInfo->tableMetaMap);
+    taosCacheEmpty(pInfo->vgroupListBuf);
+  } else {
+    // the metas kept by the last process are valid except the changed ones, which are removed below
+    if (atomic_val_compare_exchange_32(&pInfo->metaCacheLoad, 1, 0) == 1) {
+      tscLoadMetaCache(pInfo, pSql->pTscObj->clusterId);
+    }
+
+    for (int32_t i = 0; i < numOfTables; ++i) {
+      char   *name = pRsp->tableNames + i * TSDB_TABLE_FNAME_LEN;
+      int32_t nameLen = (int32_t)strnlen(name, TSDB_TABLE_FNAME_LEN);
+
+      void *pv = taosCacheAcquireByKey(pInfo->vgroupListBuf, name, nameLen);
+      if (pv != NULL) {
+        taosCacheRelease(pInfo->vgroupListBuf, &pv, true);
+      }
+
+      taosHashRemove(pInfo->tableMetaMap, name, nameLen);
+      tscDebug("0x%"PRIx64" HB, metadata of %s is changed, remove it from cache", pSql->self, name);
+    }
+  }
+
+  // the stale entries are removed before the version is updated, so no change is skipped by the next heartbeat
+  atomic_store_64(&pInfo->metaInstanceId, instanceId);
+  atomic_store_64(&pInfo->metaVersion, metaVersion);
+}
+
 void tscProcessHeartBeatRsp(void *param, TAOS_RES *tres, int code) {
   STscObj *pObj = (STscObj *)param;
   if (pObj == NULL) return;
@@ -259,6 +307,11 @@ void tscProcessHeartBeatRsp(void *param, TAOS_RES *tres, int code) {
 
     pRes->length[0] = total;
     pRes->length[1] = online;
+
+    // mnode of earlier versions does not report the metadata changes
+    if (pObj->pClusterInfo != NULL && pRes->rspLen >= (int32_t)(sizeof(SHeartBeatRsp) + sizeof(SMetaChangeRsp))) {
+      tscProcessMetaChangeRsp(pSql, (SMetaChangeRsp *)(pRsp + 1), pRes->rspLen - sizeof(SHeartBeatRsp));
+    }
   } else {
     tscDebug("%" PRId64 " heartbeat failed, code:%s", pObj->hbrid, tstrerror(code));
     if (pRes->length == NULL) {
@@ -2119,7 +2172,8 @@ int tscBuildHeartBeatMsg(SSqlObj *pSql, SSqlInfo *pInfo) {
     numOfStreams++;
   }
 
-  int size = numOfQueries * sizeof(SQueryDesc) + numOfStreams * sizeof(SStreamDesc) + sizeof(SHeartBeatMsg) + 100;
+  int size = numOfQueries * sizeof(SQueryDesc) + numOfStreams * sizeof(SStreamDesc) + sizeof(SHeartBeatMsg) +
+             sizeof(SMetaVersionMsg) + 100;
   if (TSDB_CODE_SUCCESS != tscAllocPayload(pCmd, size)) {
     pthread_mutex_unlock(&pObj->mutex);
     tscError("0x%"PRIx64" failed to create heartbeat msg", pSql->self);
@@ -2137,6 +2191,14 @@ int tscBuildHeartBeatMsg(SSqlObj *pSql, SSqlInfo *pInfo) {
 
   int msgLen = tscBuildQueryStreamDesc(pHeartbeat, pObj);
 
+  // report the version of cached metadata, mnode responds with the tables changed since then
+  if (pObj->pClusterInfo != NULL) {
+    SMetaVersionMsg *pVersion = (SMetaVersionMsg *)(pCmd->payload + msgLen);
+    pVersion->instanceId = htobe64(atomic_load_64(&pObj->pClusterInfo->metaInstanceId));
+    pVersion->version    = htobe64(atomic_load_64(&pObj->pClusterInfo->metaVersion));
+    msgLen += sizeof(SMetaVersionMsg);
+  }
+
   pthread_mutex_unlock(&pObj->mutex);
 
   pCmd->payloadLen = msgLen;
@@ -2506,7 +2568,10 @@ int tscProcessMultiTableMetaRsp(SSqlObj *pSql) {
     idList->num = numOfVgId;
     memcpy(idList->data, TARRAY_GET_START(p->vgroupIdList), numOfVgId * sizeof(int32_t));
 
-    void* idListInst = taosCachePut(UTIL_GET_VGROUPLIST(pParentSql), fname, len, idList, s, 5000);
+    // the change of vgroup list is reported by heartbeat if mnode supports it, keep it longer in this case
+    int32_t keepTime = (atomic_load_64(&pParentSql->pTscObj->pClusterInfo->metaInstanceId) != 0) ?
+                       VERSIONED_VGROUP_LIST_KEEP_MS : VGROUP_LIST_KEEP_MS;
+    void* idListInst = taosCachePut(UTIL_GET_VGROUPLIST(pParentSql), fname, len, idList, s, keepTime);
     taosCacheRelease(UTIL_GET_VGROUPLIST(pParentSql), (void*) &idListInst, false);
 
     tfree(idList);
@@ -2732,8 +2797,10 @@ int tscProcessConnectRsp(SSqlObj *pSql) {
   
   createHbObj(pObj);
 
-  //launch a timer to send heartbeat to maintain the connection and send status to mnode
-  taosTmrReset(tscProcessActivityTimer, tsShellActivityTimer * 500, (void *)pObj->rid, tscTmr, &pObj->pTimer);
+  // launch a timer to send heartbeat to maintain the connection and send status to mnode. If the metadata cache is
+  // kept across restarts, the first heartbeat validates the loaded cache and makes the cache savable, send it soon
+  int32_t waitingDuring = (tsMetaCacheDir[0] != 0) ? FIRST_HEARTBEAT_DELAY_MS : tsShellActivityTimer * 500;
+  taosTmrReset(tscProcessActivityTimer, waitingDuring, (void *)pObj->rid, tscTmr, &pObj->pTimer);
 
   return 0;
 }
@@ -2890,6 +2957,19 @@ int tscProcessRetrieveRspFromNode(SSqlObj *pSql) {
     return pRes->code;
   }
 
+  // the explain msg is at the end of the rsp, take it before the rsp is reallocated by decompression
+  int32_t trailer = pRes->rspLen - (int32_t)(sizeof(SRetrieveTableRsp) + sizeof(int32_t));
+  if (pRes->completed && (pRetrieve->extend & TSDB_RETRIEVE_RSP_EXPLAIN) && trailer > 0) {
+    int32_t explainLen = 0;
+    memcpy(&explainLen, pRes->pRsp + pRes->rspLen - sizeof(int32_t), sizeof(int32_t));
+    explainLen = htonl(explainLen);
+
+    if (explainLen > 0 && explainLen <= trailer) {
+      tscDestroyExplainInfo(pRes->pExplain);
+      pRes->pExplain = tscCreateExplainInfo(pRes->pRsp + pRes->rspLen - sizeof(int32_t) - explainLen, explainLen);
+    }
+  }
+
   //Decompress col data if compressed from server
   if (pRetrieve->compressed) {
     int32_t compLen = htonl(pRetrieve->compLen);
@@ -2936,7 +3016,7 @@ int tscProcessRetrieveRspFromNode(SSqlObj *pSql) {
 
 void tscTableMetaCallBack(void *param, TAOS_RES *res, int code);
 
-static int32_t getTableMetaFromMnode(SSqlObj *pSql, STableMetaInfo *pTableMetaInfo, bool autocreate) {
+static int32_t getTableMetaFromMnode(SSqlObj *pSql, STableMetaInfo *pTableMetaInfo, bool autocreate, __async_cb_func_t fp) {
   SSqlObj *pNew = calloc(1, sizeof(SSqlObj));
   if (NULL == pNew) {
     tscError("0x%"PRIx64" malloc failed for new sqlobj to get table meta", pSql->self);
@@ -2968,7 +3048,7 @@ static int32_t getTableMetaFromMnode(SSqlObj *pSql, STableMetaInfo *pTableMetaIn
 
   registerSqlObj(pNew);
 
-  pNew->fp    = tscTableMetaCallBack;
+  pNew->fp    = fp;
   pNew->param = (void *)pSql->self;
 
   tscDebug("0x%"PRIx64" new pSqlObj:0x%"PRIx64" to get tableMeta, auto create:%d, metaRid from %"PRId64" to %"PRId64,
@@ -3002,7 +3082,7 @@ static int32_t getTableMetaFromMnode(SSqlObj *pSql, STableMetaInfo *pTableMetaIn
   return code;
 }
 
-int32_t getMultiTableMetaFromMnode(SSqlObj *pSql, SArray* pNameList, SArray* pVgroupNameList, SArray* pUdfList, __async_cb_func_t fp, bool metaClone) {
+int32_t getMultiTableMetaFromMnode(SSqlObj *pSql, SArray* pNameList, SArray* pVgroupNameList, SArray* pUdfList, __async_cb_func_t fp, bool metaClone, bool skipMissing) {
   SSqlObj *pNew = calloc(1, sizeof(SSqlObj));
   if (NULL == pNew) {
     tscError("0x%"PRIx64" failed to allocate sqlobj to get multiple table meta", pSql->self);
@@ -3014,7 +3094,7 @@ int32_t getMultiTableMetaFromMnode(SSqlObj *pSql, SArray* pNameList, SArray* pVg
   pNew->cmd.command = TSDB_SQL_MULTI_META;
 
   int32_t numOfTable      = (int32_t) taosArrayGetSize(pNameList);
-  int32_t numOfVgroupList = (int32_t) taosArrayGetSize(pVgroupNameList);
+  int32_t numOfVgroupList = pVgroupNameList ? (int32_t) taosArrayGetSize(pVgroupNameList) : 0;
   int32_t numOfUdf        = pUdfList ? (int32_t)taosArrayGetSize(pUdfList) : 0;
 
   int32_t size = (numOfTable + numOfVgroupList) * TSDB_TABLE_FNAME_LEN + TSDB_FUNC_NAME_LEN * numOfUdf + sizeof(SMultiTableInfoMsg);
@@ -3025,9 +3105,10 @@ int32_t getMultiTableMetaFromMnode(SSqlObj *pSql, SArray* pNameList, SArray* pVg
   }
 
   SMultiTableInfoMsg* pInfo = (SMultiTableInfoMsg*) pNew->cmd.payload;
+  pInfo->extend       = skipMissing? TSDB_MULTI_META_SKIP_MISSING:0;
   pInfo->metaClone    = metaClone? 1:0;
-  pInfo->numOfTables  = htonl((uint32_t) taosArrayGetSize(pNameList));
-  pInfo->numOfVgroups = htonl((uint32_t) taosArrayGetSize(pVgroupNameList));
+  pInfo->numOfTables  = htonl((uint32_t) numOfTable);
+  pInfo->numOfVgroups = htonl((uint32_t) numOfVgroupList);
   pInfo->numOfUdfs    = htonl(numOfUdf);
 
   char* start = pInfo->tableNames;
@@ -3086,7 +3167,8 @@ int32_t getMultiTableMetaFromMnode(SSqlObj *pSql, SArray* pNameList, SArray* pVg
   return code;
 }
 
-int32_t tscGetTableMetaImpl(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool autocreate, bool onlyLocal) {
+static int32_t doGetTableMeta(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool autocreate, bool onlyLocal,
+                              __async_cb_func_t fp) {
   if (!tIsValidName(&pTableMetaInfo->name)) {
     return TSDB_CODE_TSC_APP_ERROR;
   }
@@ -3116,7 +3198,7 @@ int32_t tscGetTableMetaImpl(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool
       pSql->pBuf   = (void *)(pSTMeta);
       pMeta   = pTableMetaInfo->pTableMeta;
       if (code != TSDB_CODE_SUCCESS) {
-        return getTableMetaFromMnode(pSql, pTableMetaInfo, autocreate);
+        return getTableMetaFromMnode(pSql, pTableMetaInfo, autocreate, fp);
       }
     }
 
@@ -3128,7 +3210,56 @@ int32_t tscGetTableMetaImpl(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool
     return TSDB_CODE_TSC_NO_META_CACHED;
   }
   
-  return getTableMetaFromMnode(pSql, pTableMetaInfo, autocreate);
+  return getTableMetaFromMnode(pSql, pTableMetaInfo, autocreate, fp);
+}
+
+int32_t tscGetTableMetaImpl(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool autocreate, bool onlyLocal) {
+  return doGetTableMeta(pSql, pTableMetaInfo, autocreate, onlyLocal, tscTableMetaCallBack);
+}
+
+static void tscSyncTableMetaCallBack(void *param, TAOS_RES *res, int code) {
+  SSqlObj* pSql = (SSqlObj*)taosAcquireRef(tscObjRef, (int64_t)param);
+  if (pSql == NULL) {
+    return;
+  }
+
+  pSql->res.code = code;
+  tsem_post(&pSql->rspSem);
+  taosReleaseRef(tscObjRef, pSql->self);
+}
+
+/**
+ * Get the table meta and wait until it is available in the local cache, instead of resuming the sql parse in the
+ * callback. If autocreate is set, the child table is created by mnode with the tags in insertParam.tagData.
+ */
+int32_t tscGetTableMetaSync(SSqlObj* pSql, STableMetaInfo *pTableMetaInfo, bool autocreate) {
+  int32_t code = doGetTableMeta(pSql, pTableMetaInfo, autocreate, false, tscSyncTableMetaCallBack);
+
+  for (int32_t i = 0; code == TSDB_CODE_TSC_ACTION_IN_PROGRESS; ++i) {
+    tsem_wait(&pSql->rspSem);
+    if ((code = pSql->res.code) != TSDB_CODE_SUCCESS) {
+      break;
+    }
+
+    // the response has put the table meta into the local cache
+    code = doGetTableMeta(pSql, pTableMetaInfo, autocreate, i >= pSql->maxRetry, tscSyncTableMetaCallBack);
+  }
+
+  return code;
+}
+
+/**
+ * Get the metas of the tables by one request and wait until they are available in the local cache, the tables that do
+ * not exist are skipped by mnode.
+ */
+int32_t tscGetMultiTableMetaSync(SSqlObj* pSql, SArray* pNameList) {
+  int32_t code = getMultiTableMetaFromMnode(pSql, pNameList, NULL, NULL, tscSyncTableMetaCallBack, false, true);
+  if (code == TSDB_CODE_TSC_ACTION_IN_PROGRESS) {
+    tsem_wait(&pSql->rspSem);
+    code = pSql->res.code;
+  }
+
+  return code;
 }
 
 int32_t tscGetTableMeta(SSqlObj *pSql, STableMetaInfo *pTableMetaInfo) {
@@ -3255,7 +3386,7 @@ int tscRenewTableMeta(SSqlObj *pSql) {
   tfree(rootSql->pSubs);
   tscResetSqlCmd(&rootSql->cmd, true, rootSql->self);
 
-  code = getMultiTableMetaFromMnode(rootSql, pNameList, vgroupList, NULL, tscTableMetaCallBack, true);
+  code = getMultiTableMetaFromMnode(rootSql, pNameList, vgroupList, NULL, tscTableMetaCallBack, true, false);
   taosArrayDestroyEx(&pNameList, freeElem);
   taosArrayDestroyEx(&vgroupList, freeElem);
 
@@ -575,6 +575,136 @@ int taos_fetch_block(TAOS_RES *res, TAOS_ROW *rows) {
   return pRes->numOfRows;
 }
 
+// describe the current block as typed columns, the values are not copied but referenced in place
+static int32_t tscSetResColumns(SSqlRes *pRes, SQueryInfo *pQueryInfo) {
+  int32_t numOfCols = tscNumOfFields(pQueryInfo);
+  int32_t rows = (int32_t)pRes->numOfRows;
+
+  if (pRes->pColumns == NULL) {
+    pRes->pColumns = calloc(numOfCols, sizeof(TAOS_COLUMN));
+    if (pRes->pColumns == NULL) {
+      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    }
+  }
+
+  // one bitmap for each column, and offset/length pairs for each var-length column
+  int32_t bitmapLen = (rows + 7) >> 3;
+  int32_t size = 0;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SInternalField *pInfo = tscFieldInfoGetInternalField(&pQueryInfo->fieldsInfo, i);
+    size += ALIGN8(bitmapLen);
+    if (IS_VAR_DATA_TYPE(pInfo->field.type) || pInfo->field.type == TSDB_DATA_TYPE_JSON) {
+      size += rows * sizeof(int32_t) * 2;
+    }
+  }
+
+  if (size > pRes->colBufLen) {
+    char *tmp = realloc(pRes->pColumnBuf, size);
+    if (tmp == NULL) {
+      return TSDB_CODE_TSC_OUT_OF_MEMORY;
+    }
+
+    pRes->pColumnBuf = tmp;
+    pRes->colBufLen = size;
+  }
+
+  char *buf = pRes->pColumnBuf;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SInternalField *pInfo = tscFieldInfoGetInternalField(&pQueryInfo->fieldsInfo, i);
+    TAOS_COLUMN    *pCol = &pRes->pColumns[i];
+
+    int16_t bytes = pInfo->field.bytes;
+    uint8_t type = pInfo->field.type;
+    char   *data = pRes->urow[i];
+
+    pCol->type = type;
+    pCol->bytes = bytes;
+    pCol->numOfRows = rows;
+    pCol->data = data;
+    pCol->offset = NULL;
+    pCol->length = NULL;
+
+    uint8_t *bitmap = (uint8_t *)buf;
+    memset(bitmap, 0, bitmapLen);
+    pCol->bitmap = bitmap;
+    buf += ALIGN8(bitmapLen);
+
+    if (IS_VAR_DATA_TYPE(type) || type == TSDB_DATA_TYPE_JSON) {
+      int32_t *offset = (int32_t *)buf;
+      int32_t *length = offset + rows;
+      buf += rows * sizeof(int32_t) * 2;
+
+      for (int32_t k = 0; k < rows; ++k) {
+        char *p = data + k * bytes;
+
+        offset[k] = k * bytes + VARSTR_HEADER_SIZE;
+        if (isNull(p, type)) {
+          length[k] = 0;
+        } else {
+          length[k] = varDataLen(p);
+          bitmap[k >> 3] |= (1u << (k & 7u));
+        }
+      }
+
+      pCol->offset = offset;
+      pCol->length = length;
+    } else {
+      for (int32_t k = 0; k < rows; ++k) {
+        if (!isNull(data + k * bytes, type)) {
+          bitmap[k >> 3] |= (1u << (k & 7u));
+        }
+      }
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+int taos_fetch_block_columns(TAOS_RES *res, TAOS_COLUMN **columns) {
+  SSqlObj *pSql = (SSqlObj *)res;
+  if (pSql == NULL || pSql->signature != pSql) {
+    terrno = TSDB_CODE_TSC_DISCONNECTED;
+    return 0;
+  }
+
+  SSqlCmd *pCmd = &pSql->cmd;
+  SSqlRes *pRes = &pSql->res;
+
+  *columns = NULL;
+  if (pRes->qId == 0 ||
+      pRes->code == TSDB_CODE_TSC_QUERY_CANCELLED ||
+      pCmd->command == TSDB_SQL_RETRIEVE_EMPTY_RESULT ||
+      pCmd->command == TSDB_SQL_INSERT) {
+    return 0;
+  }
+
+  tscResetForNextRetrieve(pRes);
+
+  // set the sql object owner
+  tscSetSqlOwner(pSql);
+
+  // current data set are exhausted, fetch more data from node
+  if (needToFetchNewBlock(pSql)) {
+    taos_fetch_rows_a(res, waitForRetrieveRsp, pSql->pTscObj);
+    tsem_wait(&pSql->rspSem);
+  }
+
+  SQueryInfo *pQueryInfo = tscGetQueryInfo(pCmd);
+  if (pRes->numOfRows > 0 && pQueryInfo != NULL) {
+    int32_t code = tscSetResColumns(pRes, pQueryInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      tscClearSqlOwner(pSql);
+      return 0;
+    }
+
+    *columns = pRes->pColumns;
+  }
+
+  tscClearSqlOwner(pSql);
+  return (*columns == NULL) ? 0 : pRes->numOfRows;
+}
+
 TAOS_ROW *taos_result_block(TAOS_RES *res) {
   SSqlObj *pSql = (SSqlObj *)res;
   if (pSql == NULL || pSql->signature != pSql) {
@@ -1186,7 +1316,7 @@ int taos_load_table_info(TAOS *taos, const char *tableNameList) {
   registerSqlObj(pSql);
   tscDebug("0x%"PRIx64" load multiple table meta, tableNameList: %s pObj:%p", pSql->self, tableNameList, pObj);
 
-  code = getMultiTableMetaFromMnode(pSql, plist, vgroupList, NULL, loadMultiTableMetaCallback, false);
+  code = getMultiTableMetaFromMnode(pSql, plist, vgroupList, NULL, loadMultiTableMetaCallback, false, false);
   if (code == TSDB_CODE_TSC_ACTION_IN_PROGRESS) {
     code = TSDB_CODE_SUCCESS;
   }
@@ -3106,6 +3106,15 @@ static void tscAllDataRetrievedFromDnode(SRetrieveSupport *trsupport, SSqlObj* p
       pParentSql->self, pState->numOfSub, pState->numOfRetrievedRows);
   
   SQueryInfo *pPQueryInfo = tscGetQueryInfo(&pParentSql->cmd);
+
+  if (TSDB_QUERY_HAS_TYPE(pPQueryInfo->type, TSDB_QUERY_TYPE_EXPLAIN)) {
+    for (int32_t i = 0; i < pState->numOfSub; ++i) {
+      SSqlObj* pSub = pParentSql->pSubs[i];
+      if (pSub != NULL && tscMergeExplainInfo(&pParentSql->res.pExplain, pSub->res.pExplain) != TSDB_CODE_SUCCESS) {
+        tscError("0x%"PRIx64" failed to merge the explain info of sub:0x%"PRIx64, pParentSql->self, pSub->self);
+      }
+    }
+  }
   
   code = tscCreateGlobalMerger(trsupport->pExtMemBuffer, pState->numOfSub, pDesc, pPQueryInfo, &pParentSql->res.pMerger, pParentSql->self);
   pParentSql->res.code = code;
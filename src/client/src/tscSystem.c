@@ -26,6 +26,7 @@
 #include "tconfig.h"
 #include "ttimezone.h"
 #include "qScript.h"
+#include "hash.h"
 
 // global, not configurable
 #define TSC_VAR_NOT_RELEASE 1
@@ -123,6 +124,179 @@ int32_t tscAcquireRpc(const char *key, const char *user, const char *secretEncry
   return 0;
 }
 
+// the table metas and vgroup infos are kept in tsMetaCacheDir after the last connection to the cluster is closed. The
+// next process reports their version by the first heartbeat, and loads them only if mnode knows the changes since then.
+#define META_CACHE_FILE_MAGIC   0x4154454d  // "META"
+#define META_CACHE_FILE_VERSION 1
+
+typedef struct {
+  int32_t magic;
+  int32_t fileVersion;
+  int64_t metaInstanceId;
+  int64_t metaVersion;
+  int32_t numOfTables;
+  int32_t numOfVgroups;
+} SMetaCacheFileHead;
+
+static void tscGetMetaCacheFileName(const char *clusterId, char *path, int32_t len) {
+  snprintf(path, len, "%s/meta-%s", tsMetaCacheDir, clusterId);
+}
+
+static int32_t tscWriteHashEntries(FILE *fp, SHashObj *pHashObj) {
+  int32_t num = 0;
+  void   *p = taosHashIterate(pHashObj, NULL);
+  while (p != NULL) {
+    SHashNode *pNode = GET_HASH_PNODE(p);
+    uint32_t   keyLen = taosHashGetDataKeyLen(pHashObj, p);
+    if (fwrite(&keyLen, sizeof(keyLen), 1, fp) != 1 || fwrite(&pNode->dataLen, sizeof(pNode->dataLen), 1, fp) != 1 ||
+        fwrite(taosHashGetDataKey(pHashObj, p), keyLen, 1, fp) != 1 || fwrite(p, pNode->dataLen, 1, fp) != 1) {
+      taosHashCancelIterate(pHashObj, p);
+      return -1;
+    }
+
+    num++;
+    p = taosHashIterate(pHashObj, p);
+  }
+
+  return num;
+}
+
+static int32_t tscReadHashEntries(FILE *fp, SHashObj *pHashObj, int32_t num) {
+  char   *buf = NULL;
+  int32_t code = 0;
+
+  for (int32_t i = 0; i < num; ++i) {
+    uint32_t keyLen = 0, dataLen = 0;
+    if (fread(&keyLen, sizeof(keyLen), 1, fp) != 1 || fread(&dataLen, sizeof(dataLen), 1, fp) != 1 ||
+        keyLen == 0 || keyLen > TSDB_TABLE_FNAME_LEN || dataLen == 0 ||
+        dataLen > sizeof(STableMeta) + sizeof(SSchema) * (TSDB_MAX_COLUMNS + TSDB_MAX_TAGS)) {
+      code = -1;
+      break;
+    }
+
+    char *tmp = realloc(buf, keyLen + dataLen);
+    if (tmp == NULL) {
+      code = -1;
+      break;
+    }
+
+    buf = tmp;
+    if (fread(buf, keyLen + dataLen, 1, fp) != 1) {
+      code = -1;
+      break;
+    }
+
+    // the ones retrieved before the validation are not older than the kept ones
+    if (taosHashGet(pHashObj, buf, keyLen) == NULL) {
+      taosHashPut(pHashObj, buf, keyLen, buf + keyLen, dataLen);
+    }
+  }
+
+  tfree(buf);
+  return code;
+}
+
+static void tscSaveMetaCache(SClusterInfo *pObj, const char *clusterId) {
+  // without the version, the cached metas can not be validated by the next process. If the kept ones are not validated
+  // yet, the file is left as it is.
+  if (tsMetaCacheDir[0] == 0 || pObj->metaInstanceId == 0 || atomic_load_32(&pObj->metaCacheLoad) != 0) {
+    return;
+  }
+
+  if (taosMkDir(tsMetaCacheDir, 0755) != 0) {
+    tscError("failed to create meta cache dir:%s, reason:%s", tsMetaCacheDir, strerror(errno));
+    return;
+  }
+
+  char path[PATH_MAX] = {0};
+  char tmpPath[PATH_MAX + 4] = {0};
+  tscGetMetaCacheFileName(clusterId, path, sizeof(path));
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+  FILE *fp = fopen(tmpPath, "wb");
+  if (fp == NULL) {
+    tscError("failed to create meta cache file:%s, reason:%s", tmpPath, strerror(errno));
+    return;
+  }
+
+  SMetaCacheFileHead head = {.magic = META_CACHE_FILE_MAGIC, .fileVersion = META_CACHE_FILE_VERSION,
+                             .metaInstanceId = pObj->metaInstanceId, .metaVersion = pObj->metaVersion};
+  bool ok = fwrite(&head, sizeof(head), 1, fp) == 1;
+  if (ok) {
+    head.numOfTables = tscWriteHashEntries(fp, pObj->tableMetaMap);
+    head.numOfVgroups = (head.numOfTables >= 0) ? tscWriteHashEntries(fp, pObj->vgroupMap) : -1;
+    ok = head.numOfVgroups >= 0 && fseek(fp, 0, SEEK_SET) == 0 && fwrite(&head, sizeof(head), 1, fp) == 1;
+  }
+
+  if (fclose(fp) != 0 || !ok || rename(tmpPath, path) != 0) {
+    tscError("failed to save meta cache file:%s, reason:%s", path, strerror(errno));
+    remove(tmpPath);
+    return;
+  }
+
+  tscDebug("meta cache of cluster:%s is saved, tables:%d, vgroups:%d, version:%" PRId64, clusterId, head.numOfTables,
+           head.numOfVgroups, head.metaVersion);
+}
+
+static bool tscReadMetaCacheHead(FILE *fp, SMetaCacheFileHead *pHead) {
+  return fread(pHead, sizeof(SMetaCacheFileHead), 1, fp) == 1 && pHead->magic == META_CACHE_FILE_MAGIC &&
+         pHead->fileVersion == META_CACHE_FILE_VERSION && pHead->metaInstanceId != 0;
+}
+
+// only the version is taken when the cluster info is created, the heartbeat reports it to mnode
+static void tscOpenMetaCache(SClusterInfo *pObj, const char *clusterId) {
+  if (tsMetaCacheDir[0] == 0) {
+    return;
+  }
+
+  char path[PATH_MAX] = {0};
+  tscGetMetaCacheFileName(clusterId, path, sizeof(path));
+
+  FILE *fp = fopen(path, "rb");
+  if (fp == NULL) {
+    return;
+  }
+
+  SMetaCacheFileHead head = {0};
+  if (tscReadMetaCacheHead(fp, &head)) {
+    pObj->metaInstanceId = head.metaInstanceId;
+    pObj->metaVersion = head.metaVersion;
+    pObj->metaCacheLoad = 1;
+  } else {
+    tscError("invalid meta cache file:%s, ignore it", path);
+  }
+
+  fclose(fp);
+}
+
+// called when mnode has reported the tables changed since the version of the kept metas, before they are removed
+void tscLoadMetaCache(SClusterInfo *pObj, const char *clusterId) {
+  char path[PATH_MAX] = {0};
+  tscGetMetaCacheFileName(clusterId, path, sizeof(path));
+
+  FILE *fp = fopen(path, "rb");
+  if (fp == NULL) {
+    tscError("failed to open meta cache file:%s, reason:%s", path, strerror(errno));
+    return;
+  }
+
+  SMetaCacheFileHead head = {0};
+  if (!tscReadMetaCacheHead(fp, &head) || head.metaInstanceId != atomic_load_64(&pObj->metaInstanceId) ||
+      head.metaVersion != atomic_load_64(&pObj->metaVersion) ||
+      tscReadHashEntries(fp, pObj->tableMetaMap, head.numOfTables) != 0 ||
+      tscReadHashEntries(fp, pObj->vgroupMap, head.numOfVgroups) != 0) {
+    tscError("invalid meta cache file:%s, drop all cached metadata", path);
+    taosHashClear(pObj->tableMetaMap);
+    taosHashClear(pObj->vgroupMap);
+    fclose(fp);
+    return;
+  }
+
+  fclose(fp);
+  tscDebug("meta cache of cluster:%s is loaded, tables:%d, vgroups:%d, version:%" PRId64, clusterId, head.numOfTables,
+           head.numOfVgroups, head.metaVersion);
+}
+
 void tscClusterInfoDestroy(SClusterInfo *pObj) {
   if (pObj == NULL) { return; }
   taosHashCleanup(pObj->vgroupMap);
@@ -147,6 +321,7 @@ void *tscAcquireClusterInfo(const char *clusterId) {
         tscClusterInfoDestroy(pObj);
         pObj = NULL;
       } else {
+        tscOpenMetaCache(pObj, clusterId);
         taosHashPut(tscClusterMap, clusterId, len, &pObj, POINTER_BYTES);
       } 
     }
@@ -170,10 +345,30 @@ void tscReleaseClusterInfo(const char *clusterId) {
   }
   if (pObj && --pObj->ref == 0) {
     taosHashRemove(tscClusterMap, clusterId, len);
+    tscSaveMetaCache(pObj, clusterId);
     tscClusterInfoDestroy(pObj); 
   }
   pthread_mutex_unlock(&clusterMutex);
 }
+
+// the connections that are not closed, or not released yet when the process exits
+static void tscSaveAllMetaCaches() {
+  if (tscClusterMap == NULL || tsMetaCacheDir[0] == 0) {
+    return;
+  }
+
+  pthread_mutex_lock(&clusterMutex);
+  void *p = taosHashIterate(tscClusterMap, NULL);
+  while (p != NULL) {
+    char   clusterId[TSDB_CLUSTER_ID_LEN] = {0};
+    size_t len = taosHashGetDataKeyLen(tscClusterMap, p);
+    memcpy(clusterId, taosHashGetDataKey(tscClusterMap, p), MIN(len, sizeof(clusterId) - 1));
+
+    tscSaveMetaCache(*(SClusterInfo **)p, clusterId);
+    p = taosHashIterate(tscClusterMap, p);
+  }
+  pthread_mutex_unlock(&clusterMutex);
+}
 void taos_init_imp(void) {
   char temp[128] = {0};
 
@@ -305,6 +500,8 @@ void taos_cleanup(void) {
 
   pthread_mutex_destroy(&setConfMutex);
 
+  tscSaveAllMetaCaches();
+
   if (tscEmbedded == 0) {
     rpcCleanup();
     taosCloseLog();
@@ -1103,9 +1103,9 @@ static void fetchNextBlockIfCompleted(SOperatorInfo* pOperator, bool* newgroup)
     if (pStatus->pBlock == NULL || pStatus->index >= pStatus->pBlock->info.rows) {
       tscDebug("Retrieve nest query result, index:%d, total:%d", i, pOperator->numOfUpstream);
 
-      publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+      publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
       pStatus->pBlock = pOperator->upstream[i]->exec(pOperator->upstream[i], newgroup);
-      publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+      publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pStatus->pBlock);
       pStatus->index = 0;
 
       if (pStatus->pBlock == NULL) {
@@ -1566,6 +1566,9 @@ static void tscDestroyResPointerInfo(SSqlRes* pRes) {
   tfree(pRes->urow);
 
   tfree(pRes->pColumnIndex);
+  tfree(pRes->pColumns);
+  tfree(pRes->pColumnBuf);
+  pRes->colBufLen = 0;
   tfree(pRes->final);
 
   pRes->data = NULL;  // pRes->data points to the buffer of pRsp, no need to free
@@ -1673,6 +1676,9 @@ void tscFreeSqlResult(SSqlObj* pSql) {
   tscDestroyGlobalMerger(pRes->pMerger);
   pRes->pMerger = NULL;
 
+  tscDestroyExplainInfo(pRes->pExplain);
+  pRes->pExplain = NULL;
+
   tscDestroyResPointerInfo(pRes);
   memset(&pSql->res, 0, sizeof(SSqlRes));
 }
@@ -2170,6 +2176,41 @@ static void extractTableNameList(SSqlObj *pSql, SInsertStatementParam *pInsertPa
   }
 }
 
+/**
+ * create the sql object to submit the data blocks built by the client directly in raw payload, rather than from the
+ * parsed insert sql
+ */
+SSqlObj* tscCreateInsertObj(STscObj* pObj) {
+  SSqlObj* pSql = calloc(1, sizeof(SSqlObj));
+  if (pSql == NULL) {
+    return NULL;
+  }
+
+  SSqlCmd* pCmd = &pSql->cmd;
+  if (tscAllocPayload(pCmd, TSDB_DEFAULT_PAYLOAD_SIZE) != TSDB_CODE_SUCCESS ||
+      tscAddQueryInfo(pCmd) != TSDB_CODE_SUCCESS || tscAddEmptyMetaInfo(tscGetQueryInfoS(pCmd)) == NULL) {
+    tscFreeSqlObj(pSql);
+    return NULL;
+  }
+
+  tsem_init(&pSql->rspSem, 0, 0);
+  pSql->signature = pSql;
+  pSql->pTscObj   = pObj;
+  pSql->rootObj   = pSql;
+  pSql->maxRetry  = TSDB_MAX_REPLICA;
+  pSql->param     = pSql;
+  pSql->fp        = waitForQueryRsp;
+  pSql->fetchFp   = waitForQueryRsp;
+
+  pCmd->command = TSDB_SQL_INSERT;
+  pCmd->insertParam.payloadType = PAYLOAD_TYPE_RAW;
+
+  registerSqlObj(pSql);
+  pCmd->insertParam.objectId = pSql->self;
+
+  return pSql;
+}
+
 int32_t tscMergeTableDataBlocks(SSqlObj *pSql, SInsertStatementParam *pInsertParam, bool freeBlockMap) {
   const int INSERT_HEAD_SIZE = sizeof(SMsgDesc) + sizeof(SSubmitMsg);
   int       code = 0;
@@ -2304,6 +2345,22 @@ void tscCloseTscObj(void *param) {
   tfree(pObj);
 }
 
+int32_t tscGetExplainPrefixLen(char* sqlstr) {
+  int32_t index = 0;
+
+  SStrToken t0 = tStrGetToken(sqlstr, &index, false);
+  if (t0.type != TK_EXPLAIN) {
+    return 0;
+  }
+
+  SStrToken t1 = tStrGetToken(sqlstr, &index, false);
+  if (t1.n != strlen("analyze") || strncasecmp(t1.z, "analyze", t1.n) != 0) {
+    return 0;
+  }
+
+  return index;
+}
+
 bool tscIsInsertData(char* sqlstr) {
   int32_t index = 0;
 
@@ -4387,6 +4444,15 @@ char* tscGetSqlStr(SSqlObj* pSql) {
   return pSql->sqlstr;
 }
 
+SExplainMsg* tscGetExplainMsg(SSqlObj* pSql, int32_t* numOfVnodes) {
+  if (pSql == NULL || pSql->signature != pSql || pSql->res.pExplain == NULL) {
+    return NULL;
+  }
+
+  *numOfVnodes = pSql->res.pExplain->numOfVnodes;
+  return pSql->res.pExplain->pMsg;
+}
+
 bool tscIsQueryWithLimit(SSqlObj* pSql) {
   if (pSql == NULL || pSql->signature != pSql) {
     return false;
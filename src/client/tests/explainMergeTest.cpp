@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include "os.h"
+#include "tscGlobalmerge.h"
+
+namespace {
+// build the explain msg of a vnode in network byte order, with a scan operator under an aggregate operator
+SExplainMsg* createExplainMsg(int32_t vgId, int64_t elapsed, int64_t rows, int32_t* len) {
+  *len = sizeof(SExplainMsg) + 2 * sizeof(SExplainOperatorMsg);
+  SExplainMsg* pMsg = (SExplainMsg*)calloc(1, *len);
+
+  pMsg->vgId = htonl(vgId);
+  pMsg->numOfOperators = htonl(2);
+  pMsg->elapsed = htobe64(elapsed);
+  pMsg->totalBlocks = htonl(10);
+  pMsg->loadBlocks = htonl(4);
+  pMsg->readBytes = htobe64(1000);
+  pMsg->cacheHits = htobe64(3);
+
+  strcpy(pMsg->operators[0].name, "MultiTableAggregate");
+  pMsg->operators[0].depth = htonl(0);
+  pMsg->operators[0].execs = htobe64(1);
+  pMsg->operators[0].selfTime = htobe64(20);
+  pMsg->operators[0].maxSelfTime = htobe64(20);
+  pMsg->operators[0].rows = htobe64(1);
+
+  strcpy(pMsg->operators[1].name, "TableScanOperator");
+  pMsg->operators[1].depth = htonl(1);
+  pMsg->operators[1].execs = htobe64(5);
+  pMsg->operators[1].selfTime = htobe64(elapsed - 20);
+  pMsg->operators[1].maxSelfTime = htobe64(elapsed / 2);
+  pMsg->operators[1].rows = htobe64(rows);
+
+  return pMsg;
+}
+}  // namespace
+
+TEST(testCase, explain_merge_test) {
+  int32_t      len = 0;
+  SExplainMsg* pMsg1 = createExplainMsg(2, 100, 500, &len);
+  SExplainMsg* pMsg2 = createExplainMsg(3, 300, 700, &len);
+
+  SExplainInfo* pInfo1 = tscCreateExplainInfo((char*)pMsg1, len);
+  SExplainInfo* pInfo2 = tscCreateExplainInfo((char*)pMsg2, len);
+  ASSERT_TRUE(pInfo1 != NULL && pInfo2 != NULL);
+
+  ASSERT_EQ(pInfo1->numOfVnodes, 1);
+  ASSERT_EQ(pInfo1->pMsg->vgId, 2);
+  ASSERT_EQ(pInfo1->pMsg->numOfOperators, 2);
+  ASSERT_EQ(pInfo1->pMsg->operators[1].depth, 1);
+  ASSERT_EQ(pInfo1->pMsg->operators[1].rows, 500);
+
+  // a truncated msg is ignored
+  ASSERT_TRUE(tscCreateExplainInfo((char*)pMsg1, len - 1) == NULL);
+
+  SExplainInfo* pMerged = NULL;
+  ASSERT_EQ(tscMergeExplainInfo(&pMerged, pInfo1), 0);
+  ASSERT_EQ(tscMergeExplainInfo(&pMerged, pInfo2), 0);
+
+  ASSERT_EQ(pMerged->numOfVnodes, 2);
+  ASSERT_EQ(pMerged->pMsg->numOfOperators, 2);
+  ASSERT_EQ(pMerged->pMsg->elapsed, 300);
+  ASSERT_EQ(pMerged->pMsg->totalBlocks, 20);
+  ASSERT_EQ(pMerged->pMsg->loadBlocks, 8);
+  ASSERT_EQ(pMerged->pMsg->readBytes, 2000);
+  ASSERT_EQ(pMerged->pMsg->cacheHits, 6);
+
+  SExplainOperatorMsg* pScan = &pMerged->pMsg->operators[1];
+  ASSERT_STREQ(pScan->name, "TableScanOperator");
+  ASSERT_EQ(pScan->execs, 10);
+  ASSERT_EQ(pScan->rows, 1200);
+  ASSERT_EQ(pScan->selfTime, 360);
+  ASSERT_EQ(pScan->maxSelfTime, 150);
+
+  tscDestroyExplainInfo(pMerged);
+  tscDestroyExplainInfo(pInfo1);
+  tscDestroyExplainInfo(pInfo2);
+  free(pMsg1);
+  free(pMsg2);
+}
@@ -423,6 +423,7 @@ int        tdInitDataCols(SDataCols *pCols, STSchema *pSchema);
 SDataCols *tdDupDataCols(SDataCols *pCols, bool keepData);
 SDataCols *tdFreeDataCols(SDataCols *pCols);
 int        tdMergeDataCols(SDataCols *target, SDataCols *source, int rowsToMerge, int *pOffset, bool forceSetNull);
+int        tdAppendDataColsRange(SDataCols *target, SDataCols *source, int offset, int nRows);
 
 // ----------------- K-V data row structure
 /* |<-------------------------------------- len -------------------------------------------->|
@@ -66,6 +66,7 @@ extern int32_t  tsCompressMsgSize;
 extern int32_t  tsCompressColData;
 extern int32_t  tsMaxNumOfDistinctResults;
 extern char     tsTempDir[];
+extern char     tsMetaCacheDir[];
 extern int32_t  tsShortcutFlag;
 
 // query buffer management
@@ -73,6 +74,8 @@ extern int32_t tsQueryBufferSize;  // maximum allowed usage buffer size in MB fo
 extern int64_t
     tsQueryBufferSizeBytes;  // maximum allowed usage buffer size in byte for each data node during query processing
 extern int32_t tsRetrieveBlockingModel;  // retrieve threads will be blocked
+extern int32_t tsSortBufferSize;  // memory budget in MB of each order by operator before spilling to disk
+extern int32_t tsQueryParallelism;  // threads a super table aggregate on one vnode is split over
 
 extern int8_t tsKeepOriginalColumnName;
 
@@ -107,6 +110,8 @@ extern int32_t tsTimePrecision;
 extern int8_t  tsCompression;
 extern int8_t  tsWAL;
 extern int32_t tsFsyncPeriod;
+extern int8_t  tsWalGroupCommit;
+extern int32_t tsWalPreallocSize;
 extern int32_t tsReplications;
 extern int16_t tsPartitons;
 extern int32_t tsQuorum;
@@ -117,6 +122,13 @@ extern int8_t  tsCacheLastRow;
 extern bool    tsdbForceKeepFile;
 extern bool    tsdbForceCompactFile;
 extern int32_t tsdbWalFlushSize;
+extern int8_t  tsdbColumnarMem;
+extern int32_t tsdbReadAheadBlocks;
+extern int32_t tsdbBlockCacheSize;
+extern int8_t  tsdbBloomFilter;
+extern int32_t tsdbCommitWorkers;
+extern int32_t tsdbAutoCompactInterval;
+extern int32_t tsdbAutoCompactRate;
 
 // balance
 extern int8_t  tsEnableBalance;
@@ -31,9 +31,18 @@ typedef struct SDataStatis {
   int16_t numOfNull;
 } SDataStatis;
 
+// null information of a column in the current data block, COL_NULL_UNKNOWN means it is not computed yet
+enum {
+  COL_NULL_UNKNOWN = 0,
+  COL_HAS_NO_NULL  = 1,
+  COL_HAS_NULL     = 2,
+  COL_ALL_NULL     = 3,
+};
+
 typedef struct SColumnInfoData {
   SColumnInfo info;
-  char* pData;    // the corresponding block data in memory
+  char* pData;       // the corresponding block data in memory
+  uint8_t nullFlag;  // COL_NULL_UNKNOWN, COL_HAS_NO_NULL, COL_HAS_NULL or COL_ALL_NULL
 } SColumnInfoData;
 
 typedef struct SResPair {
@@ -593,6 +593,58 @@ _err:
   return -1;
 }
 
+/**
+ * Append the rows [offset, offset + nRows) of source to target. Columns are matched by colId, target columns not in
+ * source get NULL values. The fixed length columns are copied as a whole once they hold a not NULL value.
+ */
+int tdAppendDataColsRange(SDataCols *target, SDataCols *source, int offset, int nRows) {
+  ASSERT(nRows > 0 && target->numOfRows + nRows <= target->maxPoints);
+  ASSERT(target->numOfRows == 0 || dataColsKeyLast(target) < dataColsKeyAt(source, offset));
+
+  int scol = 0;
+  for (int dcol = 0; dcol < target->numOfCols; dcol++) {
+    SDataCol *pDataCol = target->cols + dcol;
+    while (scol < source->numOfCols && source->cols[scol].colId < pDataCol->colId) scol++;
+
+    if (scol >= source->numOfCols || source->cols[scol].colId != pDataCol->colId) {
+      for (int i = 0; i < nRows; i++) {
+        if (dataColAppendVal(pDataCol, getNullValue(pDataCol->type), target->numOfRows + i, target->maxPoints, 0) < 0) {
+          return -1;
+        }
+      }
+      continue;
+    }
+
+    SDataCol *pSrcCol = source->cols + scol;
+    ASSERT(pSrcCol->type == pDataCol->type);
+
+    int i = 0;
+    if (!IS_VAR_DATA_TYPE(pDataCol->type)) {
+      for (; i < nRows && isAllRowsNull(pDataCol); i++) {
+        if (dataColAppendVal(pDataCol, tdGetColDataOfRowUnsafe(pSrcCol, offset + i), target->numOfRows + i,
+                             target->maxPoints, 0) < 0) {
+          return -1;
+        }
+      }
+      if (i < nRows) {
+        int len = TYPE_BYTES[pDataCol->type] * (nRows - i);
+        memcpy(POINTER_SHIFT(pDataCol->pData, pDataCol->len), tdGetColDataOfRowUnsafe(pSrcCol, offset + i), len);
+        pDataCol->len += len;
+      }
+    } else {
+      for (; i < nRows; i++) {
+        if (dataColAppendVal(pDataCol, tdGetColDataOfRowUnsafe(pSrcCol, offset + i), target->numOfRows + i,
+                             target->maxPoints, 0) < 0) {
+          return -1;
+        }
+      }
+    }
+  }
+
+  target->numOfRows += nRows;
+  return 0;
+}
+
 // src2 data has more priority than src1
 static void tdMergeTwoDataCols(SDataCols *target, SDataCols *src1, int *iter1, int limit1, SDataCols *src2, int *iter2,
                                int limit2, int tRows, bool forceSetNull) {
@@ -128,6 +128,12 @@ int64_t tsMaxRetentWindow = 24 * 3600L;  // maximum time window tolerance
 int32_t tsQueryBufferSize = -1;
 int64_t tsQueryBufferSizeBytes = -1;
 
+// the memory budget in MB of each order by operator, sorted runs beyond it are spilled into temporary files
+int32_t tsSortBufferSize = 64;
+
+// threads a super table aggregate on one vnode is split over by table partition, 1 runs it on the query thread only
+int32_t tsQueryParallelism = 1;
+
 // in retrieve blocking model, the retrieve threads will wait for the completion of the query processing.
 int32_t tsRetrieveBlockingModel = 0;
 
@@ -146,6 +152,8 @@ int32_t tsTimePrecision = TSDB_DEFAULT_PRECISION;
 int8_t  tsCompression = TSDB_DEFAULT_COMP_LEVEL;
 int8_t  tsWAL = TSDB_DEFAULT_WAL_LEVEL;
 int32_t tsFsyncPeriod = TSDB_DEFAULT_FSYNC_PERIOD;
+int8_t  tsWalGroupCommit = 0;  // write the wal records of a vnode write batch at once
+int32_t tsWalPreallocSize = 0;  // MB, preallocate and recycle the vnode wal files if not 0
 int32_t tsReplications = TSDB_DEFAULT_DB_REPLICA_OPTION;
 int32_t tsQuorum = TSDB_DEFAULT_DB_QUORUM_OPTION;
 int16_t tsPartitons = TSDB_DEFAULT_DB_PARTITON_OPTION;
@@ -162,6 +170,13 @@ int32_t tsTsdbMetaCompactRatio = TSDB_META_COMPACT_RATIO;
 bool    tsdbForceKeepFile = false;
 bool    tsdbForceCompactFile = false;                    // compact TSDB fileset forcibly
 int32_t tsdbWalFlushSize = TSDB_DEFAULT_WAL_FLUSH_SIZE;  // MB
+int8_t  tsdbColumnarMem = 0;                              // keep in-order rows of the memtable in column chunks
+int32_t tsdbReadAheadBlocks = 4;                          // file blocks to read ahead of a query scan
+int32_t tsdbBlockCacheSize = 0;                           // MB of decompressed file block columns cached per vnode
+int8_t  tsdbBloomFilter = 0;                              // write bloom filters of BINARY/NCHAR columns of file blocks
+int32_t tsdbCommitWorkers = 1;                            // threads committing the file sets of a vnode in parallel
+int32_t tsdbAutoCompactInterval = 0;                      // seconds between auto compactions of a vnode, 0 to disable
+int32_t tsdbAutoCompactRate = 64;                         // MB per second an auto compaction writes at most, 0 for no limit
 
 // balance
 int8_t  tsEnableBalance = 1;
@@ -210,6 +225,7 @@ char   tsMnodeBakDir[PATH_MAX] = {0};
 char   tsDataDir[PATH_MAX] = {0};
 char   tsScriptDir[PATH_MAX] = {0};
 char   tsTempDir[PATH_MAX] = "/tmp/";
+char   tsMetaCacheDir[PATH_MAX] = {0};  // client keeps its table metas here across restarts, empty to disable
 int32_t tsKeepTimeOffset = 0;
 
 int32_t tsDiskCfgNum = 0;
@@ -990,6 +1006,26 @@ static void doInitGlobalConfig(void) {
   cfg.unitType = TAOS_CFG_UTYPE_NONE;
   taosInitConfigOption(cfg);
 
+  cfg.option = "walGroupCommit";
+  cfg.ptr = &tsWalGroupCommit;
+  cfg.valType = TAOS_CFG_VTYPE_INT8;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 1;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "walPreallocSize";
+  cfg.ptr = &tsWalPreallocSize;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 4096;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_MB;
+  taosInitConfigOption(cfg);
+
   cfg.option = "replica";
   cfg.ptr = &tsReplications;
   cfg.valType = TAOS_CFG_VTYPE_INT32;
@@ -1110,6 +1146,26 @@ static void doInitGlobalConfig(void) {
   cfg.unitType = TAOS_CFG_UTYPE_BYTE;
   taosInitConfigOption(cfg);
 
+  cfg.option = "sortBufferSize";
+  cfg.ptr = &tsSortBufferSize;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_CLIENT | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 1;
+  cfg.maxValue = 65536;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_MB;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "queryParallelism";
+  cfg.ptr = &tsQueryParallelism;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 1;
+  cfg.maxValue = 64;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
   cfg.option = "retrieveBlockingModel";
   cfg.ptr = &tsRetrieveBlockingModel;
   cfg.valType = TAOS_CFG_VTYPE_INT32;
@@ -1647,6 +1703,16 @@ static void doInitGlobalConfig(void) {
   cfg.unitType = TAOS_CFG_UTYPE_NONE;
   taosInitConfigOption(cfg);
 
+  cfg.option = "metaCacheDir";
+  cfg.ptr = tsMetaCacheDir;
+  cfg.valType = TAOS_CFG_VTYPE_STRING;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_CLIENT;
+  cfg.minValue = 0;
+  cfg.maxValue = 0;
+  cfg.ptrLength = tListLen(tsMetaCacheDir);
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
   cfg.option = "tsdbMetaCompactRatio";
   cfg.ptr = &tsTsdbMetaCompactRatio;
   cfg.valType = TAOS_CFG_VTYPE_INT32;
@@ -1722,6 +1788,76 @@ static void doInitGlobalConfig(void) {
   cfg.unitType = TAOS_CFG_UTYPE_MB;
   taosInitConfigOption(cfg);
 
+  cfg.option = "tsdbColumnarMem";
+  cfg.ptr = &tsdbColumnarMem;
+  cfg.valType = TAOS_CFG_VTYPE_INT8;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 1;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbReadAheadBlocks";
+  cfg.ptr = &tsdbReadAheadBlocks;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 256;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbBlockCacheSize";
+  cfg.ptr = &tsdbBlockCacheSize;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 65536;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_MB;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbBloomFilter";
+  cfg.ptr = &tsdbBloomFilter;
+  cfg.valType = TAOS_CFG_VTYPE_INT8;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 1;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbCommitWorkers";
+  cfg.ptr = &tsdbCommitWorkers;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 1;
+  cfg.maxValue = 64;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_NONE;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbAutoCompactInterval";
+  cfg.ptr = &tsdbAutoCompactInterval;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 86400 * 365;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_SECOND;
+  taosInitConfigOption(cfg);
+
+  cfg.option = "tsdbAutoCompactRate";
+  cfg.ptr = &tsdbAutoCompactRate;
+  cfg.valType = TAOS_CFG_VTYPE_INT32;
+  cfg.cfgType = TSDB_CFG_CTYPE_B_CONFIG | TSDB_CFG_CTYPE_B_SHOW;
+  cfg.minValue = 0;
+  cfg.maxValue = 10240;
+  cfg.ptrLength = 0;
+  cfg.unitType = TAOS_CFG_UTYPE_MB;
+  taosInitConfigOption(cfg);
+
   // shortcut flag to facilitate debugging
   cfg.option = "shortcutFlag";
   cfg.ptr = &tsShortcutFlag;
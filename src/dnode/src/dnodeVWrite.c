@@ -268,7 +268,16 @@ static void *dnodeProcessVWriteQueue(void *wparam) {
       dTrace("msg:%p is processed in vwrite queue, code:0x%x", pWrite, pWrite->code);
     }
 
-    walFsync(vnodeGetWal(pVnode), forceFsync);
+    // in group commit mode the wal records of the batch reach the file here, fail the writes if they are lost
+    int32_t code = walFsync(vnodeGetWal(pVnode), forceFsync);
+    if (code != 0) {
+      dError("pVnode:%p, failed to write wal of %d msgs since %s", pVnode, numOfMsgs, tstrerror(code));
+      taosResetQitems(pWorker->qall);
+      for (int32_t i = 0; i < numOfMsgs; ++i) {
+        taosGetQitem(pWorker->qall, &qtype, (void **)&pWrite);
+        if (pWrite->code == 0) pWrite->code = code;
+      }
+    }
 
     // browse all items, and process them one by one
     taosResetQitems(pWorker->qall);
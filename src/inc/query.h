@@ -99,6 +99,12 @@ void** qReleaseQInfo(void* pMgmt, void* pQInfo, bool freeHandle);
 bool checkQIdEqual(void *qHandle, uint64_t qId);
 int64_t genQueryId(void);
 
+/**
+ * the thread pool shared by the table partitions of the super table aggregates of all the vnodes
+ */
+int32_t qInitQueryPartitionPool(void);
+void    qCleanupQueryPartitionPool(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -63,6 +63,17 @@ typedef struct taosField {
   int16_t  bytes;
 } TAOS_FIELD;
 
+// one column of a block returned by taos_fetch_block_columns, the buffers are owned by the result
+typedef struct taosColumn {
+  uint8_t        type;
+  int16_t        bytes;      // width of one value slot in data, including the length header of var-length types
+  int32_t        numOfRows;
+  const char    *data;       // numOfRows slots of bytes each, pointing into the retrieved block
+  const uint8_t *bitmap;     // validity bitmap, bit (i & 7) of byte (i >> 3) is set when row i is not null
+  const int32_t *offset;     // var-length types only: offset of the content of row i from data
+  const int32_t *length;     // var-length types only: content length of row i, 0 for null
+} TAOS_COLUMN;
+
 typedef enum {
   SET_CONF_RET_SUCC = 0,
   SET_CONF_RET_ERR_PART = -1,
@@ -182,6 +193,7 @@ DLL_EXPORT void taos_stop_query(TAOS_RES *res);
 DLL_EXPORT bool taos_is_null(TAOS_RES *res, int32_t row, int32_t col);
 DLL_EXPORT bool taos_is_update_query(TAOS_RES *res);
 DLL_EXPORT int taos_fetch_block(TAOS_RES *res, TAOS_ROW *rows);
+DLL_EXPORT int taos_fetch_block_columns(TAOS_RES *res, TAOS_COLUMN **columns);
 DLL_EXPORT int* taos_fetch_lengths(TAOS_RES *res);
 DLL_EXPORT TAOS_ROW *taos_result_block(TAOS_RES *res);
 
@@ -210,6 +222,9 @@ DLL_EXPORT int taos_load_table_info(TAOS *taos, const char* tableNameList);
 
 DLL_EXPORT TAOS_RES *taos_schemaless_insert(TAOS* taos, char* lines[], int numLines, int protocol, int precision);
 
+// insert the column arrays of a table, one TAOS_MULTI_BIND for each column of the table in schema order
+DLL_EXPORT TAOS_RES *taos_insert_columns(TAOS* taos, const char* table, TAOS_MULTI_BIND* bind, int numOfCols);
+
 DLL_EXPORT int32_t taos_parse_time(char* timestr, int64_t* time, int32_t len, int32_t timePrec, int8_t dayligth);
 
 DLL_EXPORT int taos_affected_tables(TAOS_RES *res);
@@ -396,6 +396,7 @@ do { \
 #define TSDB_QUERY_TYPE_FILE_INSERT            0x400u    // insert data from file
 #define TSDB_QUERY_TYPE_STMT_INSERT            0x800u    // stmt insert type
 #define TSDB_QUERY_TYPE_NEST_SUBQUERY          0x1000u   // nested sub query
+#define TSDB_QUERY_TYPE_EXPLAIN                0x2000u   // explain analyze, return the execution statistics
 
 #define TSDB_QUERY_HAS_TYPE(x, _type)          (((x) & (_type)) != 0)
 #define TSDB_QUERY_SET_TYPE(x, _type)          ((x) |= (_type))
@@ -201,7 +201,9 @@ enum _mgmt_table {
 
 // SSubmitBlk->flag define
 #define FLAG_BLK_CONTROL            0x00000001 // SSubmitBlk is a control block to submit
+#define FLAG_BLK_COLUMNAR           0x00000002 // data of SSubmitBlk is column-major, see SSubmitColumn
 #define IS_CONTROL_BLOCK(x)         (x->flag & FLAG_BLK_CONTROL)
+#define IS_COLUMNAR_BLOCK(x)        (x->flag & FLAG_BLK_COLUMNAR)
 
 extern char *taosMsg[];
 
@@ -234,6 +236,23 @@ typedef struct SSubmitBlk {
   char     data[];
 } SSubmitBlk;
 
+/*
+ * The data of a columnar SSubmitBlk is one SSubmitColumn for each column of the table schema of sversion, in schema
+ * order. The data of a column is the null bitmap of numOfRows bits, followed by numOfRows values for fixed length
+ * types, or by numOfRows offsets into the var data (VarDataLenT + content) that comes after them for binary and nchar.
+ * Like the rows of a row-major block, the column heads and values are in host byte order.
+ */
+typedef struct SSubmitColumn {
+  int16_t colId;
+  int8_t  type;
+  int32_t len;  // length of data
+  char    data[];
+} SSubmitColumn;
+
+#define SUBMIT_COL_BITMAP_LEN(rows)  (((rows) + 7) >> 3)
+#define SUBMIT_COL_IS_NULL(bm, i)    ((((uint8_t *)(bm))[(i) >> 3] >> ((i)&7)) & 1)
+#define SUBMIT_COL_SET_NULL(bm, i)   (((uint8_t *)(bm))[(i) >> 3] |= (uint8_t)(1 << ((i)&7)))
+
 // Submit message for this TSDB
 typedef struct SSubmitMsg {
   SMsgHead   header;
@@ -564,6 +583,9 @@ typedef struct {
   uint16_t free;
 } SRetrieveTableMsg;
 
+// set in extend of the last rsp of an explain analyze query, which ends with an SExplainMsg and its int32_t length
+#define TSDB_RETRIEVE_RSP_EXPLAIN 0x1
+
 typedef struct SRetrieveTableRsp {
   int8_t  extend;
   int32_t numOfRows;
@@ -576,6 +598,33 @@ typedef struct SRetrieveTableRsp {
   char    data[];
 } SRetrieveTableRsp;
 
+#define TSDB_EXPLAIN_NAME_LEN 48
+
+typedef struct SExplainOperatorMsg {
+  char    name[TSDB_EXPLAIN_NAME_LEN];
+  int32_t depth;        // depth in the operator tree, the root is 0
+  int64_t execs;        // times the operator is executed
+  int64_t selfTime;     // time spent in the operator itself, excluding its upstream, in microseconds
+  int64_t maxSelfTime;  // the max time of one execution
+  int64_t rows;         // rows returned by the operator
+} SExplainOperatorMsg;
+
+typedef struct SExplainMsg {
+  int32_t vgId;
+  int32_t numOfOperators;
+  int64_t elapsed;
+  int32_t totalBlocks;
+  int32_t loadBlocks;
+  int32_t loadBlockStatis;
+  int32_t discardBlocks;
+  int64_t totalRows;
+  int64_t checkedRows;
+  int64_t readBytes;
+  int64_t decompBytes;
+  int64_t cacheHits;
+  SExplainOperatorMsg operators[];
+} SExplainMsg;
+
 typedef struct {
   int32_t  vgId;
   int32_t  dbCfgVersion;
@@ -798,6 +847,9 @@ typedef struct {
   char    tags[];
 } STableInfoMsg;
 
+// SMultiTableInfoMsg.extend flags
+#define TSDB_MULTI_META_SKIP_MISSING 0x1  // skip the tables that do not exist instead of failing the whole request
+
 typedef struct {
   int8_t  extend;
   uint8_t metaClone;     // create local clone of the cached table meta
@@ -965,6 +1017,21 @@ typedef struct {
   SRpcEpSet epSet;
 } SHeartBeatRsp;
 
+// appended to SHeartBeatMsg, following the query and stream descriptions
+typedef struct {
+  int64_t instanceId;    // mnode instance that assigned the version
+  int64_t version;       // version of the last metadata change applied to the client cache
+} SMetaVersionMsg;
+
+// appended to SHeartBeatRsp if SMetaVersionMsg is found in the heartbeat
+typedef struct {
+  int64_t instanceId;
+  int64_t version;       // version of the last metadata change in mnode
+  int8_t  reset;         // the changes are not known since the version of client, all cached metadata are stale
+  int32_t numOfTables;   // number of the changed tables since the version of client
+  char    tableNames[];  // full name of each changed table, TSDB_TABLE_FNAME_LEN bytes for each
+} SMetaChangeRsp;
+
 typedef struct {
   int8_t     extend;
   char queryId[TSDB_KILL_MSG_LEN + 1];
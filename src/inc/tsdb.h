@@ -249,6 +249,12 @@ typedef struct {
   SArray   *dataBlockInfos;
 } STableBlockDist;
 
+typedef struct {
+  int64_t readBytes;    // bytes of block data read from data/last files
+  int64_t decompBytes;  // bytes of column data after decompression
+  int64_t cacheHits;    // columns served by the block cache
+} STsdbReadCost;
+
 /**
  * Get the data block iterator, starting from position according to the query condition
  *
@@ -338,6 +344,17 @@ void tsdbRetrieveDataBlockInfo(TsdbQueryHandleT *pQueryHandle, SDataBlockInfo *p
  */
 int32_t tsdbRetrieveDataBlockStatisInfo(TsdbQueryHandleT *pQueryHandle, SDataStatis **pBlockStatis);
 
+/**
+ * Check the value against the bloom filter of a BINARY/NCHAR column of the current data block.
+ *
+ * @param pQueryHandle  query handle
+ * @param colId         column id
+ * @param val           value without the var string header
+ * @param len           length of the value
+ * @return false only if no row of the current data block has the value in the column
+ */
+bool tsdbDataBlockMayContain(TsdbQueryHandleT *pQueryHandle, int16_t colId, const void *val, int32_t len);
+
 /**
  *
  * The query condition with primary timestamp is passed to iterator during its constructor function,
@@ -398,6 +415,13 @@ int32_t tsdbGetFileBlocksDistInfo(TsdbQueryHandleT* queryHandle, STableBlockDist
 // obtain queryHandle attribute
 int64_t tsdbSkipOffset(TsdbQueryHandleT queryHandle);
 
+/**
+ * get the bytes read and decompressed by the query handle so far
+ * @param queryHandle
+ * @param pCost. the read cost to fill
+ */
+void tsdbGetQueryReadCost(TsdbQueryHandleT queryHandle, STsdbReadCost *pCost);
+
 /**
  * get the statistics of repo usage
  * @param repo. point to the tsdbrepo
@@ -46,6 +46,8 @@ typedef struct {
   int32_t  fsyncPeriod;  // millisecond
   EWalType walLevel;     // wal level
   EWalKeep keep;         // keep the wal file when closed
+  int8_t   groupCommit;  // buffer the records until walFsync
+  int32_t  preallocSize; // MB, preallocate and recycle the wal files if not 0
 } SWalCfg;
 
 typedef void *  twalh;  // WAL HANDLE
@@ -61,7 +63,7 @@ int32_t  walRenew(twalh);
 void     walRemoveOneOldFile(twalh);
 void     walRemoveAllOldFiles(twalh);
 int32_t  walWrite(twalh, SWalHead *);
-void     walFsync(twalh, bool forceFsync);
+int32_t  walFsync(twalh, bool forceFsync);
 int32_t  walRestore(twalh, void *pVnode, FWalWrite writeFp);
 int32_t  walGetWalFile(twalh, char *fileName, int64_t *fileId);
 uint64_t walGetVersion(twalh);
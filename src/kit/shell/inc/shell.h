@@ -96,6 +96,7 @@ void shellCheck(TAOS* con, SShellArguments* args);
 void cleanup_handler(void* arg);
 void exitShell();
 int shellDumpResult(TAOS_RES* con, char* fname, int* error_no, bool printMode);
+int shellDumpExplainResult(TAOS_RES* tres, int* error_no);
 void shellGetGrantInfo(void* con);
 int isCommentLine(char* line);
 int wsclient_handshake();
@@ -329,7 +329,13 @@ void shellRunCommandOnServer(TAOS *con, char command[]) {
   else if (!tscIsUpdateQuery(pSql)) {  // select and show kinds of commands
     int error_no = 0;
 
-    int numOfRows = shellDumpResult(pSql, fname, &error_no, printMode);
+    int numOfRows = 0;
+    if (regex_match(command, "^[\t ]*explain[ \t]+analyze[ \t]+", REG_EXTENDED | REG_ICASE)) {
+      numOfRows = shellDumpExplainResult(pSql, &error_no);
+    } else {
+      numOfRows = shellDumpResult(pSql, fname, &error_no, printMode);
+    }
+
     if (numOfRows < 0) {
       atomic_store_64(&result, 0);
       freeResultWithRid(oresult);
@@ -949,6 +955,51 @@ int shellDumpResult(TAOS_RES *tres, char *fname, int *error_no, bool vertical) {
   return numOfRows;
 }
 
+// the rows of an explain analyze query are only counted, the execution statistics are printed instead as a tree
+int shellDumpExplainResult(TAOS_RES *tres, int *error_no) {
+  int numOfRows = 0;
+  while (taos_fetch_row(tres) != NULL) {
+    numOfRows++;
+  }
+
+  *error_no = taos_errno(tres);
+  if (*error_no != 0) {
+    return numOfRows;
+  }
+
+  int32_t      numOfVnodes = 0;
+  SExplainMsg *pMsg = tscGetExplainMsg(tres, &numOfVnodes);
+  if (pMsg == NULL) {
+    printf("No execution statistics returned.\n");
+    return numOfRows;
+  }
+
+  printf("Execution statistics of %d vnode(s), elapsed time: %.3f ms\n", numOfVnodes, pMsg->elapsed / 1E3);
+
+  for (int32_t i = 0; i < pMsg->numOfOperators; ++i) {
+    SExplainOperatorMsg *pOp = &pMsg->operators[i];
+
+    // the operators are in the depth first order, the upstreams follow the operator with a depth of one more
+    int64_t rowsIn = 0;
+    for (int32_t j = i + 1; j < pMsg->numOfOperators && pMsg->operators[j].depth > pOp->depth; ++j) {
+      if (pMsg->operators[j].depth == pOp->depth + 1) {
+        rowsIn += pMsg->operators[j].rows;
+      }
+    }
+
+    printf("%*s-> %s (execs:%" PRId64 ", rows in:%" PRId64 ", rows out:%" PRId64 ", self time:%.3f ms, max:%.3f ms)\n",
+           pOp->depth * 3, "", pOp->name, pOp->execs, rowsIn, pOp->rows, pOp->selfTime / 1E3, pOp->maxSelfTime / 1E3);
+  }
+
+  printf("Blocks: total:%d, loaded:%d, statis only:%d, skipped:%d\n", pMsg->totalBlocks, pMsg->loadBlocks,
+         pMsg->loadBlockStatis, pMsg->discardBlocks);
+  printf("Rows: total:%" PRId64 ", checked:%" PRId64 "\n", pMsg->totalRows, pMsg->checkedRows);
+  printf("Bytes: read:%" PRId64 ", decompressed:%" PRId64 ", block cache hits:%" PRId64 "\n", pMsg->readBytes,
+         pMsg->decompBytes, pMsg->cacheHits);
+
+  return numOfRows;
+}
+
 
 void read_history() {
   // Initialize history
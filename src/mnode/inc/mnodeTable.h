@@ -37,6 +37,8 @@ void    mnodeDropAllChildTables(SDbObj *pDropDb);
 void    mnodeDropAllSuperTables(SDbObj *pDropDb);
 void    mnodeDropAllChildTablesInVgroups(SVgObj *pVgroup);
 int32_t mnodeCompactTables();
+int32_t mnodeGetMetaChangeNum(int64_t instanceId, int64_t metaVersion);
+void    mnodeGetMetaChanges(int64_t instanceId, int64_t metaVersion, SMetaChangeRsp *pRsp, int32_t maxTables);
 
 #ifdef __cplusplus
 }
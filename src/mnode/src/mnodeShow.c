@@ -237,13 +237,30 @@ static int32_t mnodeProcessRetrieveMsg(SMnodeMsg *pMsg) {
 }
 
 static int32_t mnodeProcessHeartBeatMsg(SMnodeMsg *pMsg) {
-  SHeartBeatRsp *pRsp = (SHeartBeatRsp *)rpcMallocCont(sizeof(SHeartBeatRsp));
+  SHeartBeatMsg *pHBMsg = pMsg->rpcMsg.pCont;
+
+  // the clients of earlier versions do not report the version of their cached metadata
+  SMetaVersionMsg *pVersion = NULL;
+  int32_t numOfChanges = 0;
+  int32_t msgLen = sizeof(SHeartBeatMsg) + htonl(pHBMsg->numOfQueries) * sizeof(SQueryDesc) +
+                   htonl(pHBMsg->numOfStreams) * sizeof(SStreamDesc);
+  if (pMsg->rpcMsg.contLen >= msgLen + (int32_t)sizeof(SMetaVersionMsg)) {
+    pVersion = (SMetaVersionMsg *)((char *)pHBMsg + msgLen);
+    pVersion->instanceId = htobe64(pVersion->instanceId);
+    pVersion->version = htobe64(pVersion->version);
+    numOfChanges = MAX(mnodeGetMetaChangeNum(pVersion->instanceId, pVersion->version), 0);
+  }
+
+  int32_t rspLen = sizeof(SHeartBeatRsp);
+  if (pVersion != NULL) {
+    rspLen += sizeof(SMetaChangeRsp) + numOfChanges * TSDB_TABLE_FNAME_LEN;
+  }
+
+  SHeartBeatRsp *pRsp = (SHeartBeatRsp *)rpcMallocCont(rspLen);
   if (pRsp == NULL) {
     return TSDB_CODE_MND_OUT_OF_MEMORY;
   }
 
-  SHeartBeatMsg *pHBMsg = pMsg->rpcMsg.pCont;
-
   SRpcConnInfo connInfo = {0};
   rpcGetConnInfo(pMsg->rpcMsg.handle, &connInfo);
     
@@ -284,8 +301,12 @@ static int32_t mnodeProcessHeartBeatMsg(SMnodeMsg *pMsg) {
   pRsp->totalDnodes = htonl(totalDnodes);
   mnodeGetMnodeEpSetForShell(&pRsp->epSet, false);
 
+  if (pVersion != NULL) {
+    mnodeGetMetaChanges(pVersion->instanceId, pVersion->version, (SMetaChangeRsp *)(pRsp + 1), numOfChanges);
+  }
+
   pMsg->rpcRsp.rsp = pRsp;
-  pMsg->rpcRsp.len = sizeof(SHeartBeatRsp);
+  pMsg->rpcRsp.len = rspLen;
 
   mnodeReleaseConn(pConn);
   return TSDB_CODE_SUCCESS;
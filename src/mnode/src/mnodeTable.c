@@ -62,12 +62,21 @@ static SHashObj *tsSTableUidHash;
 static int32_t   tsChildTableUpdateSize;
 static int32_t   tsSuperTableUpdateSize;
 
+// tables whose cached metadata in clients are stale, reported to clients in the heartbeat response
+#define META_CHANGE_LOG_SIZE 1024
+static char            tsMetaChanges[META_CHANGE_LOG_SIZE][TSDB_TABLE_FNAME_LEN];
+static int64_t         tsMetaInstanceId;
+static int64_t         tsMetaVersion;
+static int64_t         tsMetaVersionBase;  // changes after this version are all kept in the log
+static pthread_mutex_t tsMetaChangeMutex;
+
 static void *  mnodeGetChildTable(char *tableId);
 static void *  mnodeGetSuperTable(char *tableId);
 static void *  mnodeGetSuperTableByUid(uint64_t uid);
 static void    mnodeDropAllChildTablesInStable(SSTableObj *pStable);
 static void    mnodeAddTableIntoStable(SSTableObj *pStable, SCTableObj *pCtable);
 static void    mnodeRemoveTableFromStable(SSTableObj *pStable, SCTableObj *pCtable);
+static void    mnodeAddMetaChange(const char *tableId);
 
 static int32_t mnodeGetShowTableMeta(STableMetaMsg *pMeta, SShowObj *pShow, void *pConn);
 static int32_t mnodeRetrieveShowTables(SShowObj *pShow, char *data, int32_t rows, void *pConn);
@@ -230,6 +239,8 @@ static int32_t mnodeChildTableActionDelete(SSdbRow *pRow) {
   mnodeDecDbRef(pDb);
   mnodeDecAcctRef(pAcct);
 
+  mnodeAddMetaChange(pTable->info.tableId);
+
   mTrace("table:%s, vgId:%d tid:%d, perform delete action, uid:%" PRIu64 " suid:%" PRIu64, pTable->info.tableId,
          pTable->vgId, pTable->tid, pTable->uid, pTable->suid);
   return TSDB_CODE_SUCCESS;
@@ -257,6 +268,8 @@ static int32_t mnodeChildTableActionUpdate(SSdbRow *pRow) {
     free(oldSchema);
     free(oldTableId);
   }
+
+  mnodeAddMetaChange(pTable->info.tableId);
   mnodeDecTableRef(pTable);
 
   return TSDB_CODE_SUCCESS;
@@ -438,6 +451,66 @@ int64_t mnodeGetChildTableNum() {
   return sdbGetNumOfRows(tsChildTableSdb);
 }
 
+static void mnodeInitMetaChanges() {
+  pthread_mutex_init(&tsMetaChangeMutex, NULL);
+  tsMetaInstanceId  = taosGetTimestampUs();
+  tsMetaVersion     = 0;
+  tsMetaVersionBase = 0;
+}
+
+static void mnodeAddMetaChange(const char *tableId) {
+  pthread_mutex_lock(&tsMetaChangeMutex);
+  tsMetaVersion += 1;
+  tstrncpy(tsMetaChanges[tsMetaVersion % META_CHANGE_LOG_SIZE], tableId, TSDB_TABLE_FNAME_LEN);
+  if (tsMetaVersion - tsMetaVersionBase > META_CHANGE_LOG_SIZE) {
+    tsMetaVersionBase = tsMetaVersion - META_CHANGE_LOG_SIZE;
+  }
+  pthread_mutex_unlock(&tsMetaChangeMutex);
+}
+
+static int32_t mnodeDoGetMetaChangeNum(int64_t instanceId, int64_t metaVersion) {
+  // the client has not been told any version yet, its metadata is fetched recently and kept as it is
+  if (instanceId == 0) {
+    return 0;
+  }
+
+  if (instanceId != tsMetaInstanceId || metaVersion < tsMetaVersionBase || metaVersion > tsMetaVersion) {
+    return -1;
+  }
+
+  return (int32_t)(tsMetaVersion - metaVersion);
+}
+
+// returns -1 if the changes since the version are not known, the client needs to drop all its cached metadata
+int32_t mnodeGetMetaChangeNum(int64_t instanceId, int64_t metaVersion) {
+  pthread_mutex_lock(&tsMetaChangeMutex);
+  int32_t num = mnodeDoGetMetaChangeNum(instanceId, metaVersion);
+  pthread_mutex_unlock(&tsMetaChangeMutex);
+  return num;
+}
+
+void mnodeGetMetaChanges(int64_t instanceId, int64_t metaVersion, SMetaChangeRsp *pRsp, int32_t maxTables) {
+  pthread_mutex_lock(&tsMetaChangeMutex);
+
+  int32_t num = mnodeDoGetMetaChangeNum(instanceId, metaVersion);
+  pRsp->instanceId = htobe64(tsMetaInstanceId);
+  pRsp->version = htobe64(tsMetaVersion);
+
+  if (num < 0 || num > maxTables) {
+    pRsp->reset = 1;
+    pRsp->numOfTables = 0;
+  } else {
+    pRsp->reset = 0;
+    pRsp->numOfTables = htonl(num);
+    for (int32_t i = 0; i < num; ++i) {
+      memcpy(pRsp->tableNames + i * TSDB_TABLE_FNAME_LEN, tsMetaChanges[(metaVersion + i + 1) % META_CHANGE_LOG_SIZE],
+             TSDB_TABLE_FNAME_LEN);
+    }
+  }
+
+  pthread_mutex_unlock(&tsMetaChangeMutex);
+}
+
 static void mnodeAddTableIntoStable(SSTableObj *pStable, SCTableObj *pCtable) {
   atomic_add_fetch_32(&pStable->numOfTables, 1);
 
@@ -449,6 +522,7 @@ static void mnodeAddTableIntoStable(SSTableObj *pStable, SCTableObj *pCtable) {
   if (pStable->vgHash != NULL) {
     if (taosHashGet(pStable->vgHash, &pCtable->vgId, sizeof(pCtable->vgId)) == NULL) {
       taosHashPut(pStable->vgHash, &pCtable->vgId, sizeof(pCtable->vgId), &pCtable->vgId, sizeof(pCtable->vgId));
+      mnodeAddMetaChange(pStable->info.tableId);
       mDebug("stable:%s, vgId:%d is put into stable vgId hash:%p, sizeOfVgList:%d", pStable->info.tableId, pCtable->vgId,
              pStable->vgHash, taosHashGetSize(pStable->vgHash));
     }
@@ -463,6 +537,7 @@ static void mnodeRemoveTableFromStable(SSTableObj *pStable, SCTableObj *pCtable)
   SVgObj *pVgroup = mnodeGetVgroup(pCtable->vgId);
   if (pVgroup == NULL) {
     taosHashRemove(pStable->vgHash, &pCtable->vgId, sizeof(pCtable->vgId));
+    mnodeAddMetaChange(pStable->info.tableId);
     mDebug("table:%s, vgId:%d is remove from stable hash:%p sizeOfVgList:%d", pStable->info.tableId, pCtable->vgId,
            pStable->vgHash, taosHashGetSize(pStable->vgHash));
   }
@@ -509,6 +584,7 @@ static int32_t mnodeSuperTableActionDelete(SSdbRow *pRow) {
   mnodeDecDbRef(pDb);
 
   taosHashRemove(tsSTableUidHash, &pStable->uid, sizeof(int64_t));
+  mnodeAddMetaChange(pStable->info.tableId);
 
   mTrace("stable:%s, perform delete action, uid:%" PRIu64, pStable->info.tableId, pStable->uid);
   return TSDB_CODE_SUCCESS;
@@ -541,6 +617,10 @@ static int32_t mnodeSuperTableActionUpdate(SSdbRow *pRow) {
            taosHashGetSize(pTable->vgHash));
   }
 
+  if (pTable != NULL) {
+    mnodeAddMetaChange(pTable->info.tableId);
+  }
+
   mnodeDecTableRef(pTable);
   return TSDB_CODE_SUCCESS;
 }
@@ -642,6 +722,8 @@ static void mnodeCleanupSuperTables() {
 }
 
 int32_t mnodeInitTables() {
+  mnodeInitMetaChanges();
+
   int32_t code = mnodeInitSuperTables();
   if (code != TSDB_CODE_SUCCESS) {
     return code;
@@ -749,6 +831,7 @@ void mnodeDecTableRef(void *p1) {
 void mnodeCleanupTables() {
   mnodeCleanupChildTables();
   mnodeCleanupSuperTables();
+  pthread_mutex_destroy(&tsMetaChangeMutex);
 }
 
 // todo move to name.h, add length of table name
@@ -3030,6 +3113,11 @@ static int32_t mnodeProcessMultiTableMetaMsg(SMnodeMsg *pMsg) {
     char *fullName = nameList[t];
 
     pMsg->pTable = mnodeGetTable(fullName);
+    if (pMsg->pTable == NULL && (pInfo->extend & TSDB_MULTI_META_SKIP_MISSING)) {
+      mDebug("msg:%p, app:%p table:%s, not exist, skip it", pMsg, pMsg->rpcMsg.ahandle, fullName);
+      continue;
+    }
+
     if (pMsg->pTable == NULL) {
       mError("msg:%p, app:%p table:%s, failed to get table meta, table not exist", pMsg, pMsg->rpcMsg.ahandle, fullName);
       code = TSDB_CODE_MND_INVALID_TABLE_NAME;
@@ -3055,6 +3143,9 @@ static int32_t mnodeProcessMultiTableMetaMsg(SMnodeMsg *pMsg) {
         code = TSDB_CODE_MND_OUT_OF_MEMORY;
         goto _end;
       }
+
+      // the table meta msg is assumed to be zeroed, e.g., the number of vgroup eps is increased on it
+      memset((char*)pMultiMeta + totalMallocLen / 2, 0, totalMallocLen / 2);
     }
 
     STableMetaMsg *pMeta = (STableMetaMsg *)((char*) pMultiMeta + pMultiMeta->contLen);
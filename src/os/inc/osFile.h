@@ -42,6 +42,8 @@ int64_t taosWrite(FileFd fd, void *buf, int64_t count);
 
 int64_t taosLSeek(FileFd fd, int64_t offset, int32_t whence);
 int32_t taosFtruncate(FileFd fd, int64_t length);
+int32_t taosFallocate(FileFd fd, int64_t offset, int64_t len);
+int32_t taosReadAhead(FileFd fd, int64_t offset, int64_t count);
 int32_t taosFsync(FileFd fd);
 
 int32_t taosRename(char* oldName, char *newName);
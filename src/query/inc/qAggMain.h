@@ -277,6 +277,21 @@ extern int32_t functionCompatList[]; // compatible check array list
 
 bool topbot_datablock_filter(SQLFunctionCtx *pCtx, const char *minval, const char *maxval);
 
+bool isIntermediateResultMergeable(int32_t functionId);
+void mergeIntermediateResult(int32_t functionId, int16_t inputType, int32_t inputBytes, char *dst, const char *src);
+
+/*
+ * type specialized kernels over the raw data of a column in qAggKernel.c, all of them return the number of not null
+ * values, aggCountNotNull returns -1 for the types without a kernel
+ */
+int32_t aggCountNotNull(const void *data, int32_t type, int32_t numOfRows);
+int32_t aggSumSigned(const void *data, int32_t type, int32_t numOfRows, bool hasNull, int64_t *sum);
+int32_t aggSumUnsigned(const void *data, int32_t type, int32_t numOfRows, bool hasNull, uint64_t *sum);
+int32_t aggSumDouble(const void *data, int32_t type, int32_t numOfRows, double *sum);
+// res keeps the min/max so far of the input type, pos gets the row to update the tags from or -1, it may be NULL
+int32_t aggMinMax(const void *data, int32_t type, int32_t numOfRows, bool hasNull, bool isMin, void *res,
+                  int32_t *pos);
+
 /**
  * the numOfRes should be kept, since it may be used later
  * and allow the ResultInfo to be re initialized
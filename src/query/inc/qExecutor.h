@@ -28,6 +28,7 @@
 #include "taosdef.h"
 #include "tarray.h"
 #include "tlockfree.h"
+#include "tlosertree.h"
 #include "tsdb.h"
 #include "qUdf.h"
 
@@ -94,6 +95,20 @@ typedef struct SResultRow {
   SHashObj     *modeHash;  // for unique function
 } SResultRow;
 
+typedef struct SResultRowHashEntry {
+  uint64_t      k0;
+  uint64_t      k1;
+  TSKEY         skey;        // start key of the time window
+  int64_t       val;         // -1 for an empty entry
+} SResultRowHashEntry;
+
+// open addressing hash table for the result rows of time windows, keyed by two integers and the window start key
+typedef struct SResultRowHash {
+  SResultRowHashEntry *pEntries;
+  uint32_t      capacity;    // always power of 2
+  uint32_t      size;
+} SResultRowHash;
+
 typedef struct SResultRowCell {
   uint64_t     groupId;
   SResultRow  *pRow;
@@ -160,6 +175,7 @@ typedef enum {
 typedef struct {
   EQueryProfEventType eventType;
   int64_t eventTime;
+  int64_t rows;  // rows returned by the operator, for the after exec event
 
   union {
     uint8_t operatorType; //for operator event
@@ -170,7 +186,9 @@ typedef struct {
 typedef struct {
   uint8_t operatorType;
   int64_t sumSelfTime;
+  int64_t maxSelfTime;
   int64_t sumRunTimes;
+  int64_t sumRows;
 } SOperatorProfResult;
 
 typedef struct SQueryCostInfo {
@@ -180,7 +198,9 @@ typedef struct SQueryCostInfo {
   uint64_t loadStatisSize;
   uint64_t loadFileBlockSize;
   uint64_t loadDataInCacheSize;
-  
+  uint64_t decompBlockSize;
+  uint64_t blockCacheHits;
+
   uint64_t loadDataTime;
   uint64_t totalRows;
   uint64_t totalCheckedRows;
@@ -241,6 +261,8 @@ typedef struct SQueryAttr {
   bool             multigroupResult; // multigroup result can exist in one SSDataBlock
   bool             needSort;         // need sort rowRes
   bool             skipOffset;       // can skip offset if true 
+  bool             hasBloomFilter;   // pFilters has equal conditions the block bloom filters can check
+  bool             explain;          // explain analyze, the execution statistics are returned with the results
   int32_t          interBufSize;     // intermediate buffer sizse
 
   int32_t          havingNum;        // having expr number
@@ -306,6 +328,8 @@ typedef struct SQueryRuntimeEnv {
   SDiskbasedResultBuf*  pResultBuf;       // query result buffer based on blocked-wised disk file
   SHashObj*             pResultRowHashTable; // quick locate the window object for each result
   SHashObj*             pResultRowListSet;   // used to check if current ResultRowInfo has ResultRow object or not
+  SResultRowHash        winRowHash;          // (tableGroupId, window start) -> SResultRow, for time window queries
+  SResultRowHash        winRowIndex;         // (pResultRowInfo, tid, window start) -> slot in pResultRowInfo
   SArray*               pResultRowArrayList; // The array list that contains the Result rows
   char*                 keyBuf;           // window key buffer
   SResultRowPool*       pool;             // The window result objects pool, all the resultRow Objects are allocated and managed by this object.
@@ -331,6 +355,7 @@ typedef struct SQueryRuntimeEnv {
   bool                  udfIsCopy;
   SHashObj             *pTablesRead;    // record child tables already read rows by tid hash
   int32_t              cntTableReadOver; // read table over count  
+  struct SQueryPartition *pPartition;    // table partition of the query run by this env, NULL for the query itself
 } SQueryRuntimeEnv;
 
 enum {
@@ -365,6 +390,8 @@ enum OPERATOR_TYPE_E {
   OP_TimeEvery         = 23,
   OP_AllMultiTableTimeInterval = 24,
   OP_Order             = 25,
+  OP_TopN              = 26,
+  OP_PartitionAggregate = 27,
 };
 
 typedef struct SOperatorInfo {
@@ -439,8 +466,10 @@ typedef struct SQueryParam {
 } SQueryParam;
 
 typedef struct SColumnDataParam{
-  int32_t numOfCols;
-  SArray* pDataBlock;
+  int32_t      numOfCols;
+  SArray*      pDataBlock;
+  SDataStatis* pStatis;    // statistics of the columns in pDataBlock, NULL if not loaded
+  int32_t      numOfRows;
 } SColumnDataParam;
 
 typedef struct STableScanInfo {
@@ -560,7 +589,17 @@ typedef struct SGroupbyOperatorInfo {
   SOptrBasicInfo binfo;
   SArray         *pGroupbyDataInfo;
   int32_t        totalBytes;
-  char           *prevData;   // previous data buf
+  char           *prevData;   // packed key of the group in process, points into keyBuf
+  bool           fixedKey;    // at most two fixed-width group by columns, keys are hashed as two int64 values
+  int32_t        capacity;    // number of rows the buffers below are allocated for
+  char           *keyBuf;     // packed group by keys, one slot of totalBytes per row (per group for fixed keys)
+  int64_t        *groupKey;   // two values per group, fixed keys only
+  uint8_t        *groupNull;  // null mask of the group by columns per group, fixed keys only
+  int32_t        *rowGroup;   // block local group id of each row
+  int32_t        *groupRows;  // number of rows of each group, then the start offset after rows are sorted by group
+  int32_t        *rowOrder;   // row index sorted by group
+  int32_t        *slots;      // open addressing table of group ids, 2 * capacity entries
+  SSDataBlock    *pSortedBlock;  // rows of the input block gathered in group order
 } SGroupbyOperatorInfo;
 
 typedef struct SSWindowOperatorInfo {
@@ -621,13 +660,55 @@ typedef struct SMultiwayMergeInfo {
   bool                 multiGroupResults;
 } SMultiwayMergeInfo;
 
-// todo support the disk-based sort
+typedef struct SOrderMergeSource {
+  int32_t      runId;       // group id of the sorted run in the sort buffer
+  int32_t      pageIndex;   // index of current page in the page list of the run
+  int32_t      rowIndex;    // row index in current page, -1 if the run is exhausted
+  tFilePage   *pPage;
+} SOrderMergeSource;
+
 typedef struct SOrderOperatorInfo {
   int32_t      colIndex;
   int32_t      order;
-  SSDataBlock *pDataBlock;
+  SSDataBlock *pDataBlock;        // rows collected in memory
+  int64_t      bufSize;           // memory budget, half for the collected rows and half for the pages of sorted runs
+  int32_t      rowSize;
+  int32_t      numOfRowsPerPage;
+  __compar_fn_t        comparFn;
+  SDiskbasedResultBuf *pSortBuf;  // sorted runs spilled once the collected rows exceed the budget
+  int32_t      numOfRuns;
+  SOrderMergeSource   *pSources;
+  SLoserTreeInfo      *pMergeTree;
+  SSDataBlock *pRes;              // output block of the merge of the sorted runs
 } SOrderOperatorInfo;
 
+// order by with limit, only the first numOfRows rows in order are kept
+typedef struct STopNOperatorInfo {
+  int32_t      colIndex;
+  int32_t      order;
+  int32_t      numOfRows;         // offset + limit of the query
+  __compar_fn_t comparFn;
+  SSDataBlock *pDataBlock;        // rows kept, one slot per row
+  int32_t     *pHeap;             // slots of the rows kept, the root is the row that goes last in order
+  int32_t      size;              // number of rows kept
+  int64_t      numOfSkipBlocks;   // blocks skipped as a whole since none of the rows goes before the root
+} STopNOperatorInfo;
+
+// the tables of a super table aggregate are split into partitions, each scanned and aggregated on its own thread
+typedef struct SQueryPartition {
+  SQueryRuntimeEnv runtimeEnv;      // shares the query attributes and the memory snapshot with the query
+  SQueryCostInfo   cost;
+  int8_t           state;           // pending or running, whoever takes a pending partition runs it
+  int32_t          code;
+} SQueryPartition;
+
+typedef struct SPartitionAggOperatorInfo {
+  SQueryPartition *pPartitions;
+  int32_t          numOfPartitions;
+  tsem_t           finished;        // posted by each task scheduled on the partition pool
+  bool             executed;
+} SPartitionAggOperatorInfo;
+
 void appendUpstream(SOperatorInfo* p, SOperatorInfo* pUpstream);
 
 SOperatorInfo* createDataBlocksOptScanInfo(void* pTsdbQueryHandle, SQueryRuntimeEnv* pRuntimeEnv, int32_t repeatTime, int32_t reverseTime);
@@ -642,6 +723,7 @@ SOperatorInfo* createSWindowOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperato
 SOperatorInfo* createFillOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput, bool multigroupResult);
 SOperatorInfo* createGroupbyOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput);
 SOperatorInfo* createMultiTableAggOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput);
+SOperatorInfo* createPartitionAggOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv);
 SOperatorInfo* createMultiTableTimeIntervalOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput);
 SOperatorInfo* createTimeEveryOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput);
 SOperatorInfo* createTagScanOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SExprInfo* pExpr, int32_t numOfOutput);
@@ -657,6 +739,7 @@ SOperatorInfo* createFilterOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperator
 
 SOperatorInfo* createJoinOperatorInfo(SOperatorInfo** pUpstream, int32_t numOfUpstream, SSchema* pSchema, int32_t numOfOutput);
 SOperatorInfo* createOrderOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput, SOrderVal* pOrderVal);
+SOperatorInfo* createTopNOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput, SOrderVal* pOrderVal, int64_t numOfRows);
 
 SSDataBlock* doGlobalAggregate(void* param, bool* newgroup);
 SSDataBlock* doMultiwayMergeSort(void* param, bool* newgroup);
@@ -721,9 +804,10 @@ int32_t doDumpQueryResult(SQInfo *pQInfo, char *data, int8_t compressed, int32_t
 size_t getResultSize(SQInfo *pQInfo, int64_t *numOfRows);
 void setQueryKilled(SQInfo *pQInfo);
 
-void publishOperatorProfEvent(SOperatorInfo* operatorInfo, EQueryProfEventType eventType);
+void publishOperatorProfEvent(SOperatorInfo* operatorInfo, EQueryProfEventType eventType, SSDataBlock* pBlock);
 void publishQueryAbortEvent(SQInfo* pQInfo, int32_t code);
 void calculateOperatorProfResults(SQInfo* pQInfo);
+SExplainMsg* createExplainMsg(SQInfo* pQInfo, int32_t* len);
 void queryCostStatis(SQInfo *pQInfo);
 
 void freeQInfo(SQInfo *pQInfo);
@@ -733,6 +817,8 @@ int32_t getMaximumIdleDurationSec();
 
 void doInvokeUdf(SUdfInfo* pUdfInfo, SQLFunctionCtx *pCtx, int32_t idx, int32_t type);
 int32_t getColumnDataFromId(void *param, int32_t id, void **data);
+int32_t getColumnNullFlagFromId(void *param, int32_t id, uint8_t *nullFlag);
+uint8_t getColumnNullFlag(SColumnInfoData* pColInfo, SDataStatis* pStatis, int32_t numOfRows);
 
 void qInfoLogSSDataBlock(SSDataBlock* block, char* location);
 
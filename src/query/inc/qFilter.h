@@ -105,7 +105,9 @@ typedef bool (*rangeCompFunc) (const void *, const void *, const void *, const v
 typedef int32_t(*filter_desc_compare_func)(const void *, const void *);
 typedef bool(*filter_exec_func)(void *, int32_t, int8_t**, SDataStatis *, int16_t);
 typedef int32_t (*filer_get_col_from_id)(void *, int32_t, void **);
+typedef int32_t (*filer_get_col_null_from_id)(void *, int32_t, uint8_t *);
 typedef int32_t (*filer_get_col_from_name)(void *, int32_t, char*, void **);
+typedef bool (*filter_bloom_func)(void *, int16_t, const void *, int32_t);
 
 typedef struct SFilterRangeCompare {
   int64_t s;
@@ -202,6 +204,9 @@ typedef struct SFilterUnit {
   SFilterFieldId  right2;
 } SFilterUnit;
 
+struct SFilterComUnit;
+typedef void (*filter_vec_func)(struct SFilterComUnit *, int32_t, int8_t *);
+
 typedef struct SFilterComUnit {
   void *colData;
   void *valData;
@@ -212,6 +217,10 @@ typedef struct SFilterComUnit {
   uint8_t optr;
   int8_t func;
   int8_t rfunc;
+  filter_vec_func vfunc;   // evaluates the unit over the whole column, NULL if there is no kernel for it
+  void *inVals;            // values of IN as an array, for vfunc
+  int32_t inNum;
+  uint8_t nullFlag;        // null information of the column in current block, COL_NULL_UNKNOWN if not provided
 } SFilterComUnit;
 
 typedef struct SFilterPCtx {
@@ -238,6 +247,8 @@ typedef struct SFilterInfo {
   uint32_t          blkGroupNum;
   uint32_t         *blkUnits;
   int8_t           *blkUnitRes;
+  int8_t           *vecRes;     // buffer of the vectorized execution, grown to the largest block
+  uint32_t          vecResSize;
   void             *pTable;
 
   SFilterPCtx       pctx;
@@ -328,15 +339,24 @@ typedef struct SFilterInfo {
 extern int32_t filterInitFromTree(tExprNode* tree, void **pinfo, uint32_t options);
 extern bool filterExecute(SFilterInfo *info, int32_t numOfRows, int8_t** p, SDataStatis *statis, int16_t numOfCols);
 extern int32_t filterSetColFieldData(SFilterInfo *info, void *param, filer_get_col_from_id fp);
+extern int32_t filterSetColFieldNullFlag(SFilterInfo *info, void *param, filer_get_col_null_from_id fp);
 extern int32_t filterSetJsonColFieldData(SFilterInfo *info, void *param, filer_get_col_from_name fp);
 extern int32_t filterGetTimeRange(SFilterInfo *info, STimeWindow *win);
 extern int32_t filterConverNcharColumns(SFilterInfo* pFilterInfo, int32_t rows, bool *gotNchar);
 extern int32_t filterFreeNcharColumns(SFilterInfo* pFilterInfo);
 extern void filterFreeInfo(SFilterInfo *info);
 extern bool filterRangeExecute(SFilterInfo *info, SDataStatis *pDataStatis, int32_t numOfCols, int32_t numOfRows);
+extern bool filterRangeAllQualified(SFilterInfo *info, SDataStatis *pDataStatis, int32_t numOfCols, int32_t numOfRows);
+extern bool filterHasBloomUnit(SFilterInfo *info);
+extern bool filterBloomExecute(SFilterInfo *info, filter_bloom_func fp, void *param);
 extern int32_t filterIsIndexedColumnQuery(SFilterInfo* info, int32_t idxId, bool *res);
 extern int32_t filterGetIndexedColumnInfo(SFilterInfo* info, char** val, int32_t *order, int32_t *flag);
 
+extern filter_vec_func filterGetVecFunc(SFilterComUnit *cunit);
+extern void filterVecAnd(int8_t *res, const int8_t *r, int32_t numOfRows);
+extern void filterVecOr(int8_t *res, const int8_t *r, int32_t numOfRows);
+extern bool filterVecAllSet(const int8_t *res, int32_t numOfRows);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,10 @@
 #ifndef TDENGINE_QUERYUTIL_H
 #define TDENGINE_QUERYUTIL_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #include "tbuffer.h"
 
 #define SET_RES_WINDOW_KEY(_k, _ori, _len, _uid)     \
@@ -83,6 +87,37 @@ bool notNullOperator(SColumnFilterElem *pFilter, const char* minval, const char*
 
 __filter_func_t getFilterOperator(int32_t lowerOptr, int32_t upperOptr);
 
+static FORCE_INLINE uint32_t resultRowHashKey(uint64_t k0, uint64_t k1, TSKEY skey) {
+  uint64_t h = (uint64_t)skey ^ (k0 * 0x9E3779B97F4A7C15ULL) ^ (k1 * 0xC2B2AE3D27D4EB4FULL);
+  h ^= (h >> 33);
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= (h >> 33);
+  return (uint32_t)h;
+}
+
+static FORCE_INLINE int64_t* resultRowHashGet(SResultRowHash* pHash, uint64_t k0, uint64_t k1, TSKEY skey) {
+  if (pHash->size == 0) {
+    return NULL;
+  }
+
+  uint32_t mask = pHash->capacity - 1;
+  uint32_t i = resultRowHashKey(k0, k1, skey) & mask;
+  while (pHash->pEntries[i].val != -1) {
+    SResultRowHashEntry* pEntry = &pHash->pEntries[i];
+    if (pEntry->skey == skey && pEntry->k0 == k0 && pEntry->k1 == k1) {
+      return &pEntry->val;
+    }
+
+    i = (i + 1) & mask;
+  }
+
+  return NULL;
+}
+
+int32_t resultRowHashPut(SResultRowHash* pHash, uint64_t k0, uint64_t k1, TSKEY skey, int64_t val);
+void    resultRowHashCleanup(SResultRowHash* pHash);
+size_t  resultRowHashGetMemSize(const SResultRowHash* pHash);
+
 SResultRowPool* initResultRowPool(size_t size);
 SResultRow* getNewResultRow(SResultRowPool* p);
 int64_t getResultRowPoolMemSize(SResultRowPool* p);
@@ -110,4 +145,9 @@ int32_t getNumOfTotalRes(SGroupResInfo* pGroupResInfo);
 int32_t mergeIntoGroupResult(SGroupResInfo* pGroupResInfo, SQueryRuntimeEnv *pRuntimeEnv, int32_t* offset);
 
 int32_t initUdfInfo(SUdfInfo* pUdfInfo);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif  // TDENGINE_QUERYUTIL_H
@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "os.h"
+#include "qAggMain.h"
+#include "ttype.h"
+
+/**
+ * Type specialized kernels of count/sum/avg/min/max over the raw data of one column in a block, for the blocks that
+ * can not be answered by the pre-aggregated SDataStatis.
+ *
+ * Each kernel keeps its accumulator in a local variable and has no branch in the loop: the NULL rows are masked out
+ * by a select, so the compiler vectorizes the loops. The float types are reduced in AGG_VEC_LANES independent lanes,
+ * since the compiler does not reorder the floating point operations of one accumulator by itself. On x86_64 linux
+ * each kernel is built for AVX2 besides the baseline SSE4.2, and the loader picks the clone the CPU supports.
+ */
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define AGG_VEC_TARGET __attribute__((target_clones("avx2", "default")))
+#else
+#define AGG_VEC_TARGET
+#endif
+
+#define AGG_VEC_LANES 8
+
+/*
+ * The NULL of float types is one NAN given by its bits, as isNull checks it. Any other NAN is a value, so the float
+ * types are compared by their bits with the NULL, too.
+ */
+#define AGG_INT_NOTNULL(v, _null) ((v) != (_null))
+#define AGG_F32_NOTNULL(v, _null) aggF32NotNull(v)
+#define AGG_F64_NOTNULL(v, _null) aggF64NotNull(v)
+
+static FORCE_INLINE int32_t aggF32NotNull(float v) {
+  uint32_t b;
+  memcpy(&b, &v, sizeof(b));
+  return b != (uint32_t)TSDB_DATA_FLOAT_NULL;
+}
+
+static FORCE_INLINE int32_t aggF64NotNull(double v) {
+  uint64_t b;
+  memcpy(&b, &v, sizeof(b));
+  return b != (uint64_t)TSDB_DATA_DOUBLE_NULL;
+}
+
+#define AGG_SUM_INT_KERNEL(_name, _type, _acc, _null)                                      \
+  static AGG_VEC_TARGET int32_t _name(const void *data, int32_t numOfRows, bool hasNull, _acc *sum) { \
+    const _type *d = (const _type *)data;                                                  \
+    _acc         s = 0;                                                                    \
+    int32_t      num = 0;                                                                  \
+    if (!hasNull) {                                                                        \
+      for (int32_t i = 0; i < numOfRows; ++i) {                                            \
+        s += d[i];                                                                         \
+      }                                                                                    \
+      num = numOfRows;                                                                     \
+    } else {                                                                               \
+      for (int32_t i = 0; i < numOfRows; ++i) {                                            \
+        int32_t nn = AGG_INT_NOTNULL(d[i], (_type)(_null));                                \
+        s += nn ? (_acc)d[i] : 0;                                                          \
+        num += nn;                                                                         \
+      }                                                                                    \
+    }                                                                                      \
+    *sum = s;                                                                              \
+    return num;                                                                            \
+  }
+
+AGG_SUM_INT_KERNEL(aggSumI8, int8_t, int64_t, TSDB_DATA_TINYINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumI16, int16_t, int64_t, TSDB_DATA_SMALLINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumI32, int32_t, int64_t, TSDB_DATA_INT_NULL)
+AGG_SUM_INT_KERNEL(aggSumI64, int64_t, int64_t, TSDB_DATA_BIGINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumU8, uint8_t, uint64_t, TSDB_DATA_UTINYINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumU16, uint16_t, uint64_t, TSDB_DATA_USMALLINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumU32, uint32_t, uint64_t, TSDB_DATA_UINT_NULL)
+AGG_SUM_INT_KERNEL(aggSumU64, uint64_t, uint64_t, TSDB_DATA_UBIGINT_NULL)
+
+// sum in double, of the float types and of the 64 bits integers for avg
+#define AGG_SUM_DBL_KERNEL(_name, _type, NN, _null)                                        \
+  static AGG_VEC_TARGET int32_t _name(const void *data, int32_t numOfRows, double *sum) {  \
+    const _type *d = (const _type *)data;                                                  \
+    double       s[AGG_VEC_LANES] = {0};                                                   \
+    int32_t      n[AGG_VEC_LANES] = {0};                                                   \
+    int32_t      i = 0;                                                                    \
+    for (; i + AGG_VEC_LANES <= numOfRows; i += AGG_VEC_LANES) {                           \
+      for (int32_t k = 0; k < AGG_VEC_LANES; ++k) {                                        \
+        const _type v = d[i + k];                                                          \
+        int32_t     nn = NN(v, (_type)(_null));                                            \
+        s[k] += nn ? (double)v : 0.0;                                                      \
+        n[k] += nn;                                                                        \
+      }                                                                                    \
+    }                                                                                      \
+    for (; i < numOfRows; ++i) {                                                           \
+      int32_t nn = NN(d[i], (_type)(_null));                                               \
+      s[0] += nn ? (double)d[i] : 0.0;                                                     \
+      n[0] += nn;                                                                          \
+    }                                                                                      \
+    double  total = 0;                                                                     \
+    int32_t num = 0;                                                                       \
+    for (int32_t k = 0; k < AGG_VEC_LANES; ++k) {                                          \
+      total += s[k];                                                                       \
+      num += n[k];                                                                         \
+    }                                                                                      \
+    *sum = total;                                                                          \
+    return num;                                                                            \
+  }
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9)
+/*
+ * The compiler does not turn the lanes above into vector adds for the float types, so they are written with the
+ * vector extension of gcc: the NULL rows are found by their bits and cleared to 0.0 before the adds.
+ */
+typedef double  v2df __attribute__((vector_size(16)));
+typedef int64_t v2di __attribute__((vector_size(16)));
+typedef float   v2sf __attribute__((vector_size(8)));
+typedef int32_t v2si __attribute__((vector_size(8)));
+
+static AGG_VEC_TARGET int32_t aggSumDblF64(const void *data, int32_t numOfRows, double *sum) {
+  const double *d = (const double *)data;
+  const v2di    nullv = {(int64_t)TSDB_DATA_DOUBLE_NULL, (int64_t)TSDB_DATA_DOUBLE_NULL};
+  v2df          s[4] = {{0}};
+  v2di          n[4] = {{0}};
+  int32_t       i = 0;
+
+  for (; i + 8 <= numOfRows; i += 8) {
+    for (int32_t k = 0; k < 4; ++k) {
+      v2di b;
+      v2df x;
+      memcpy(&b, d + i + 2 * k, sizeof(b));
+      v2di nn = (b != nullv);  // -1 for a value not null
+      b &= nn;
+      memcpy(&x, &b, sizeof(x));
+      s[k] += x;
+      n[k] -= nn;
+    }
+  }
+
+  double  total = 0;
+  int64_t num = 0;
+  for (int32_t k = 0; k < 4; ++k) {
+    total += s[k][0] + s[k][1];
+    num += n[k][0] + n[k][1];
+  }
+
+  for (; i < numOfRows; ++i) {
+    if (aggF64NotNull(d[i])) {
+      total += d[i];
+      num += 1;
+    }
+  }
+
+  *sum = total;
+  return (int32_t)num;
+}
+
+static AGG_VEC_TARGET int32_t aggSumDblF32(const void *data, int32_t numOfRows, double *sum) {
+  const float *d = (const float *)data;
+  const v2si   nullv = {(int32_t)TSDB_DATA_FLOAT_NULL, (int32_t)TSDB_DATA_FLOAT_NULL};
+  v2df         s[4] = {{0}};
+  v2si         n[4] = {{0}};
+  int32_t      i = 0;
+
+  for (; i + 8 <= numOfRows; i += 8) {
+    for (int32_t k = 0; k < 4; ++k) {
+      v2si b;
+      v2sf x;
+      memcpy(&b, d + i + 2 * k, sizeof(b));
+      v2si nn = (b != nullv);
+      b &= nn;
+      memcpy(&x, &b, sizeof(x));
+      s[k] += __builtin_convertvector(x, v2df);
+      n[k] -= nn;
+    }
+  }
+
+  double  total = 0;
+  int64_t num = 0;
+  for (int32_t k = 0; k < 4; ++k) {
+    total += s[k][0] + s[k][1];
+    num += n[k][0] + n[k][1];
+  }
+
+  for (; i < numOfRows; ++i) {
+    if (aggF32NotNull(d[i])) {
+      total += d[i];
+      num += 1;
+    }
+  }
+
+  *sum = total;
+  return (int32_t)num;
+}
+#else
+AGG_SUM_DBL_KERNEL(aggSumDblF32, float, AGG_F32_NOTNULL, 0)
+AGG_SUM_DBL_KERNEL(aggSumDblF64, double, AGG_F64_NOTNULL, 0)
+#endif
+
+AGG_SUM_DBL_KERNEL(aggSumDblI64, int64_t, AGG_INT_NOTNULL, TSDB_DATA_BIGINT_NULL)
+AGG_SUM_DBL_KERNEL(aggSumDblU64, uint64_t, AGG_INT_NOTNULL, TSDB_DATA_UBIGINT_NULL)
+
+#define AGG_COUNT_KERNEL(_name, _type, NN, _null)                                          \
+  static AGG_VEC_TARGET int32_t _name(const void *data, int32_t numOfRows) {               \
+    const _type *d = (const _type *)data;                                                  \
+    int32_t      num = 0;                                                                  \
+    for (int32_t i = 0; i < numOfRows; ++i) {                                              \
+      num += NN(d[i], (_type)(_null));                                                     \
+    }                                                                                      \
+    return num;                                                                            \
+  }
+
+AGG_COUNT_KERNEL(aggCountBool, uint8_t, AGG_INT_NOTNULL, TSDB_DATA_BOOL_NULL)
+AGG_COUNT_KERNEL(aggCountI8, uint8_t, AGG_INT_NOTNULL, TSDB_DATA_TINYINT_NULL)
+AGG_COUNT_KERNEL(aggCountU8, uint8_t, AGG_INT_NOTNULL, TSDB_DATA_UTINYINT_NULL)
+AGG_COUNT_KERNEL(aggCountI16, uint16_t, AGG_INT_NOTNULL, TSDB_DATA_SMALLINT_NULL)
+AGG_COUNT_KERNEL(aggCountU16, uint16_t, AGG_INT_NOTNULL, TSDB_DATA_USMALLINT_NULL)
+AGG_COUNT_KERNEL(aggCountI32, uint32_t, AGG_INT_NOTNULL, TSDB_DATA_INT_NULL)
+AGG_COUNT_KERNEL(aggCountU32, uint32_t, AGG_INT_NOTNULL, TSDB_DATA_UINT_NULL)
+AGG_COUNT_KERNEL(aggCountF32, uint32_t, AGG_INT_NOTNULL, TSDB_DATA_FLOAT_NULL)
+AGG_COUNT_KERNEL(aggCountI64, uint64_t, AGG_INT_NOTNULL, TSDB_DATA_BIGINT_NULL)
+AGG_COUNT_KERNEL(aggCountU64, uint64_t, AGG_INT_NOTNULL, TSDB_DATA_UBIGINT_NULL)
+AGG_COUNT_KERNEL(aggCountF64, uint64_t, AGG_INT_NOTNULL, TSDB_DATA_DOUBLE_NULL)
+
+/*
+ * min/max of integer types. A NULL row is replaced by the value that never wins, i.e. the initial value of the
+ * accumulator, so min of signed types (the NULL is the minimum value) and max of unsigned types are still right.
+ */
+#define AGG_MINMAX_INT_KERNEL(_name, _type, _null, _tmax, _tmin)                           \
+  static AGG_VEC_TARGET int32_t _name(const void *data, int32_t numOfRows, bool hasNull, bool isMin, _type *res) { \
+    const _type *d = (const _type *)data;                                                  \
+    _type        m = *res;                                                                 \
+    int32_t      num = numOfRows;                                                          \
+    if (!hasNull) {                                                                        \
+      if (isMin) {                                                                         \
+        for (int32_t i = 0; i < numOfRows; ++i) m = (d[i] < m) ? d[i] : m;                 \
+      } else {                                                                             \
+        for (int32_t i = 0; i < numOfRows; ++i) m = (d[i] > m) ? d[i] : m;                 \
+      }                                                                                    \
+    } else {                                                                               \
+      num = 0;                                                                             \
+      if (isMin) {                                                                         \
+        for (int32_t i = 0; i < numOfRows; ++i) {                                          \
+          int32_t nn = AGG_INT_NOTNULL(d[i], (_type)(_null));                              \
+          _type   v = nn ? d[i] : (_type)(_tmax);                                          \
+          m = (v < m) ? v : m;                                                             \
+          num += nn;                                                                       \
+        }                                                                                  \
+      } else {                                                                             \
+        for (int32_t i = 0; i < numOfRows; ++i) {                                          \
+          int32_t nn = AGG_INT_NOTNULL(d[i], (_type)(_null));                              \
+          _type   v = nn ? d[i] : (_type)(_tmin);                                          \
+          m = (v > m) ? v : m;                                                             \
+          num += nn;                                                                       \
+        }                                                                                  \
+      }                                                                                    \
+    }                                                                                      \
+    *res = m;                                                                              \
+    return num;                                                                            \
+  }
+
+AGG_MINMAX_INT_KERNEL(aggMinMaxI8, int8_t, TSDB_DATA_TINYINT_NULL, INT8_MAX, INT8_MIN)
+AGG_MINMAX_INT_KERNEL(aggMinMaxI16, int16_t, TSDB_DATA_SMALLINT_NULL, INT16_MAX, INT16_MIN)
+AGG_MINMAX_INT_KERNEL(aggMinMaxI32, int32_t, TSDB_DATA_INT_NULL, INT32_MAX, INT32_MIN)
+AGG_MINMAX_INT_KERNEL(aggMinMaxI64, int64_t, TSDB_DATA_BIGINT_NULL, INT64_MAX, INT64_MIN)
+AGG_MINMAX_INT_KERNEL(aggMinMaxU8, uint8_t, TSDB_DATA_UTINYINT_NULL, UINT8_MAX, 0)
+AGG_MINMAX_INT_KERNEL(aggMinMaxU16, uint16_t, TSDB_DATA_USMALLINT_NULL, UINT16_MAX, 0)
+AGG_MINMAX_INT_KERNEL(aggMinMaxU32, uint32_t, TSDB_DATA_UINT_NULL, UINT32_MAX, 0)
+AGG_MINMAX_INT_KERNEL(aggMinMaxU64, uint64_t, TSDB_DATA_UBIGINT_NULL, UINT64_MAX, 0)
+
+// min/max of float types, the comparisons are false for a NAN, so neither the NULL nor any other NAN ever wins
+#define AGG_MINMAX_FLT_KERNEL(_name, _type, NN)                                            \
+  static AGG_VEC_TARGET int32_t _name(const void *data, int32_t numOfRows, bool hasNull, bool isMin, _type *res) { \
+    const _type *d = (const _type *)data;                                                  \
+    _type        m[AGG_VEC_LANES];                                                         \
+    int32_t      n[AGG_VEC_LANES] = {0};                                                   \
+    int32_t      i = 0;                                                                    \
+    for (int32_t k = 0; k < AGG_VEC_LANES; ++k) m[k] = *res;                               \
+    if (isMin) {                                                                           \
+      for (; i + AGG_VEC_LANES <= numOfRows; i += AGG_VEC_LANES) {                         \
+        for (int32_t k = 0; k < AGG_VEC_LANES; ++k) {                                      \
+          const _type v = d[i + k];                                                        \
+          m[k] = (v < m[k]) ? v : m[k];                                                    \
+          n[k] += NN(v, 0);                                                                \
+        }                                                                                  \
+      }                                                                                    \
+      for (; i < numOfRows; ++i) {                                                         \
+        m[0] = (d[i] < m[0]) ? d[i] : m[0];                                                \
+        n[0] += NN(d[i], 0);                                                               \
+      }                                                                                    \
+    } else {                                                                               \
+      for (; i + AGG_VEC_LANES <= numOfRows; i += AGG_VEC_LANES) {                         \
+        for (int32_t k = 0; k < AGG_VEC_LANES; ++k) {                                      \
+          const _type v = d[i + k];                                                        \
+          m[k] = (v > m[k]) ? v : m[k];                                                    \
+          n[k] += NN(v, 0);                                                                \
+        }                                                                                  \
+      }                                                                                    \
+      for (; i < numOfRows; ++i) {                                                         \
+        m[0] = (d[i] > m[0]) ? d[i] : m[0];                                                \
+        n[0] += NN(d[i], 0);                                                               \
+      }                                                                                    \
+    }                                                                                      \
+    _type   r = m[0];                                                                      \
+    int32_t num = n[0];                                                                    \
+    for (int32_t k = 1; k < AGG_VEC_LANES; ++k) {                                          \
+      r = isMin ? ((m[k] < r) ? m[k] : r) : ((m[k] > r) ? m[k] : r);                       \
+      num += n[k];                                                                         \
+    }                                                                                      \
+    *res = r;                                                                              \
+    return hasNull ? num : numOfRows;                                                      \
+  }
+
+AGG_MINMAX_FLT_KERNEL(aggMinMaxF32, float, AGG_F32_NOTNULL)
+AGG_MINMAX_FLT_KERNEL(aggMinMaxF64, double, AGG_F64_NOTNULL)
+
+/*
+ * The position of the row that the selectivity functions take the tags and the timestamp from, the same row as the
+ * row by row evaluation ends with: the first row of the maximum, or the last row of the minimum, since a row equal to
+ * the current minimum takes it over. -1 if the result is not updated by the block.
+ */
+#define AGG_FIND_POS(_type, _data, _rows, _old, _new, _isMin, _pos)                        \
+  do {                                                                                     \
+    const _type *_d = (const _type *)(_data);                                              \
+    _type        _o = *(const _type *)(_old);                                              \
+    _type        _v = *(const _type *)(_new);                                              \
+    (_pos) = -1;                                                                           \
+    if (_isMin) {                                                                          \
+      if (_v <= _o) {                                                                      \
+        for (int32_t _i = (_rows) - 1; _i >= 0; --_i) {                                    \
+          if (_d[_i] == _v) {                                                              \
+            (_pos) = _i;                                                                   \
+            break;                                                                         \
+          }                                                                                \
+        }                                                                                  \
+      }                                                                                    \
+    } else if (_v > _o) {                                                                  \
+      for (int32_t _i = 0; _i < (_rows); ++_i) {                                           \
+        if (_d[_i] == _v) {                                                                \
+          (_pos) = _i;                                                                     \
+          break;                                                                           \
+        }                                                                                  \
+      }                                                                                    \
+    }                                                                                      \
+  } while (0)
+
+int32_t aggCountNotNull(const void *data, int32_t type, int32_t numOfRows) {
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:      return aggCountBool(data, numOfRows);
+    case TSDB_DATA_TYPE_TINYINT:   return aggCountI8(data, numOfRows);
+    case TSDB_DATA_TYPE_UTINYINT:  return aggCountU8(data, numOfRows);
+    case TSDB_DATA_TYPE_SMALLINT:  return aggCountI16(data, numOfRows);
+    case TSDB_DATA_TYPE_USMALLINT: return aggCountU16(data, numOfRows);
+    case TSDB_DATA_TYPE_INT:       return aggCountI32(data, numOfRows);
+    case TSDB_DATA_TYPE_UINT:      return aggCountU32(data, numOfRows);
+    case TSDB_DATA_TYPE_FLOAT:     return aggCountF32(data, numOfRows);
+    case TSDB_DATA_TYPE_TIMESTAMP:
+    case TSDB_DATA_TYPE_BIGINT:    return aggCountI64(data, numOfRows);
+    case TSDB_DATA_TYPE_UBIGINT:   return aggCountU64(data, numOfRows);
+    case TSDB_DATA_TYPE_DOUBLE:    return aggCountF64(data, numOfRows);
+    default:                       return -1;
+  }
+}
+
+int32_t aggSumSigned(const void *data, int32_t type, int32_t numOfRows, bool hasNull, int64_t *sum) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TINYINT:  return aggSumI8(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_SMALLINT: return aggSumI16(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_INT:      return aggSumI32(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_BIGINT:   return aggSumI64(data, numOfRows, hasNull, sum);
+    default:                      *sum = 0; return 0;
+  }
+}
+
+int32_t aggSumUnsigned(const void *data, int32_t type, int32_t numOfRows, bool hasNull, uint64_t *sum) {
+  switch (type) {
+    case TSDB_DATA_TYPE_UTINYINT:  return aggSumU8(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_USMALLINT: return aggSumU16(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_UINT:      return aggSumU32(data, numOfRows, hasNull, sum);
+    case TSDB_DATA_TYPE_UBIGINT:   return aggSumU64(data, numOfRows, hasNull, sum);
+    default:                       *sum = 0; return 0;
+  }
+}
+
+int32_t aggSumDouble(const void *data, int32_t type, int32_t numOfRows, double *sum) {
+  switch (type) {
+    case TSDB_DATA_TYPE_FLOAT:   return aggSumDblF32(data, numOfRows, sum);
+    case TSDB_DATA_TYPE_DOUBLE:  return aggSumDblF64(data, numOfRows, sum);
+    case TSDB_DATA_TYPE_BIGINT:  return aggSumDblI64(data, numOfRows, sum);
+    case TSDB_DATA_TYPE_UBIGINT: return aggSumDblU64(data, numOfRows, sum);
+    default:                     *sum = 0; return 0;
+  }
+}
+
+int32_t aggMinMax(const void *data, int32_t type, int32_t numOfRows, bool hasNull, bool isMin, void *res,
+                  int32_t *pos) {
+  char    old[sizeof(int64_t)];
+  int32_t num = 0;
+
+  if (pos != NULL && IS_NUMERIC_TYPE(type)) {
+    memcpy(old, res, tDataTypes[type].bytes);
+  }
+
+#define AGG_MINMAX_CASE(_t, _type, _fn)                                 \
+  case _t:                                                              \
+    num = _fn(data, numOfRows, hasNull, isMin, (_type *)res);           \
+    if (pos != NULL && num > 0) {                                       \
+      AGG_FIND_POS(_type, data, numOfRows, old, res, isMin, *pos);      \
+    }                                                                   \
+    break;
+
+  if (pos != NULL) {
+    *pos = -1;
+  }
+
+  switch (type) {
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_TINYINT, int8_t, aggMinMaxI8)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_SMALLINT, int16_t, aggMinMaxI16)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_INT, int32_t, aggMinMaxI32)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_BIGINT, int64_t, aggMinMaxI64)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_UTINYINT, uint8_t, aggMinMaxU8)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_USMALLINT, uint16_t, aggMinMaxU16)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_UINT, uint32_t, aggMinMaxU32)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_UBIGINT, uint64_t, aggMinMaxU64)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_FLOAT, float, aggMinMaxF32)
+    AGG_MINMAX_CASE(TSDB_DATA_TYPE_DOUBLE, double, aggMinMaxF64)
+    default:
+      break;
+  }
+
+#undef AGG_MINMAX_CASE
+
+  return num;
+}
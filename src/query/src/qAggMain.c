@@ -912,13 +912,17 @@ static void count_function(SQLFunctionCtx *pCtx) {
     numOfElem = pCtx->size - pCtx->preAggVals.statis.numOfNull;
   } else {
     if (pCtx->hasNull) {
-      for (int32_t i = 0; i < pCtx->size; ++i) {
-        char *val = GET_INPUT_DATA(pCtx, i);
-        if (isNull(val, pCtx->inputType)) {
-          continue;
-        }
+      numOfElem = aggCountNotNull(GET_INPUT_DATA_LIST(pCtx), pCtx->inputType, pCtx->size);
+      if (numOfElem < 0) {
+        numOfElem = 0;
+        for (int32_t i = 0; i < pCtx->size; ++i) {
+          char *val = GET_INPUT_DATA(pCtx, i);
+          if (isNull(val, pCtx->inputType)) {
+            continue;
+          }
 
-        numOfElem += 1;
+          numOfElem += 1;
+        }
       }
     } else {
       //when counting on the primary time stamp column and no statistics data is presented, use the size value directly.
@@ -963,40 +967,6 @@ int32_t countRequired(SQLFunctionCtx *pCtx, STimeWindow* w, int32_t colId) {
 int32_t noDataRequired(SQLFunctionCtx *pCtx, STimeWindow* w, int32_t colId) {
   return BLK_DATA_NO_NEEDED;
 }
-#define LIST_ADD_N_DOUBLE_FLOAT(x, ctx, p, t, numOfElem, tsdbType)              \
-  do {                                                                \
-    t *d = (t *)(p);                                               \
-    for (int32_t i = 0; i < (ctx)->size; ++i) {                    \
-      if (((ctx)->hasNull) && isNull((char *)&(d)[i], tsdbType)) { \
-        continue;                                                  \
-      };                                                           \
-      SET_DOUBLE_VAL(&(x) , GET_DOUBLE_VAL(&(x)) + GET_FLOAT_VAL(&(d)[i]));                                               \
-      (numOfElem)++;                                               \
-    }                                                              \
-  } while(0)
-#define LIST_ADD_N_DOUBLE(x, ctx, p, t, numOfElem, tsdbType)              \
-  do {                                                                \
-    t *d = (t *)(p);                                               \
-    for (int32_t i = 0; i < (ctx)->size; ++i) {                    \
-      if (((ctx)->hasNull) && isNull((char *)&(d)[i], tsdbType)) { \
-        continue;                                                  \
-      };                                                           \
-      SET_DOUBLE_VAL(&(x) , (x) + (d)[i]);                                               \
-      (numOfElem)++;                                               \
-    }                                                              \
-  } while(0)
-
-#define LIST_ADD_N(x, ctx, p, t, numOfElem, tsdbType)              \
-  do {                                                                \
-    t *d = (t *)(p);                                               \
-    for (int32_t i = 0; i < (ctx)->size; ++i) {                    \
-      if (((ctx)->hasNull) && isNull((char *)&(d)[i], tsdbType)) { \
-        continue;                                                  \
-      };                                                           \
-      (x) += (d)[i];                                               \
-      (numOfElem)++;                                               \
-    }                                                              \
-  } while(0)
 
 #define UPDATE_DATA(ctx, left, right, num, sign, k) \
   do {                                              \
@@ -1016,22 +986,6 @@ int32_t noDataRequired(SQLFunctionCtx *pCtx, STimeWindow* w, int32_t colId) {
     }                                                       \
   } while (0)
 
-#define LOOPCHECK_N(val, list, ctx, tsdbType, sign, num)          \
-  for (int32_t i = 0; i < ((ctx)->size); ++i) {                   \
-    if ((ctx)->hasNull && isNull((char *)&(list)[i], tsdbType)) { \
-      continue;                                                   \
-    }                                                             \
-    TSKEY key = (ctx)->ptsList != NULL? GET_TS_DATA(ctx, i):0;    \
-    UPDATE_DATA(ctx, val, (list)[i], num, sign, key);             \
-  }
-
-#define TYPED_LOOPCHECK_N(type, data, list, ctx, tsdbType, sign, notNullElems) \
-  do {                                                                         \
-    type *_data = (type *)data;                                                \
-    type *_list = (type *)list;                                                \
-    LOOPCHECK_N(*_data, _list, ctx, tsdbType, sign, notNullElems);             \
-  } while (0)
-
 static void do_sum(SQLFunctionCtx *pCtx) {
   int32_t notNullElems = 0;
 
@@ -1052,38 +1006,20 @@ static void do_sum(SQLFunctionCtx *pCtx) {
     }
   } else {  // computing based on the true data block
     void *pData = GET_INPUT_DATA_LIST(pCtx);
-    notNullElems = 0;
 
     if (IS_SIGNED_NUMERIC_TYPE(pCtx->inputType)) {
-      int64_t *retVal = (int64_t *)pCtx->pOutput;
-
-      if (pCtx->inputType == TSDB_DATA_TYPE_TINYINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, int8_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_SMALLINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, int16_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_INT) {
-        LIST_ADD_N(*retVal, pCtx, pData, int32_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_BIGINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, int64_t, notNullElems, pCtx->inputType);
-      }
+      int64_t sum = 0;
+      notNullElems = aggSumSigned(pData, pCtx->inputType, pCtx->size, pCtx->hasNull, &sum);
+      *(int64_t *)pCtx->pOutput += sum;
     } else if (IS_UNSIGNED_NUMERIC_TYPE(pCtx->inputType)) {
-      uint64_t *retVal = (uint64_t *)pCtx->pOutput;
-
-      if (pCtx->inputType == TSDB_DATA_TYPE_UTINYINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, uint8_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_USMALLINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, uint16_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_UINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, uint32_t, notNullElems, pCtx->inputType);
-      } else if (pCtx->inputType == TSDB_DATA_TYPE_UBIGINT) {
-        LIST_ADD_N(*retVal, pCtx, pData, uint64_t, notNullElems, pCtx->inputType);
-      }
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_DOUBLE) {
-      double *retVal = (double *)pCtx->pOutput;
-      LIST_ADD_N_DOUBLE(*retVal, pCtx, pData, double, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_FLOAT) {
+      uint64_t sum = 0;
+      notNullElems = aggSumUnsigned(pData, pCtx->inputType, pCtx->size, pCtx->hasNull, &sum);
+      *(uint64_t *)pCtx->pOutput += sum;
+    } else if (IS_FLOAT_TYPE(pCtx->inputType)) {
       double *retVal = (double *)pCtx->pOutput;
-      LIST_ADD_N_DOUBLE_FLOAT(*retVal, pCtx, pData, float, notNullElems, pCtx->inputType);
+      double  sum = 0;
+      notNullElems = aggSumDouble(pData, pCtx->inputType, pCtx->size, &sum);
+      SET_DOUBLE_VAL(retVal, *retVal + sum);
     }
   }
 
@@ -1139,6 +1075,7 @@ static void sum_func_merge(SQLFunctionCtx *pCtx) {
   }
 }
 
+// the block statistics, or only the time range of the block as for elapsed and _wstart/_wstop/_wduration, are enough
 static int32_t statisRequired(SQLFunctionCtx *pCtx, STimeWindow* w, int32_t colId) {
   return BLK_DATA_STATIS_NEEDED;
 }
@@ -1259,26 +1196,20 @@ static void avg_function(SQLFunctionCtx *pCtx) {
   } else {
     void *pData = GET_INPUT_DATA_LIST(pCtx);
 
-    if (pCtx->inputType == TSDB_DATA_TYPE_TINYINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, int8_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_SMALLINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, int16_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_INT) {
-      LIST_ADD_N(*pVal, pCtx, pData, int32_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_BIGINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, int64_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_DOUBLE) {
-      LIST_ADD_N_DOUBLE(*pVal, pCtx, pData, double, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_FLOAT) {
-      LIST_ADD_N_DOUBLE_FLOAT(*pVal, pCtx, pData, float, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_UTINYINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, uint8_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_USMALLINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, uint16_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_UINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, uint32_t, notNullElems, pCtx->inputType);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_UBIGINT) {
-      LIST_ADD_N(*pVal, pCtx, pData, uint64_t, notNullElems, pCtx->inputType);
+    // the sum of a block of integers up to 32 bits is exact in int64, the others are summed in double as before
+    if (IS_FLOAT_TYPE(pCtx->inputType) || pCtx->inputType == TSDB_DATA_TYPE_BIGINT ||
+        pCtx->inputType == TSDB_DATA_TYPE_UBIGINT) {
+      double sum = 0;
+      notNullElems = aggSumDouble(pData, pCtx->inputType, pCtx->size, &sum);
+      *pVal += sum;
+    } else if (IS_SIGNED_NUMERIC_TYPE(pCtx->inputType)) {
+      int64_t sum = 0;
+      notNullElems = aggSumSigned(pData, pCtx->inputType, pCtx->size, pCtx->hasNull, &sum);
+      *pVal += (double)sum;
+    } else if (IS_UNSIGNED_NUMERIC_TYPE(pCtx->inputType)) {
+      uint64_t sum = 0;
+      notNullElems = aggSumUnsigned(pData, pCtx->inputType, pCtx->size, pCtx->hasNull, &sum);
+      *pVal += (double)sum;
     }
   }
 
@@ -1452,54 +1383,19 @@ static void minMax_function(SQLFunctionCtx *pCtx, char *pOutput, int32_t isMin,
     return;
   }
 
-  void  *p = GET_INPUT_DATA_LIST(pCtx);
-  TSKEY *tsList = GET_TS_LIST(pCtx);
-
-  *notNullElems = 0;
-
-  if (IS_SIGNED_NUMERIC_TYPE(pCtx->inputType)) {
-    if (pCtx->inputType == TSDB_DATA_TYPE_TINYINT) {
-      TYPED_LOOPCHECK_N(int8_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_SMALLINT) {
-      TYPED_LOOPCHECK_N(int16_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_INT) {
-      int32_t *pData = p;
-      int32_t *retVal = (int32_t*) pOutput;
+  void *p = GET_INPUT_DATA_LIST(pCtx);
 
-      for (int32_t i = 0; i < pCtx->size; ++i) {
-        if (pCtx->hasNull && isNull((const char*)&pData[i], pCtx->inputType)) {
-          continue;
-        }
+  // the tags are only taken from the row of the result of the block, when they are required
+  if (pCtx->tagInfo.numOfTagCols == 0) {
+    *notNullElems = aggMinMax(p, pCtx->inputType, pCtx->size, pCtx->hasNull, isMin, pOutput, NULL);
+    return;
+  }
 
-        if ((*retVal < pData[i]) ^ isMin) {
-          *retVal = pData[i];
-          if(tsList) {
-            TSKEY k = tsList[i];
-            DO_UPDATE_TAG_COLUMNS(pCtx, k);
-          }
-        }
-        *notNullElems += 1;
-      }
-#if defined(_DEBUG_VIEW)
-      qDebug("max value updated:%d", *retVal);
-#endif
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_BIGINT) {
-      TYPED_LOOPCHECK_N(int64_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    }
-  } else if (IS_UNSIGNED_NUMERIC_TYPE(pCtx->inputType)) {
-    if (pCtx->inputType == TSDB_DATA_TYPE_UTINYINT) {
-      TYPED_LOOPCHECK_N(uint8_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_USMALLINT) {
-      TYPED_LOOPCHECK_N(uint16_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_UINT) {
-      TYPED_LOOPCHECK_N(uint32_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    } else if (pCtx->inputType == TSDB_DATA_TYPE_UBIGINT) {
-      TYPED_LOOPCHECK_N(uint64_t, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-    }
-  } else if (pCtx->inputType == TSDB_DATA_TYPE_DOUBLE) {
-    TYPED_LOOPCHECK_N(double, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
-  } else if (pCtx->inputType == TSDB_DATA_TYPE_FLOAT) {
-    TYPED_LOOPCHECK_N(float, pOutput, p, pCtx, pCtx->inputType, isMin, *notNullElems);
+  int32_t pos = -1;
+  *notNullElems = aggMinMax(p, pCtx->inputType, pCtx->size, pCtx->hasNull, isMin, pOutput, &pos);
+  if (pos >= 0) {
+    TSKEY key = (pCtx->ptsList != NULL) ? GET_TS_DATA(pCtx, pos) : 0;
+    DO_UPDATE_TAG_COLUMNS(pCtx, key);
   }
 }
 
@@ -2089,7 +1985,7 @@ static void first_dist_function(SQLFunctionCtx *pCtx) {
    * 1. data block that are not loaded
    * 2. scan data files in desc order
    */
-  if (pCtx->order == TSDB_ORDER_DESC/* || pCtx->preAggVals.dataBlockLoaded == false*/) {
+  if (pCtx->order == TSDB_ORDER_DESC || pCtx->preAggVals.dataBlockLoaded == false) {
     return;
   }
   
@@ -2226,7 +2122,7 @@ static void last_dist_function(SQLFunctionCtx *pCtx) {
    * 1. for scan data is not the required order
    * 2. for data blocks that are not loaded, no need to check data
    */
-  if (pCtx->order != pCtx->param[0].i64) {
+  if (pCtx->order != pCtx->param[0].i64 || pCtx->preAggVals.dataBlockLoaded == false) {
     return;
   }
 
@@ -6035,6 +5931,134 @@ static void window_duration_function(SQLFunctionCtx *pCtx) {
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+bool isIntermediateResultMergeable(int32_t functionId) {
+  switch (functionId) {
+    case TSDB_FUNC_COUNT:
+    case TSDB_FUNC_SUM:
+    case TSDB_FUNC_AVG:
+    case TSDB_FUNC_MIN:
+    case TSDB_FUNC_MAX:
+    case TSDB_FUNC_SPREAD:
+    case TSDB_FUNC_FIRST_DST:
+    case TSDB_FUNC_LAST_DST:
+    case TSDB_FUNC_TAG:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#define MINMAX_INTER_MERGE(_t, _dst, _src, _isMin)               \
+  do {                                                          \
+    _t _s = *(const _t *)(_src);                                \
+    if ((_isMin) ? (_s < *(_t *)(_dst)) : (_s > *(_t *)(_dst))) { \
+      *(_t *)(_dst) = _s;                                       \
+    }                                                           \
+  } while (0)
+
+static void minmax_inter_merge(int16_t type, char *dst, const char *src, bool isMin) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TINYINT:   MINMAX_INTER_MERGE(int8_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_SMALLINT:  MINMAX_INTER_MERGE(int16_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_INT:       MINMAX_INTER_MERGE(int32_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_BIGINT:    MINMAX_INTER_MERGE(int64_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_UTINYINT:  MINMAX_INTER_MERGE(uint8_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_USMALLINT: MINMAX_INTER_MERGE(uint16_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_UINT:      MINMAX_INTER_MERGE(uint32_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_UBIGINT:   MINMAX_INTER_MERGE(uint64_t, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_FLOAT:     MINMAX_INTER_MERGE(float, dst, src, isMin); break;
+    case TSDB_DATA_TYPE_DOUBLE:    MINMAX_INTER_MERGE(double, dst, src, isMin); break;
+    default:
+      break;
+  }
+}
+
+/*
+ * Merge the intermediate result of a super table query kept in the output buffer of the function on the vnode, src into
+ * dst, e.g. the results of the same group from different table partitions. The result is in the same format, so it is
+ * merged again by the client as the result of a vnode. Only the functions of isIntermediateResultMergeable are allowed.
+ */
+void mergeIntermediateResult(int32_t functionId, int16_t inputType, int32_t inputBytes, char *dst, const char *src) {
+  switch (functionId) {
+    case TSDB_FUNC_COUNT: {
+      *(int64_t *)dst += *(const int64_t *)src;
+      break;
+    }
+    case TSDB_FUNC_SUM: {
+      SSumInfo *pDst = (SSumInfo *)dst;
+      const SSumInfo *pSrc = (const SSumInfo *)src;
+      if (pSrc->hasResult != DATA_SET_FLAG) {
+        break;
+      }
+
+      if (pDst->hasResult != DATA_SET_FLAG) {
+        *pDst = *pSrc;
+      } else if (IS_SIGNED_NUMERIC_TYPE(inputType)) {
+        pDst->isum += pSrc->isum;
+      } else if (IS_UNSIGNED_NUMERIC_TYPE(inputType)) {
+        pDst->usum += pSrc->usum;
+      } else {
+        pDst->dsum += pSrc->dsum;
+      }
+      break;
+    }
+    case TSDB_FUNC_AVG: {
+      SAvgInfo *pDst = (SAvgInfo *)dst;
+      const SAvgInfo *pSrc = (const SAvgInfo *)src;
+      if (pSrc->num > 0) {
+        pDst->sum = (pDst->num > 0) ? pDst->sum + pSrc->sum : pSrc->sum;
+        pDst->num += pSrc->num;
+      }
+      break;
+    }
+    case TSDB_FUNC_MIN:
+    case TSDB_FUNC_MAX: {
+      if (src[inputBytes] != DATA_SET_FLAG) {
+        break;
+      }
+
+      if (dst[inputBytes] != DATA_SET_FLAG) {
+        memcpy(dst, src, inputBytes + DATA_SET_FLAG_SIZE);
+      } else {
+        minmax_inter_merge(inputType, dst, src, functionId == TSDB_FUNC_MIN);
+      }
+      break;
+    }
+    case TSDB_FUNC_SPREAD: {
+      SSpreadInfo *pDst = (SSpreadInfo *)dst;
+      const SSpreadInfo *pSrc = (const SSpreadInfo *)src;
+      if (pSrc->hasResult != DATA_SET_FLAG) {
+        break;
+      }
+
+      if (pDst->hasResult != DATA_SET_FLAG) {
+        *pDst = *pSrc;
+      } else {
+        pDst->min = MIN(pDst->min, pSrc->min);
+        pDst->max = MAX(pDst->max, pSrc->max);
+      }
+      break;
+    }
+    case TSDB_FUNC_FIRST_DST:
+    case TSDB_FUNC_LAST_DST: {
+      SFirstLastInfo *pDst = (SFirstLastInfo *)(dst + inputBytes);
+      const SFirstLastInfo *pSrc = (const SFirstLastInfo *)(src + inputBytes);
+      if (pSrc->hasResult != DATA_SET_FLAG) {
+        break;
+      }
+
+      if (pDst->hasResult != DATA_SET_FLAG || (functionId == TSDB_FUNC_FIRST_DST && pSrc->ts < pDst->ts) ||
+          (functionId == TSDB_FUNC_LAST_DST && pSrc->ts > pDst->ts)) {
+        memcpy(dst, src, inputBytes + sizeof(SFirstLastInfo));
+      }
+      break;
+    }
+    default:  // the tags are the same for all the tables of a group
+      break;
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 /*
  * function compatible list.
@@ -6516,7 +6540,7 @@ SAggFunctionInfo aAggs[TSDB_FUNC_MAX_NUM] = {{
                               elapsedFunction,
                               elapsedFinalizer,
                               elapsedMerge,
-                              dataBlockRequired,
+                              statisRequired,
                           },
                           {
                               //38
@@ -6600,7 +6624,7 @@ SAggFunctionInfo aAggs[TSDB_FUNC_MAX_NUM] = {{
                               window_start_function,
                               doFinalizer,
                               copy_function,
-                              dataBlockRequired,
+                              statisRequired,
                           },
                           {
                               // 45
@@ -6612,7 +6636,7 @@ SAggFunctionInfo aAggs[TSDB_FUNC_MAX_NUM] = {{
                               window_stop_function,
                               doFinalizer,
                               copy_function,
-                              dataBlockRequired,
+                              statisRequired,
                           },
                           {
                               // 46
@@ -6624,7 +6648,7 @@ SAggFunctionInfo aAggs[TSDB_FUNC_MAX_NUM] = {{
                               window_duration_function,
                               doFinalizer,
                               copy_function,
-                              dataBlockRequired,
+                              statisRequired,
                           },
                           {
                               // 47
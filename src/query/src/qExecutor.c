@@ -33,6 +33,7 @@
 #include "cJSON.h"
 #include "tsdbMeta.h"
 #include "tscUtil.h"
+#include "tsched.h"
 
 #define IS_MASTER_SCAN(runtime)        ((runtime)->scanFlag == MASTER_SCAN)
 #define IS_REVERSE_SCAN(runtime)       ((runtime)->scanFlag == REVERSE_SCAN)
@@ -47,6 +48,8 @@
 
 #define MULTI_KEY_DELIM  "-"
 
+#define ORDER_SORT_PAGE_SIZE (64 * 1024)
+
 enum {
   TS_JOIN_TS_EQUAL       = 0,
   TS_JOIN_TS_NOT_EQUALS  = 1,
@@ -231,6 +234,9 @@ static void destroyGroupbyOperatorInfo(void* param, int32_t numOfOutput);
 static void destroyProjectOperatorInfo(void* param, int32_t numOfOutput);
 static void destroyTagScanOperatorInfo(void* param, int32_t numOfOutput);
 static void destroyOrderOperatorInfo(void* param, int32_t numOfOutput);
+static void destroyTopNOperatorInfo(void* param, int32_t numOfOutput);
+static void destroyPartitionAggOperatorInfo(void* param, int32_t numOfOutput);
+static void doDestroyTableGroupList(SArray* pGroupList);
 static void destroySWindowOperatorInfo(void* param, int32_t numOfOutput);
 static void destroyStateWindowOperatorInfo(void* param, int32_t numOfOutput);
 static void destroyAggOperatorInfo(void* param, int32_t numOfOutput);
@@ -457,7 +463,72 @@ static bool isProjQuery(SQueryAttr *pQueryAttr) {
   return true;
 }
 
-static bool hasNull(SColIndex* pColIndex, SDataStatis *pStatis) {
+// the flag is settled once a null and a non-null value are found, only the columns without null are scanned to the end
+#define SCAN_COL_NULL_FLAG(_t, _nullv, _data, _rows, _flag)        \
+  do {                                                             \
+    const _t *_p = (const _t *)(_data);                            \
+    bool      _n = (_p[0] == (_t)(_nullv));                        \
+    (_flag) = _n ? COL_ALL_NULL : COL_HAS_NO_NULL;                 \
+    for (int32_t _r = 1; _r < (_rows); ++_r) {                     \
+      if ((_p[_r] == (_t)(_nullv)) != _n) {                        \
+        (_flag) = COL_HAS_NULL;                                    \
+        break;                                                     \
+      }                                                            \
+    }                                                              \
+  } while (0)
+
+static uint8_t scanColumnNullFlag(SColumnInfoData* pColInfo, int32_t numOfRows) {
+  uint8_t flag = COL_NULL_UNKNOWN;
+
+  switch (pColInfo->info.type) {
+    case TSDB_DATA_TYPE_BOOL:      SCAN_COL_NULL_FLAG(uint8_t, TSDB_DATA_BOOL_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_TINYINT:   SCAN_COL_NULL_FLAG(uint8_t, TSDB_DATA_TINYINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_UTINYINT:  SCAN_COL_NULL_FLAG(uint8_t, TSDB_DATA_UTINYINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_SMALLINT:  SCAN_COL_NULL_FLAG(uint16_t, TSDB_DATA_SMALLINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_USMALLINT: SCAN_COL_NULL_FLAG(uint16_t, TSDB_DATA_USMALLINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_INT:       SCAN_COL_NULL_FLAG(uint32_t, TSDB_DATA_INT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_UINT:      SCAN_COL_NULL_FLAG(uint32_t, TSDB_DATA_UINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_FLOAT:     SCAN_COL_NULL_FLAG(uint32_t, TSDB_DATA_FLOAT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP: SCAN_COL_NULL_FLAG(uint64_t, TSDB_DATA_BIGINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_UBIGINT:   SCAN_COL_NULL_FLAG(uint64_t, TSDB_DATA_UBIGINT_NULL, pColInfo->pData, numOfRows, flag); break;
+    case TSDB_DATA_TYPE_DOUBLE:    SCAN_COL_NULL_FLAG(uint64_t, TSDB_DATA_DOUBLE_NULL, pColInfo->pData, numOfRows, flag); break;
+    default: {
+      bool n = isNull(pColInfo->pData, pColInfo->info.type);
+      flag = n ? COL_ALL_NULL : COL_HAS_NO_NULL;
+      for (int32_t r = 1; r < numOfRows; ++r) {
+        if (isNull(pColInfo->pData + (size_t)r * pColInfo->info.bytes, pColInfo->info.type) != n) {
+          flag = COL_HAS_NULL;
+          break;
+        }
+      }
+    }
+  }
+
+  return flag;
+}
+
+/*
+ * Get the null flag of a column in the current block. It is taken from the block statistics if there are, otherwise
+ * the column is scanned once, and the flag is kept in the column until the next block is retrieved.
+ */
+uint8_t getColumnNullFlag(SColumnInfoData* pColInfo, SDataStatis* pStatis, int32_t numOfRows) {
+  if (pColInfo->nullFlag != COL_NULL_UNKNOWN || numOfRows <= 0 || pColInfo->pData == NULL) {
+    return pColInfo->nullFlag;
+  }
+
+  if (pStatis != NULL) {
+    pColInfo->nullFlag = (pStatis->numOfNull == 0)           ? COL_HAS_NO_NULL
+                         : (pStatis->numOfNull == numOfRows) ? COL_ALL_NULL
+                                                             : COL_HAS_NULL;
+  } else {
+    pColInfo->nullFlag = scanColumnNullFlag(pColInfo, numOfRows);
+  }
+
+  return pColInfo->nullFlag;
+}
+
+static bool hasNull(SColIndex* pColIndex, SDataStatis *pStatis, SColumnInfoData* pColInfo, int32_t numOfRows) {
   if (TSDB_COL_IS_TAG(pColIndex->flag) || TSDB_COL_IS_UD_COL(pColIndex->flag) ||
       TSDB_COL_IS_TSWIN_COL(pColIndex->colId) || pColIndex->colId == PRIMARYKEY_TIMESTAMP_COL_INDEX) {
     return false;
@@ -467,6 +538,11 @@ static bool hasNull(SColIndex* pColIndex, SDataStatis *pStatis) {
     return false;
   }
 
+  // no statistics for data from cache or a mixed block, the null flag of the column is used instead
+  if (pColInfo != NULL && getColumnNullFlag(pColInfo, NULL, numOfRows) == COL_HAS_NO_NULL) {
+    return false;
+  }
+
   return true;
 }
 
@@ -496,8 +572,86 @@ static void prepareResultListBuffer(SResultRowInfo* pResultRowInfo, SQueryRuntim
   pResultRowInfo->capacity = (int32_t)newCapacity;
 }
 
+static SResultRow* doSetResultOutBufByWindow(SQueryRuntimeEnv* pRuntimeEnv, SResultRowInfo* pResultRowInfo, int64_t tid,
+                                             TSKEY skey, bool masterscan, uint64_t tableGroupId) {
+  // time windows are mostly visited in order, so check the current one before any hash lookup
+  if (pResultRowInfo->curPos >= 0 && pResultRowInfo->curPos < pResultRowInfo->size &&
+      pResultRowInfo->pResult[pResultRowInfo->curPos]->win.skey == skey) {
+    return pResultRowInfo->pResult[pResultRowInfo->curPos];
+  }
+
+  bool existed = false;
+  int64_t* p1 = resultRowHashGet(&pRuntimeEnv->winRowHash, tableGroupId, 0, skey);
+
+  // in case of repeat scan/reverse scan, no new time window added.
+  if (!masterscan) {  // the *p1 may be NULL in case of sliding+offset exists.
+    return (p1 != NULL)? (SResultRow*)(intptr_t)(*p1):NULL;
+  }
+
+  if (p1 != NULL) {
+    if (pResultRowInfo->size == 0) {
+      existed = false;
+      assert(pResultRowInfo->curPos == -1);
+    } else if (pResultRowInfo->size == 1) {
+      existed = (pResultRowInfo->pResult[0] == (SResultRow*)(intptr_t)(*p1));
+      pResultRowInfo->curPos = 0;
+    } else {  // check if current pResultRowInfo contains the existed pResultRow
+      int64_t* index = resultRowHashGet(&pRuntimeEnv->winRowIndex, (uint64_t)(uintptr_t)pResultRowInfo, tid, skey);
+      if (index != NULL) {
+        pResultRowInfo->curPos = (int32_t) *index;
+        existed = true;
+      } else {
+        existed = false;
+      }
+    }
+  }
+
+  if (!existed) {
+    prepareResultListBuffer(pResultRowInfo, pRuntimeEnv);
+
+    SResultRow *pResult = NULL;
+    if (p1 == NULL) {
+      pResult = getNewResultRow(pRuntimeEnv->pool);
+      int32_t ret = initResultRow(pResult);
+      if (ret != TSDB_CODE_SUCCESS) {
+        longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+      }
+
+      // add a new result set for a new group
+      if (resultRowHashPut(&pRuntimeEnv->winRowHash, tableGroupId, 0, skey, (int64_t)(intptr_t)pResult) != TSDB_CODE_SUCCESS) {
+        longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+      }
+
+      SResultRowCell cell = {.groupId = tableGroupId, .pRow = pResult};
+      taosArrayPush(pRuntimeEnv->pResultRowArrayList, &cell);
+    } else {
+      pResult = (SResultRow*)(intptr_t)(*p1);
+    }
+
+    pResultRowInfo->curPos = pResultRowInfo->size;
+    pResultRowInfo->pResult[pResultRowInfo->size++] = pResult;
+
+    if (resultRowHashPut(&pRuntimeEnv->winRowIndex, (uint64_t)(uintptr_t)pResultRowInfo, tid, skey,
+                         pResultRowInfo->curPos) != TSDB_CODE_SUCCESS) {
+      longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+    }
+  }
+
+  // too many time window in query
+  if (pResultRowInfo->size > MAX_INTERVAL_TIME_WINDOW) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_TOO_MANY_TIMEWINDOW);
+  }
+
+  return pResultRowInfo->pResult[pResultRowInfo->curPos];
+}
+
 static SResultRow* doSetResultOutBufByKey(SQueryRuntimeEnv* pRuntimeEnv, SResultRowInfo* pResultRowInfo, int64_t tid,
                                           char* pData, int16_t bytes, bool masterscan, uint64_t tableGroupId) {
+  // the keys of time windows are the start keys, group by keys always end with the delimiter
+  if (QUERY_IS_INTERVAL_QUERY(pRuntimeEnv->pQueryAttr) && bytes == TSDB_KEYSIZE) {
+    return doSetResultOutBufByWindow(pRuntimeEnv, pResultRowInfo, tid, GET_INT64_VAL(pData), masterscan, tableGroupId);
+  }
+
   bool existed = false;
   SET_RES_WINDOW_KEY(pRuntimeEnv->keyBuf, pData, bytes, tableGroupId);
 
@@ -1597,10 +1751,6 @@ static bool initGroupbyInfo(const SSDataBlock *pSDataBlock, const SGroupbyExpr *
     for (int32_t i = 0; i < pSDataBlock->info.numOfCols; ++i) {
       SColumnInfoData* pColInfo = taosArrayGet(pSDataBlock->pDataBlock, i);
       if (pColInfo->info.colId == pColIndex->colId) {
-        int32_t type = pColInfo->info.type;
-        if (type == TSDB_DATA_TYPE_FLOAT || type == TSDB_DATA_TYPE_DOUBLE) {
-          return false;
-        }
         pInfo->totalBytes += pColInfo->info.bytes;
 
         SGroupbyDataInfo info =  {.index = i, .type = pColInfo->info.type, .bytes = pColInfo->info.bytes};
@@ -1615,21 +1765,55 @@ static bool initGroupbyInfo(const SSDataBlock *pSDataBlock, const SGroupbyExpr *
   }
   pInfo->totalBytes += (int32_t)strlen(MULTI_KEY_DELIM) * pGroupbyExpr->numOfGroupCols;
 
+  // one or two fixed-width columns are hashed by value, without comparing the packed keys
+  size_t numOfCols = taosArrayGetSize(pInfo->pGroupbyDataInfo);
+  pInfo->fixedKey = (numOfCols > 0 && numOfCols <= 2);
+  for (int32_t i = 0; i < numOfCols; i++) {
+    SGroupbyDataInfo *pDataInfo = taosArrayGet(pInfo->pGroupbyDataInfo, i);
+    if (IS_VAR_DATA_TYPE(pDataInfo->type) || pDataInfo->bytes > sizeof(int64_t)) {
+      pInfo->fixedKey = false;
+    }
+  }
+
   return true;
 }
 
-static void buildGroupbyKeyBuf(const SSDataBlock *pSDataBlock, SGroupbyOperatorInfo *pInfo, int32_t rowId, char **buf) {
-  char *p = calloc(1, pInfo->totalBytes);
-  if (p == NULL) {
-    *buf = NULL;
-    return;
+static FORCE_INLINE int64_t getGroupbyFixedKey(const char *val, int32_t type, int32_t bytes) {
+  int64_t k = 0;
+  if (type == TSDB_DATA_TYPE_FLOAT) {
+    float f = GET_FLOAT_VAL(val);
+    if (f == 0) {  // -0.0 and 0.0 belong to the same group
+      f = 0;
+    }
+    memcpy(&k, &f, sizeof(f));
+  } else if (type == TSDB_DATA_TYPE_DOUBLE) {
+    double d = GET_DOUBLE_VAL(val);
+    if (d == 0) {
+      d = 0;
+    }
+    memcpy(&k, &d, sizeof(d));
+  } else {
+    memcpy(&k, val, bytes);
   }
-  *buf  = p;
+
+  return k;
+}
+
+static FORCE_INLINE uint32_t groupbyFixedKeyHash(int64_t k0, int64_t k1, uint8_t nullMask) {
+  uint64_t h = (uint64_t)k0 * 0x9E3779B97F4A7C15ULL;
+  h ^= ((uint64_t)k1 + nullMask) * 0xC2B2AE3D27D4EB4FULL;
+  h ^= (h >> 29);
+  return (uint32_t)h;
+}
+
+// the packed key is the key of the result row in pResultRowHashTable, the buffer holds totalBytes
+static void packGroupbyKey(const SSDataBlock *pSDataBlock, SGroupbyOperatorInfo *pInfo, int32_t rowId, char *p) {
+  memset(p, 0, pInfo->totalBytes);
+
   for (int32_t i = 0; i < taosArrayGetSize(pInfo->pGroupbyDataInfo); i++) {
     SGroupbyDataInfo *pDataInfo = taosArrayGet(pInfo->pGroupbyDataInfo, i);
 
     SColumnInfoData* pColData = taosArrayGet(pSDataBlock->pDataBlock, pDataInfo->index);
-    //TODO(yihaoDeng): handle float & double
     char *val = ((char *)pColData->pData) + pDataInfo->bytes * rowId;
     if (isNull(val, pDataInfo->type)) {
       p += pDataInfo->bytes;
@@ -1638,6 +1822,10 @@ static void buildGroupbyKeyBuf(const SSDataBlock *pSDataBlock, SGroupbyOperatorI
     if (IS_VAR_DATA_TYPE(pDataInfo->type)) {
       memcpy(p, varDataVal(val), varDataLen(val));
       p +=  varDataLen(val);
+    } else if (pDataInfo->type == TSDB_DATA_TYPE_FLOAT || pDataInfo->type == TSDB_DATA_TYPE_DOUBLE) {
+      int64_t k = getGroupbyFixedKey(val, pDataInfo->type, pDataInfo->bytes);
+      memcpy(p, &k, pDataInfo->bytes);
+      p += pDataInfo->bytes;
     } else {
       memcpy(p, val, pDataInfo->bytes);
       p += pDataInfo->bytes;
@@ -1648,96 +1836,321 @@ static void buildGroupbyKeyBuf(const SSDataBlock *pSDataBlock, SGroupbyOperatorI
   }
 }
 
-static bool isGroupbyKeyEqual(void *a, void *b, void *ext) {
-  SGroupbyOperatorInfo *pInfo = (SGroupbyOperatorInfo *)ext;
-  if (memcmp(a, b, pInfo->totalBytes) == 0) {
-    return true;
+static int32_t ensureGroupbyBufCapacity(SGroupbyOperatorInfo *pInfo, int32_t numOfRows) {
+  if (numOfRows <= pInfo->capacity) {
+    return TSDB_CODE_SUCCESS;
   }
-  int32_t offset = 0;
-  for (int32_t i = 0; i < taosArrayGetSize(pInfo->pGroupbyDataInfo); i++) {
-    SGroupbyDataInfo *pDataInfo = taosArrayGet(pInfo->pGroupbyDataInfo, i);
 
-    char *k1 = (char *)a + offset;
-    char *k2 = (char *)b + offset;
-    if (getComparFunc(pDataInfo->type, 0)(k1, k2) != 0) {
-       return false;
+  int32_t capacity = MAX(pInfo->capacity, 1024);
+  while (capacity < numOfRows) {
+    capacity <<= 1;
+  }
+
+  char    *keyBuf    = realloc(pInfo->keyBuf, (size_t)capacity * pInfo->totalBytes);
+  int64_t *groupKey  = realloc(pInfo->groupKey, sizeof(int64_t) * 2 * capacity);
+  uint8_t *groupNull = realloc(pInfo->groupNull, sizeof(uint8_t) * capacity);
+  int32_t *rowGroup  = realloc(pInfo->rowGroup, sizeof(int32_t) * capacity);
+  int32_t *groupRows = realloc(pInfo->groupRows, sizeof(int32_t) * capacity);
+  int32_t *rowOrder  = realloc(pInfo->rowOrder, sizeof(int32_t) * capacity);
+  int32_t *slots     = realloc(pInfo->slots, sizeof(int32_t) * 2 * capacity);
+
+  if (keyBuf != NULL) pInfo->keyBuf = keyBuf;
+  if (groupKey != NULL) pInfo->groupKey = groupKey;
+  if (groupNull != NULL) pInfo->groupNull = groupNull;
+  if (rowGroup != NULL) pInfo->rowGroup = rowGroup;
+  if (groupRows != NULL) pInfo->groupRows = groupRows;
+  if (rowOrder != NULL) pInfo->rowOrder = rowOrder;
+  if (slots != NULL) pInfo->slots = slots;
+
+  if (keyBuf == NULL || groupKey == NULL || groupNull == NULL || rowGroup == NULL || groupRows == NULL ||
+      rowOrder == NULL || slots == NULL) {
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  // the gathered block is created again with the new capacity
+  pInfo->pSortedBlock = destroyOutputBuf(pInfo->pSortedBlock);
+  pInfo->capacity = capacity;
+  return TSDB_CODE_SUCCESS;
+}
+
+/*
+ * The first pass over the block: assign a block local group id to each row. The packed key of a new group is
+ * built in the slot of keyBuf of the group id, so the keys of all groups of the block stay in place without any
+ * allocation. Rows that have the same key as the previous row skip the hash table lookup.
+ */
+static int32_t assignGroupbyRows(SGroupbyOperatorInfo *pInfo, const SSDataBlock *pSDataBlock, int32_t *numOfRuns) {
+  int32_t numOfRows = pSDataBlock->info.rows;
+  int32_t numOfGroups = 0;
+  int32_t prevGroup = -1;
+
+  uint32_t numOfSlots = 2;
+  while (numOfSlots < (uint32_t)numOfRows * 2) {
+    numOfSlots <<= 1;
+  }
+  uint32_t mask = numOfSlots - 1;
+  memset(pInfo->slots, 0xff, sizeof(int32_t) * numOfSlots);
+
+  *numOfRuns = 0;
+
+  if (pInfo->fixedKey) {
+    SGroupbyDataInfo *pInfo0 = taosArrayGet(pInfo->pGroupbyDataInfo, 0);
+    SGroupbyDataInfo *pInfo1 = (taosArrayGetSize(pInfo->pGroupbyDataInfo) > 1)? taosArrayGet(pInfo->pGroupbyDataInfo, 1):NULL;
+
+    SColumnInfoData *pCol0 = taosArrayGet(pSDataBlock->pDataBlock, pInfo0->index);
+    SColumnInfoData *pCol1 = (pInfo1 != NULL)? taosArrayGet(pSDataBlock->pDataBlock, pInfo1->index):NULL;
+
+    int64_t pk0 = 0, pk1 = 0;
+    uint8_t pnull = 0;
+    for (int32_t j = 0; j < numOfRows; ++j) {
+      int64_t k0 = 0, k1 = 0;
+      uint8_t nullMask = 0;
+
+      const char *v0 = pCol0->pData + (size_t)pInfo0->bytes * j;
+      if (isNull(v0, pInfo0->type)) {
+        nullMask |= 1;
+      } else {
+        k0 = getGroupbyFixedKey(v0, pInfo0->type, pInfo0->bytes);
+      }
+
+      if (pCol1 != NULL) {
+        const char *v1 = pCol1->pData + (size_t)pInfo1->bytes * j;
+        if (isNull(v1, pInfo1->type)) {
+          nullMask |= 2;
+        } else {
+          k1 = getGroupbyFixedKey(v1, pInfo1->type, pInfo1->bytes);
+        }
+      }
+
+      if (prevGroup < 0 || k0 != pk0 || k1 != pk1 || nullMask != pnull) {
+        uint32_t h = groupbyFixedKeyHash(k0, k1, nullMask) & mask;
+        while (1) {
+          int32_t g = pInfo->slots[h];
+          if (g < 0) {
+            g = numOfGroups++;
+            pInfo->slots[h] = g;
+            pInfo->groupKey[2 * g] = k0;
+            pInfo->groupKey[2 * g + 1] = k1;
+            pInfo->groupNull[g] = nullMask;
+            pInfo->groupRows[g] = 0;
+            packGroupbyKey(pSDataBlock, pInfo, j, pInfo->keyBuf + (size_t)g * pInfo->totalBytes);
+            prevGroup = g;
+            break;
+          }
+
+          if (pInfo->groupKey[2 * g] == k0 && pInfo->groupKey[2 * g + 1] == k1 && pInfo->groupNull[g] == nullMask) {
+            prevGroup = g;
+            break;
+          }
+
+          h = (h + 1) & mask;
+        }
+
+        pk0 = k0;
+        pk1 = k1;
+        pnull = nullMask;
+        (*numOfRuns)++;
+      }
+
+      pInfo->rowGroup[j] = prevGroup;
+      pInfo->groupRows[prevGroup]++;
+    }
+  } else {
+    for (int32_t j = 0; j < numOfRows; ++j) {
+      // the key is packed into the slot of the next new group, and is kept only if no group matches
+      char *key = pInfo->keyBuf + (size_t)numOfGroups * pInfo->totalBytes;
+      packGroupbyKey(pSDataBlock, pInfo, j, key);
+
+      if (prevGroup < 0 || memcmp(pInfo->keyBuf + (size_t)prevGroup * pInfo->totalBytes, key, pInfo->totalBytes) != 0) {
+        uint32_t h = MurmurHash3_32(key, pInfo->totalBytes) & mask;
+        while (1) {
+          int32_t g = pInfo->slots[h];
+          if (g < 0) {
+            g = numOfGroups++;
+            pInfo->slots[h] = g;
+            pInfo->groupRows[g] = 0;
+            prevGroup = g;
+            break;
+          }
+
+          if (memcmp(pInfo->keyBuf + (size_t)g * pInfo->totalBytes, key, pInfo->totalBytes) == 0) {
+            prevGroup = g;
+            break;
+          }
+
+          h = (h + 1) & mask;
+        }
+
+        (*numOfRuns)++;
+      }
+
+      pInfo->rowGroup[j] = prevGroup;
+      pInfo->groupRows[prevGroup]++;
     }
-    offset += pDataInfo->bytes;
-    offset += (int32_t)strlen(MULTI_KEY_DELIM);
   }
-  return true;
+
+  return numOfGroups;
+}
+
+static void gatherGroupbyColumn(char *dst, const char *src, int32_t bytes, const int32_t *rowOrder, int32_t numOfRows) {
+  switch (bytes) {
+    case 1:
+      for (int32_t i = 0; i < numOfRows; ++i) ((int8_t *)dst)[i] = ((const int8_t *)src)[rowOrder[i]];
+      break;
+    case 2:
+      for (int32_t i = 0; i < numOfRows; ++i) ((int16_t *)dst)[i] = ((const int16_t *)src)[rowOrder[i]];
+      break;
+    case 4:
+      for (int32_t i = 0; i < numOfRows; ++i) ((int32_t *)dst)[i] = ((const int32_t *)src)[rowOrder[i]];
+      break;
+    case 8:
+      for (int32_t i = 0; i < numOfRows; ++i) ((int64_t *)dst)[i] = ((const int64_t *)src)[rowOrder[i]];
+      break;
+    default:
+      for (int32_t i = 0; i < numOfRows; ++i) {
+        memcpy(dst + (size_t)i * bytes, src + (size_t)rowOrder[i] * bytes, bytes);
+      }
+  }
+}
+
+// copy the rows of the block into pSortedBlock in the order of rowOrder, so each group is a contiguous range
+static SSDataBlock *gatherGroupbyRows(SGroupbyOperatorInfo *pInfo, const SSDataBlock *pSDataBlock) {
+  SSDataBlock *pBlock = pInfo->pSortedBlock;
+  if (pBlock != NULL && pBlock->info.numOfCols != pSDataBlock->info.numOfCols) {
+    pBlock = pInfo->pSortedBlock = destroyOutputBuf(pBlock);
+  }
+
+  if (pBlock == NULL) {
+    pBlock = calloc(1, sizeof(SSDataBlock));
+    if (pBlock == NULL) {
+      return NULL;
+    }
+
+    pBlock->pDataBlock = taosArrayInit(pSDataBlock->info.numOfCols, sizeof(SColumnInfoData));
+    for (int32_t i = 0; i < pSDataBlock->info.numOfCols; ++i) {
+      SColumnInfoData *pSrc = taosArrayGet(pSDataBlock->pDataBlock, i);
+
+      SColumnInfoData col = {.info = pSrc->info};
+      col.pData = malloc((size_t)pInfo->capacity * pSrc->info.bytes);
+      if (col.pData == NULL) {
+        return destroyOutputBuf(pBlock);
+      }
+
+      taosArrayPush(pBlock->pDataBlock, &col);
+      pBlock->info.numOfCols += 1;
+    }
+
+    pInfo->pSortedBlock = pBlock;
+  }
+
+  SDataBlockInfo info = pSDataBlock->info;
+  pBlock->info = info;
+
+  for (int32_t i = 0; i < pSDataBlock->info.numOfCols; ++i) {
+    SColumnInfoData *pSrc = taosArrayGet(pSDataBlock->pDataBlock, i);
+    SColumnInfoData *pDst = taosArrayGet(pBlock->pDataBlock, i);
+
+    pDst->info = pSrc->info;
+    pDst->nullFlag = pSrc->nullFlag;  // the flag holds for any order of the rows
+    gatherGroupbyColumn(pDst->pData, pSrc->pData, pSrc->info.bytes, pInfo->rowOrder, info.rows);
+  }
+
+  return pBlock;
+}
+
+static void doGroupbyAggImpl(SOperatorInfo *pOperator, SGroupbyOperatorInfo *pInfo, int32_t groupId, int32_t start,
+                             int32_t num, TSKEY *tsList, int32_t numOfRows) {
+  SQueryRuntimeEnv *pRuntimeEnv = pOperator->pRuntimeEnv;
+  SQueryAttr       *pQueryAttr = pRuntimeEnv->pQueryAttr;
+
+  STimeWindow w = TSWINDOW_INITIALIZER;
+
+  pInfo->prevData = pInfo->keyBuf + (size_t)groupId * pInfo->totalBytes;
+  if (pQueryAttr->stableQuery && pQueryAttr->stabledev && (pRuntimeEnv->prevResult != NULL)) {
+    setParamForStableStddevByColData(pRuntimeEnv, pInfo->binfo.pCtx, pOperator->numOfOutput, pOperator->pExpr, pInfo);
+  }
+
+  int32_t ret = setGroupResultOutputBuf(pRuntimeEnv, &(pInfo->binfo), pOperator->numOfOutput, pInfo->prevData, 0,
+                                        pInfo->totalBytes, pRuntimeEnv->current->groupIndex);
+  if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_APP_ERROR);
+  }
+
+  int32_t offset = QUERY_IS_ASC_QUERY(pQueryAttr) ? start : start + num - 1;
+  doApplyFunctions(pRuntimeEnv, pInfo->binfo.pCtx, &w, offset, num, tsList, numOfRows, pOperator->numOfOutput);
 }
 
+/*
+ * Two passes over the block: the first one assigns a group to each row, the second one aggregates each group with
+ * a single lookup of its result row. If the rows of each group are adjacent, the groups are aggregated in place,
+ * otherwise the rows are gathered into a block ordered by group first.
+ */
 static void doHashGroupbyAgg(SOperatorInfo* pOperator, SGroupbyOperatorInfo *pInfo, SSDataBlock *pSDataBlock) {
   SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
-  STableQueryInfo*  item = pRuntimeEnv->current;
-
-  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
 
   if (!initGroupbyInfo(pSDataBlock, pRuntimeEnv->pQueryAttr->pGroupbyExpr, pInfo)) {
-    qError("QInfo:0x%"PRIx64" group by not supported on double/float columns, abort", GET_QID(pRuntimeEnv));
+    qError("QInfo:0x%"PRIx64" group by column not found in data block, abort", GET_QID(pRuntimeEnv));
     return;
   }
-  //realloc pRuntimeEnv->keyBuf
-  pRuntimeEnv->keyBuf = realloc(pRuntimeEnv->keyBuf, pInfo->totalBytes + sizeof(int64_t) + POINTER_BYTES);
 
-  SColumnInfoData* pFirstColData = taosArrayGet(pSDataBlock->pDataBlock, 0);
-  int64_t* tsList = (pFirstColData->info.type == TSDB_DATA_TYPE_TIMESTAMP)? (int64_t*) pFirstColData->pData:NULL;
+  int32_t numOfRows = pSDataBlock->info.rows;
+  if (numOfRows <= 0) {
+    return;
+  }
 
-  STimeWindow w = TSWINDOW_INITIALIZER;
+  //realloc pRuntimeEnv->keyBuf
+  pRuntimeEnv->keyBuf = realloc(pRuntimeEnv->keyBuf, pInfo->totalBytes + sizeof(int64_t) + POINTER_BYTES);
+  if (ensureGroupbyBufCapacity(pInfo, numOfRows) != TSDB_CODE_SUCCESS) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+  }
 
-  char *key = NULL;
-  int16_t num = 0;
-  int32_t type = 0;
-  for (int32_t j = 0; j < pSDataBlock->info.rows; ++j) {
-    buildGroupbyKeyBuf(pSDataBlock, pInfo, j, &key);
-    if (!key)  { continue; }
+  int32_t numOfRuns = 0;
+  int32_t numOfGroups = assignGroupbyRows(pInfo, pSDataBlock, &numOfRuns);
 
-    if (pInfo->prevData == NULL) {
-      // first row of
-      pInfo->prevData = key;
-      num++;
-      continue;
-    } else if (isGroupbyKeyEqual(pInfo->prevData, key, pInfo)) {
-      num++;
-      tfree(key);
-      continue;
-    }
+  if (numOfRuns == numOfGroups) {
+    SColumnInfoData* pFirstColData = taosArrayGet(pSDataBlock->pDataBlock, 0);
+    int64_t* tsList = (pFirstColData->info.type == TSDB_DATA_TYPE_TIMESTAMP)? (int64_t*) pFirstColData->pData:NULL;
 
-    if (pQueryAttr->stableQuery && pQueryAttr->stabledev && (pRuntimeEnv->prevResult != NULL)) {
-      setParamForStableStddevByColData(pRuntimeEnv, pInfo->binfo.pCtx, pOperator->numOfOutput, pOperator->pExpr, pInfo);
+    int32_t num = 0;
+    for (int32_t j = 0; j < numOfRows; j += num) {
+      int32_t g = pInfo->rowGroup[j];
+      num = pInfo->groupRows[g];
+      doGroupbyAggImpl(pOperator, pInfo, g, j, num, tsList, numOfRows);
     }
 
-    int32_t ret = setGroupResultOutputBuf(pRuntimeEnv, &(pInfo->binfo), pOperator->numOfOutput, pInfo->prevData, type, pInfo->totalBytes, item->groupIndex);
-    if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
-      longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_APP_ERROR);
-    }
+    pInfo->prevData = NULL;
+    return;
+  }
 
-    doApplyFunctions(pRuntimeEnv, pInfo->binfo.pCtx, &w, j - num, num, tsList, pSDataBlock->info.rows, pOperator->numOfOutput);
+  // stable counting sort of the rows by group, groupRows[g] ends up as the end offset of group g
+  int32_t offset = 0;
+  for (int32_t g = 0; g < numOfGroups; ++g) {
+    int32_t num = pInfo->groupRows[g];
+    pInfo->groupRows[g] = offset;
+    offset += num;
+  }
 
-    num = 1;
+  for (int32_t j = 0; j < numOfRows; ++j) {
+    pInfo->rowOrder[pInfo->groupRows[pInfo->rowGroup[j]]++] = j;
+  }
 
-    tfree(pInfo->prevData);
-    pInfo->prevData = key;
+  SSDataBlock* pBlock = gatherGroupbyRows(pInfo, pSDataBlock);
+  if (pBlock == NULL) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
   }
 
-  if (num > 0) {
-    buildGroupbyKeyBuf(pSDataBlock, pInfo, pSDataBlock->info.rows - num, &key);
-    if (key) {
-      tfree(pInfo->prevData);
-      pInfo->prevData = key;
-      if (pQueryAttr->stableQuery && pQueryAttr->stabledev && (pRuntimeEnv->prevResult != NULL)) {
-        setParamForStableStddevByColData(pRuntimeEnv, pInfo->binfo.pCtx, pOperator->numOfOutput, pOperator->pExpr, pInfo);
-      }
-      int32_t ret = setGroupResultOutputBuf(pRuntimeEnv, &(pInfo->binfo), pOperator->numOfOutput, pInfo->prevData, type, pInfo->totalBytes, item->groupIndex);
-      if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
-        longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_APP_ERROR);
-      }
-      doApplyFunctions(pRuntimeEnv, pInfo->binfo.pCtx, &w, pSDataBlock->info.rows - num, num, tsList, pSDataBlock->info.rows, pOperator->numOfOutput);
-    }
+  setInputDataBlock(pOperator, pInfo->binfo.pCtx, pBlock, pRuntimeEnv->pQueryAttr->order.order);
+
+  SColumnInfoData* pFirstColData = taosArrayGet(pBlock->pDataBlock, 0);
+  int64_t* tsList = (pFirstColData->info.type == TSDB_DATA_TYPE_TIMESTAMP)? (int64_t*) pFirstColData->pData:NULL;
+
+  int32_t start = 0;
+  for (int32_t g = 0; g < numOfGroups; ++g) {
+    int32_t end = pInfo->groupRows[g];
+    doGroupbyAggImpl(pOperator, pInfo, g, start, end - start, tsList, numOfRows);
+    start = end;
   }
 
-  tfree(pInfo->prevData);
+  pInfo->prevData = NULL;
 }
 
 static void doSessionWindowAggImpl(SOperatorInfo* pOperator, SSWindowOperatorInfo *pInfo, SSDataBlock *pSDataBlock) {
@@ -1913,7 +2326,20 @@ void setBlockStatisInfo(SQLFunctionCtx *pCtx, SSDataBlock* pSDataBlock, SColInde
     pCtx->preAggVals.isSet = false;
   }
 
-  pCtx->hasNull = hasNull(pColIndex, pStatis);
+  // the functions answered by the statistics of a block do not load it, the input of the others is not updated then
+  pCtx->preAggVals.dataBlockLoaded = (pSDataBlock->pDataBlock != NULL);
+
+  SColumnInfoData* pColInfo = NULL;
+  if (pStatis == NULL && pSDataBlock->pDataBlock != NULL && TSDB_COL_IS_NORMAL_COL(pColIndex->flag) &&
+      !TSDB_COL_IS_TSWIN_COL(pColIndex->colId) && pColIndex->colIndex >= 0 &&
+      pColIndex->colIndex < (int32_t)taosArrayGetSize(pSDataBlock->pDataBlock)) {
+    pColInfo = taosArrayGet(pSDataBlock->pDataBlock, pColIndex->colIndex);
+    if (pColInfo->info.colId != pColIndex->colId) {
+      pColInfo = NULL;
+    }
+  }
+
+  pCtx->hasNull = hasNull(pColIndex, pStatis, pColInfo, pSDataBlock->info.rows);
 
   // set the statistics data for primary time stamp column
   if ((pCtx->functionId == TSDB_FUNC_SPREAD || pCtx->functionId == TSDB_FUNC_ELAPSED) && pColIndex->colId == PRIMARYKEY_TIMESTAMP_COL_INDEX) {
@@ -2236,6 +2662,13 @@ static int32_t setupQueryRuntimeEnv(SQueryRuntimeEnv *pRuntimeEnv, int32_t numOf
         setTableScanFilterOperatorInfo(pRuntimeEnv->proot->upstream[0]->info, pRuntimeEnv->proot);
         break;
       }
+      case OP_PartitionAggregate: {
+        pRuntimeEnv->proot = createPartitionAggOperatorInfo(pRuntimeEnv);
+        if (pRuntimeEnv->proot == NULL) {
+          goto _clean;
+        }
+        break;
+      }
       case OP_Aggregate: {
         pRuntimeEnv->proot =
             createAggregateOperatorInfo(pRuntimeEnv, pRuntimeEnv->proot, pQueryAttr->pExpr1, pQueryAttr->numOfOutput);
@@ -2363,6 +2796,21 @@ static int32_t setupQueryRuntimeEnv(SQueryRuntimeEnv *pRuntimeEnv, int32_t numOf
         break;
       }
 
+      case OP_TopN: {
+        int64_t numOfRows = pQueryAttr->limit.offset + pQueryAttr->limit.limit;
+        if (pQueryAttr->pExpr2 != NULL) {
+          pRuntimeEnv->proot = createTopNOperatorInfo(pRuntimeEnv, pRuntimeEnv->proot, pQueryAttr->pExpr2,
+                                                      pQueryAttr->numOfExpr2, &pQueryAttr->order, numOfRows);
+        } else {
+          pRuntimeEnv->proot = createTopNOperatorInfo(pRuntimeEnv, pRuntimeEnv->proot, pQueryAttr->pExpr1,
+                                                      pQueryAttr->numOfOutput, &pQueryAttr->order, numOfRows);
+        }
+        if (pRuntimeEnv->proot == NULL) {
+          goto _clean;
+        }
+        break;
+      }
+
       case OP_Order: {
         if (pQueryAttr->pExpr2 != NULL) {
           pRuntimeEnv->proot = createOrderOperatorInfo(pRuntimeEnv, pRuntimeEnv->proot, pQueryAttr->pExpr2,
@@ -2402,7 +2850,8 @@ static void doFreeQueryHandle(SQueryRuntimeEnv* pRuntimeEnv) {
   pRuntimeEnv->pQueryHandle = NULL;
 
   SMemRef* pMemRef = &pQueryAttr->memRef;
-  assert(pMemRef->ref == 0 && pMemRef->snapshot.imem == NULL && pMemRef->snapshot.mem == NULL);
+  assert(pRuntimeEnv->pPartition != NULL ||
+         (pMemRef->ref == 0 && pMemRef->snapshot.imem == NULL && pMemRef->snapshot.mem == NULL));
 }
 
 static void destroyTsComp(SQueryRuntimeEnv *pRuntimeEnv, SQueryAttr *pQueryAttr) {
@@ -2438,6 +2887,11 @@ static void teardownQueryRuntimeEnv(SQueryRuntimeEnv *pRuntimeEnv) {
   }
 
   destroyResultBuf(pRuntimeEnv->pResultBuf);
+
+  // the table partitions are released with the operators, before the memory snapshot they share is released
+  destroyOperatorInfo(pRuntimeEnv->proot);
+  pRuntimeEnv->proot = NULL;
+
   doFreeQueryHandle(pRuntimeEnv);
 
   destroyTsComp(pRuntimeEnv, pQueryAttr);
@@ -2460,7 +2914,8 @@ static void teardownQueryRuntimeEnv(SQueryRuntimeEnv *pRuntimeEnv) {
   taosHashCleanup(pRuntimeEnv->pResultRowListSet);
   pRuntimeEnv->pResultRowListSet = NULL;
 
-  destroyOperatorInfo(pRuntimeEnv->proot);
+  resultRowHashCleanup(&pRuntimeEnv->winRowHash);
+  resultRowHashCleanup(&pRuntimeEnv->winRowIndex);
 
   pRuntimeEnv->pool = destroyResultRowPool(pRuntimeEnv->pool);
   taosArrayDestroy(&pRuntimeEnv->pResultRowArrayList);
@@ -2847,8 +3302,18 @@ static FORCE_INLINE bool doFilterByBlockStatistics(SQueryRuntimeEnv* pRuntimeEnv
   return filterRangeExecute(pQueryAttr->pFilters, pDataStatis, pQueryAttr->numOfCols, numOfRows);
 }
 
-static bool overlapWithTimeWindow(SQueryAttr* pQueryAttr, SDataBlockInfo* pBlockInfo) {
-  STimeWindow w = {0};
+static FORCE_INLINE bool doFilterByBlockBloom(SQueryRuntimeEnv* pRuntimeEnv, TsdbQueryHandleT pQueryHandle) {
+  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
+
+  if (pQueryAttr->pFilters == NULL || !pQueryAttr->hasBloomFilter) {
+    return true;
+  }
+
+  return filterBloomExecute(pQueryAttr->pFilters, (filter_bloom_func)tsdbDataBlockMayContain, pQueryHandle);
+}
+
+static bool overlapWithTimeWindow(SQueryAttr* pQueryAttr, SDataBlockInfo* pBlockInfo) {
+  STimeWindow w = {0};
 
   TSKEY sk = MIN(pQueryAttr->window.skey, pQueryAttr->window.ekey);
   TSKEY ek = MAX(pQueryAttr->window.skey, pQueryAttr->window.ekey);
@@ -3011,6 +3476,14 @@ void doCompactSDataBlock(SSDataBlock* pBlock, int32_t numOfRows, int8_t* p) {
   pBlock->info.rows = start;
   pBlock->pBlockStatis = NULL;  // clean the block statistics info
 
+  // the remained rows may have no null any more, while no null or all null still holds for them
+  for (int32_t i = 0; i < pBlock->info.numOfCols; ++i) {
+    SColumnInfoData* pColumnInfoData = taosArrayGet(pBlock->pDataBlock, i);
+    if (pColumnInfoData->nullFlag == COL_HAS_NULL) {
+      pColumnInfoData->nullFlag = COL_NULL_UNKNOWN;
+    }
+  }
+
   if (start > 0) {
     SColumnInfoData* pColumnInfoData = taosArrayGet(pBlock->pDataBlock, 0);
     if (pColumnInfoData->info.type == TSDB_DATA_TYPE_TIMESTAMP &&
@@ -3176,6 +3649,20 @@ FORCE_INLINE int32_t getColumnDataFromId(void *param, int32_t id, void **data) {
   return TSDB_CODE_SUCCESS;
 }
 
+FORCE_INLINE int32_t getColumnNullFlagFromId(void *param, int32_t id, uint8_t *nullFlag) {
+  SColumnDataParam* pParam = (SColumnDataParam *)param;
+
+  for (int32_t j = 0; j < pParam->numOfCols; ++j) {
+    SColumnInfoData* pColInfo = taosArrayGet(pParam->pDataBlock, j);
+    if (id == pColInfo->info.colId) {
+      SDataStatis* pStatis = (pParam->pStatis != NULL) ? &pParam->pStatis[j] : NULL;
+      *nullFlag = getColumnNullFlag(pColInfo, pStatis, pParam->numOfRows);
+      break;
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
 
 int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTableScanInfo, SSDataBlock* pBlock,
                               uint32_t* status) {
@@ -3188,7 +3675,7 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
   bool    ascQuery = QUERY_IS_ASC_QUERY(pQueryAttr);
 
   SQInfo*         pQInfo = pRuntimeEnv->qinfo;
-  SQueryCostInfo* pCost = &pQInfo->summary;
+  SQueryCostInfo* pCost = (pRuntimeEnv->pPartition != NULL)? &pRuntimeEnv->pPartition->cost:&pQInfo->summary;
 
   pCost->totalBlocks += 1;
   pCost->totalRows += pBlock->info.rows;
@@ -3219,11 +3706,27 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
 
   // Calculate all time windows that are overlapping or contain current data block.
   // If current data block is contained by all possible time window, do not load current data block.
-  if (pQueryAttr->pFilters || pQueryAttr->groupbyColumn || pQueryAttr->sw.gap > 0 ||
+  if (pQueryAttr->groupbyColumn || pQueryAttr->sw.gap > 0 ||
       (QUERY_IS_INTERVAL_QUERY(pQueryAttr) && overlapWithTimeWindow(pQueryAttr, &pBlock->info))) {
     (*status) = BLK_DATA_ALL_NEEDED;
   }
 
+  // The filter needs the rows of the block, unless the block statistics show that all of them are qualified. In that
+  // case the block is handled as one of a query without filter, and the functions decide what to load.
+  bool statisLoaded = false;
+  bool needFilter = (pQueryAttr->pFilters != NULL);
+  if (needFilter && (*status) != BLK_DATA_ALL_NEEDED) {
+    pCost->loadBlockStatis += 1;
+    tsdbRetrieveDataBlockStatisInfo(pTableScanInfo->pQueryHandle, &pBlock->pBlockStatis);
+    statisLoaded = true;
+
+    needFilter = !filterRangeAllQualified(pQueryAttr->pFilters, pBlock->pBlockStatis, pQueryAttr->numOfCols,
+                                          pBlock->info.rows);
+    if (needFilter) {
+      (*status) = BLK_DATA_ALL_NEEDED;
+    }
+  }
+
   // check if this data block is required to load
   if ((*status) != BLK_DATA_ALL_NEEDED) {
     // the pCtx[i] result is belonged to previous time window since the outputBuf has not been set yet,
@@ -3258,8 +3761,10 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
     pCost->discardBlocks += 1;
   } else if ((*status) == BLK_DATA_STATIS_NEEDED) {
     // this function never returns error?
-    pCost->loadBlockStatis += 1;
-    tsdbRetrieveDataBlockStatisInfo(pTableScanInfo->pQueryHandle, &pBlock->pBlockStatis);
+    if (!statisLoaded) {
+      pCost->loadBlockStatis += 1;
+      tsdbRetrieveDataBlockStatisInfo(pTableScanInfo->pQueryHandle, &pBlock->pBlockStatis);
+    }
 
     if (pBlock->pBlockStatis == NULL) {  // data block statistics does not exist, load data block
       pBlock->pDataBlock = tsdbRetrieveDataBlock(pTableScanInfo->pQueryHandle, NULL);
@@ -3269,8 +3774,10 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
     assert((*status) == BLK_DATA_ALL_NEEDED);
 
     // load the data block statistics to perform further filter
-    pCost->loadBlockStatis += 1;
-    tsdbRetrieveDataBlockStatisInfo(pTableScanInfo->pQueryHandle, &pBlock->pBlockStatis);
+    if (!statisLoaded) {
+      pCost->loadBlockStatis += 1;
+      tsdbRetrieveDataBlockStatisInfo(pTableScanInfo->pQueryHandle, &pBlock->pBlockStatis);
+    }
 
     if (pQueryAttr->topBotQuery && pBlock->pBlockStatis != NULL) {
       { // set previous window
@@ -3306,7 +3813,8 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
     }
 
     // current block has been discard due to filter applied
-    if (!doFilterByBlockStatistics(pRuntimeEnv, pBlock->pBlockStatis, pTableScanInfo->pCtx, pBlockInfo->rows)) {
+    if (needFilter && (!doFilterByBlockStatistics(pRuntimeEnv, pBlock->pBlockStatis, pTableScanInfo->pCtx, pBlockInfo->rows) ||
+        !doFilterByBlockBloom(pRuntimeEnv, pTableScanInfo->pQueryHandle))) {
       pCost->discardBlocks += 1;
       qDebug("QInfo:0x%"PRIx64" data block discard, brange:%" PRId64 "-%" PRId64 ", rows:%d", pQInfo->qId, pBlockInfo->window.skey,
              pBlockInfo->window.ekey, pBlockInfo->rows);
@@ -3321,12 +3829,14 @@ int32_t loadDataBlockOnDemand(SQueryRuntimeEnv* pRuntimeEnv, STableScanInfo* pTa
       return terrno;
     }
 
-    if (pQueryAttr->pFilters != NULL) {
-      SColumnDataParam param = {.numOfCols = pBlock->info.numOfCols, .pDataBlock = pBlock->pDataBlock};
+    if (needFilter) {
+      SColumnDataParam param = {.numOfCols = pBlock->info.numOfCols, .pDataBlock = pBlock->pDataBlock,
+                                .pStatis = pBlock->pBlockStatis, .numOfRows = pBlock->info.rows};
       filterSetColFieldData(pQueryAttr->pFilters, &param, getColumnDataFromId);
+      filterSetColFieldNullFlag(pQueryAttr->pFilters, &param, getColumnNullFlagFromId);
     }
 
-    if (pQueryAttr->pFilters != NULL || pRuntimeEnv->pTsBuf != NULL) {
+    if (needFilter || pRuntimeEnv->pTsBuf != NULL) {
       filterColRowsInDataBlock(pRuntimeEnv, pBlock, ascQuery);
     }
   }
@@ -4559,14 +5069,16 @@ int32_t doFillTimeIntervalGapsInResults(SFillInfo* pFillInfo, SSDataBlock *pOutp
   return pOutput->info.rows;
 }
 
-void publishOperatorProfEvent(SOperatorInfo* operatorInfo, EQueryProfEventType eventType) {
+void publishOperatorProfEvent(SOperatorInfo* operatorInfo, EQueryProfEventType eventType, SSDataBlock* pBlock) {
   SQueryProfEvent event = {0};
 
   event.eventType    = eventType;
   event.eventTime    = taosGetTimestampUs();
   event.operatorType = operatorInfo->operatorType;
+  event.rows         = (pBlock != NULL) ? pBlock->info.rows : 0;
 
-  if (operatorInfo->pRuntimeEnv) {
+  // the events of the table partitions run by other threads are not recorded
+  if (operatorInfo->pRuntimeEnv && operatorInfo->pRuntimeEnv->pPartition == NULL) {
     SQInfo* pQInfo = operatorInfo->pRuntimeEnv->qinfo;
     if (pQInfo->summary.queryProfEvents) {
       taosArrayPush(pQInfo->summary.queryProfEvents, &event);
@@ -4594,6 +5106,8 @@ typedef struct  {
 } SOperatorStackItem;
 
 static void doOperatorExecProfOnce(SOperatorStackItem* item, SQueryProfEvent* event, SArray* opStack, SHashObj* profResults) {
+  int64_t rows = (event->eventType == QUERY_PROF_AFTER_OPERATOR_EXEC) ? event->rows : 0;
+
   item->endTime = event->eventTime;
   item->selfTime = (item->endTime - item->beginTime) - (item->descendantsTime);
 
@@ -4607,11 +5121,15 @@ static void doOperatorExecProfOnce(SOperatorStackItem* item, SQueryProfEvent* ev
   if (result != NULL) {
     result->sumRunTimes++;
     result->sumSelfTime += item->selfTime;
+    result->maxSelfTime = MAX(result->maxSelfTime, item->selfTime);
+    result->sumRows += rows;
   } else {
     SOperatorProfResult opResult;
     opResult.operatorType = operatorType;
     opResult.sumSelfTime = item->selfTime;
+    opResult.maxSelfTime = item->selfTime;
     opResult.sumRunTimes = 1;
+    opResult.sumRows = rows;
     taosHashPut(profResults, &(operatorType), sizeof(operatorType),
                 &opResult, sizeof(opResult));
   }
@@ -4656,14 +5174,94 @@ void calculateOperatorProfResults(SQInfo* pQInfo) {
     }
   }
 
+  // the events are consumed, so that the results are not accumulated twice if calculated again
+  taosArrayClear(pQInfo->summary.queryProfEvents);
   taosArrayDestroy(&opStack);
 }
 
+// the table partitions have added the read cost of their own query handles into the summary
+static void getQueryReadCost(SQInfo* pQInfo, STsdbReadCost* pCost) {
+  tsdbGetQueryReadCost(pQInfo->runtimeEnv.pQueryHandle, pCost);
+
+  pCost->readBytes   += pQInfo->summary.loadFileBlockSize;
+  pCost->decompBytes += pQInfo->summary.decompBlockSize;
+  pCost->cacheHits   += pQInfo->summary.blockCacheHits;
+}
+
+static int32_t getNumOfOperators(SOperatorInfo* pOperator) {
+  int32_t num = 1;
+  for (int32_t i = 0; i < pOperator->numOfUpstream; ++i) {
+    num += getNumOfOperators(pOperator->upstream[i]);
+  }
+
+  return num;
+}
+
+static void doDumpExplainOperator(SOperatorInfo* pOperator, int32_t depth, SHashObj* profResults, SExplainMsg* pMsg) {
+  SExplainOperatorMsg* pOp = &pMsg->operators[pMsg->numOfOperators++];
+
+  tstrncpy(pOp->name, pOperator->name, sizeof(pOp->name));
+  pOp->depth = htonl(depth);
+
+  // the operators are profiled by type, the same type of operators in one plan share the statistics
+  uint8_t operatorType = pOperator->operatorType;
+  SOperatorProfResult* pRes = taosHashGet(profResults, &operatorType, sizeof(operatorType));
+  if (pRes != NULL) {
+    pOp->execs       = htobe64(pRes->sumRunTimes);
+    pOp->selfTime    = htobe64(pRes->sumSelfTime);
+    pOp->maxSelfTime = htobe64(pRes->maxSelfTime);
+    pOp->rows        = htobe64(pRes->sumRows);
+  }
+
+  for (int32_t i = 0; i < pOperator->numOfUpstream; ++i) {
+    doDumpExplainOperator(pOperator->upstream[i], depth + 1, profResults, pMsg);
+  }
+}
+
+SExplainMsg* createExplainMsg(SQInfo* pQInfo, int32_t* len) {
+  SQueryRuntimeEnv* pRuntimeEnv = &pQInfo->runtimeEnv;
+  SQueryCostInfo*   pSummary = &pQInfo->summary;
+
+  calculateOperatorProfResults(pQInfo);
+
+  int32_t numOfOperators = (pRuntimeEnv->proot != NULL) ? getNumOfOperators(pRuntimeEnv->proot) : 0;
+
+  *len = (int32_t)(sizeof(SExplainMsg) + numOfOperators * sizeof(SExplainOperatorMsg));
+  SExplainMsg* pMsg = calloc(1, *len);
+  if (pMsg == NULL) {
+    *len = 0;
+    return NULL;
+  }
+
+  if (numOfOperators > 0 && pSummary->operatorProfResults != NULL) {
+    doDumpExplainOperator(pRuntimeEnv->proot, 0, pSummary->operatorProfResults, pMsg);
+  }
+
+  STsdbReadCost cost = {0};
+  getQueryReadCost(pQInfo, &cost);
+
+  pMsg->vgId            = htonl(pRuntimeEnv->pQueryAttr->vgId);
+  pMsg->numOfOperators  = htonl(pMsg->numOfOperators);
+  pMsg->elapsed         = htobe64(pSummary->elapsedTime);
+  pMsg->totalBlocks     = htonl(pSummary->totalBlocks);
+  pMsg->loadBlocks      = htonl(pSummary->loadBlocks);
+  pMsg->loadBlockStatis = htonl(pSummary->loadBlockStatis);
+  pMsg->discardBlocks   = htonl(pSummary->discardBlocks);
+  pMsg->totalRows       = htobe64(pSummary->totalRows);
+  pMsg->checkedRows     = htobe64(pSummary->totalCheckedRows);
+  pMsg->readBytes       = htobe64(cost.readBytes);
+  pMsg->decompBytes     = htobe64(cost.decompBytes);
+  pMsg->cacheHits       = htobe64(cost.cacheHits);
+
+  return pMsg;
+}
+
 void queryCostStatis(SQInfo *pQInfo) {
   SQueryRuntimeEnv *pRuntimeEnv = &pQInfo->runtimeEnv;
   SQueryCostInfo *pSummary = &pQInfo->summary;
 
   uint64_t hashSize = taosHashGetMemSize(pQInfo->runtimeEnv.pResultRowHashTable);
+  hashSize += resultRowHashGetMemSize(&pRuntimeEnv->winRowHash) + resultRowHashGetMemSize(&pRuntimeEnv->winRowIndex);
   hashSize += taosHashGetMemSize(pRuntimeEnv->tableqinfoGroupInfo.map);
   pSummary->hashSize = hashSize;
 
@@ -4681,11 +5279,17 @@ void queryCostStatis(SQInfo *pQInfo) {
 
   calculateOperatorProfResults(pQInfo);
 
+  STsdbReadCost cost = {0};
+  getQueryReadCost(pQInfo, &cost);
+
   qDebug("QInfo:0x%"PRIx64" :cost summary: elapsed time:%"PRId64" us, first merge:%"PRId64" us, total blocks:%d, "
          "load block statis:%d, load data block:%d, total rows:%"PRId64 ", check rows:%"PRId64,
          pQInfo->qId, pSummary->elapsedTime, pSummary->firstStageMergeTime, pSummary->totalBlocks, pSummary->loadBlockStatis,
          pSummary->loadBlocks, pSummary->totalRows, pSummary->totalCheckedRows);
 
+  qDebug("QInfo:0x%"PRIx64" :cost summary: read bytes:%"PRId64", decompressed bytes:%"PRId64", block cache hits:%"PRId64,
+         pQInfo->qId, cost.readBytes, cost.decompBytes, cost.cacheHits);
+
   qDebug("QInfo:0x%"PRIx64" :cost summary: winResPool size:%.2f Kb, numOfWin:%"PRId64", tableInfoSize:%.2f Kb, hashTable:%.2f Kb", pQInfo->qId, pSummary->winInfoSize/1024.0,
       pSummary->numOfTimeWindows, pSummary->tableInfoSize/1024.0, pSummary->hashSize/1024.0);
 
@@ -5030,6 +5634,40 @@ static SFillColInfo* createFillColInfo(SExprInfo* pExpr, int32_t numOfOutput, in
   return pFillCol;
 }
 
+#define QUERY_PARTITION_MIN_TABLES 16
+
+static int32_t getNumOfQueryPartitions(SQueryRuntimeEnv* pRuntimeEnv) {
+  int64_t numOfPartitions = pRuntimeEnv->tableqinfoGroupInfo.numOfTables / QUERY_PARTITION_MIN_TABLES;
+  return (int32_t) MAX(1, MIN(tsQueryParallelism, numOfPartitions));
+}
+
+/*
+ * A super table aggregate on the table scan is split over partitions of the tables, if there is no filter of columns.
+ * The intermediate results of a group from all the partitions are merged into one on the vnode, so only the functions
+ * whose intermediate results can be merged there are allowed.
+ */
+static bool isPartitionAggQuery(SQueryRuntimeEnv* pRuntimeEnv, int32_t tbScanner, SArray* pOperator) {
+  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
+
+  if (tsQueryParallelism <= 1 || tbScanner != OP_TableScan || taosArrayGetSize(pOperator) != 1 ||
+      *(int32_t*) taosArrayGet(pOperator, 0) != OP_MultiTableAggregate) {
+    return false;
+  }
+
+  if (pQueryAttr->pFilters != NULL || pRuntimeEnv->pTsBuf != NULL || pRuntimeEnv->prevResult != NULL ||
+      pRuntimeEnv->pUdfInfo != NULL || isFirstLastRowQuery(pQueryAttr) || isCachedLastQuery(pQueryAttr)) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < pQueryAttr->numOfOutput; ++i) {
+    if (!isIntermediateResultMergeable(pQueryAttr->pExpr1[i].base.functionId)) {
+      return false;
+    }
+  }
+
+  return getNumOfScanTimes(pQueryAttr) == 1 && getNumOfQueryPartitions(pRuntimeEnv) > 1;
+}
+
 int32_t doInitQInfo(SQInfo* pQInfo, STSBuf* pTsBuf, void* tsdb, void* sourceOptr, int32_t tbScanner, SArray* pOperator,
     void* param) {
   SQueryRuntimeEnv *pRuntimeEnv = &pQInfo->runtimeEnv;
@@ -5054,7 +5692,11 @@ int32_t doInitQInfo(SQInfo* pQInfo, STSBuf* pTsBuf, void* tsdb, void* sourceOptr
   pRuntimeEnv->cur.vgroupIndex = -1;
   setResultBufSize(pQueryAttr, &pRuntimeEnv->resultInfo);
 
-  switch(tbScanner) {
+  // the table partitions create the table scans of their own, the query handle of the query only takes the snapshot
+  // of the memory tables for them
+  bool partitioned = (tsdb != NULL && isPartitionAggQuery(pRuntimeEnv, tbScanner, pOperator));
+
+  switch(partitioned? 0:tbScanner) {
     case OP_TableBlockInfoScan: {
       pRuntimeEnv->proot = createTableBlockInfoScanOperator(pRuntimeEnv->pQueryHandle, pRuntimeEnv);
       if (pRuntimeEnv->proot == NULL) {
@@ -5124,7 +5766,20 @@ int32_t doInitQInfo(SQInfo* pQInfo, STSBuf* pTsBuf, void* tsdb, void* sourceOptr
     qDebug("QInfo:0x%"PRIx64" failed to allocate operator prof results hash", pQInfo->qId);
   }
 
-  code = setupQueryRuntimeEnv(pRuntimeEnv, (int32_t) pQueryAttr->tableGroupInfo.numOfTables, pOperator, param);
+  if (partitioned) {
+    int32_t op = OP_PartitionAggregate;
+    SArray* pPartitionPlan = taosArrayInit(1, sizeof(int32_t));
+    if (pPartitionPlan == NULL) {
+      return TSDB_CODE_QRY_OUT_OF_MEMORY;
+    }
+
+    taosArrayPush(pPartitionPlan, &op);
+    code = setupQueryRuntimeEnv(pRuntimeEnv, (int32_t) pQueryAttr->tableGroupInfo.numOfTables, pPartitionPlan, param);
+    taosArrayDestroy(&pPartitionPlan);
+  } else {
+    code = setupQueryRuntimeEnv(pRuntimeEnv, (int32_t) pQueryAttr->tableGroupInfo.numOfTables, pOperator, param);
+  }
+
   if (code != TSDB_CODE_SUCCESS) {
     return code;
   }
@@ -5880,6 +6535,217 @@ static int32_t doMergeSDatablock(SSDataBlock* pDest, SSDataBlock* pSrc) {
   return TSDB_CODE_SUCCESS;
 }
 
+static void doSortDataBlock(SSDataBlock* pBlock, int32_t colIndex, __compar_fn_t comparFn) {
+  if (pBlock->info.rows == 0) {
+    return;
+  }
+
+  int32_t numOfCols = pBlock->info.numOfCols;
+  void** pCols     = calloc(numOfCols, POINTER_BYTES);
+  SSchema* pSchema = calloc(numOfCols, sizeof(SSchema));
+
+  for(int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* p1 = taosArrayGet(pBlock->pDataBlock, i);
+    pCols[i] = p1->pData;
+    pSchema[i].colId = p1->info.colId;
+    pSchema[i].bytes = p1->info.bytes;
+    pSchema[i].type  = (uint8_t) p1->info.type;
+  }
+
+  taoscQSort(pCols, pSchema, numOfCols, pBlock->info.rows, colIndex, comparFn);
+
+  tfree(pCols);
+  tfree(pSchema);
+}
+
+// the rows of a page of sorted run are stored column by column, each column takes numOfRowsPerPage slots
+static char* getSortedRunColData(SOrderOperatorInfo* pInfo, tFilePage* pPage, int32_t colIndex, int32_t rowIndex) {
+  int32_t offset = 0;
+  for (int32_t i = 0; i < colIndex; ++i) {
+    SColumnInfoData* pCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, i);
+    offset += pCol->info.bytes * pInfo->numOfRowsPerPage;
+  }
+
+  SColumnInfoData* pCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, colIndex);
+  return pPage->data + offset + pCol->info.bytes * rowIndex;
+}
+
+// sort the rows collected in memory, and write them into the sort buffer as a new sorted run
+static void doSpillSortedRun(SOperatorInfo* pOperator, SOrderOperatorInfo* pInfo) {
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+  SSDataBlock*      pBlock = pInfo->pDataBlock;
+
+  doSortDataBlock(pInfo->pDataBlock, pInfo->colIndex, pInfo->comparFn);
+
+  if (pInfo->pSortBuf == NULL) {
+    int32_t pageSize = (int32_t)(pInfo->numOfRowsPerPage * pInfo->rowSize + sizeof(tFilePage));
+    int32_t inMemSize = (int32_t)MIN(pInfo->bufSize / 2, INT32_MAX);
+
+    int32_t code = createDiskbasedResultBuffer(&pInfo->pSortBuf, pageSize, inMemSize, GET_QID(pRuntimeEnv));
+    if (code != TSDB_CODE_SUCCESS) {
+      longjmp(pRuntimeEnv->env, code);
+    }
+  }
+
+  int32_t runId = pInfo->numOfRuns++;
+  for (int32_t start = 0; start < pBlock->info.rows; start += pInfo->numOfRowsPerPage) {
+    int32_t pageId = -1;
+    tFilePage* pPage = getNewDataBuf(pInfo->pSortBuf, runId, &pageId);
+    if (pPage == NULL) {
+      longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+    }
+
+    int32_t num = MIN(pInfo->numOfRowsPerPage, pBlock->info.rows - start);
+    for (int32_t i = 0; i < pBlock->info.numOfCols; ++i) {
+      SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, i);
+      memcpy(getSortedRunColData(pInfo, pPage, i, 0), pCol->pData + (size_t)start * pCol->info.bytes, (size_t)num * pCol->info.bytes);
+    }
+
+    pPage->num = num;
+    releaseResBufPage(pInfo->pSortBuf, pPage);
+  }
+
+  qDebug("QInfo:0x%"PRIx64" order by spills sorted run:%d, rows:%d", GET_QID(pRuntimeEnv), runId, pBlock->info.rows);
+  pBlock->info.rows = 0;
+}
+
+static int32_t sortedRunComparator(const void *pLeft, const void *pRight, void *param) {
+  int32_t leftIndex  = *(int32_t *)pLeft;
+  int32_t rightIndex = *(int32_t *)pRight;
+
+  SOrderOperatorInfo* pInfo = (SOrderOperatorInfo*) param;
+  SOrderMergeSource*  pLeftSource = &pInfo->pSources[leftIndex];
+  SOrderMergeSource*  pRightSource = &pInfo->pSources[rightIndex];
+
+  // this run is exhausted, set the special value to denote this
+  if (pLeftSource->rowIndex == -1) {
+    return 1;
+  }
+
+  if (pRightSource->rowIndex == -1) {
+    return -1;
+  }
+
+  char* f1 = getSortedRunColData(pInfo, pLeftSource->pPage, pInfo->colIndex, pLeftSource->rowIndex);
+  char* f2 = getSortedRunColData(pInfo, pRightSource->pPage, pInfo->colIndex, pRightSource->rowIndex);
+
+  int32_t ret = pInfo->comparFn(f1, f2);
+  if (ret == 0) {
+    return (leftIndex < rightIndex)? -1:1;
+  }
+
+  return ret;
+}
+
+static void doLoadSortedRunPage(SOperatorInfo* pOperator, SOrderOperatorInfo* pInfo, SOrderMergeSource* pSource) {
+  SIDList list = getDataBufPagesIdList(pInfo->pSortBuf, pSource->runId);
+  if (pSource->pageIndex >= taosArrayGetSize(list)) {
+    pSource->pPage = NULL;
+    pSource->rowIndex = -1;
+    return;
+  }
+
+  SPageInfo* pi = taosArrayGetP(list, pSource->pageIndex);
+  pSource->pPage = getResBufPage(pInfo->pSortBuf, pi->pageId);
+  if (pSource->pPage == NULL) {
+    longjmp(pOperator->pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+  }
+
+  pSource->rowIndex = 0;
+}
+
+static void doInitSortedRunMerge(SOperatorInfo* pOperator, SOrderOperatorInfo* pInfo) {
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+
+  if (pInfo->pDataBlock->info.rows > 0) {
+    doSpillSortedRun(pOperator, pInfo);
+  }
+
+  // the collected rows are all in sorted runs now, release the memory of them
+  SSDataBlock* pRes = calloc(1, sizeof(SSDataBlock));
+  pInfo->pRes = pRes;
+  if (pRes == NULL) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+  }
+
+  pRes->pDataBlock = taosArrayInit(pInfo->pDataBlock->info.numOfCols, sizeof(SColumnInfoData));
+  for (int32_t i = 0; i < pInfo->pDataBlock->info.numOfCols; ++i) {
+    SColumnInfoData* pCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, i);
+    tfree(pCol->pData);
+
+    SColumnInfoData col = {.info = pCol->info};
+    col.pData = malloc((size_t)pRuntimeEnv->resultInfo.capacity * pCol->info.bytes);
+    if (col.pData == NULL) {
+      longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+    }
+
+    taosArrayPush(pRes->pDataBlock, &col);
+    pRes->info.numOfCols += 1;
+  }
+
+  pInfo->pSources = calloc(pInfo->numOfRuns, sizeof(SOrderMergeSource));
+  if (pInfo->pSources == NULL) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+  }
+
+  for (int32_t i = 0; i < pInfo->numOfRuns; ++i) {
+    pInfo->pSources[i].runId = i;
+    doLoadSortedRunPage(pOperator, pInfo, &pInfo->pSources[i]);
+  }
+
+  int32_t code = tLoserTreeCreate(&pInfo->pMergeTree, pInfo->numOfRuns, pInfo, sortedRunComparator);
+  if (code != TSDB_CODE_SUCCESS) {
+    longjmp(pRuntimeEnv->env, code);
+  }
+
+  qDebug("QInfo:0x%"PRIx64" order by starts to merge %d sorted runs", GET_QID(pRuntimeEnv), pInfo->numOfRuns);
+}
+
+static SSDataBlock* doMergeSortedRuns(SOperatorInfo* pOperator, SOrderOperatorInfo* pInfo) {
+  SSDataBlock*    pRes = pInfo->pRes;
+  SLoserTreeInfo* pTree = pInfo->pMergeTree;
+
+  pRes->info.rows = 0;
+  while (pRes->info.rows < pOperator->pRuntimeEnv->resultInfo.capacity) {
+    int32_t index = pTree->pNode[0].index;
+
+    // the winner is exhausted only if all runs are exhausted
+    SOrderMergeSource* pSource = &pInfo->pSources[index];
+    if (pSource->rowIndex == -1) {
+      break;
+    }
+
+    for (int32_t i = 0; i < pRes->info.numOfCols; ++i) {
+      SColumnInfoData* pCol = taosArrayGet(pRes->pDataBlock, i);
+      memcpy(pCol->pData + (size_t)pRes->info.rows * pCol->info.bytes,
+             getSortedRunColData(pInfo, pSource->pPage, i, pSource->rowIndex), pCol->info.bytes);
+    }
+
+    pRes->info.rows += 1;
+
+    pSource->rowIndex += 1;
+    if (pSource->rowIndex >= pSource->pPage->num) {
+      releaseResBufPage(pInfo->pSortBuf, pSource->pPage);
+      pSource->pageIndex += 1;
+      doLoadSortedRunPage(pOperator, pInfo, pSource);
+    }
+
+    tLoserTreeAdjust(pTree, index + pTree->numOfEntries);
+  }
+
+  if (pRes->info.rows == 0) {
+    doSetOperatorCompleted(pOperator);
+    return NULL;
+  }
+
+  return pRes;
+}
+
+/*
+ * The rows are collected in memory, and sorted in place if all of them fit into half of the memory budget. Otherwise,
+ * each time the collected rows exceed it, they are sorted and spilled into the disk-based sort buffer as a sorted run,
+ * and the runs are merged with a loser tree at last.
+ */
 static SSDataBlock* doSort(void* param, bool* newgroup) {
   SOperatorInfo* pOperator = (SOperatorInfo*) param;
   if (pOperator->status == OP_EXEC_DONE) {
@@ -5887,45 +6753,39 @@ static SSDataBlock* doSort(void* param, bool* newgroup) {
   }
 
   SOrderOperatorInfo* pInfo = pOperator->info;
+  if (pInfo->pMergeTree != NULL) {
+    return doMergeSortedRuns(pOperator, pInfo);
+  }
 
   SSDataBlock* pBlock = NULL;
   while(1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
-    // start to flush data into disk and try do multiway merge sort
     if (pBlock == NULL) {
-      doSetOperatorCompleted(pOperator);
       break;
     }
 
     int32_t code = doMergeSDatablock(pInfo->pDataBlock, pBlock);
     if (code != TSDB_CODE_SUCCESS) {
-      // todo handle error
+      longjmp(pOperator->pRuntimeEnv->env, code);
     }
-  }
-
-  int32_t numOfCols = pInfo->pDataBlock->info.numOfCols;
-  void** pCols     = calloc(numOfCols, POINTER_BYTES);
-  SSchema* pSchema = calloc(numOfCols, sizeof(SSchema));
 
-  for(int32_t i = 0; i < numOfCols; ++i) {
-    SColumnInfoData* p1 = taosArrayGet(pInfo->pDataBlock->pDataBlock, i);
-    pCols[i] = p1->pData;
-    pSchema[i].colId = p1->info.colId;
-    pSchema[i].bytes = p1->info.bytes;
-    pSchema[i].type  = (uint8_t) p1->info.type;
+    if ((int64_t)pInfo->pDataBlock->info.rows * pInfo->rowSize >= pInfo->bufSize / 2) {
+      doSpillSortedRun(pOperator, pInfo);
+    }
   }
 
-  __compar_fn_t  comp = getKeyComparFunc(pSchema[pInfo->colIndex].type, pInfo->order);
-  if (pInfo->pDataBlock->info.rows) {
-    taoscQSort(pCols, pSchema, numOfCols, pInfo->pDataBlock->info.rows, pInfo->colIndex, comp);
+  if (pInfo->numOfRuns == 0) {
+    doSetOperatorCompleted(pOperator);
+    doSortDataBlock(pInfo->pDataBlock, pInfo->colIndex, pInfo->comparFn);
+    return (pInfo->pDataBlock->info.rows > 0)? pInfo->pDataBlock:NULL;
   }
 
-  tfree(pCols);
-  tfree(pSchema);
-  return (pInfo->pDataBlock->info.rows > 0)? pInfo->pDataBlock:NULL;
+  // start to flush data into disk and try do multiway merge sort
+  doInitSortedRunMerge(pOperator, pInfo);
+  return doMergeSortedRuns(pOperator, pInfo);
 }
 
 SOperatorInfo *createOrderOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput, SOrderVal* pOrderVal) {
@@ -5962,12 +6822,23 @@ SOperatorInfo *createOrderOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorI
       pInfo->pDataBlock = pDataBlock;
   }
 
+  for (int32_t i = 0; i < numOfOutput; ++i) {
+    pInfo->rowSize += pExpr[i].base.resBytes;
+  }
+
+  pInfo->rowSize = MAX(pInfo->rowSize, 1);
+  pInfo->bufSize = ((int64_t)tsSortBufferSize) * 1048576L;
+  pInfo->numOfRowsPerPage = MAX(1, (int32_t)((ORDER_SORT_PAGE_SIZE - sizeof(tFilePage)) / pInfo->rowSize));
+
+  SColumnInfoData* pOrderCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, pInfo->colIndex);
+  pInfo->comparFn = getKeyComparFunc(pOrderCol->info.type, pInfo->order);
+
   SOperatorInfo* pOperator = calloc(1, sizeof(SOperatorInfo));
   if (pOperator == NULL) {
     goto _clean;
   }
 
-  pOperator->name          = "InMemoryOrder";
+  pOperator->name          = "OrderOperator";
   pOperator->operatorType  = OP_Order;
   pOperator->blockingOptr  = true;
   pOperator->status        = OP_IN_EXECUTING;
@@ -5986,45 +6857,247 @@ _clean:
   return NULL;
 }
 
-static int32_t getTableScanOrder(STableScanInfo* pTableScanInfo) {
-  return pTableScanInfo->order;
-}
-
-// check all SQLFunctionCtx is completed
-static bool allCtxCompleted(SOperatorInfo* pOperator, SQLFunctionCtx* pCtx) {
-  // only one false, return false
-  for(int32_t i = 0; i < pOperator->numOfOutput; i++) {
-    if(pCtx[i].resultInfo == NULL)
-      return false;
-    if(!pCtx[i].resultInfo->complete)
-      return false;
-  }
-  return true;
+static FORCE_INLINE char* getTopNRowKey(SColumnInfoData* pOrderCol, int32_t slot) {
+  return pOrderCol->pData + (size_t)slot * pOrderCol->info.bytes;
 }
 
-// this is a blocking operator
-static SSDataBlock* doAggregate(void* param, bool* newgroup) {
-  SOperatorInfo* pOperator = (SOperatorInfo*) param;
-  if (pOperator->status == OP_EXEC_DONE) {
-    return NULL;
-  }
+// the heap is ordered by comparFn in reverse, so the root is the row that goes last in the rows kept
+static void doTopNSiftUp(STopNOperatorInfo* pInfo, SColumnInfoData* pOrderCol, int32_t pos) {
+  int32_t* pHeap = pInfo->pHeap;
 
-  SAggOperatorInfo* pAggInfo = pOperator->info;
-  SOptrBasicInfo* pInfo = &pAggInfo->binfo;
+  while (pos > 0) {
+    int32_t parent = (pos - 1) >> 1;
+    if (pInfo->comparFn(getTopNRowKey(pOrderCol, pHeap[pos]), getTopNRowKey(pOrderCol, pHeap[parent])) <= 0) {
+      break;
+    }
 
-  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+    SWAP(pHeap[pos], pHeap[parent], int32_t);
+    pos = parent;
+  }
+}
 
-  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
-  int32_t order = pQueryAttr->order.order;
+static void doTopNSiftDown(STopNOperatorInfo* pInfo, SColumnInfoData* pOrderCol, int32_t pos) {
+  int32_t* pHeap = pInfo->pHeap;
 
-  SOperatorInfo* upstream = pOperator->upstream[0];
+  while (1) {
+    int32_t child = (pos << 1) + 1;
+    if (child >= pInfo->size) {
+      break;
+    }
 
-  while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
-    SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    if (child + 1 < pInfo->size &&
+        pInfo->comparFn(getTopNRowKey(pOrderCol, pHeap[child + 1]), getTopNRowKey(pOrderCol, pHeap[child])) > 0) {
+      child += 1;
+    }
 
-    if (pBlock == NULL) {
+    if (pInfo->comparFn(getTopNRowKey(pOrderCol, pHeap[child]), getTopNRowKey(pOrderCol, pHeap[pos])) <= 0) {
+      break;
+    }
+
+    SWAP(pHeap[pos], pHeap[child], int32_t);
+    pos = child;
+  }
+}
+
+static void doCopyTopNRow(STopNOperatorInfo* pInfo, SSDataBlock* pBlock, int32_t rowIndex, int32_t slot) {
+  for (int32_t i = 0; i < pInfo->pDataBlock->info.numOfCols; ++i) {
+    SColumnInfoData* pDst = taosArrayGet(pInfo->pDataBlock->pDataBlock, i);
+    SColumnInfoData* pSrc = taosArrayGet(pBlock->pDataBlock, i);
+
+    int32_t bytes = pDst->info.bytes;
+    memcpy(pDst->pData + (size_t)slot * bytes, pSrc->pData + (size_t)rowIndex * bytes, bytes);
+  }
+}
+
+/*
+ * Once the heap is full, a block is skipped as a whole if its first row in order does not go before the root. The
+ * bound is taken by the min/max kernel over the raw values, which orders the integer types the same as comparFn does,
+ * the NULL values included.
+ */
+static bool topNBlockSkippable(STopNOperatorInfo* pInfo, SColumnInfoData* pOrderCol, SSDataBlock* pBlock) {
+  int32_t type = pOrderCol->info.type;
+  if (!IS_SIGNED_NUMERIC_TYPE(type) && !IS_UNSIGNED_NUMERIC_TYPE(type) && type != TSDB_DATA_TYPE_TIMESTAMP &&
+      type != TSDB_DATA_TYPE_BOOL) {
+    return false;
+  }
+
+  if (type == TSDB_DATA_TYPE_TIMESTAMP) {
+    type = TSDB_DATA_TYPE_BIGINT;
+  } else if (type == TSDB_DATA_TYPE_BOOL) {
+    type = TSDB_DATA_TYPE_TINYINT;
+  }
+
+  SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, pInfo->colIndex);
+
+  char first[sizeof(int64_t)];
+  memcpy(first, pCol->pData, pOrderCol->info.bytes);
+  aggMinMax(pCol->pData, type, pBlock->info.rows, false, pInfo->order == TSDB_ORDER_ASC, first, NULL);
+
+  return pInfo->comparFn(first, getTopNRowKey(pOrderCol, pInfo->pHeap[0])) >= 0;
+}
+
+static void doTopNDataBlock(STopNOperatorInfo* pInfo, SSDataBlock* pBlock) {
+  SColumnInfoData* pOrderCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, pInfo->colIndex);
+  SColumnInfoData* pCol      = taosArrayGet(pBlock->pDataBlock, pInfo->colIndex);
+
+  if (pInfo->size == pInfo->numOfRows && topNBlockSkippable(pInfo, pOrderCol, pBlock)) {
+    pInfo->numOfSkipBlocks += 1;
+    return;
+  }
+
+  int32_t bytes = pOrderCol->info.bytes;
+  for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+    if (pInfo->size < pInfo->numOfRows) {
+      doCopyTopNRow(pInfo, pBlock, i, pInfo->size);
+      pInfo->pHeap[pInfo->size] = pInfo->size;
+      pInfo->size += 1;
+      doTopNSiftUp(pInfo, pOrderCol, pInfo->size - 1);
+      continue;
+    }
+
+    if (pInfo->comparFn(pCol->pData + (size_t)i * bytes, getTopNRowKey(pOrderCol, pInfo->pHeap[0])) >= 0) {
+      continue;
+    }
+
+    doCopyTopNRow(pInfo, pBlock, i, pInfo->pHeap[0]);
+    doTopNSiftDown(pInfo, pOrderCol, 0);
+  }
+}
+
+static SSDataBlock* doTopN(void* param, bool* newgroup) {
+  SOperatorInfo* pOperator = (SOperatorInfo*) param;
+  if (pOperator->status == OP_EXEC_DONE) {
+    return NULL;
+  }
+
+  STopNOperatorInfo* pInfo = pOperator->info;
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+
+  while(1) {
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
+    SSDataBlock* pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
+
+    if (pBlock == NULL) {
+      break;
+    }
+
+    if (pBlock->info.rows > 0) {
+      doTopNDataBlock(pInfo, pBlock);
+    }
+  }
+
+  doSetOperatorCompleted(pOperator);
+
+  // rows kept take the slots from 0 to size - 1
+  pInfo->pDataBlock->info.rows = pInfo->size;
+  doSortDataBlock(pInfo->pDataBlock, pInfo->colIndex, pInfo->comparFn);
+
+  qDebug("QInfo:0x%"PRIx64" top %d rows kept, %"PRId64" blocks skipped", GET_QID(pRuntimeEnv), pInfo->size,
+         pInfo->numOfSkipBlocks);
+  return (pInfo->pDataBlock->info.rows > 0)? pInfo->pDataBlock:NULL;
+}
+
+/*
+ * The rows kept are bounded by numOfRows, so they are not spilled to disk. If they do not fit in the memory budget of
+ * the sort, the order operator is created instead.
+ */
+SOperatorInfo *createTopNOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput, SOrderVal* pOrderVal, int64_t numOfRows) {
+  int64_t rowSize = 0;
+  for (int32_t i = 0; i < numOfOutput; ++i) {
+    rowSize += pExpr[i].base.resBytes;
+  }
+
+  int64_t bufSize = ((int64_t)tsSortBufferSize) * 1048576L;
+  if (numOfRows <= 0 || numOfRows > INT32_MAX || numOfRows * MAX(rowSize, 1) >= bufSize / 2) {
+    return createOrderOperatorInfo(pRuntimeEnv, upstream, pExpr, numOfOutput, pOrderVal);
+  }
+
+  STopNOperatorInfo* pInfo = calloc(1, sizeof(STopNOperatorInfo));
+  if (pInfo == NULL) {
+    return NULL;
+  }
+
+  for (int32_t i = 0; i < numOfOutput; ++i) {
+    if (pExpr[i].base.colInfo.colId == pOrderVal->orderColId) {
+      pInfo->colIndex = i;
+    }
+  }
+
+  pInfo->order      = pOrderVal->order;
+  pInfo->numOfRows  = (int32_t) numOfRows;
+  pInfo->pDataBlock = createOutputBuf(pExpr, numOfOutput, pInfo->numOfRows);
+  pInfo->pHeap      = calloc(pInfo->numOfRows, sizeof(int32_t));
+  if (pInfo->pDataBlock == NULL || pInfo->pHeap == NULL) {
+    goto _clean;
+  }
+
+  SColumnInfoData* pOrderCol = taosArrayGet(pInfo->pDataBlock->pDataBlock, pInfo->colIndex);
+  pInfo->comparFn = getKeyComparFunc(pOrderCol->info.type, pInfo->order);
+
+  SOperatorInfo* pOperator = calloc(1, sizeof(SOperatorInfo));
+  if (pOperator == NULL) {
+    goto _clean;
+  }
+
+  pOperator->name          = "TopNOperator";
+  pOperator->operatorType  = OP_TopN;
+  pOperator->blockingOptr  = true;
+  pOperator->status        = OP_IN_EXECUTING;
+  pOperator->info          = pInfo;
+  pOperator->exec          = doTopN;
+  pOperator->cleanup       = destroyTopNOperatorInfo;
+  pOperator->pRuntimeEnv   = pRuntimeEnv;
+
+  appendUpstream(pOperator, upstream);
+  return pOperator;
+
+_clean:
+  destroyTopNOperatorInfo((void *)pInfo, numOfOutput);
+  tfree(pInfo);
+
+  return NULL;
+}
+
+static int32_t getTableScanOrder(STableScanInfo* pTableScanInfo) {
+  return pTableScanInfo->order;
+}
+
+// check all SQLFunctionCtx is completed
+static bool allCtxCompleted(SOperatorInfo* pOperator, SQLFunctionCtx* pCtx) {
+  // only one false, return false
+  for(int32_t i = 0; i < pOperator->numOfOutput; i++) {
+    if(pCtx[i].resultInfo == NULL)
+      return false;
+    if(!pCtx[i].resultInfo->complete)
+      return false;
+  }
+  return true;
+}
+
+// this is a blocking operator
+static SSDataBlock* doAggregate(void* param, bool* newgroup) {
+  SOperatorInfo* pOperator = (SOperatorInfo*) param;
+  if (pOperator->status == OP_EXEC_DONE) {
+    return NULL;
+  }
+
+  SAggOperatorInfo* pAggInfo = pOperator->info;
+  SOptrBasicInfo* pInfo = &pAggInfo->binfo;
+
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+
+  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
+  int32_t order = pQueryAttr->order.order;
+
+  SOperatorInfo* upstream = pOperator->upstream[0];
+
+  while(1) {
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
+    SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
+
+    if (pBlock == NULL) {
       break;
     }
 
@@ -6080,9 +7153,9 @@ static SSDataBlock* doSTableAggregate(void* param, bool* newgroup) {
   SOperatorInfo* upstream = pOperator->upstream[0];
 
   while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       break;
@@ -6180,9 +7253,9 @@ static SSDataBlock* doProjectOperation(void* param, bool* newgroup) {
     bool prevVal = *newgroup;
 
     // The upstream exec may change the value of the newgroup, so use a local variable instead.
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       //assert(*newgroup == false);
@@ -6253,9 +7326,9 @@ static SSDataBlock* doLimit(void* param, bool* newgroup) {
 
   SSDataBlock* pBlock = NULL;
   while (1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       doSetOperatorCompleted(pOperator);
@@ -6322,9 +7395,9 @@ static SSDataBlock* doFilter(void* param, bool* newgroup) {
   SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
 
   while (1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock *pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       break;
@@ -6380,9 +7453,9 @@ static SSDataBlock* doIntervalAgg(void* param, bool* newgroup) {
   SOperatorInfo* upstream = pOperator->upstream[0];
 
   while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       break;
@@ -6815,9 +7888,9 @@ static SSDataBlock* doTimeEvery(void* param, bool* newgroup) {
     bool prevVal = *newgroup;
 
     // The upstream exec may change the value of the newgroup, so use a local variable instead.
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       if (!pEveryInfo->groupDone) {
@@ -6928,9 +8001,9 @@ static SSDataBlock* doSTableIntervalAgg(void* param, bool* newgroup) {
 
   STableId prevId = {0, 0};
   while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       break;
@@ -7070,9 +8143,9 @@ static SSDataBlock* doStateWindowAgg(void *param, bool* newgroup) {
   STimeWindow win = pQueryAttr->window;
   SOperatorInfo* upstream = pOperator->upstream[0];
   while (1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       break;
@@ -7132,9 +8205,9 @@ static SSDataBlock* doSessionWindowAgg(void* param, bool* newgroup) {
   SOperatorInfo* upstream = pOperator->upstream[0];
 
   while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
     if (pBlock == NULL) {
       break;
     }
@@ -7185,9 +8258,9 @@ static SSDataBlock* hashGroupbyAggregate(void* param, bool* newgroup) {
   SOperatorInfo* upstream = pOperator->upstream[0];
 
   while(1) {
-    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = upstream->exec(upstream, newgroup);
-    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(upstream, QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
     if (pBlock == NULL) {
       break;
     }
@@ -7268,9 +8341,9 @@ static SSDataBlock* doFill(void* param, bool* newgroup) {
   }
 
   while(1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     SSDataBlock* pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (*newgroup) {
       assert(pBlock != NULL);
@@ -7472,9 +8545,14 @@ static void destroyGroupbyOperatorInfo(void* param, int32_t numOfOutput) {
   doDestroyBasicInfo(&pInfo->binfo, numOfOutput);
   taosArrayDestroy(&pInfo->pGroupbyDataInfo);
 
-  if (pInfo->prevData) {
-    tfree(pInfo->prevData);
-  }
+  tfree(pInfo->keyBuf);
+  tfree(pInfo->groupKey);
+  tfree(pInfo->groupNull);
+  tfree(pInfo->rowGroup);
+  tfree(pInfo->groupRows);
+  tfree(pInfo->rowOrder);
+  tfree(pInfo->slots);
+  destroyOutputBuf(pInfo->pSortedBlock);
 }
 
 static void destroyProjectOperatorInfo(void* param, int32_t numOfOutput) {
@@ -7506,6 +8584,44 @@ static void destroyOrderOperatorInfo(void* param, int32_t numOfOutput) {
   if (pInfo->pDataBlock) {
     pInfo->pDataBlock = destroyOutputBuf(pInfo->pDataBlock);
   }
+
+  pInfo->pRes = destroyOutputBuf(pInfo->pRes);
+  destroyResultBuf(pInfo->pSortBuf);
+  pInfo->pSortBuf = NULL;
+
+  tfree(pInfo->pSources);
+  tfree(pInfo->pMergeTree);
+}
+
+static void destroyPartitionAggOperatorInfo(void* param, int32_t numOfOutput) {
+  SPartitionAggOperatorInfo* pInfo = (SPartitionAggOperatorInfo*) param;
+  tsem_destroy(&pInfo->finished);
+
+  if (pInfo->pPartitions == NULL) {
+    return;
+  }
+
+  for (int32_t i = 0; i < pInfo->numOfPartitions; ++i) {
+    SQueryRuntimeEnv* pPartEnv = &pInfo->pPartitions[i].runtimeEnv;
+    if (pPartEnv->pQueryAttr == NULL) {
+      continue;
+    }
+
+    teardownQueryRuntimeEnv(pPartEnv);
+
+    // the tables are kept by the query, only the lists of the partition are released
+    doDestroyTableGroupList(pPartEnv->tableqinfoGroupInfo.pGroupList);
+    taosHashCleanup(pPartEnv->tableqinfoGroupInfo.map);
+  }
+
+  tfree(pInfo->pPartitions);
+}
+
+static void destroyTopNOperatorInfo(void* param, int32_t numOfOutput) {
+  STopNOperatorInfo* pInfo = (STopNOperatorInfo*) param;
+
+  pInfo->pDataBlock = destroyOutputBuf(pInfo->pDataBlock);
+  tfree(pInfo->pHeap);
 }
 
 static void destroyConditionOperatorInfo(void* param, int32_t numOfOutput) {
@@ -7576,6 +8692,445 @@ _clean:
   return NULL;
 }
 
+enum {
+  QUERY_PARTITION_PENDING = 0,
+  QUERY_PARTITION_RUNNING = 1,
+};
+
+static void* queryPartitionSched = NULL;
+
+int32_t qInitQueryPartitionPool(void) {
+  if (tsQueryParallelism <= 1) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  queryPartitionSched = taosInitScheduler(1024, MAX(1, tsNumOfCores), "qpart");
+  if (queryPartitionSched == NULL) {
+    qError("failed to init the query partition pool");
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+void qCleanupQueryPartitionPool(void) {
+  if (queryPartitionSched != NULL) {
+    taosCleanUpScheduler(queryPartitionSched);
+    queryPartitionSched = NULL;
+  }
+}
+
+static void doExecQueryPartition(SQueryPartition* pPartition) {
+  SQueryRuntimeEnv* pRuntimeEnv = &pPartition->runtimeEnv;
+
+  int32_t code = setjmp(pRuntimeEnv->env);
+  if (code != TSDB_CODE_SUCCESS) {
+    pPartition->code = code;
+    return;
+  }
+
+  // all the tables are aggregated by the first call, the result rows are merged by the query afterwards
+  bool newgroup = false;
+  pRuntimeEnv->proot->exec(pRuntimeEnv->proot, &newgroup);
+}
+
+static void doRunQueryPartition(SQueryPartition* pPartition) {
+  if (atomic_val_compare_exchange_8(&pPartition->state, QUERY_PARTITION_PENDING, QUERY_PARTITION_RUNNING) ==
+      QUERY_PARTITION_PENDING) {
+    doExecQueryPartition(pPartition);
+  }
+}
+
+static void doRunQueryPartitionTask(SSchedMsg* pMsg) {
+  SPartitionAggOperatorInfo* pInfo = pMsg->ahandle;
+
+  doRunQueryPartition(pMsg->thandle);
+  tsem_post(&pInfo->finished);
+}
+
+/*
+ * The partitions after the first one are scheduled on the partition pool, the query thread runs the first one and then
+ * any partition no thread of the pool has taken yet, so a busy pool does not hold up the query.
+ */
+static void doRunQueryPartitions(SOperatorInfo* pOperator, SPartitionAggOperatorInfo* pInfo) {
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+  SQInfo*           pQInfo = pRuntimeEnv->qinfo;
+
+  int32_t numOfScheduled = 0;
+  if (queryPartitionSched != NULL) {
+    for (int32_t i = 1; i < pInfo->numOfPartitions; ++i, ++numOfScheduled) {
+      SSchedMsg schedMsg = {0};
+      schedMsg.fp      = doRunQueryPartitionTask;
+      schedMsg.ahandle = pInfo;
+      schedMsg.thandle = &pInfo->pPartitions[i];
+      taosScheduleTask(queryPartitionSched, &schedMsg);
+    }
+  }
+
+  qDebug("QInfo:0x%"PRIx64" %u tables in %d partitions, %d scheduled", pQInfo->qId,
+         pRuntimeEnv->tableqinfoGroupInfo.numOfTables, pInfo->numOfPartitions, numOfScheduled);
+
+  for (int32_t i = 0; i < pInfo->numOfPartitions; ++i) {
+    doRunQueryPartition(&pInfo->pPartitions[i]);
+  }
+
+  // the tasks refer to the partitions, wait for all of them even if their partitions are run by the query thread
+  for (int32_t i = 0; i < numOfScheduled; ++i) {
+    tsem_wait(&pInfo->finished);
+  }
+
+  int32_t code = TSDB_CODE_SUCCESS;
+  for (int32_t i = 0; i < pInfo->numOfPartitions; ++i) {
+    SQueryPartition* pPartition = &pInfo->pPartitions[i];
+
+    SQueryCostInfo* pSummary = &pQInfo->summary;
+    pSummary->totalBlocks      += pPartition->cost.totalBlocks;
+    pSummary->totalRows        += pPartition->cost.totalRows;
+    pSummary->totalCheckedRows += pPartition->cost.totalCheckedRows;
+    pSummary->loadBlocks       += pPartition->cost.loadBlocks;
+    pSummary->loadBlockStatis  += pPartition->cost.loadBlockStatis;
+    pSummary->discardBlocks    += pPartition->cost.discardBlocks;
+
+    STsdbReadCost cost = {0};
+    tsdbGetQueryReadCost(pPartition->runtimeEnv.pQueryHandle, &cost);
+    pSummary->loadFileBlockSize += cost.readBytes;
+    pSummary->decompBlockSize   += cost.decompBytes;
+    pSummary->blockCacheHits    += cost.cacheHits;
+
+    if (pPartition->code != TSDB_CODE_SUCCESS) {
+      code = pPartition->code;
+    }
+  }
+
+  if (code != TSDB_CODE_SUCCESS) {
+    longjmp(pRuntimeEnv->env, code);
+  }
+}
+
+static SResultRow* getTableGroupResultRow(SQueryRuntimeEnv* pRuntimeEnv, int32_t tableGroupId) {
+  // the same key as doSetTableGroupOutputBuf
+  uint64_t uid = 0;
+  SET_RES_WINDOW_KEY(pRuntimeEnv->keyBuf, (char*) &tableGroupId, sizeof(tableGroupId), uid);
+
+  SResultRow** p = (SResultRow**) taosHashGet(pRuntimeEnv->pResultRowHashTable, pRuntimeEnv->keyBuf,
+                                               GET_RES_WINDOW_KEY_LEN(sizeof(tableGroupId)));
+  return (p != NULL)? *p:NULL;
+}
+
+static void doMergeTableGroupResultRow(SQueryAttr* pQueryAttr, SOptrBasicInfo* pDstInfo, SQueryRuntimeEnv* pDstEnv,
+                                       SResultRow* pDst, SOptrBasicInfo* pSrcInfo, SQueryRuntimeEnv* pSrcEnv,
+                                       SResultRow* pSrc, bool created) {
+  tFilePage* pDstPage = getResBufPage(pDstEnv->pResultBuf, pDst->pageId);
+  tFilePage* pSrcPage = getResBufPage(pSrcEnv->pResultBuf, pSrc->pageId);
+
+  int32_t offset = 0;
+  for (int32_t i = 0; i < pQueryAttr->numOfOutput; ++i) {
+    SQLFunctionCtx* pCtx = &pDstInfo->pCtx[i];
+
+    char* dst = getPosInResultPage(pQueryAttr, pDstPage, pDst->offset, offset);
+    char* src = getPosInResultPage(pQueryAttr, pSrcPage, pSrc->offset, offset);
+    if (created) {
+      memcpy(dst, src, pCtx->outputBytes);
+    } else {
+      mergeIntermediateResult(pCtx->functionId, pCtx->inputType, pCtx->inputBytes, dst, src);
+    }
+
+    SResultRowCellInfo* pDstCell = getResultCell(pDst, i, pDstInfo->rowCellInfoOffset);
+    SResultRowCellInfo* pSrcCell = getResultCell(pSrc, i, pSrcInfo->rowCellInfoOffset);
+    if (pSrcCell->hasResult == DATA_SET_FLAG) {
+      pDstCell->hasResult = DATA_SET_FLAG;
+    }
+
+    pDstCell->numOfRes = MAX(pDstCell->numOfRes, pSrcCell->numOfRes);
+    offset += pCtx->outputBytes;
+  }
+
+  pDst->numOfRows = MAX(pDst->numOfRows, pSrc->numOfRows);
+}
+
+/*
+ * The result row of a group in each partition is merged into the one of the first partition, which is created there if
+ * the first partition has no table of the group. The merged rows are returned in the order of the groups, one row for
+ * a group, like the result of a vnode without partitions.
+ */
+static void doMergeQueryPartitions(SOperatorInfo* pOperator, SPartitionAggOperatorInfo* pInfo) {
+  SQueryRuntimeEnv* pRuntimeEnv = pOperator->pRuntimeEnv;
+  SQueryAttr*       pQueryAttr = pRuntimeEnv->pQueryAttr;
+  SQueryRuntimeEnv* pDstEnv = &pInfo->pPartitions[0].runtimeEnv;
+  SOptrBasicInfo*   pDstInfo = &((SAggOperatorInfo*) pDstEnv->proot->info)->binfo;
+
+  int32_t numOfGroups = (int32_t) GET_NUM_OF_TABLEGROUP(pRuntimeEnv);
+
+  SArray* pRows = taosArrayInit(numOfGroups, POINTER_BYTES);
+  if (pRows == NULL) {
+    longjmp(pRuntimeEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+  }
+
+  // the result row of the first partition may be created for a group, which jumps back to the env of the partition
+  int32_t code = setjmp(pDstEnv->env);
+  if (code != TSDB_CODE_SUCCESS) {
+    taosArrayDestroy(&pRows);
+    longjmp(pRuntimeEnv->env, code);
+  }
+
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SResultRow* pDst = getTableGroupResultRow(pDstEnv, i);
+
+    for (int32_t j = 1; j < pInfo->numOfPartitions; ++j) {
+      SQueryRuntimeEnv* pSrcEnv = &pInfo->pPartitions[j].runtimeEnv;
+      SOptrBasicInfo*   pSrcInfo = &((SAggOperatorInfo*) pSrcEnv->proot->info)->binfo;
+
+      SResultRow* pSrc = getTableGroupResultRow(pSrcEnv, i);
+      if (pSrc == NULL || pSrc->pageId == -1) {
+        continue;
+      }
+
+      bool created = (pDst == NULL);
+      if (created) {
+        doSetTableGroupOutputBuf(pDstEnv, &pDstInfo->resultRowInfo, pDstInfo->pCtx, pDstInfo->rowCellInfoOffset,
+                                 pQueryAttr->numOfOutput, i);
+        pDst = getTableGroupResultRow(pDstEnv, i);
+        if (pDst == NULL || pDst->pageId == -1) {
+          longjmp(pDstEnv->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+        }
+      }
+
+      doMergeTableGroupResultRow(pQueryAttr, pDstInfo, pDstEnv, pDst, pSrcInfo, pSrcEnv, pSrc, created);
+    }
+
+    if (pDst != NULL) {
+      taosArrayPush(pRows, &pDst);
+    }
+  }
+
+  taosArrayDestroy(&pDstEnv->groupResInfo.pRows);
+  pDstEnv->groupResInfo.pRows = pRows;
+  pDstEnv->groupResInfo.index = 0;
+}
+
+static SSDataBlock* doPartitionAggregate(void* param, bool* newgroup) {
+  SOperatorInfo* pOperator = (SOperatorInfo*) param;
+  if (pOperator->status == OP_EXEC_DONE) {
+    return NULL;
+  }
+
+  SPartitionAggOperatorInfo* pInfo = pOperator->info;
+  if (!pInfo->executed) {
+    doRunQueryPartitions(pOperator, pInfo);
+    doMergeQueryPartitions(pOperator, pInfo);
+    pInfo->executed = true;
+  }
+
+  SQueryRuntimeEnv* pDstEnv = &pInfo->pPartitions[0].runtimeEnv;
+  SSDataBlock*      pRes = ((SAggOperatorInfo*) pDstEnv->proot->info)->binfo.pRes;
+
+  toSSDataBlock(&pDstEnv->groupResInfo, pDstEnv, pRes);
+  if (pRes->info.rows == 0 || !hasRemainDataInCurrentGroup(&pDstEnv->groupResInfo)) {
+    doSetOperatorCompleted(pOperator);
+  }
+
+  return (pRes->info.rows > 0)? pRes:NULL;
+}
+
+static int32_t doInitQueryPartition(SQueryRuntimeEnv* pRuntimeEnv, SQueryPartition* pPartition,
+                                    STableGroupInfo* pTableGroupInfo) {
+  SQueryAttr*       pQueryAttr = pRuntimeEnv->pQueryAttr;
+  SQueryRuntimeEnv* pPartEnv = &pPartition->runtimeEnv;
+
+  // the memory snapshot has been taken by the query handle of the query, for all the tables
+  STsdbQueryCond cond = createTsdbQueryCond(pQueryAttr, &pQueryAttr->window);
+  pPartEnv->pQueryHandle = tsdbQueryTables(pQueryAttr->tsdb, &cond, pTableGroupInfo, GET_QID(pRuntimeEnv), &pQueryAttr->memRef);
+  if (pPartEnv->pQueryHandle == NULL) {
+    return (terrno != TSDB_CODE_SUCCESS)? terrno:TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  int32_t ps = DEFAULT_PAGE_SIZE;
+  getIntermediateBufInfo(pPartEnv, &ps, &pQueryAttr->intermediateResultRowSize);
+
+  int32_t code = createDiskbasedResultBuffer(&pPartEnv->pResultBuf, ps, 1024 * 1024 * 20, GET_QID(pRuntimeEnv));
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  pPartEnv->proot = createTableScanOperator(pPartEnv->pQueryHandle, pPartEnv, 1);
+  if (pPartEnv->proot == NULL) {
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  int32_t op = OP_MultiTableAggregate;
+  SArray* plan = taosArrayInit(1, sizeof(int32_t));
+  if (plan == NULL) {
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  taosArrayPush(plan, &op);
+  code = setupQueryRuntimeEnv(pPartEnv, (int32_t) pPartEnv->tableqinfoGroupInfo.numOfTables, plan, NULL);
+  taosArrayDestroy(&plan);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  setQueryStatus(pPartEnv, QUERY_NOT_COMPLETED);
+  return TSDB_CODE_SUCCESS;
+}
+
+static void doDestroyTableGroupList(SArray* pGroupList) {
+  size_t numOfGroups = taosArrayGetSize(pGroupList);
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SArray* p = taosArrayGetP(pGroupList, i);
+    taosArrayDestroy(&p);
+  }
+
+  taosArrayDestroy(&pGroupList);
+}
+
+/*
+ * The tables of every group are dealt out to the partitions in turn. A partition keeps the STableQueryInfo of its
+ * tables in the groups of the query, so the group index of the results is the same, but the groups without any table
+ * of the partition are left out of the table list for the tsdb query handle.
+ */
+SOperatorInfo* createPartitionAggOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv) {
+  SQueryAttr* pQueryAttr = pRuntimeEnv->pQueryAttr;
+
+  SPartitionAggOperatorInfo* pInfo = calloc(1, sizeof(SPartitionAggOperatorInfo));
+  if (pInfo == NULL) {
+    return NULL;
+  }
+
+  tsem_init(&pInfo->finished, 0, 0);
+
+  int32_t numOfPartitions = getNumOfQueryPartitions(pRuntimeEnv);
+  size_t  numOfGroups = GET_NUM_OF_TABLEGROUP(pRuntimeEnv);
+
+  STableGroupInfo* pTableGroupInfo = calloc(numOfPartitions, sizeof(STableGroupInfo));
+  SArray**         pKeyList = calloc(numOfPartitions, POINTER_BYTES);
+
+  pInfo->pPartitions = calloc(numOfPartitions, sizeof(SQueryPartition));
+  if (pInfo->pPartitions == NULL || pTableGroupInfo == NULL || pKeyList == NULL) {
+    goto _clean;
+  }
+
+  pInfo->numOfPartitions = numOfPartitions;
+  for (int32_t i = 0; i < numOfPartitions; ++i) {
+    SQueryPartition*  pPartition = &pInfo->pPartitions[i];
+    SQueryRuntimeEnv* pPartEnv = &pPartition->runtimeEnv;
+
+    pPartEnv->qinfo       = pRuntimeEnv->qinfo;
+    pPartEnv->pQueryAttr  = pQueryAttr;
+    pPartEnv->pPartition  = pPartition;
+    pPartEnv->resultInfo  = pRuntimeEnv->resultInfo;
+    pPartEnv->cur.vgroupIndex = -1;
+    pPartEnv->groupResInfo.totalGroup = (int32_t) numOfGroups;
+
+    pPartEnv->tableqinfoGroupInfo.pGroupList = taosArrayInit(numOfGroups, POINTER_BYTES);
+    pPartEnv->tableqinfoGroupInfo.map =
+        taosHashInit(pRuntimeEnv->tableqinfoGroupInfo.numOfTables / numOfPartitions + 1,
+                     taosGetDefaultHashFunction(TSDB_DATA_TYPE_INT), true, HASH_NO_LOCK);
+    pTableGroupInfo[i].pGroupList = taosArrayInit(numOfGroups, POINTER_BYTES);
+    if (pPartEnv->tableqinfoGroupInfo.pGroupList == NULL || pPartEnv->tableqinfoGroupInfo.map == NULL ||
+        pTableGroupInfo[i].pGroupList == NULL) {
+      goto _clean;
+    }
+  }
+
+  int64_t index = 0;
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SArray* group = GET_TABLEGROUP(pRuntimeEnv, i);
+    SArray* pKeys = taosArrayGetP(pQueryAttr->tableGroupInfo.pGroupList, i);
+
+    for (int32_t j = 0; j < numOfPartitions; ++j) {
+      SArray* p = taosArrayInit(4, POINTER_BYTES);
+      if (p == NULL || taosArrayPush(pInfo->pPartitions[j].runtimeEnv.tableqinfoGroupInfo.pGroupList, &p) == NULL) {
+        taosArrayDestroy(&p);
+        goto _clean;
+      }
+
+      pKeyList[j] = taosArrayInit(4, sizeof(STableKeyInfo));
+      if (pKeyList[j] == NULL) {
+        goto _clean;
+      }
+    }
+
+    size_t num = taosArrayGetSize(group);
+    for (int32_t j = 0; j < num; ++j, ++index) {
+      STableQueryInfo*  item = taosArrayGetP(group, j);
+      SQueryRuntimeEnv* pPartEnv = &pInfo->pPartitions[index % numOfPartitions].runtimeEnv;
+
+      SArray* p = taosArrayGetP(pPartEnv->tableqinfoGroupInfo.pGroupList, i);
+      taosArrayPush(p, &item);
+      taosArrayPush(pKeyList[index % numOfPartitions], taosArrayGet(pKeys, j));
+
+      STableId* id = TSDB_TABLEID(item->pTable);
+      taosHashPut(pPartEnv->tableqinfoGroupInfo.map, &id->tid, sizeof(id->tid), &item, POINTER_BYTES);
+      pPartEnv->tableqinfoGroupInfo.numOfTables += 1;
+    }
+
+    for (int32_t j = 0; j < numOfPartitions; ++j) {
+      if (taosArrayGetSize(pKeyList[j]) == 0) {
+        taosArrayDestroy(&pKeyList[j]);
+        continue;
+      }
+
+      pTableGroupInfo[j].numOfTables += taosArrayGetSize(pKeyList[j]);
+      taosArrayPush(pTableGroupInfo[j].pGroupList, &pKeyList[j]);
+      pKeyList[j] = NULL;
+    }
+  }
+
+  for (int32_t i = 0; i < numOfPartitions; ++i) {
+    int32_t code = doInitQueryPartition(pRuntimeEnv, &pInfo->pPartitions[i], &pTableGroupInfo[i]);
+    if (code != TSDB_CODE_SUCCESS) {
+      qError("QInfo:0x%"PRIx64" failed to init table partition %d, code:%s", GET_QID(pRuntimeEnv), i, tstrerror(code));
+      goto _clean;
+    }
+  }
+
+  for (int32_t i = 0; i < numOfPartitions; ++i) {
+    doDestroyTableGroupList(pTableGroupInfo[i].pGroupList);
+  }
+  tfree(pTableGroupInfo);
+  tfree(pKeyList);
+
+  SOperatorInfo* pOperator = calloc(1, sizeof(SOperatorInfo));
+  if (pOperator == NULL) {
+    destroyPartitionAggOperatorInfo(pInfo, pQueryAttr->numOfOutput);
+    tfree(pInfo);
+    return NULL;
+  }
+
+  pOperator->name         = "PartitionAggregate";
+  pOperator->operatorType = OP_PartitionAggregate;
+  pOperator->blockingOptr = true;
+  pOperator->status       = OP_IN_EXECUTING;
+  pOperator->info         = pInfo;
+  pOperator->numOfOutput  = pQueryAttr->numOfOutput;
+  pOperator->pRuntimeEnv  = pRuntimeEnv;
+
+  pOperator->exec         = doPartitionAggregate;
+  pOperator->cleanup      = destroyPartitionAggOperatorInfo;
+  return pOperator;
+
+_clean:
+  if (pTableGroupInfo != NULL) {
+    for (int32_t i = 0; i < numOfPartitions; ++i) {
+      doDestroyTableGroupList(pTableGroupInfo[i].pGroupList);
+    }
+  }
+
+  if (pKeyList != NULL) {
+    for (int32_t i = 0; i < numOfPartitions; ++i) {
+      taosArrayDestroy(&pKeyList[i]);
+    }
+  }
+
+  tfree(pTableGroupInfo);
+  tfree(pKeyList);
+
+  destroyPartitionAggOperatorInfo(pInfo, pQueryAttr->numOfOutput);
+  tfree(pInfo);
+  return NULL;
+}
+
 SOperatorInfo* createProjectOperatorInfo(SQueryRuntimeEnv* pRuntimeEnv, SOperatorInfo* upstream, SExprInfo* pExpr, int32_t numOfOutput) {
   SProjectOperatorInfo* pInfo = calloc(1, sizeof(SProjectOperatorInfo));
   if (pInfo == NULL) {
@@ -8382,9 +9937,9 @@ static SSDataBlock* hashDistinct(void* param, bool* newgroup) {
   SSDataBlock* pBlock = NULL;
 
   while(1) {
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
     pBlock = pOperator->upstream[0]->exec(pOperator->upstream[0], newgroup);
-    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC);
+    publishOperatorProfEvent(pOperator->upstream[0], QUERY_PROF_AFTER_OPERATOR_EXEC, pBlock);
 
     if (pBlock == NULL) {
       doSetOperatorCompleted(pOperator);
@@ -9660,6 +11215,8 @@ SQInfo* createQInfoImpl(SQueryTableMsg* pQueryMsg, SGroupbyExpr* pGroupbyExpr, S
   pQueryAttr->needReverseScan  = pQueryMsg->needReverseScan;
   pQueryAttr->stateWindow      = pQueryMsg->stateWindow;
   pQueryAttr->pFilters        = pFilters;
+  pQueryAttr->hasBloomFilter  = (pFilters != NULL) && filterHasBloomUnit(pFilters);
+  pQueryAttr->explain         = TSDB_QUERY_HAS_TYPE(pQueryMsg->queryType, TSDB_QUERY_TYPE_EXPLAIN);
   pQueryAttr->range           = pQueryMsg->range;
 
   pQueryAttr->tableCols = calloc(numOfCols, sizeof(SSingleColumnFilterInfo));
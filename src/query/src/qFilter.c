@@ -1774,9 +1774,13 @@ void filterFreePCtx(SFilterPCtx *pctx) {
 void filterFreeInfo(SFilterInfo *info) {
   CHK_RETV(info == NULL);
 
+  for (uint32_t i = 0; info->cunits && i < info->unitNum; ++i) {
+    tfree(info->cunits[i].inVals);
+  }
   tfree(info->cunits);
   tfree(info->blkUnitRes);
   tfree(info->blkUnits);
+  tfree(info->vecRes);
   
   for (int32_t i = 0; i < FLD_TYPE_MAX; ++i) {
     for (uint32_t f = 0; f < info->fields[i].num; ++f) {
@@ -2666,6 +2670,9 @@ int32_t filterGenerateComInfo(SFilterInfo *info) {
     
     info->cunits[i].dataSize = FILTER_UNIT_COL_SIZE(info, unit);
     info->cunits[i].dataType = FILTER_UNIT_DATA_TYPE(unit);
+    info->cunits[i].vfunc = NULL;
+    info->cunits[i].inVals = NULL;
+    info->cunits[i].inNum = 0;
   }
   
   return TSDB_CODE_SUCCESS;
@@ -2676,6 +2683,7 @@ int32_t filterUpdateComUnits(SFilterInfo *info) {
     SFilterUnit *unit = &info->units[i];
 
     info->cunits[i].colData = FILTER_UNIT_COL_DATA(info, unit, 0);
+    info->cunits[i].nullFlag = COL_NULL_UNKNOWN;
   }
 
   return TSDB_CODE_SUCCESS;
@@ -2760,9 +2768,12 @@ int32_t filterRmUnitByRange(SFilterInfo *info, SDataStatis *pDataStatis, int32_t
       minRes = (*gRangeCompare[cunit->rfunc])(minVal, minVal, cunit->valData, cunit->valData2, gDataCompare[cunit->func]);
       maxRes = (*gRangeCompare[cunit->rfunc])(maxVal, maxVal, cunit->valData, cunit->valData2, gDataCompare[cunit->func]);
 
+      // the null values of the block never qualify, whatever the range of the others is
       if (minRes && maxRes) {
-        info->blkUnitRes[k] = 1;
-        rmUnit = 1;
+        if (pDataBlockst->numOfNull <= 0) {
+          info->blkUnitRes[k] = 1;
+          rmUnit = 1;
+        }
       } else if ((!minRes) && (!maxRes)) {
         minRes = filterDoCompare(gDataCompare[cunit->func], TSDB_RELATION_LESS_EQUAL, minVal, cunit->valData);
         maxRes = filterDoCompare(gDataCompare[cunit->func], TSDB_RELATION_GREATER_EQUAL, maxVal, cunit->valData2);
@@ -2779,8 +2790,10 @@ int32_t filterRmUnitByRange(SFilterInfo *info, SDataStatis *pDataStatis, int32_t
       maxRes = filterDoCompare(gDataCompare[cunit->func], cunit->optr, maxVal, cunit->valData);
 
       if (minRes && maxRes) {
-        info->blkUnitRes[k] = 1;
-        rmUnit = 1;
+        if (pDataBlockst->numOfNull <= 0) {
+          info->blkUnitRes[k] = 1;
+          rmUnit = 1;
+        }
       } else if ((!minRes) && (!maxRes)) {
         if (cunit->optr == TSDB_RELATION_EQUAL) {
           minRes = filterDoCompare(gDataCompare[cunit->func], TSDB_RELATION_GREATER, minVal, cunit->valData);
@@ -3073,6 +3086,82 @@ static void doJsonCompare(SFilterComUnit *cunit, int8_t *result, void* colData){
   }
 }
 
+// Evaluate the groups column by column with the kernels of the units, return false if any unit has no kernel or column
+// the result of a unit is the same for all rows if the column is all null, or IS [NOT] NULL on a column without null
+static FORCE_INLINE bool filterExecuteUnitByNullFlag(SFilterComUnit *cunit, int32_t numOfRows, int8_t *res) {
+  if (cunit->nullFlag == COL_ALL_NULL) {
+    memset(res, cunit->optr == TSDB_RELATION_ISNULL, numOfRows);
+    return true;
+  }
+
+  if (cunit->nullFlag == COL_HAS_NO_NULL && (cunit->optr == TSDB_RELATION_ISNULL || cunit->optr == TSDB_RELATION_NOTNULL)) {
+    memset(res, cunit->optr == TSDB_RELATION_NOTNULL, numOfRows);
+    return true;
+  }
+
+  return false;
+}
+
+static FORCE_INLINE void filterExecuteUnitVec(SFilterComUnit *cunit, int32_t numOfRows, int8_t *res) {
+  if (!filterExecuteUnitByNullFlag(cunit, numOfRows, res)) {
+    (*cunit->vfunc)(cunit, numOfRows, res);
+  }
+}
+
+static bool filterExecuteVec(SFilterInfo *info, int32_t numOfRows, int8_t *p, bool *all) {
+  int8_t *buf = NULL;
+
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    SFilterComUnit *cunit = &info->cunits[i];
+    if (cunit->colData == NULL) {
+      return false;
+    }
+
+    if (cunit->vfunc == NULL && !(cunit->nullFlag == COL_ALL_NULL ||
+        (cunit->nullFlag == COL_HAS_NO_NULL && (cunit->optr == TSDB_RELATION_ISNULL || cunit->optr == TSDB_RELATION_NOTNULL)))) {
+      return false;
+    }
+  }
+
+  if (info->unitNum > 1) {
+    uint32_t size = sizeof(int8_t) * numOfRows * 2;
+    if (info->vecResSize < size) {
+      buf = realloc(info->vecRes, size);
+      if (buf == NULL) {
+        return false;
+      }
+
+      info->vecRes = buf;
+      info->vecResSize = size;
+    }
+
+    buf = info->vecRes;
+  }
+
+  for (uint32_t g = 0; g < info->groupNum; ++g) {
+    SFilterGroup *group = &info->groups[g];
+    int8_t *gres = (g == 0) ? p : buf;
+
+    for (uint32_t u = 0; u < group->unitNum; ++u) {
+      SFilterComUnit *cunit = &info->cunits[group->unitIdxs[u]];
+
+      if (u == 0) {
+        filterExecuteUnitVec(cunit, numOfRows, gres);
+      } else {
+        filterExecuteUnitVec(cunit, numOfRows, buf + numOfRows);
+        filterVecAnd(gres, buf + numOfRows, numOfRows);
+      }
+    }
+
+    if (g > 0) {
+      filterVecOr(p, gres, numOfRows);
+    }
+  }
+
+  *all = filterVecAllSet(p, numOfRows);
+  return true;
+}
+
 bool filterExecuteImplRange(void *pinfo, int32_t numOfRows, int8_t** p, SDataStatis *statis, int16_t numOfCols) {
   SFilterInfo *info = (SFilterInfo *)pinfo;
   bool all = true;
@@ -3090,6 +3179,10 @@ bool filterExecuteImplRange(void *pinfo, int32_t numOfRows, int8_t** p, SDataSta
   if (*p == NULL) {
     *p = calloc(numOfRows, sizeof(int8_t));
   }
+
+  if (filterExecuteVec(info, numOfRows, *p, &all)) {
+    return all;
+  }
   
   for (int32_t i = 0; i < numOfRows; ++i) {
     if (colData == NULL || isNull(colData, info->cunits[0].dataType)) {
@@ -3121,6 +3214,10 @@ bool filterExecuteImplMisc(void *pinfo, int32_t numOfRows, int8_t** p, SDataStat
   if (*p == NULL) {
     *p = calloc(numOfRows, sizeof(int8_t));
   }
+
+  if (filterExecuteVec(info, numOfRows, *p, &all)) {
+    return all;
+  }
   
   for (int32_t i = 0; i < numOfRows; ++i) {
     uint32_t uidx = info->groups[0].unitIdxs[0];
@@ -3167,6 +3264,10 @@ bool filterExecuteImpl(void *pinfo, int32_t numOfRows, int8_t** p, SDataStatis *
   if (*p == NULL) {
     *p = calloc(numOfRows, sizeof(int8_t));
   }
+
+  if (filterExecuteVec(info, numOfRows, *p, &all)) {
+    return all;
+  }
   
   for (int32_t i = 0; i < numOfRows; ++i) {
     //FILTER_UNIT_CLR_F(info);
@@ -3248,6 +3349,10 @@ int32_t filterSetExecFunc(SFilterInfo *info) {
     return TSDB_CODE_SUCCESS;
   }
 
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    info->cunits[i].vfunc = filterGetVecFunc(&info->cunits[i]);
+  }
+
   if (info->unitNum > 1) {
     info->func = filterExecuteImpl;
     return TSDB_CODE_SUCCESS;
@@ -3336,6 +3441,30 @@ int32_t filterSetColFieldData(SFilterInfo *info, void *param, filer_get_col_from
   return TSDB_CODE_SUCCESS;
 }
 
+int32_t filterSetColFieldNullFlag(SFilterInfo *info, void *param, filer_get_col_null_from_id fp) {
+  CHK_LRET(info == NULL, TSDB_CODE_QRY_APP_ERROR, "info NULL");
+
+  if (FILTER_ALL_RES(info) || FILTER_EMPTY_RES(info)) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  // the flag may cost a scan of the column, only get it for the units whose result it can decide
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    SFilterComUnit *cunit = &info->cunits[i];
+
+    cunit->nullFlag = COL_NULL_UNKNOWN;
+    if (cunit->vfunc != NULL && cunit->optr != TSDB_RELATION_ISNULL && cunit->optr != TSDB_RELATION_NOTNULL) {
+      continue;
+    }
+
+    SFilterField* fi = FILTER_UNIT_LEFT_FIELD(info, &info->units[i]);
+    SSchema* sch = fi->desc;
+    (*fp)(param, sch->colId, &cunit->nullFlag);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t filterSetJsonColFieldData(SFilterInfo *info, void *param, filer_get_col_from_name fp) {
   CHK_LRET(info == NULL, TSDB_CODE_QRY_APP_ERROR, "info NULL");
   CHK_LRET(info->fields[FLD_TYPE_COLUMN].num <= 0, TSDB_CODE_QRY_APP_ERROR, "no column fileds");
@@ -3497,7 +3626,77 @@ bool filterRangeExecute(SFilterInfo *info, SDataStatis *pDataStatis, int32_t num
   return ret;
 }
 
+// Every row of the block qualifies the filter, if one of the groups is satisfied by the block statistics alone.
+bool filterRangeAllQualified(SFilterInfo *info, SDataStatis *pDataStatis, int32_t numOfCols, int32_t numOfRows) {
+  if (FILTER_EMPTY_RES(info)) {
+    return false;
+  }
+
+  if (FILTER_ALL_RES(info)) {
+    return true;
+  }
+
+  if (pDataStatis == NULL || numOfRows <= 0) {
+    return false;
+  }
+
+  info->blkFlag = 0;
+  filterRmUnitByRange(info, pDataStatis, numOfCols, numOfRows);
+
+  bool all = FILTER_GET_FLAG(info->blkFlag, FI_STATUS_BLK_ALL);
+  info->blkFlag = 0;
+
+  return all;
+}
 
+bool filterHasBloomUnit(SFilterInfo *info) {
+  if (FILTER_EMPTY_RES(info) || FILTER_ALL_RES(info)) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    SFilterComUnit *cunit = &info->cunits[i];
+    if (cunit->optr == TSDB_RELATION_EQUAL && cunit->valData != NULL &&
+        (cunit->dataType == TSDB_DATA_TYPE_BINARY || cunit->dataType == TSDB_DATA_TYPE_NCHAR)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// A block can be skipped if every group has an equal condition on a BINARY/NCHAR column whose value the bloom filter
+// of the block rules out.
+bool filterBloomExecute(SFilterInfo *info, filter_bloom_func fp, void *param) {
+  if (FILTER_EMPTY_RES(info)) {
+    return false;
+  }
+
+  if (FILTER_ALL_RES(info)) {
+    return true;
+  }
+
+  for (uint32_t g = 0; g < info->groupNum; ++g) {
+    SFilterGroup *group = &info->groups[g];
+    bool          mayMatch = true;
+
+    for (uint32_t u = 0; u < group->unitNum && mayMatch; ++u) {
+      SFilterComUnit *cunit = &info->cunits[group->unitIdxs[u]];
+      if (cunit->optr != TSDB_RELATION_EQUAL || cunit->valData == NULL ||
+          (cunit->dataType != TSDB_DATA_TYPE_BINARY && cunit->dataType != TSDB_DATA_TYPE_NCHAR)) {
+        continue;
+      }
+
+      mayMatch = (*fp)(param, cunit->colId, varDataVal(cunit->valData), varDataLen(cunit->valData));
+    }
+
+    if (mayMatch) {
+      return true;
+    }
+  }
+
+  return false;
+}
 
 int32_t filterGetTimeRange(SFilterInfo *info, STimeWindow       *win) {
   SFilterRange ra = {0};
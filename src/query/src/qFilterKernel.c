@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "os.h"
+#include "qFilter.h"
+#include "tcompare.h"
+#include "hash.h"
+
+/**
+ * Type specialized kernels evaluating one filter unit over a whole column. They give the same result as the row by row
+ * evaluation with gRangeCompare/gDataCompare: NULL rows are false for every operator but IS NULL.
+ *
+ * The loops are branch free so the compiler vectorizes them. On x86_64 linux each kernel is built for AVX2 besides the
+ * baseline SSE4.2, and the loader picks the clone the CPU supports; elsewhere the plain loop is the scalar fallback.
+ */
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define FILTER_VEC_TARGET __attribute__((target_clones("avx2", "default")))
+#else
+#define FILTER_VEC_TARGET
+#endif
+
+// IN with more values than this is left to the hash lookup
+#define FILTER_VEC_MAX_IN_VALUES 16
+
+typedef struct {
+  filter_vec_func range[8];  // in the order of gRangeCompare
+  filter_vec_func eq;
+  filter_vec_func ne;
+  filter_vec_func isNull;
+  filter_vec_func notNull;
+  filter_vec_func in;
+} SFilterVecKernels;
+
+// comparisons of integer types
+#define FILTER_INT_GT(v, x) ((v) > (x))
+#define FILTER_INT_GE(v, x) ((v) >= (x))
+#define FILTER_INT_LT(v, x) ((v) < (x))
+#define FILTER_INT_LE(v, x) ((v) <= (x))
+#define FILTER_INT_EQ(v, x) ((v) == (x))
+
+// comparisons of float types, same as compareFloatVal/compareDoubleVal without the branches. The NULL of float types
+// is a NAN, for which all of them are false
+#define FILTER_FLT_GT(v, x) (!FLT_EQUAL(v, x) & ((v) > (x)))
+#define FILTER_FLT_GE(v, x) (FLT_EQUAL(v, x) | ((v) > (x)))
+#define FILTER_FLT_LT(v, x) (!FLT_EQUAL(v, x) & ((v) < (x)))
+#define FILTER_FLT_LE(v, x) (FLT_EQUAL(v, x) | ((v) < (x)))
+#define FILTER_FLT_EQ(v, x) FLT_EQUAL(v, x)
+
+#define FILTER_VEC_VAL_KERNEL(_name, _type, _cond)                                          \
+  static FILTER_VEC_TARGET void _name(SFilterComUnit *cunit, int32_t numOfRows, int8_t *res) { \
+    const _type *col = (const _type *)cunit->colData;                                      \
+    const _type  v1 = *(const _type *)cunit->valData;                                      \
+    const _type  v2 = *(const _type *)cunit->valData2;                                     \
+    (void)v1;                                                                              \
+    (void)v2;                                                                              \
+    for (int32_t i = 0; i < numOfRows; ++i) {                                              \
+      const _type v = col[i];                                                              \
+      res[i] = (int8_t)(_cond);                                                            \
+    }                                                                                      \
+  }
+
+#define FILTER_VEC_VAL_KERNELS(_t, _type, NN, GT, GE, LT, LE, EQ)                          \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ee, _type, NN(v) & GT(v, v1) & LT(v, v2))           \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ei, _type, NN(v) & GT(v, v1) & LE(v, v2))           \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ie, _type, NN(v) & GE(v, v1) & LT(v, v2))           \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ii, _type, NN(v) & GE(v, v1) & LE(v, v2))           \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ge, _type, NN(v) & GT(v, v1))                       \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Gi, _type, NN(v) & GE(v, v1))                       \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Le, _type, NN(v) & LT(v, v2))                       \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Li, _type, NN(v) & LE(v, v2))                       \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Eq, _type, NN(v) & EQ(v, v1))                       \
+  FILTER_VEC_VAL_KERNEL(filterVec##_t##Ne, _type, NN(v) & !EQ(v, v1))
+
+// NULL tests and IN compare the bits of the values, like isNull() and the hash set of IN of integers do
+#define FILTER_VEC_BITS_KERNELS(_t, _utype, _null)                                                     \
+  static FILTER_VEC_TARGET void filterVec##_t##IsNull(SFilterComUnit *cunit, int32_t numOfRows,        \
+                                                       int8_t *res) {                                  \
+    const _utype *col = (const _utype *)cunit->colData;                                                \
+    for (int32_t i = 0; i < numOfRows; ++i) res[i] = (int8_t)(col[i] == (_utype)(_null));              \
+  }                                                                                                    \
+  static FILTER_VEC_TARGET void filterVec##_t##NotNull(SFilterComUnit *cunit, int32_t numOfRows,       \
+                                                        int8_t *res) {                                 \
+    const _utype *col = (const _utype *)cunit->colData;                                                \
+    for (int32_t i = 0; i < numOfRows; ++i) res[i] = (int8_t)(col[i] != (_utype)(_null));              \
+  }                                                                                                    \
+  static FILTER_VEC_TARGET void filterVec##_t##In(SFilterComUnit *cunit, int32_t numOfRows, int8_t *res) { \
+    const _utype *col = (const _utype *)cunit->colData;                                                \
+    const _utype *vals = (const _utype *)cunit->inVals;                                                \
+    for (int32_t i = 0; i < numOfRows; ++i) res[i] = 0;                                                \
+    for (int32_t k = 0; k < cunit->inNum; ++k) {                                                       \
+      const _utype x = vals[k];                                                                        \
+      for (int32_t i = 0; i < numOfRows; ++i) res[i] |= (int8_t)(col[i] == x);                         \
+    }                                                                                                  \
+    for (int32_t i = 0; i < numOfRows; ++i) res[i] &= (int8_t)(col[i] != (_utype)(_null));             \
+  }
+
+#define FILTER_NN_INT8(v) ((v) != (int8_t)TSDB_DATA_TINYINT_NULL)
+#define FILTER_NN_INT16(v) ((v) != (int16_t)TSDB_DATA_SMALLINT_NULL)
+#define FILTER_NN_INT32(v) ((v) != (int32_t)TSDB_DATA_INT_NULL)
+#define FILTER_NN_INT64(v) ((v) != (int64_t)TSDB_DATA_BIGINT_NULL)
+#define FILTER_NN_UINT8(v) ((v) != (uint8_t)TSDB_DATA_UTINYINT_NULL)
+#define FILTER_NN_UINT16(v) ((v) != (uint16_t)TSDB_DATA_USMALLINT_NULL)
+#define FILTER_NN_UINT32(v) ((v) != (uint32_t)TSDB_DATA_UINT_NULL)
+#define FILTER_NN_UINT64(v) ((v) != (uint64_t)TSDB_DATA_UBIGINT_NULL)
+#define FILTER_NN_FLT(v) ((v) == (v))
+
+#define FILTER_VEC_INT_KERNELS(_t, _type, NN) \
+  FILTER_VEC_VAL_KERNELS(_t, _type, NN, FILTER_INT_GT, FILTER_INT_GE, FILTER_INT_LT, FILTER_INT_LE, FILTER_INT_EQ)
+#define FILTER_VEC_FLT_KERNELS(_t, _type) \
+  FILTER_VEC_VAL_KERNELS(_t, _type, FILTER_NN_FLT, FILTER_FLT_GT, FILTER_FLT_GE, FILTER_FLT_LT, FILTER_FLT_LE, FILTER_FLT_EQ)
+
+FILTER_VEC_INT_KERNELS(Int8, int8_t, FILTER_NN_INT8)
+FILTER_VEC_INT_KERNELS(Int16, int16_t, FILTER_NN_INT16)
+FILTER_VEC_INT_KERNELS(Int32, int32_t, FILTER_NN_INT32)
+FILTER_VEC_INT_KERNELS(Int64, int64_t, FILTER_NN_INT64)
+FILTER_VEC_INT_KERNELS(Uint8, uint8_t, FILTER_NN_UINT8)
+FILTER_VEC_INT_KERNELS(Uint16, uint16_t, FILTER_NN_UINT16)
+FILTER_VEC_INT_KERNELS(Uint32, uint32_t, FILTER_NN_UINT32)
+FILTER_VEC_INT_KERNELS(Uint64, uint64_t, FILTER_NN_UINT64)
+FILTER_VEC_FLT_KERNELS(Float, float)
+FILTER_VEC_FLT_KERNELS(Double, double)
+
+FILTER_VEC_BITS_KERNELS(Int8, uint8_t, TSDB_DATA_TINYINT_NULL)
+FILTER_VEC_BITS_KERNELS(Int16, uint16_t, TSDB_DATA_SMALLINT_NULL)
+FILTER_VEC_BITS_KERNELS(Int32, uint32_t, TSDB_DATA_INT_NULL)
+FILTER_VEC_BITS_KERNELS(Int64, uint64_t, TSDB_DATA_BIGINT_NULL)
+FILTER_VEC_BITS_KERNELS(Uint8, uint8_t, TSDB_DATA_UTINYINT_NULL)
+FILTER_VEC_BITS_KERNELS(Uint16, uint16_t, TSDB_DATA_USMALLINT_NULL)
+FILTER_VEC_BITS_KERNELS(Uint32, uint32_t, TSDB_DATA_UINT_NULL)
+FILTER_VEC_BITS_KERNELS(Uint64, uint64_t, TSDB_DATA_UBIGINT_NULL)
+FILTER_VEC_BITS_KERNELS(Float, uint32_t, TSDB_DATA_FLOAT_NULL)
+FILTER_VEC_BITS_KERNELS(Double, uint64_t, TSDB_DATA_DOUBLE_NULL)
+
+#define FILTER_VEC_KERNELS_ENTRY(_t)                                                                          \
+  {                                                                                                          \
+    {filterVec##_t##Ee, filterVec##_t##Ei, filterVec##_t##Ie, filterVec##_t##Ii, filterVec##_t##Ge,          \
+     filterVec##_t##Gi, filterVec##_t##Le, filterVec##_t##Li},                                               \
+        filterVec##_t##Eq, filterVec##_t##Ne, filterVec##_t##IsNull, filterVec##_t##NotNull, filterVec##_t##In \
+  }
+
+static const SFilterVecKernels gVecKernels[TSDB_DATA_TYPE_UBIGINT + 1] = {
+    [TSDB_DATA_TYPE_TINYINT] = FILTER_VEC_KERNELS_ENTRY(Int8),
+    [TSDB_DATA_TYPE_SMALLINT] = FILTER_VEC_KERNELS_ENTRY(Int16),
+    [TSDB_DATA_TYPE_INT] = FILTER_VEC_KERNELS_ENTRY(Int32),
+    [TSDB_DATA_TYPE_BIGINT] = FILTER_VEC_KERNELS_ENTRY(Int64),
+    [TSDB_DATA_TYPE_FLOAT] = FILTER_VEC_KERNELS_ENTRY(Float),
+    [TSDB_DATA_TYPE_DOUBLE] = FILTER_VEC_KERNELS_ENTRY(Double),
+    [TSDB_DATA_TYPE_TIMESTAMP] = FILTER_VEC_KERNELS_ENTRY(Int64),
+    [TSDB_DATA_TYPE_UTINYINT] = FILTER_VEC_KERNELS_ENTRY(Uint8),
+    [TSDB_DATA_TYPE_USMALLINT] = FILTER_VEC_KERNELS_ENTRY(Uint16),
+    [TSDB_DATA_TYPE_UINT] = FILTER_VEC_KERNELS_ENTRY(Uint32),
+    [TSDB_DATA_TYPE_UBIGINT] = FILTER_VEC_KERNELS_ENTRY(Uint64),
+};
+
+static int32_t filterVecInitInValues(SFilterComUnit *cunit) {
+  SHashObj *pSet = (SHashObj *)cunit->valData;
+  int32_t   num = taosHashGetSize(pSet);
+
+  if (num <= 0 || num > FILTER_VEC_MAX_IN_VALUES) {
+    return TSDB_CODE_QRY_APP_ERROR;
+  }
+
+  char *vals = malloc((size_t)num * cunit->dataSize);
+  if (vals == NULL) {
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  int32_t n = 0;
+  void *  p = taosHashIterate(pSet, NULL);
+  while (p) {
+    // the keys of integers are put as int64 holding the value of the column type, see filterConvertSetFromBinary()
+    if (n >= num || taosHashGetDataKeyLen(pSet, p) < cunit->dataSize) {
+      taosHashCancelIterate(pSet, p);
+      free(vals);
+      return TSDB_CODE_QRY_APP_ERROR;
+    }
+
+    memcpy(vals + n * cunit->dataSize, taosHashGetDataKey(pSet, p), cunit->dataSize);
+    n++;
+    p = taosHashIterate(pSet, p);
+  }
+
+  cunit->inVals = vals;
+  cunit->inNum = n;
+  return TSDB_CODE_SUCCESS;
+}
+
+filter_vec_func filterGetVecFunc(SFilterComUnit *cunit) {
+  if (cunit->dataType >= tListLen(gVecKernels) || gVecKernels[cunit->dataType].eq == NULL ||
+      cunit->dataSize != tDataTypes[cunit->dataType].bytes) {
+    return NULL;
+  }
+
+  const SFilterVecKernels *pKernels = &gVecKernels[cunit->dataType];
+
+  switch (cunit->optr) {
+    case TSDB_RELATION_ISNULL:
+      return pKernels->isNull;
+    case TSDB_RELATION_NOTNULL:
+      return pKernels->notNull;
+    case TSDB_RELATION_IN:
+      // the set of floats matches with a tolerance, not by bits
+      if (IS_FLOAT_TYPE(cunit->dataType)) {
+        return NULL;
+      }
+      if (cunit->inVals == NULL && filterVecInitInValues(cunit) != TSDB_CODE_SUCCESS) {
+        return NULL;
+      }
+      return pKernels->in;
+    default:
+      break;
+  }
+
+  if (cunit->valData == NULL || cunit->valData2 == NULL) {
+    return NULL;
+  }
+
+  if (cunit->rfunc >= 0) {
+    return pKernels->range[cunit->rfunc];
+  }
+
+  if (cunit->optr == TSDB_RELATION_EQUAL) {
+    return pKernels->eq;
+  } else if (cunit->optr == TSDB_RELATION_NOT_EQUAL) {
+    return pKernels->ne;
+  }
+
+  return NULL;
+}
+
+FILTER_VEC_TARGET void filterVecAnd(int8_t *res, const int8_t *r, int32_t numOfRows) {
+  for (int32_t i = 0; i < numOfRows; ++i) res[i] &= r[i];
+}
+
+FILTER_VEC_TARGET void filterVecOr(int8_t *res, const int8_t *r, int32_t numOfRows) {
+  for (int32_t i = 0; i < numOfRows; ++i) res[i] |= r[i];
+}
+
+FILTER_VEC_TARGET bool filterVecAllSet(const int8_t *res, int32_t numOfRows) {
+  int8_t all = 1;
+  for (int32_t i = 0; i < numOfRows; ++i) all &= res[i];
+
+  return all != 0;
+}
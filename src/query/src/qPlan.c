@@ -592,7 +592,7 @@ SArray* createExecOperatorPlan(SQueryAttr* pQueryAttr) {
       int32_t orderColId = pQueryAttr->order.orderColId;
 
       if (pQueryAttr->vgId == 0 && orderColId != INT32_MIN) {
-        op = OP_Order;
+        op = (pQueryAttr->limit.limit > 0)? OP_TopN:OP_Order;
         taosArrayPush(plan, &op);
       }
     }
@@ -666,7 +666,8 @@ SArray* createExecOperatorPlan(SQueryAttr* pQueryAttr) {
     // outer query order by support
     int32_t orderColId = pQueryAttr->order.orderColId;
     if (pQueryAttr->vgId == 0 && orderColId != INT32_MIN) {
-      op = OP_Order;
+      // only the first offset + limit rows in order are required by the limit operator
+      op = (pQueryAttr->limit.limit > 0)? OP_TopN:OP_Order;
       taosArrayPush(plan, &op);
     }
   }
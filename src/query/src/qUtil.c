@@ -193,6 +193,73 @@ size_t getResultRowSize(SQueryRuntimeEnv* pRuntimeEnv) {
   return (pQueryAttr->numOfOutput * sizeof(SResultRowCellInfo)) + pQueryAttr->interBufSize + sizeof(SResultRow);
 }
 
+static int32_t resultRowHashResize(SResultRowHash* pHash, uint32_t capacity) {
+  SResultRowHashEntry* pEntries = malloc(sizeof(SResultRowHashEntry) * capacity);
+  if (pEntries == NULL) {
+    return TSDB_CODE_QRY_OUT_OF_MEMORY;
+  }
+
+  memset(pEntries, 0xff, sizeof(SResultRowHashEntry) * capacity);
+
+  uint32_t mask = capacity - 1;
+  for (uint32_t i = 0; i < pHash->capacity; ++i) {
+    SResultRowHashEntry* pEntry = &pHash->pEntries[i];
+    if (pEntry->val == -1) {
+      continue;
+    }
+
+    uint32_t j = resultRowHashKey(pEntry->k0, pEntry->k1, pEntry->skey) & mask;
+    while (pEntries[j].val != -1) {
+      j = (j + 1) & mask;
+    }
+
+    pEntries[j] = *pEntry;
+  }
+
+  tfree(pHash->pEntries);
+  pHash->pEntries = pEntries;
+  pHash->capacity = capacity;
+  return TSDB_CODE_SUCCESS;
+}
+
+// insert or update, the table is kept at most half full
+int32_t resultRowHashPut(SResultRowHash* pHash, uint64_t k0, uint64_t k1, TSKEY skey, int64_t val) {
+  assert(val != -1);
+
+  if ((pHash->size + 1) * 2 > pHash->capacity) {
+    int32_t code = resultRowHashResize(pHash, (pHash->capacity == 0) ? 64 : pHash->capacity * 2);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+
+  uint32_t mask = pHash->capacity - 1;
+  uint32_t i = resultRowHashKey(k0, k1, skey) & mask;
+  while (pHash->pEntries[i].val != -1) {
+    SResultRowHashEntry* pEntry = &pHash->pEntries[i];
+    if (pEntry->skey == skey && pEntry->k0 == k0 && pEntry->k1 == k1) {
+      pEntry->val = val;
+      return TSDB_CODE_SUCCESS;
+    }
+
+    i = (i + 1) & mask;
+  }
+
+  pHash->pEntries[i] = (SResultRowHashEntry){.k0 = k0, .k1 = k1, .skey = skey, .val = val};
+  pHash->size += 1;
+  return TSDB_CODE_SUCCESS;
+}
+
+void resultRowHashCleanup(SResultRowHash* pHash) {
+  tfree(pHash->pEntries);
+  pHash->capacity = 0;
+  pHash->size = 0;
+}
+
+size_t resultRowHashGetMemSize(const SResultRowHash* pHash) {
+  return sizeof(SResultRowHashEntry) * pHash->capacity;
+}
+
 SResultRowPool* initResultRowPool(size_t size) {
   SResultRowPool* p = calloc(1, sizeof(SResultRowPool));
   if (p == NULL) {
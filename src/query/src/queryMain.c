@@ -269,7 +269,7 @@ bool qTableQuery(qinfo_t qinfo, uint64_t *qId) {
   qDebug("QInfo:0x%"PRIx64" query task is launched", pQInfo->qId);
 
   bool newgroup = false;
-  publishOperatorProfEvent(pRuntimeEnv->proot, QUERY_PROF_BEFORE_OPERATOR_EXEC);
+  publishOperatorProfEvent(pRuntimeEnv->proot, QUERY_PROF_BEFORE_OPERATOR_EXEC, NULL);
 
   int64_t st = taosGetTimestampUs();
   pRuntimeEnv->outputBuf = pRuntimeEnv->proot->exec(pRuntimeEnv->proot, &newgroup);
@@ -277,7 +277,7 @@ bool qTableQuery(qinfo_t qinfo, uint64_t *qId) {
 #ifdef TEST_IMPL
   waitMoment(pQInfo);
 #endif
-  publishOperatorProfEvent(pRuntimeEnv->proot, QUERY_PROF_AFTER_OPERATOR_EXEC);
+  publishOperatorProfEvent(pRuntimeEnv->proot, QUERY_PROF_AFTER_OPERATOR_EXEC, pRuntimeEnv->outputBuf);
   pRuntimeEnv->resultInfo.total += GET_NUM_OF_RESULTS(pRuntimeEnv);
 
   if (isQueryKilled(pQInfo)) {
@@ -339,6 +339,33 @@ int32_t qRetrieveQueryResultInfo(qinfo_t qinfo, bool* buildRes, void* pRspContex
   return code;
 }
 
+// the execution statistics of an explain analyze query are appended to the end of its last rsp, followed by their length
+static void doAppendExplainMsg(SQInfo* pQInfo, SRetrieveTableRsp** pRsp, int32_t* contLen) {
+  int32_t      len = 0;
+  SExplainMsg* pMsg = createExplainMsg(pQInfo, &len);
+  if (pMsg == NULL) {
+    qError("QInfo:0x%"PRIx64" failed to create explain msg", pQInfo->qId);
+    return;
+  }
+
+  int32_t            size = len + (int32_t)sizeof(int32_t);
+  SRetrieveTableRsp* pNew = (SRetrieveTableRsp*)rpcReallocCont(*pRsp, *contLen + size);
+  if (pNew == NULL) {
+    qError("QInfo:0x%"PRIx64" failed to append explain msg, size:%d", pQInfo->qId, len);
+    free(pMsg);
+    return;
+  }
+
+  int32_t netLen = htonl(len);
+  memcpy((char*)pNew + *contLen, pMsg, len);
+  memcpy((char*)pNew + *contLen + len, &netLen, sizeof(int32_t));
+  pNew->extend |= TSDB_RETRIEVE_RSP_EXPLAIN;
+
+  *pRsp = pNew;
+  *contLen += size;
+  free(pMsg);
+}
+
 int32_t qDumpRetrieveResult(qinfo_t qinfo, SRetrieveTableRsp **pRsp, int32_t *contLen, bool* continueExec) {
   SQInfo *pQInfo = (SQInfo *)qinfo;
   int32_t compLen = 0;
@@ -404,6 +431,10 @@ int32_t qDumpRetrieveResult(qinfo_t qinfo, SRetrieveTableRsp **pRsp, int32_t *co
     *continueExec = false;
     (*pRsp)->completed = 1;  // notify no more result to client
     qDebug("QInfo:0x%"PRIx64" no more results to retrieve", pQInfo->qId);
+
+    if (pQueryAttr->explain && pQInfo->code == TSDB_CODE_SUCCESS) {
+      doAppendExplainMsg(pQInfo, pRsp, contLen);
+    }
   } else {
     *continueExec = true;
     qDebug("QInfo:0x%"PRIx64" has more results to retrieve", pQInfo->qId);
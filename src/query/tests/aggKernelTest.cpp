@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include "taos.h"
+#include "taosdef.h"
+#include "qAggMain.h"
+
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+
+namespace {
+
+const int32_t rows = 4096;
+
+// the row by row loops the functions in qAggMain.c ran before the kernels, as the reference
+template <typename T, typename R>
+__attribute__((noinline))
+int32_t refSum(const T* d, int32_t n, int32_t type, bool hasNull, R* out) {
+  int32_t num = 0;
+  for (int32_t i = 0; i < n; ++i) {
+    if (hasNull && isNull((const char*)&d[i], type)) {
+      continue;
+    }
+    *out += d[i];
+    num++;
+  }
+  return num;
+}
+
+template <typename T>
+__attribute__((noinline))
+int32_t refMinMax(const T* d, int32_t n, int32_t type, bool isMin, T* out, int32_t* pos) {
+  int32_t num = 0;
+  *pos = -1;
+  for (int32_t i = 0; i < n; ++i) {
+    if (isNull((const char*)&d[i], type)) {
+      continue;
+    }
+    if ((*out < d[i]) ^ isMin) {
+      *out = d[i];
+      *pos = i;
+    }
+    num++;
+  }
+  return num;
+}
+
+}  // namespace
+
+TEST(testCase, aggKernelSumTest) {
+  int32_t i4[rows];
+  float   f4[rows];
+  int16_t i2[rows];
+
+  for (int32_t i = 0; i < rows; ++i) {
+    i4[i] = (i % 13 == 0) ? (int32_t)TSDB_DATA_INT_NULL : (i * 7919) % 100003 - 50000;
+    i2[i] = (i % 5 == 0) ? (int16_t)TSDB_DATA_SMALLINT_NULL : (int16_t)(i % 3000 - 1500);
+    if (i % 11 == 0) {
+      *(uint32_t*)&f4[i] = TSDB_DATA_FLOAT_NULL;
+    } else {
+      f4[i] = (float)((i % 97) * 0.25);
+    }
+  }
+
+  int64_t sum = 0, ref = 0;
+  int32_t n = aggSumSigned(i4, TSDB_DATA_TYPE_INT, rows, true, &sum);
+  ASSERT_EQ(n, refSum(i4, rows, TSDB_DATA_TYPE_INT, true, &ref));
+  ASSERT_EQ(sum, ref);
+
+  sum = 0, ref = 0;
+  n = aggSumSigned(i2, TSDB_DATA_TYPE_SMALLINT, rows, true, &sum);
+  ASSERT_EQ(n, refSum(i2, rows, TSDB_DATA_TYPE_SMALLINT, true, &ref));
+  ASSERT_EQ(sum, ref);
+
+  double dsum = 0, dref = 0;
+  n = aggSumDouble(f4, TSDB_DATA_TYPE_FLOAT, rows, &dsum);
+  ASSERT_EQ(n, refSum(f4, rows, TSDB_DATA_TYPE_FLOAT, true, &dref));
+  ASSERT_NEAR(dsum, dref, 1e-6);
+
+  ASSERT_EQ(aggCountNotNull(i4, TSDB_DATA_TYPE_INT, rows), rows - (rows + 12) / 13);
+  ASSERT_EQ(aggCountNotNull(f4, TSDB_DATA_TYPE_FLOAT, rows), rows - (rows + 10) / 11);
+  ASSERT_EQ(aggCountNotNull(i4, TSDB_DATA_TYPE_BINARY, rows), -1);
+}
+
+TEST(testCase, aggKernelMinMaxTest) {
+  int32_t i4[rows];
+  double  f8[rows];
+
+  for (int32_t i = 0; i < rows; ++i) {
+    i4[i] = (i % 9 == 0) ? (int32_t)TSDB_DATA_INT_NULL : (i * 37) % 1000;
+    if (i % 7 == 0) {
+      *(uint64_t*)&f8[i] = TSDB_DATA_DOUBLE_NULL;
+    } else {
+      f8[i] = ((i * 31) % 500) - 250.5;
+    }
+  }
+
+  for (int32_t isMin = 0; isMin <= 1; ++isMin) {
+    int32_t v = isMin ? INT32_MAX : INT32_MIN, r = v;
+    int32_t pos = -1, rpos = -1;
+    int32_t n = aggMinMax(i4, TSDB_DATA_TYPE_INT, rows, true, isMin, &v, &pos);
+    ASSERT_EQ(n, refMinMax(i4, rows, TSDB_DATA_TYPE_INT, isMin, &r, &rpos));
+    ASSERT_EQ(v, r);
+    ASSERT_EQ(pos, rpos) << "isMin " << isMin;
+
+    // no row of the block takes over the result
+    pos = 0;
+    aggMinMax(i4, TSDB_DATA_TYPE_INT, rows, true, isMin, &v, &pos);
+    ASSERT_EQ(pos, isMin ? rpos : -1);
+
+    double d = isMin ? DBL_MAX : -DBL_MAX, rd = d;
+    n = aggMinMax(f8, TSDB_DATA_TYPE_DOUBLE, rows, true, isMin, &d, &pos);
+    ASSERT_EQ(n, refMinMax(f8, rows, TSDB_DATA_TYPE_DOUBLE, isMin, &rd, &rpos));
+    ASSERT_EQ(d, rd);
+    ASSERT_EQ(pos, rpos);
+  }
+}
+
+// a NAN other than the NULL is a value, as isNull tells, in the vectorized loops and in the tails of them
+TEST(testCase, aggKernelNanTest) {
+  const int32_t n = rows - 3;
+  float         f4[rows];
+  double        f8[rows];
+
+  for (int32_t i = 0; i < n; ++i) {
+    if (i % 10 == 0) {
+      *(uint32_t*)&f4[i] = TSDB_DATA_FLOAT_NULL;
+      *(uint64_t*)&f8[i] = TSDB_DATA_DOUBLE_NULL;
+    } else if (i % 10 == 3 || i == n - 1) {
+      f4[i] = NAN;
+      f8[i] = -NAN;
+    } else {
+      f4[i] = (float)(i % 50);
+      f8[i] = i % 70;
+    }
+  }
+
+  int32_t numOfNull = (n + 9) / 10;
+  ASSERT_TRUE(isnan(f8[n - 1]) && !isNull((const char*)&f8[n - 1], TSDB_DATA_TYPE_DOUBLE));
+
+  double sum = 0;
+  ASSERT_EQ(aggSumDouble(f4, TSDB_DATA_TYPE_FLOAT, n, &sum), n - numOfNull);
+  ASSERT_TRUE(isnan(sum));
+  ASSERT_EQ(aggSumDouble(f8, TSDB_DATA_TYPE_DOUBLE, n, &sum), n - numOfNull);
+  ASSERT_TRUE(isnan(sum));
+
+  ASSERT_EQ(aggCountNotNull(f4, TSDB_DATA_TYPE_FLOAT, n), n - numOfNull);
+  ASSERT_EQ(aggCountNotNull(f8, TSDB_DATA_TYPE_DOUBLE, n), n - numOfNull);
+
+  float   fmax = -FLT_MAX;
+  double  dmin = DBL_MAX;
+  int32_t pos = 0;
+  ASSERT_EQ(aggMinMax(f4, TSDB_DATA_TYPE_FLOAT, n, true, false, &fmax, &pos), n - numOfNull);
+  ASSERT_EQ(fmax, 49.0f);
+  ASSERT_EQ(aggMinMax(f8, TSDB_DATA_TYPE_DOUBLE, n, true, true, &dmin, &pos), n - numOfNull);
+  ASSERT_EQ(dmin, 1.0);
+}
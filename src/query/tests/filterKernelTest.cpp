@@ -0,0 +1,336 @@
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include "taos.h"
+#include "taosdef.h"
+#include "tcompare.h"
+
+#include "qFilter.h"
+
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+
+extern "C" {
+extern int8_t filterGetCompFuncIdx(int32_t type, int32_t optr);
+extern int8_t filterGetRangeCompFuncFromOptrs(uint8_t optr, uint8_t optr2);
+extern rangeCompFunc gRangeCompare[];
+extern __compar_fn_t gDataCompare[];
+extern bool filterExecuteImpl(void* pinfo, int32_t numOfRows, int8_t** p, SDataStatis* statis, int16_t numOfCols);
+extern uint8_t getColumnNullFlag(SColumnInfoData* pColInfo, SDataStatis* pStatis, int32_t numOfRows);
+}
+
+namespace {
+
+const int32_t rows = 1000;
+
+SFilterComUnit initUnit(int32_t type, uint8_t optr, int8_t rfunc, void* col, void* val, void* val2) {
+  SFilterComUnit cunit = {0};
+  cunit.colData = col;
+  cunit.valData = val;
+  cunit.valData2 = val2;
+  cunit.dataType = type;
+  cunit.dataSize = tDataTypes[type].bytes;
+  cunit.optr = optr;
+  cunit.func = filterGetCompFuncIdx(type, optr);
+  cunit.rfunc = rfunc;
+  return cunit;
+}
+
+}  // namespace
+
+// every kernel must give the same result as the row by row evaluation
+TEST(testCase, filterVecRangeTest) {
+  int32_t col[rows];
+  int8_t  res[rows];
+  int32_t lo = -100, hi = 100;
+
+  for (int32_t i = 0; i < rows; ++i) {
+    col[i] = (i % 7 == 0) ? (int32_t)TSDB_DATA_INT_NULL : (i - rows / 2);
+  }
+
+  for (int32_t rfunc = 0; rfunc < 8; ++rfunc) {
+    SFilterComUnit cunit = initUnit(TSDB_DATA_TYPE_INT, TSDB_RELATION_GREATER, rfunc, col, &lo, &hi);
+    filter_vec_func vfunc = filterGetVecFunc(&cunit);
+    ASSERT_NE(vfunc, nullptr);
+
+    (*vfunc)(&cunit, rows, res);
+    for (int32_t i = 0; i < rows; ++i) {
+      int8_t expect = (col[i] == (int32_t)TSDB_DATA_INT_NULL)
+                          ? 0
+                          : (*gRangeCompare[rfunc])(&col[i], &col[i], &lo, &hi, gDataCompare[cunit.func]);
+      ASSERT_EQ(res[i], expect) << "rfunc " << rfunc << " row " << i;
+    }
+  }
+}
+
+TEST(testCase, filterVecFloatTest) {
+  float   col[rows];
+  int8_t  res[rows];
+  float   val = 220;
+  uint8_t optrs[] = {TSDB_RELATION_GREATER, TSDB_RELATION_GREATER_EQUAL, TSDB_RELATION_LESS,
+                     TSDB_RELATION_LESS_EQUAL, TSDB_RELATION_EQUAL,         TSDB_RELATION_NOT_EQUAL};
+
+  for (int32_t i = 0; i < rows; ++i) {
+    if (i % 5 == 0) {
+      *(uint32_t*)&col[i] = TSDB_DATA_FLOAT_NULL;
+    } else {
+      col[i] = 215.0f + (i % 11);
+    }
+  }
+
+  for (size_t k = 0; k < tListLen(optrs); ++k) {
+    int8_t         rfunc = filterGetRangeCompFuncFromOptrs(optrs[k], 0);
+    SFilterComUnit cunit = initUnit(TSDB_DATA_TYPE_FLOAT, optrs[k], rfunc, col, &val, &val);
+    filter_vec_func vfunc = filterGetVecFunc(&cunit);
+    ASSERT_NE(vfunc, nullptr);
+
+    (*vfunc)(&cunit, rows, res);
+    for (int32_t i = 0; i < rows; ++i) {
+      int8_t expect = 0;
+      if (!isNull((char*)&col[i], TSDB_DATA_TYPE_FLOAT)) {
+        int32_t c = compareFloatVal(&col[i], &val);
+        switch (optrs[k]) {
+          case TSDB_RELATION_GREATER: expect = c > 0; break;
+          case TSDB_RELATION_GREATER_EQUAL: expect = c >= 0; break;
+          case TSDB_RELATION_LESS: expect = c < 0; break;
+          case TSDB_RELATION_LESS_EQUAL: expect = c <= 0; break;
+          case TSDB_RELATION_EQUAL: expect = c == 0; break;
+          default: expect = c != 0; break;
+        }
+      }
+      ASSERT_EQ(res[i], expect) << "optr " << (int)optrs[k] << " row " << i;
+    }
+  }
+}
+
+TEST(testCase, filterVecInNullTest) {
+  int16_t col[rows];
+  int8_t  res[rows];
+
+  for (int32_t i = 0; i < rows; ++i) {
+    col[i] = (i % 9 == 0) ? (int16_t)TSDB_DATA_SMALLINT_NULL : (int16_t)(i % 20);
+  }
+
+  // keys are put as int64 like filterConvertSetFromBinary does
+  SHashObj* pSet = taosHashInit(8, taosGetDefaultHashFunction(TSDB_DATA_TYPE_SMALLINT), true, HASH_NO_LOCK);
+  int32_t   dummy = -1;
+  for (int64_t v : {1, 5, 7}) {
+    taosHashPut(pSet, &v, sizeof(v), &dummy, sizeof(dummy));
+  }
+
+  SFilterComUnit cunit = initUnit(TSDB_DATA_TYPE_SMALLINT, TSDB_RELATION_IN, -1, col, pSet, pSet);
+  filter_vec_func vfunc = filterGetVecFunc(&cunit);
+  ASSERT_NE(vfunc, nullptr);
+  ASSERT_EQ(cunit.inNum, 3);
+
+  (*vfunc)(&cunit, rows, res);
+  for (int32_t i = 0; i < rows; ++i) {
+    int8_t expect = (col[i] == 1 || col[i] == 5 || col[i] == 7);
+    ASSERT_EQ(res[i], expect) << "row " << i;
+  }
+
+  SFilterComUnit ncunit = initUnit(TSDB_DATA_TYPE_SMALLINT, TSDB_RELATION_ISNULL, -1, col, NULL, NULL);
+  vfunc = filterGetVecFunc(&ncunit);
+  ASSERT_NE(vfunc, nullptr);
+  (*vfunc)(&ncunit, rows, res);
+  for (int32_t i = 0; i < rows; ++i) {
+    ASSERT_EQ(res[i], (int8_t)(i % 9 == 0)) << "row " << i;
+  }
+
+  free(cunit.inVals);
+  taosHashCleanup(pSet);
+}
+
+TEST(testCase, filterVecLogicTest) {
+  int8_t a[rows], b[rows], c[rows];
+
+  for (int32_t i = 0; i < rows; ++i) {
+    a[i] = c[i] = (i % 2 == 0);
+    b[i] = (i % 3 == 0);
+  }
+
+  filterVecAnd(a, b, rows);
+  filterVecOr(c, b, rows);
+  for (int32_t i = 0; i < rows; ++i) {
+    ASSERT_EQ(a[i], (int8_t)(i % 6 == 0));
+    ASSERT_EQ(c[i], (int8_t)(i % 2 == 0 || i % 3 == 0));
+  }
+
+  EXPECT_FALSE(filterVecAllSet(c, rows));
+  memset(c, 1, sizeof(c));
+  EXPECT_TRUE(filterVecAllSet(c, rows));
+}
+
+// a block is qualified as a whole by its statistics only if no value of the column is null
+TEST(testCase, filterRangeAllQualifiedTest) {
+  int32_t val = 10;
+
+  SFilterComUnit cunit = initUnit(TSDB_DATA_TYPE_INT, TSDB_RELATION_GREATER, -1, NULL, &val, &val);
+  cunit.colId = 1;
+
+  uint32_t     unitIdx = 0;
+  SFilterGroup group = {0};
+  group.unitNum = 1;
+  group.unitIdxs = &unitIdx;
+
+  int8_t   blkUnitRes[1] = {0};
+  uint32_t blkUnits[2] = {0};
+
+  SFilterInfo info = {0};
+  info.unitNum = 1;
+  info.groupNum = 1;
+  info.groups = &group;
+  info.cunits = &cunit;
+  info.blkUnitRes = blkUnitRes;
+  info.blkUnits = blkUnits;
+
+  SDataStatis statis[2] = {0};
+  statis[0].colId = PRIMARYKEY_TIMESTAMP_COL_INDEX;
+  statis[1].colId = 1;
+  statis[1].min = 20;
+  statis[1].max = 50;
+
+  EXPECT_TRUE(filterRangeAllQualified(&info, statis, 2, rows));
+
+  statis[1].numOfNull = 3;
+  EXPECT_FALSE(filterRangeAllQualified(&info, statis, 2, rows));
+
+  statis[1].numOfNull = rows;
+  EXPECT_FALSE(filterRangeAllQualified(&info, statis, 2, rows));
+
+  statis[1].numOfNull = 0;
+  statis[1].min = 5;
+  EXPECT_FALSE(filterRangeAllQualified(&info, statis, 2, rows));
+  EXPECT_FALSE(filterRangeAllQualified(&info, NULL, 2, rows));
+}
+
+// (col > 10 and col < 20) or col == 50, over blocks of growing size sharing the buffer kept in the filter info
+TEST(testCase, filterExecuteVecGroupsTest) {
+  int32_t col[rows];
+  int32_t lo = 10, hi = 20, eq = 50;
+
+  for (int32_t i = 0; i < rows; ++i) {
+    col[i] = (i % 13 == 0) ? (int32_t)TSDB_DATA_INT_NULL : (i % 60);
+  }
+
+  SFilterComUnit cunits[3] = {
+      initUnit(TSDB_DATA_TYPE_INT, TSDB_RELATION_GREATER, filterGetRangeCompFuncFromOptrs(TSDB_RELATION_GREATER, 0), col, &lo, &lo),
+      initUnit(TSDB_DATA_TYPE_INT, TSDB_RELATION_LESS, filterGetRangeCompFuncFromOptrs(TSDB_RELATION_LESS, 0), col, &hi, &hi),
+      initUnit(TSDB_DATA_TYPE_INT, TSDB_RELATION_EQUAL, filterGetRangeCompFuncFromOptrs(TSDB_RELATION_EQUAL, 0), col, &eq, &eq),
+  };
+  for (int32_t i = 0; i < 3; ++i) {
+    cunits[i].vfunc = filterGetVecFunc(&cunits[i]);
+    ASSERT_NE(cunits[i].vfunc, nullptr);
+  }
+
+  uint32_t     idx0[] = {0, 1}, idx1[] = {2};
+  SFilterGroup groups[2] = {0};
+  groups[0].unitNum = 2;
+  groups[0].unitIdxs = idx0;
+  groups[1].unitNum = 1;
+  groups[1].unitIdxs = idx1;
+
+  SFilterInfo info = {0};
+  info.unitNum = 3;
+  info.groupNum = 2;
+  info.groups = groups;
+  info.cunits = cunits;
+
+  for (int32_t numOfRows : {rows / 4, rows, rows / 2}) {
+    int8_t* res = NULL;
+    bool    all = filterExecuteImpl(&info, numOfRows, &res, NULL, 0);
+    EXPECT_FALSE(all);
+    ASSERT_GE(info.vecResSize, (uint32_t)rows / 2);
+
+    for (int32_t i = 0; i < numOfRows; ++i) {
+      int8_t expect = (col[i] != (int32_t)TSDB_DATA_INT_NULL) && ((col[i] > lo && col[i] < hi) || col[i] == eq);
+      ASSERT_EQ(res[i], expect) << "rows " << numOfRows << " row " << i;
+    }
+    free(res);
+  }
+
+  EXPECT_EQ(info.vecResSize, (uint32_t)rows * 2);
+  free(info.vecRes);
+}
+
+// the null flag is computed on demand from the statistics or by a scan, and kept until the column is reset
+TEST(testCase, columnNullFlagTest) {
+  int32_t col[rows];
+  SColumnInfoData colInfo = {0};
+  colInfo.info.type = TSDB_DATA_TYPE_INT;
+  colInfo.info.bytes = sizeof(int32_t);
+  colInfo.pData = (char*)col;
+
+  for (int32_t i = 0; i < rows; ++i) col[i] = i;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, rows), COL_HAS_NO_NULL);
+
+  col[rows - 1] = (int32_t)TSDB_DATA_INT_NULL;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, rows), COL_HAS_NO_NULL);  // kept until reset
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, rows), COL_HAS_NULL);
+
+  for (int32_t i = 0; i < rows; ++i) col[i] = (int32_t)TSDB_DATA_INT_NULL;
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, rows), COL_ALL_NULL);
+
+  col[0] = 1;
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, rows), COL_HAS_NULL);
+
+  // the statistics are trusted without looking at the data
+  SDataStatis statis = {0};
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, &statis, rows), COL_HAS_NO_NULL);
+  statis.numOfNull = rows;
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, &statis, rows), COL_ALL_NULL);
+
+  colInfo.nullFlag = COL_NULL_UNKNOWN;
+  EXPECT_EQ(getColumnNullFlag(&colInfo, NULL, 0), COL_NULL_UNKNOWN);
+}
+
+// IS NULL has no kernel for the binary column, an all null or no null block is still evaluated as a whole
+TEST(testCase, filterExecuteNullFlagTest) {
+  char col[rows][12];
+  for (int32_t i = 0; i < rows; ++i) setVardataNull(col[i], TSDB_DATA_TYPE_BINARY);
+
+  SColumnInfoData colInfo = {0};
+  colInfo.info.type = TSDB_DATA_TYPE_BINARY;
+  colInfo.info.bytes = sizeof(col[0]);
+  colInfo.pData = (char*)col;
+
+  SFilterComUnit cunit = initUnit(TSDB_DATA_TYPE_BINARY, TSDB_RELATION_ISNULL, -1, col, NULL, NULL);
+  cunit.dataSize = sizeof(col[0]);
+  cunit.vfunc = filterGetVecFunc(&cunit);
+
+  uint32_t     idx0[] = {0};
+  SFilterGroup group = {0};
+  group.unitNum = 1;
+  group.unitIdxs = idx0;
+
+  SFilterInfo info = {0};
+  info.unitNum = 1;
+  info.groupNum = 1;
+  info.groups = &group;
+  info.cunits = &cunit;
+
+  for (uint8_t flag : {COL_ALL_NULL, COL_HAS_NO_NULL}) {
+    colInfo.nullFlag = COL_NULL_UNKNOWN;
+    if (flag == COL_HAS_NO_NULL) {
+      for (int32_t i = 0; i < rows; ++i) STR_WITH_SIZE_TO_VARSTR(col[i], "a", 1);
+    }
+
+    cunit.nullFlag = getColumnNullFlag(&colInfo, NULL, rows);
+    ASSERT_EQ(cunit.nullFlag, flag);
+
+    int8_t* res = NULL;
+    bool    all = filterExecuteImpl(&info, rows, &res, NULL, 0);
+    EXPECT_EQ(all, flag == COL_ALL_NULL);
+    for (int32_t i = 0; i < rows; ++i) {
+      ASSERT_EQ(res[i], (int8_t)(flag == COL_ALL_NULL)) << "row " << i;
+    }
+    free(res);
+  }
+
+  free(info.vecRes);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include "taos.h"
+#include "qExecutor.h"
+#include "qUtil.h"
+
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+
+namespace {
+
+const int32_t numOfGroups = 200;
+const int32_t numOfWindows = 500;
+const TSKEY   startKey = 1600000000000L;
+const int64_t interval = 60000;
+
+}  // namespace
+
+TEST(testCase, resultRowHashTest) {
+  SResultRowHash h = {0};
+  ASSERT_EQ(resultRowHashGet(&h, 1, 0, startKey), (int64_t*)NULL);
+
+  for (int32_t g = 0; g < numOfGroups; ++g) {
+    for (int32_t w = 0; w < numOfWindows; ++w) {
+      ASSERT_EQ(resultRowHashPut(&h, g, 0, startKey + w * interval, g * numOfWindows + w), TSDB_CODE_SUCCESS);
+    }
+  }
+
+  ASSERT_EQ(h.size, numOfGroups * numOfWindows);
+  ASSERT_LE(h.size * 2, h.capacity);
+
+  for (int32_t g = 0; g < numOfGroups; ++g) {
+    for (int32_t w = 0; w < numOfWindows; ++w) {
+      int64_t* p = resultRowHashGet(&h, g, 0, startKey + w * interval);
+      ASSERT_TRUE(p != NULL);
+      ASSERT_EQ(*p, g * numOfWindows + w);
+    }
+  }
+
+  // keys that differ in only one part are not found
+  ASSERT_EQ(resultRowHashGet(&h, numOfGroups, 0, startKey), (int64_t*)NULL);
+  ASSERT_EQ(resultRowHashGet(&h, 0, 1, startKey), (int64_t*)NULL);
+  ASSERT_EQ(resultRowHashGet(&h, 0, 0, startKey + 1), (int64_t*)NULL);
+
+  // put of an existed key updates the value
+  ASSERT_EQ(resultRowHashPut(&h, 3, 0, startKey, 7), TSDB_CODE_SUCCESS);
+  ASSERT_EQ(*resultRowHashGet(&h, 3, 0, startKey), 7);
+  ASSERT_EQ(h.size, numOfGroups * numOfWindows);
+
+  ASSERT_EQ(resultRowHashGetMemSize(&h), h.capacity * sizeof(SResultRowHashEntry));
+  resultRowHashCleanup(&h);
+  ASSERT_EQ(h.capacity, 0);
+  ASSERT_EQ(resultRowHashGet(&h, 3, 0, startKey), (int64_t*)NULL);
+}
+
+// the windows of many groups are found the same as in the generic hash table with the key built in a buffer
+TEST(testCase, resultRowHashCompareTest) {
+  SHashObj*      pHash = taosHashInit(numOfGroups, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  SResultRowHash h = {0};
+  char           keyBuf[sizeof(int64_t) * 2];
+
+  for (int32_t w = 0; w < numOfWindows; ++w) {
+    for (uint64_t g = 0; g < numOfGroups; ++g) {
+      TSKEY   skey = startKey + w * interval;
+      int64_t val = g * numOfWindows + w;
+      SET_RES_WINDOW_KEY(keyBuf, &skey, TSDB_KEYSIZE, g);
+      if (taosHashGet(pHash, keyBuf, GET_RES_WINDOW_KEY_LEN(TSDB_KEYSIZE)) == NULL) {
+        taosHashPut(pHash, keyBuf, GET_RES_WINDOW_KEY_LEN(TSDB_KEYSIZE), &val, sizeof(val));
+      }
+      if (resultRowHashGet(&h, g, 0, skey) == NULL) {
+        resultRowHashPut(&h, g, 0, skey, val);
+      }
+    }
+  }
+
+  ASSERT_EQ(h.size, taosHashGetSize(pHash));
+  for (int32_t w = numOfWindows - 1; w >= 0; --w) {
+    for (uint64_t g = 0; g < numOfGroups; ++g) {
+      TSKEY skey = startKey + w * interval;
+      SET_RES_WINDOW_KEY(keyBuf, &skey, TSDB_KEYSIZE, g);
+      int64_t* p = (int64_t*)taosHashGet(pHash, keyBuf, GET_RES_WINDOW_KEY_LEN(TSDB_KEYSIZE));
+      int64_t* q = resultRowHashGet(&h, g, 0, skey);
+      ASSERT_NE(p, (int64_t*)NULL);
+      ASSERT_NE(q, (int64_t*)NULL);
+      ASSERT_EQ(*p, *q);
+    }
+  }
+
+  taosHashCleanup(pHash);
+  resultRowHashCleanup(&h);
+}
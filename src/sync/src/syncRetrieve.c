@@ -153,6 +153,12 @@ static int32_t syncReadOneWalRecord(int32_t sfd, SWalHead *pHead) {
     return 0;
   }
 
+  if (pHead->len == 0 && pHead->version == 0) {
+    // a preallocated wal file is zero filled beyond its last record
+    sTrace("sfd:%d, read to the end of records", sfd);
+    return 0;
+  }
+
   assert(pHead->len <= TSDB_MAX_WAL_SIZE);
 
   ret = read(sfd, pHead->cont, pHead->len);
@@ -341,6 +347,14 @@ static int64_t syncRetrieveWal(SSyncPeer *pPeer) {
       break;
     }
 
+    // a committed wal file is moved aside before it is recycled and zero filled
+    struct stat sstat;
+    if (stat(fname, &sstat) < 0 || sstat.st_mtime != fstat.st_mtime || sstat.st_size != fstat.st_size) {
+      code = -1;
+      sInfo("%s, wal:%s is recycled while retrieve", pPeer->id, fname);
+      break;
+    }
+
     if (syncAreFilesModified(pNode, pPeer)) {
       code = -1;
       break;
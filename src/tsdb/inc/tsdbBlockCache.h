@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_TSDB_BLOCK_CACHE_H_
+#define _TD_TSDB_BLOCK_CACHE_H_
+
+/**
+ * Vnode level LRU cache of decompressed column data of file blocks, shared by all the queries of a repo.
+ *
+ * A file keeps its name, and so its version, as long as the bytes already written to it are not changed: commit only
+ * appends to .data/.last, while compact, delete and sync write new files with a new version. The version in the key
+ * makes a stale entry unreachable even if it is put by a query still reading the old file set after the purge.
+ */
+typedef struct {
+  int64_t  offset;  // offset of the column data in the file
+  int32_t  fid;
+  uint32_t fver;    // version in the file name
+  int16_t  colId;
+  int8_t   ftype;   // TSDB_FILE_DATA or TSDB_FILE_LAST
+  int8_t   reserved;
+} SBlockCacheKey;
+
+typedef struct STsdbBlockCache STsdbBlockCache;
+
+STsdbBlockCache *tsdbNewBlockCache(int64_t capacity);
+void *           tsdbFreeBlockCache(STsdbBlockCache *pCache);
+bool             tsdbBlockCacheGet(STsdbBlockCache *pCache, const SBlockCacheKey *pKey, SDataCol *pDataCol, int maxPoints,
+                                   int numOfRows);
+void             tsdbBlockCachePut(STsdbBlockCache *pCache, const SBlockCacheKey *pKey, const SDataCol *pDataCol);
+void             tsdbBlockCachePurge(STsdbBlockCache *pCache, SArray *aDFileSet);
+
+#endif /* _TD_TSDB_BLOCK_CACHE_H_ */
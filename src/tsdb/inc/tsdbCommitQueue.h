@@ -22,6 +22,7 @@ typedef enum {
   COMPACT_REQ,
   CONTROL_REQ,
   COMMIT_CONFIG_REQ,
+  AUTO_COMPACT_REQ,
 } TSDB_REQ_T;
 
 int tsdbScheduleCommit(STsdbRepo *pRepo, void* param, TSDB_REQ_T req);
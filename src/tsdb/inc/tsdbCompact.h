@@ -20,6 +20,9 @@ extern "C" {
 #endif
 
 void *tsdbCompactImpl(STsdbRepo *pRepo);
+void *tsdbAutoCompactImpl(STsdbRepo *pRepo);
+bool  tsdbScheduleAutoCompact(STsdbRepo *pRepo);
+void  tsdbWaitAutoCompactStop(STsdbRepo *pRepo);
 
 #ifdef __cplusplus
 }
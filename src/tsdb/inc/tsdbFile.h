@@ -175,19 +175,20 @@ static FORCE_INLINE int64_t tsdbReadMFile(SMFile* pMFile, void* buf, int64_t nby
 typedef struct {
   uint32_t magic;
   uint32_t len;
-  uint32_t totalBlocks;
-  uint32_t totalSubBlocks;
+  uint32_t totalBlocks;     // .head only: super blocks of all the tables
+  uint32_t totalSubBlocks;  // .head only: sub-blocks of all the tables
   uint32_t offset;
   uint64_t size;
-  uint64_t tombSize;
+  uint64_t tombSize;        // .head only: bytes of .data/.last no block refers to after a commit
   uint32_t fver;
 } SDFInfo;
 
 typedef struct {
-  SDFInfo info;
-  TFILE   f;
-  int     fd;
-  uint8_t state;
+  SDFInfo  info;
+  TFILE    f;
+  int      fd;
+  uint8_t  state;
+  uint32_t ver;  // version in the file name, kept to avoid parsing the name on each lookup of the block cache
 } SDFile;
 
 void  tsdbInitDFile(SDFile* pDFile, SDiskID did, int vid, int fid, uint32_t ver, TSDB_FILE_T ftype);
@@ -201,6 +202,8 @@ int   tsdbParseDFilename(const char* fname, int* vid, int* fid, TSDB_FILE_T* fty
 
 static FORCE_INLINE void tsdbSetDFileInfo(SDFile* pDFile, SDFInfo* pInfo) { pDFile->info = *pInfo; }
 
+static FORCE_INLINE uint32_t tsdbGetDFileVer(const SDFile* pDFile) { return pDFile->ver; }
+
 static FORCE_INLINE int tsdbOpenDFile(SDFile* pDFile, int flags) {
   ASSERT(!TSDB_FILE_OPENED(pDFile));
 
@@ -280,6 +283,13 @@ static FORCE_INLINE int tsdbAppendDFile(SDFile* pDFile, void* buf, int64_t nbyte
 
 static FORCE_INLINE int tsdbRemoveDFile(SDFile* pDFile) { return tfsremove(TSDB_FILE_F(pDFile)); }
 
+// hint the kernel to start reading the range in background, errors are ignored as it is only an optimization
+static FORCE_INLINE void tsdbReadAheadDFile(SDFile* pDFile, int64_t offset, int64_t nbyte) {
+  ASSERT(TSDB_FILE_OPENED(pDFile));
+
+  taosReadAhead(TSDB_FILE_FD(pDFile), offset, nbyte);
+}
+
 static FORCE_INLINE int64_t tsdbReadDFile(SDFile* pDFile, void* buf, int64_t nbyte) {
   ASSERT(TSDB_FILE_OPENED(pDFile));
 
@@ -27,20 +27,56 @@ typedef struct {
   TSKEY keyLast;
 } SMergeInfo;
 
-typedef struct {
-  STable *           pTable;
-  SSkipListIterator *pIter;
-} SCommitIter;
+/**
+ * In columnar mode the rows of a table that arrive in key order are appended to a chain of column chunks, while
+ * out-of-order rows (and, for update 1, rows overwriting a chunk row) go to the skip list. Every value of a chunk row,
+ * including NULLs, is written before data.numOfRows is bumped, so readers may scan a chunk while it is being filled.
+ */
+typedef struct SMemColChunk {
+  struct SMemColChunk *next;     // set once when the next chunk is published
+  struct SMemColChunk *prev;
+  STSchema *           pSchema;  // schema of the rows in this chunk
+  SDataCols            data;
+} SMemColChunk;
 
 struct STableData {
-  uint64_t   uid;
-  TSKEY      keyFirst;
-  TSKEY      keyLast;
-  int64_t    numOfRows;
-  SSkipList* pData;
+  uint64_t      uid;
+  TSKEY         keyFirst;
+  TSKEY         keyLast;
+  int64_t       numOfRows;
+  SSkipList*    pData;
+  bool          columnar;
+  SMemColChunk* pChunkTail;  // last column chunk, NULL if no row was appended in columnar mode
   T_REF_DECLARE()
 };
 
+typedef struct {
+  SMemColChunk *pChunk;  // chunk row held in row
+  int32_t       pos;
+  int32_t       size;
+  SMemRow       row;
+} SMemRowBuf;
+
+/**
+ * Iterator over the rows of a STableData, merging the column chunks with the skip list. It may be copied by value to
+ * look ahead; the copies share the row buffer with the original.
+ */
+typedef struct {
+  STable *          pTable;
+  SSkipListIterator slIter;
+  SMemColChunk *    pChunk;     // chunk of the next column row, NULL if there is none
+  int32_t           pos;
+  int8_t            order;
+  bool              started;
+  bool              fromChunk;  // whether the current row is pChunk[pos]
+  SMemRowBuf *      pRowBuf;
+} SMemIter;
+
+typedef struct {
+  STable *  pTable;
+  SMemIter *pIter;
+} SCommitIter;
+
 enum { TSDB_UPDATE_META, TSDB_DROP_META };
 
 #ifdef WINDOWS
@@ -69,31 +105,40 @@ void* tsdbAllocBytes(STsdbRepo* pRepo, int bytes);
 // if pCtrlData is NULL, force must be true
 int   tsdbAsyncCommit(STsdbRepo* pRepo, SControlDataInfo* pCtlDataInfo);
 int   tsdbSyncCommitConfig(STsdbRepo* pRepo);
-int   tsdbLoadDataFromCache(STable* pTable, SSkipListIterator* pIter, TSKEY maxKey, int maxRowsToRead, SDataCols* pCols,
+int   tsdbLoadDataFromCache(STable* pTable, SMemIter* pIter, TSKEY maxKey, int maxRowsToRead, SDataCols* pCols,
                             TKEY* filterKeys, int nFilterKeys, bool keepDup, SMergeInfo* pMergeInfo);
 void* tsdbCommitData(STsdbRepo* pRepo, bool end);
 
-static FORCE_INLINE SMemRow tsdbNextIterRow(SSkipListIterator* pIter) {
-  if (pIter == NULL) return NULL;
+// if pKey is NULL, iterate from the first row in the given order
+SMemIter* tsdbCreateMemIter(STable* pTable, STableData* pTableData, const TSKEY* pKey, int32_t order);
+void*     tsdbDestroyMemIter(SMemIter* pIter);
+bool      tsdbMemIterNext(SMemIter* pIter);
+SMemRow   tsdbMemIterGet(SMemIter* pIter);
+int       tsdbMemIterChunkRows(SMemIter* pIter, TSKEY boundKey, int maxRows);
+void      tsdbMemIterSkipChunkRows(SMemIter* pIter, int nRows);
 
-  SSkipListNode* node = tSkipListIterGet(pIter);
-  if (node == NULL) return NULL;
+static FORCE_INLINE SMemRow tsdbNextIterRow(SMemIter* pIter) {
+  if (pIter == NULL) return NULL;
 
-  return (SMemRow)SL_GET_NODE_DATA(node);
+  return tsdbMemIterGet(pIter);
 }
 
-static FORCE_INLINE TSKEY tsdbNextIterKey(SSkipListIterator* pIter) {
-  SMemRow row = tsdbNextIterRow(pIter);
-  if (row == NULL) return TSDB_DATA_TIMESTAMP_NULL;
+static FORCE_INLINE TKEY tsdbNextIterTKey(SMemIter* pIter) {
+  if (pIter == NULL || !pIter->started) return TKEY_NULL;
+
+  if (pIter->fromChunk) return dataColsTKeyAt(&pIter->pChunk->data, pIter->pos);
+
+  SSkipListNode* node = tSkipListIterGet(&pIter->slIter);
+  if (node == NULL) return TKEY_NULL;
 
-  return memRowKey(row);
+  return memRowTKey((SMemRow)SL_GET_NODE_DATA(node));
 }
 
-static FORCE_INLINE TKEY tsdbNextIterTKey(SSkipListIterator* pIter) {
-  SMemRow row = tsdbNextIterRow(pIter);
-  if (row == NULL) return TKEY_NULL;
+static FORCE_INLINE TSKEY tsdbNextIterKey(SMemIter* pIter) {
+  TKEY tkey = tsdbNextIterTKey(pIter);
+  if (tkey == TKEY_NULL) return TSDB_DATA_TIMESTAMP_NULL;
 
-  return memRowTKey(row);
+  return tdGetKey(tkey);
 }
 
 #endif /* _TD_TSDB_MEMTABLE_H_ */
\ No newline at end of file
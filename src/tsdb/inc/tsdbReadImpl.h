@@ -161,6 +161,53 @@ typedef struct {
 
 typedef void SAggrBlkData;  // SBlockCol cols[];
 
+/**
+ * Optional bloom filters of the BINARY/NCHAR columns of a block, written right after the aggr part of the block in
+ * .smad/.smal. Readers not knowing it never look past the aggr part. The first int16 of the magic is negative, so it
+ * can not be taken for the colId leading the aggr part of the next block.
+ */
+#define TSDB_BLOOM_MAGIC 0xF10FB10Fu
+#define TSDB_BLOOM_BITS_PER_KEY 10
+#define TSDB_BLOOM_MIN_BITS 64
+
+typedef struct {
+  int16_t  colId;
+  uint8_t  nHash;
+  uint8_t  reserved;
+  uint32_t nBits;
+  uint32_t offset;  // offset of the bits from the start of SBloomBlkData
+} SBloomBlkCol;
+
+typedef struct {
+  uint32_t     magic;
+  uint32_t     len;  // length of the whole bloom part, including the checksum
+  int32_t      numOfCols;
+  int32_t      reserved;
+  SBloomBlkCol cols[];
+} SBloomBlkData;
+
+// Probes follow the double hashing of the leveldb bloom filter, deriving the k hash values from one
+static FORCE_INLINE uint32_t tsdbBloomHash(const void *val, int32_t len) { return MurmurHash3_32(val, len); }
+
+static FORCE_INLINE void tsdbBloomAdd(uint8_t *bits, uint32_t nBits, uint8_t nHash, uint32_t h) {
+  uint32_t delta = (h >> 17) | (h << 15);
+  for (uint8_t i = 0; i < nHash; i++) {
+    uint32_t pos = h % nBits;
+    bits[pos / 8] |= (uint8_t)(1 << (pos % 8));
+    h += delta;
+  }
+}
+
+static FORCE_INLINE bool tsdbBloomTest(const uint8_t *bits, uint32_t nBits, uint8_t nHash, uint32_t h) {
+  uint32_t delta = (h >> 17) | (h << 15);
+  for (uint8_t i = 0; i < nHash; i++) {
+    uint32_t pos = h % nBits;
+    if ((bits[pos / 8] & (1 << (pos % 8))) == 0) return false;
+    h += delta;
+  }
+  return true;
+}
+
 struct SReadH {
   STsdbRepo * pRepo;
   SDFileSet   rSet;     // FSET to read
@@ -171,10 +218,15 @@ struct SReadH {
   SBlockInfo *  pBlkInfo;  // SBlockInfoV#
   SBlockData *pBlkData;  // Block info
   SAggrBlkData *pAggrBlkData;  // Aggregate Block info
+  SBloomBlkData *pBloomBlkData;  // Bloom filters of the block, NULL if not loaded or the block has none
+  void *      pBloomBuf;
   SDataCols * pDCols[2];
   void *      pBuf;   // buffer
   void *      pCBuf;  // compression buffer
   void *      pExBuf;  // extra buffer
+  uint32_t    dataFVer;  // file versions of rSet, only set when the block cache is on
+  uint32_t    lastFVer;
+  STsdbReadCost cost;  // accumulated read cost of block data
 };
 
 #define TSDB_READ_REPO(rh) ((rh)->pRepo)
@@ -225,8 +277,11 @@ int   tsdbSetReadTable(SReadH *pReadh, STable *pTable);
 int   tsdbLoadBlockInfo(SReadH *pReadh, void **pTarget, uint32_t *extendedLen);
 int   tsdbLoadBlockData(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlockInfo);
 int   tsdbLoadBlockDataCols(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlkInfo, int16_t *colIds, int numOfColsIds);
+void  tsdbReadAheadBlockData(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlkInfo);
 int   tsdbLoadBlockStatis(SReadH *pReadh, SBlock *pBlock);
 int   tsdbLoadBlockOffset(SReadH *pReadh, SBlock *pBlock);
+int   tsdbLoadBlockBloom(SReadH *pReadh, SBlock *pBlock);
+bool  tsdbBlockBloomMayContain(SReadH *pReadh, int16_t colId, const void *val, int32_t len);
 int   tsdbEncodeSBlockIdx(void **buf, SBlockIdx *pIdx);
 void *tsdbDecodeSBlockIdx(void *buf, SBlockIdx *pIdx);
 void  tsdbGetBlockStatis(SReadH *pReadh, SDataStatis *pStatis, int numOfCols, SBlock *pBlock);
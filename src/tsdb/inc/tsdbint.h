@@ -62,6 +62,8 @@ extern "C" {
 #include "tsdbFS.h"
 // ReadImpl
 #include "tsdbReadImpl.h"
+// Block cache
+#include "tsdbBlockCache.h"
 // Commit
 #include "tsdbCommit.h"
 // Compact
@@ -99,9 +101,13 @@ struct STsdbRepo {
 
   SMergeBuf       mergeBuf;  //used when update=2
   int8_t          compactState;  // compact state: inCompact/noCompact/waitingCompact?
+  int8_t          compactStop;   // asks a running auto compaction to give up, set when the repo is closed
   int8_t          deleteState;  // truncate state: inTruncate/noTruncate/waitingTruncate
+  int64_t         lastAutoCompact;  // in seconds, when the last auto compaction was scheduled
 
   pthread_t*      pthread;
+
+  STsdbBlockCache* blkCache;  // NULL if tsdbBlockCacheSize is 0
 };
 
 #define REPO_ID(r) (r)->config.tsdbId
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdbint.h"
+
+typedef struct SBlockCacheEntry {
+  SBlockCacheKey           key;
+  struct SBlockCacheEntry *prev;
+  struct SBlockCacheEntry *next;
+  int32_t                  len;
+  char                     data[];
+} SBlockCacheEntry;
+
+struct STsdbBlockCache {
+  pthread_mutex_t   mutex;
+  int64_t           capacity;  // in bytes
+  int64_t           used;
+  SHashObj *        pHash;     // SBlockCacheKey -> SBlockCacheEntry *
+  SBlockCacheEntry *head;      // most recently used
+  SBlockCacheEntry *tail;      // least recently used
+};
+
+typedef struct {
+  int      fid;
+  uint32_t fver[TSDB_FILE_LAST + 1];
+} SBlockCacheFSet;
+
+#define TSDB_BLOCK_CACHE_ENTRY_SIZE(len) ((int64_t)sizeof(SBlockCacheEntry) + (len))
+
+static void tsdbBlockCacheUnlink(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry);
+static void tsdbBlockCacheLinkHead(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry);
+static void tsdbBlockCacheRemove(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry);
+
+STsdbBlockCache *tsdbNewBlockCache(int64_t capacity) {
+  STsdbBlockCache *pCache = (STsdbBlockCache *)calloc(1, sizeof(*pCache));
+  if (pCache == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  pCache->capacity = capacity;
+  pCache->pHash = taosHashInit(1024, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  if (pCache->pHash == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    free(pCache);
+    return NULL;
+  }
+
+  pthread_mutex_init(&pCache->mutex, NULL);
+  return pCache;
+}
+
+void *tsdbFreeBlockCache(STsdbBlockCache *pCache) {
+  if (pCache == NULL) return NULL;
+
+  SBlockCacheEntry *pEntry = pCache->head;
+  while (pEntry) {
+    SBlockCacheEntry *pNext = pEntry->next;
+    free(pEntry);
+    pEntry = pNext;
+  }
+
+  taosHashCleanup(pCache->pHash);
+  pthread_mutex_destroy(&pCache->mutex);
+  free(pCache);
+  return NULL;
+}
+
+bool tsdbBlockCacheGet(STsdbBlockCache *pCache, const SBlockCacheKey *pKey, SDataCol *pDataCol, int maxPoints,
+                       int numOfRows) {
+  bool found = false;
+
+  pthread_mutex_lock(&pCache->mutex);
+
+  SBlockCacheEntry **ppEntry = (SBlockCacheEntry **)taosHashGet(pCache->pHash, pKey, sizeof(*pKey));
+  if (ppEntry != NULL) {
+    SBlockCacheEntry *pEntry = *ppEntry;
+    if (tdAllocMemForCol(pDataCol, maxPoints) == 0) {
+      memcpy(pDataCol->pData, pEntry->data, pEntry->len);
+      pDataCol->len = pEntry->len;
+      if (IS_VAR_DATA_TYPE(pDataCol->type)) {
+        dataColSetOffset(pDataCol, numOfRows);
+      }
+      found = true;
+    }
+
+    tsdbBlockCacheUnlink(pCache, pEntry);
+    tsdbBlockCacheLinkHead(pCache, pEntry);
+  }
+
+  pthread_mutex_unlock(&pCache->mutex);
+
+  return found;
+}
+
+void tsdbBlockCachePut(STsdbBlockCache *pCache, const SBlockCacheKey *pKey, const SDataCol *pDataCol) {
+  int64_t size = TSDB_BLOCK_CACHE_ENTRY_SIZE(pDataCol->len);
+  if (size > pCache->capacity) return;
+
+  SBlockCacheEntry *pEntry = (SBlockCacheEntry *)malloc((size_t)size);
+  if (pEntry == NULL) return;
+
+  pEntry->key = *pKey;
+  pEntry->prev = NULL;
+  pEntry->next = NULL;
+  pEntry->len = pDataCol->len;
+  memcpy(pEntry->data, pDataCol->pData, pDataCol->len);
+
+  pthread_mutex_lock(&pCache->mutex);
+
+  // another query may have put the same column meanwhile
+  if (taosHashGet(pCache->pHash, pKey, sizeof(*pKey)) != NULL ||
+      taosHashPut(pCache->pHash, pKey, sizeof(*pKey), &pEntry, sizeof(pEntry)) != 0) {
+    pthread_mutex_unlock(&pCache->mutex);
+    free(pEntry);
+    return;
+  }
+
+  tsdbBlockCacheLinkHead(pCache, pEntry);
+  pCache->used += size;
+
+  while (pCache->used > pCache->capacity) {
+    tsdbBlockCacheRemove(pCache, pCache->tail);
+  }
+
+  pthread_mutex_unlock(&pCache->mutex);
+}
+
+// Remove the entries of the files which are not in aDFileSet any more, called after a new file set array takes effect
+void tsdbBlockCachePurge(STsdbBlockCache *pCache, SArray *aDFileSet) {
+  size_t           nSets = taosArrayGetSize(aDFileSet);
+  SBlockCacheFSet *pSets = NULL;
+
+  if (nSets > 0) {
+    pSets = (SBlockCacheFSet *)malloc(sizeof(SBlockCacheFSet) * nSets);
+    if (pSets == NULL) {
+      // without the versions of the live files every entry has to go
+      nSets = 0;
+    }
+  }
+
+  for (size_t i = 0; i < nSets; i++) {
+    SDFileSet *pSet = taosArrayGet(aDFileSet, i);
+    pSets[i].fid = pSet->fid;
+    pSets[i].fver[TSDB_FILE_DATA] = tsdbGetDFileVer(TSDB_DFILE_IN_SET(pSet, TSDB_FILE_DATA));
+    pSets[i].fver[TSDB_FILE_LAST] = tsdbGetDFileVer(TSDB_DFILE_IN_SET(pSet, TSDB_FILE_LAST));
+  }
+
+  pthread_mutex_lock(&pCache->mutex);
+
+  SBlockCacheEntry *pEntry = pCache->head;
+  while (pEntry) {
+    SBlockCacheEntry *pNext = pEntry->next;
+    bool              live = false;
+
+    // aDFileSet is sorted by fid
+    size_t left = 0, right = nSets;
+    while (left < right) {
+      size_t mid = (left + right) / 2;
+      if (pSets[mid].fid < pEntry->key.fid) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    if (left < nSets && pSets[left].fid == pEntry->key.fid) {
+      live = (pSets[left].fver[pEntry->key.ftype] == pEntry->key.fver);
+    }
+
+    if (!live) tsdbBlockCacheRemove(pCache, pEntry);
+    pEntry = pNext;
+  }
+
+  pthread_mutex_unlock(&pCache->mutex);
+
+  tfree(pSets);
+}
+
+static void tsdbBlockCacheUnlink(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry) {
+  if (pEntry->prev) {
+    pEntry->prev->next = pEntry->next;
+  } else {
+    pCache->head = pEntry->next;
+  }
+
+  if (pEntry->next) {
+    pEntry->next->prev = pEntry->prev;
+  } else {
+    pCache->tail = pEntry->prev;
+  }
+
+  pEntry->prev = NULL;
+  pEntry->next = NULL;
+}
+
+static void tsdbBlockCacheLinkHead(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry) {
+  pEntry->prev = NULL;
+  pEntry->next = pCache->head;
+  if (pCache->head) {
+    pCache->head->prev = pEntry;
+  } else {
+    pCache->tail = pEntry;
+  }
+  pCache->head = pEntry;
+}
+
+static void tsdbBlockCacheRemove(STsdbBlockCache *pCache, SBlockCacheEntry *pEntry) {
+  tsdbBlockCacheUnlink(pCache, pEntry);
+  taosHashRemove(pCache->pHash, &pEntry->key, sizeof(pEntry->key));
+  pCache->used -= TSDB_BLOCK_CACHE_ENTRY_SIZE(pEntry->len);
+  free(pEntry);
+}
@@ -35,8 +35,28 @@ typedef struct {
   SArray *     aSupBlk;  // Table super-block array
   SArray *     aSubBlk;  // table sub-block array
   SDataCols *  pDataCols;
+  int64_t      liveSize;  // bytes of .data/.last referenced by the blocks written to .head
 } SCommitH;
 
+// Commit of the memory data of one FSET, or retention of one FSET without memory data
+typedef struct {
+  int        fid;
+  SDFileSet *pSet;       // existing FSET, NULL if a new one is created
+  bool       hasMem;     // has memory data to commit to the FSET
+  bool       committed;  // wSet is written and closed
+  int32_t    code;
+  SDFileSet  wSet;       // FSET written by the commit
+} SCommitJob;
+
+// Jobs of a commit in fid order, taken by the commit workers one by one
+typedef struct {
+  STsdbRepo *pRepo;
+  SRtn       rtn;
+  SArray *   aJob;     // SCommitJob array
+  int32_t    nextJob;  // index of the next job to take
+  int32_t    code;     // first error of the workers
+} SCommitJobs;
+
 /*
  * millisecond by default
  * for TSDB_TIME_PRECISION_MILLI: 3600000L
@@ -71,6 +91,9 @@ static int  tsdbCommitToFile(SCommitH *pCommith, SDFileSet *pSet, int fid);
 static int  tsdbCreateCommitIters(SCommitH *pCommith);
 static void tsdbDestroyCommitIters(SCommitH *pCommith);
 static void tsdbSeekCommitIter(SCommitH *pCommith, TSKEY key);
+static int  tsdbResetCommitIters(SCommitH *pCommith, TSKEY key);
+static int  tsdbRunCommitJobs(SCommitJobs *pJobs);
+static void *tsdbCommitWorker(void *arg);
 static int  tsdbInitCommitH(SCommitH *pCommith, STsdbRepo *pRepo);
 static void tsdbDestroyCommitH(SCommitH *pCommith);
 static int  tsdbGetFidLevel(int fid, SRtn *pRtn);
@@ -216,6 +239,8 @@ int tsdbWriteBlockInfoImpl(SDFile *pHeadf, STable *pTable, SArray *pSupA, SArray
   }
 
   tsdbUpdateDFileMagic(pHeadf, POINTER_SHIFT(pBlkInfo, tlen - sizeof(TSCKSUM)));
+  pHeadf->info.totalBlocks += (uint32_t)nSupBlocks;
+  pHeadf->info.totalSubBlocks += (uint32_t)nSubBlocks;
 
   // Set pIdx
   pBlock = taosArrayGetLast(pSupA);
@@ -610,10 +635,12 @@ _err:
 
 // =================== Commit Time-Series Data
 static int tsdbCommitTSData(STsdbRepo *pRepo) {
-  SMemTable *pMem = pRepo->imem;
-  SCommitH   commith;
-  SDFileSet *pSet = NULL;
-  int        fid;
+  SMemTable * pMem = pRepo->imem;
+  STsdbCfg *  pCfg = REPO_CFG(pRepo);
+  SCommitH    commith;
+  SCommitJobs jobs;
+  SDFileSet * pSet = NULL;
+  int         fid;
 
   memset(&commith, 0, sizeof(commith));
 
@@ -630,6 +657,16 @@ static int tsdbCommitTSData(STsdbRepo *pRepo) {
     return -1;
   }
 
+  memset(&jobs, 0, sizeof(jobs));
+  jobs.pRepo = pRepo;
+  jobs.rtn = commith.rtn;
+  jobs.aJob = taosArrayInit(16, sizeof(SCommitJob));
+  if (jobs.aJob == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    tsdbDestroyCommitH(&commith);
+    return -1;
+  }
+
   // Skip expired memory data and expired FSET
   tsdbSeekCommitIter(&commith, commith.rtn.minKey);
   while ((pSet = tsdbFSIterNext(&(commith.fsIter)))) {
@@ -641,50 +678,173 @@ static int tsdbCommitTSData(STsdbRepo *pRepo) {
     }
   }
 
-  // Loop to commit to each file
+  // Loop to collect the job of each file
   fid = tsdbNextCommitFid(&(commith));
   while (true) {
     // Loop over both on disk and memory
     if (pSet == NULL && fid == TSDB_IVLD_FID) break;
 
+    SCommitJob job = {0};
+
     if (pSet && (fid == TSDB_IVLD_FID || pSet->fid < fid)) {
       // Only has existing FSET but no memory data to commit in this
       // existing FSET, only check if file in correct retention
-      if (tsdbApplyRtnOnFSet(pRepo, pSet, &(commith.rtn)) < 0) {
-        tsdbDestroyCommitH(&commith);
-        return -1;
-      }
+      job.fid = pSet->fid;
+      job.pSet = pSet;
+      job.hasMem = false;
 
       pSet = tsdbFSIterNext(&(commith.fsIter));
     } else {
       // Has memory data to commit
-      SDFileSet *pCSet;
-      int        cfid;
-
       if (pSet == NULL || pSet->fid > fid) {
         // Commit to a new FSET with fid: fid
-        pCSet = NULL;
-        cfid = fid;
+        job.fid = fid;
+        job.pSet = NULL;
       } else {
         // Commit to an existing FSET
-        pCSet = pSet;
-        cfid = pSet->fid;
+        job.fid = pSet->fid;
+        job.pSet = pSet;
         pSet = tsdbFSIterNext(&(commith.fsIter));
       }
+      job.hasMem = true;
 
-      if (tsdbCommitToFile(&commith, pCSet, cfid) < 0) {
+      TSKEY minKey, maxKey;
+      tsdbGetFidKeyRange(pCfg->daysPerFile, pCfg->precision, job.fid, &minKey, &maxKey);
+      if (tsdbResetCommitIters(&commith, maxKey + 1) < 0) {
+        taosArrayDestroy(&jobs.aJob);
         tsdbDestroyCommitH(&commith);
         return -1;
       }
 
       fid = tsdbNextCommitFid(&commith);
     }
+
+    if (taosArrayPush(jobs.aJob, &job) == NULL) {
+      terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+      taosArrayDestroy(&jobs.aJob);
+      tsdbDestroyCommitH(&commith);
+      return -1;
+    }
   }
 
+  // The workers have their own handles and memory iterators
   tsdbDestroyCommitH(&commith);
+
+  if (tsdbRunCommitJobs(&jobs) < 0) {
+    taosArrayDestroy(&jobs.aJob);
+    return -1;
+  }
+
+  taosArrayDestroy(&jobs.aJob);
   return 0;
 }
 
+// Commit the jobs with memory data on up to tsdbCommitWorkers threads, then apply the results in fid order
+static int tsdbRunCommitJobs(SCommitJobs *pJobs) {
+  STsdbRepo *pRepo = pJobs->pRepo;
+  size_t     nJobs = taosArrayGetSize(pJobs->aJob);
+  int        nWorkers = 0;
+
+  for (size_t i = 0; i < nJobs; i++) {
+    SCommitJob *pJob = taosArrayGet(pJobs->aJob, i);
+    if (pJob->hasMem) nWorkers++;
+  }
+  nWorkers = MIN(nWorkers, MAX(tsdbCommitWorkers, 1));
+
+  if (nWorkers > 1) {
+    pthread_t *threads = (pthread_t *)calloc(nWorkers, sizeof(pthread_t));
+    int        nStarted = 0;
+
+    if (threads != NULL) {
+      for (; nStarted < nWorkers; nStarted++) {
+        if (pthread_create(threads + nStarted, NULL, tsdbCommitWorker, pJobs) != 0) break;
+      }
+    }
+
+    tsdbDebug("vgId:%d commit %d FSETs with %d workers", REPO_ID(pRepo), (int)nJobs, nStarted);
+
+    // the caller takes the jobs left if no worker could be started
+    if (nStarted == 0) {
+      tsdbCommitWorker(pJobs);
+    }
+
+    for (int i = 0; i < nStarted; i++) {
+      pthread_join(threads[i], NULL);
+    }
+    tfree(threads);
+  } else if (nWorkers == 1) {
+    tsdbCommitWorker(pJobs);
+  }
+
+  if (pJobs->code != TSDB_CODE_SUCCESS) {
+    // revert the file change of the jobs done
+    for (size_t i = 0; i < nJobs; i++) {
+      SCommitJob *pJob = taosArrayGet(pJobs->aJob, i);
+      if (pJob->committed) {
+        tsdbApplyDFileSetChange(&(pJob->wSet), pJob->pSet);
+      }
+    }
+
+    terrno = pJobs->code;
+    return -1;
+  }
+
+  for (size_t i = 0; i < nJobs; i++) {
+    SCommitJob *pJob = taosArrayGet(pJobs->aJob, i);
+
+    if (pJob->hasMem) {
+      ASSERT(pJob->committed);
+      if (tsdbUpdateDFileSet(REPO_FS(pRepo), &(pJob->wSet)) < 0) {
+        return -1;
+      }
+    } else {
+      if (tsdbApplyRtnOnFSet(pRepo, pJob->pSet, &(pJobs->rtn)) < 0) {
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+static void *tsdbCommitWorker(void *arg) {
+  SCommitJobs *pJobs = (SCommitJobs *)arg;
+  STsdbRepo *  pRepo = pJobs->pRepo;
+  STsdbCfg *   pCfg = REPO_CFG(pRepo);
+  size_t       nJobs = taosArrayGetSize(pJobs->aJob);
+  SCommitH     commith;
+
+  if (tsdbInitCommitH(&commith, pRepo) < 0) {
+    atomic_val_compare_exchange_32(&(pJobs->code), TSDB_CODE_SUCCESS, terrno);
+    return NULL;
+  }
+  commith.rtn = pJobs->rtn;
+
+  while (atomic_load_32(&(pJobs->code)) == TSDB_CODE_SUCCESS) {
+    int32_t idx = atomic_fetch_add_32(&(pJobs->nextJob), 1);
+    if (idx >= (int32_t)nJobs) break;
+
+    SCommitJob *pJob = taosArrayGet(pJobs->aJob, idx);
+    if (!pJob->hasMem) continue;
+
+    // jobs are taken in fid order, so the memory iterators of a worker only move forward
+    TSKEY minKey, maxKey;
+    tsdbGetFidKeyRange(pCfg->daysPerFile, pCfg->precision, pJob->fid, &minKey, &maxKey);
+    if (tsdbResetCommitIters(&commith, MAX(minKey, commith.rtn.minKey)) < 0 ||
+        tsdbCommitToFile(&commith, pJob->pSet, pJob->fid) < 0) {
+      pJob->code = terrno;
+      atomic_val_compare_exchange_32(&(pJobs->code), TSDB_CODE_SUCCESS, pJob->code);
+      break;
+    }
+
+    pJob->wSet = commith.wSet;
+    pJob->committed = true;
+  }
+
+  tsdbDestroyCommitH(&commith);
+  return NULL;
+}
+
 static void tsdbStartCommit(STsdbRepo *pRepo) {
   SMemTable *pMem = pRepo->imem;
 
@@ -718,8 +878,8 @@ static void tsdbEndCommit(STsdbRepo *pRepo, int eno, bool end) {
   (void)tsdbUnlockRepo(pRepo);
   tsdbUnRefMemTable(pRepo, pIMem);
 
-  // release readyToCommit allow next commit
-  if (end) {
+  // release readyToCommit allow next commit, or hand it over to an auto compaction
+  if (end && (eno != TSDB_CODE_SUCCESS || !tsdbScheduleAutoCompact(pRepo))) {
     tsem_post(&(pRepo->readyToCommit));
   }
 }
@@ -771,6 +931,11 @@ static int tsdbCommitToFile(SCommitH *pCommith, SDFileSet *pSet, int fid) {
     return -1;
   }
 
+  // bytes left behind in .data/.last by the blocks merged or rewritten, for the auto compaction to score the FSET
+  int64_t fsize = (int64_t)TSDB_COMMIT_DATA_FILE(pCommith)->info.size + TSDB_COMMIT_LAST_FILE(pCommith)->info.size -
+                  2 * TSDB_FILE_HEAD_SIZE;
+  TSDB_COMMIT_HEAD_FILE(pCommith)->info.tombSize = (uint64_t)MAX(fsize - pCommith->liveSize, 0);
+
   if (tsdbUpdateDFileSetHeader(&(pCommith->wSet)) < 0) {
     tsdbError("vgId:%d failed to update FSET %d header since %s", REPO_ID(pRepo), fid, tstrerror(terrno));
     tsdbCloseCommitFile(pCommith, true);
@@ -782,10 +947,6 @@ static int tsdbCommitToFile(SCommitH *pCommith, SDFileSet *pSet, int fid) {
   // Close commit file
   tsdbCloseCommitFile(pCommith, false);
 
-  if (tsdbUpdateDFileSet(REPO_FS(pRepo), &(pCommith->wSet)) < 0) {
-    return -1;
-  }
-
   return 0;
 }
 
@@ -816,12 +977,13 @@ static int tsdbCreateCommitIters(SCommitH *pCommith) {
   for (int i = 0; i < pMem->maxTables; i++) {
     if ((pCommith->iters[i].pTable != NULL) && (pMem->tData[i] != NULL) &&
         (TABLE_UID(pCommith->iters[i].pTable) == pMem->tData[i]->uid)) {
-      if ((pCommith->iters[i].pIter = tSkipListCreateIter(pMem->tData[i]->pData)) == NULL) {
+      if ((pCommith->iters[i].pIter = tsdbCreateMemIter(pCommith->iters[i].pTable, pMem->tData[i], NULL,
+                                                        TSDB_ORDER_ASC)) == NULL) {
         terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
         return -1;
       }
 
-      tSkipListIterNext(pCommith->iters[i].pIter);
+      tsdbMemIterNext(pCommith->iters[i].pIter);
     }
   }
 
@@ -834,7 +996,7 @@ static void tsdbDestroyCommitIters(SCommitH *pCommith) {
   for (int i = 1; i < pCommith->niters; i++) {
     if (pCommith->iters[i].pTable != NULL) {
       tsdbUnRefTable(pCommith->iters[i].pTable);
-      tSkipListDestroyIter(pCommith->iters[i].pIter);
+      tsdbDestroyMemIter(pCommith->iters[i].pIter);
     }
   }
 
@@ -853,6 +1015,29 @@ static void tsdbSeekCommitIter(SCommitH *pCommith, TSKEY key) {
   }
 }
 
+// Move the memory iterators which are before key to the first row not before key
+static int tsdbResetCommitIters(SCommitH *pCommith, TSKEY key) {
+  SMemTable *pMem = TSDB_COMMIT_REPO(pCommith)->imem;
+
+  for (int i = 0; i < pCommith->niters; i++) {
+    SCommitIter *pIter = pCommith->iters + i;
+    if (pIter->pTable == NULL || pIter->pIter == NULL) continue;
+
+    TSKEY nextKey = tsdbNextIterKey(pIter->pIter);
+    if (nextKey == TSDB_DATA_TIMESTAMP_NULL || nextKey >= key) continue;
+
+    pIter->pIter = tsdbDestroyMemIter(pIter->pIter);
+    if ((pIter->pIter = tsdbCreateMemIter(pIter->pTable, pMem->tData[i], &key, TSDB_ORDER_ASC)) == NULL) {
+      terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+      return -1;
+    }
+
+    tsdbMemIterNext(pIter->pIter);
+  }
+
+  return 0;
+}
+
 static int tsdbInitCommitH(SCommitH *pCommith, STsdbRepo *pRepo) {
   STsdbCfg *pCfg = REPO_CFG(pRepo);
 
@@ -1071,6 +1256,95 @@ static int tsdbComparKeyBlock(const void *arg1, const void *arg2) {
   }
 }
 
+// the number of distinct values of a sorted column is unknown, count the value changes as its upper bound
+static uint32_t tsdbEstimateDistinctValues(SDataCol *pDataCol, int nRows) {
+  const void *prev = NULL;
+  uint32_t    ndv = 0;
+
+  for (int i = 0; i < nRows; i++) {
+    const void *val = tdGetColDataOfRow(pDataCol, i);
+    if (isNull(val, pDataCol->type)) continue;
+
+    if (prev == NULL || varDataLen(prev) != varDataLen(val) || memcmp(varDataVal(prev), varDataVal(val), varDataLen(val)) != 0) {
+      ndv++;
+    }
+    prev = val;
+  }
+
+  return ndv;
+}
+
+static int tsdbWriteBlockBloom(SDFile *pDFileAggr, SDataCols *pDataCols, int nRows, void **ppBuf) {
+  int      nCols = 0;
+  uint32_t len = sizeof(SBloomBlkData) + sizeof(TSCKSUM);
+
+  // the estimate of each column, 0 for the columns without a filter
+  uint32_t *ndvs = calloc(pDataCols->numOfCols, sizeof(uint32_t));
+  if (ndvs == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  for (int ncol = 1; ncol < pDataCols->numOfCols; ncol++) {
+    SDataCol *pDataCol = pDataCols->cols + ncol;
+    if (!IS_VAR_DATA_TYPE(pDataCol->type) || isAllRowsNull(pDataCol)) continue;
+
+    ndvs[ncol] = tsdbEstimateDistinctValues(pDataCol, nRows);
+    if (ndvs[ncol] == 0) continue;
+
+    uint32_t nBits = MAX(ndvs[ncol] * TSDB_BLOOM_BITS_PER_KEY, TSDB_BLOOM_MIN_BITS);
+    len += sizeof(SBloomBlkCol) + (nBits + 7) / 8;
+    nCols++;
+  }
+
+  if (nCols == 0 || tsdbMakeRoom(ppBuf, len) < 0) {
+    tfree(ndvs);
+    return (nCols == 0) ? 0 : -1;
+  }
+  memset(*ppBuf, 0, len);
+
+  SBloomBlkData *pBloomBlkData = (SBloomBlkData *)(*ppBuf);
+  uint32_t       offset = sizeof(SBloomBlkData) + sizeof(SBloomBlkCol) * nCols;
+  int            tcol = 0;
+
+  pBloomBlkData->magic = TSDB_BLOOM_MAGIC;
+  pBloomBlkData->len = len;
+  pBloomBlkData->numOfCols = nCols;
+
+  for (int ncol = 1; ncol < pDataCols->numOfCols && tcol < nCols; ncol++) {
+    SDataCol *pDataCol = pDataCols->cols + ncol;
+    uint32_t  ndv = ndvs[ncol];
+    if (ndv == 0) continue;
+
+    SBloomBlkCol *pBloomBlkCol = pBloomBlkData->cols + tcol;
+    pBloomBlkCol->colId = pDataCol->colId;
+    pBloomBlkCol->nHash = TSDB_BLOOM_BITS_PER_KEY * 69 / 100;  // ln2 * bits per key minimizes the false positives
+    pBloomBlkCol->nBits = ((MAX(ndv * TSDB_BLOOM_BITS_PER_KEY, TSDB_BLOOM_MIN_BITS) + 7) / 8) * 8;
+    pBloomBlkCol->offset = offset;
+
+    uint8_t *bits = POINTER_SHIFT(pBloomBlkData, offset);
+    for (int i = 0; i < nRows; i++) {
+      const void *val = tdGetColDataOfRow(pDataCol, i);
+      if (isNull(val, pDataCol->type)) continue;
+      tsdbBloomAdd(bits, pBloomBlkCol->nBits, pBloomBlkCol->nHash, tsdbBloomHash(varDataVal(val), varDataLen(val)));
+    }
+
+    offset += pBloomBlkCol->nBits / 8;
+    tcol++;
+  }
+  tfree(ndvs);
+
+  taosCalcChecksumAppend(0, (uint8_t *)pBloomBlkData, len);
+  tsdbUpdateDFileMagic(pDFileAggr, POINTER_SHIFT(pBloomBlkData, len - sizeof(TSCKSUM)));
+
+  // must directly follow the aggr part of the block
+  if (tsdbAppendDFile(pDFileAggr, (void *)pBloomBlkData, len, NULL) < (int)len) {
+    return -1;
+  }
+
+  return 0;
+}
+
 int tsdbWriteBlockImpl(STsdbRepo *pRepo, STable *pTable, SDFile *pDFile, SDFile *pDFileAggr, SDataCols *pDataCols,
                        SBlock *pBlock, bool isLast, bool isSuper, void **ppBuf, void **ppCBuf, void **ppExBuf) {
   STsdbCfg *  pCfg = REPO_CFG(pRepo);
@@ -1211,6 +1485,11 @@ int tsdbWriteBlockImpl(STsdbRepo *pRepo, STable *pTable, SDFile *pDFile, SDFile
     if (tsdbAppendDFile(pDFileAggr, (void *)pAggrBlkData, tsizeAggr, &offsetAggr) < tsizeAggr) {
       return -1;
     }
+
+    // the aggr part is written, so its buffer is free for the bloom part
+    if (tsdbBloomFilter && tsdbWriteBlockBloom(pDFileAggr, pDataCols, rowsToWrite, ppExBuf) < 0) {
+      return -1;
+    }
   }
 
   // Update pBlock membership variables
@@ -1259,6 +1538,14 @@ static int tsdbWriteBlockInfo(SCommitH *pCommih) {
     return 0;
   }
 
+  for (size_t i = 0; i < taosArrayGetSize(pCommih->aSupBlk); i++) {
+    SBlock *pBlock = taosArrayGet(pCommih->aSupBlk, i);
+    if (pBlock->numOfSubBlocks == 1) pCommih->liveSize += pBlock->len;
+  }
+  for (size_t i = 0; i < taosArrayGetSize(pCommih->aSubBlk); i++) {
+    pCommih->liveSize += ((SBlock *)taosArrayGet(pCommih->aSubBlk, i))->len;
+  }
+
   if (taosArrayPush(pCommih->aBlkIdx, (void *)(&blkIdx)) == NULL) {
     terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
     return -1;
@@ -1318,7 +1605,7 @@ static int tsdbMergeMemData(SCommitH *pCommith, SCommitIter *pIter, int bidx) {
     keyLimit = pBlock[1].keyFirst - 1;
   }
 
-  SSkipListIterator titer = *(pIter->pIter);
+  SMemIter   titer = *(pIter->pIter);
   if (tsdbLoadBlockDataCols(&(pCommith->readh), pBlock, NULL, &colId, 1) < 0) return -1;
 
   tsdbLoadDataFromCache(pIter->pTable, &titer, keyLimit, INT32_MAX, NULL, pCommith->readh.pDCols[0]->cols[0].pData,
@@ -1470,11 +1757,9 @@ static void tsdbLoadAndMergeFromCache(SDataCols *pDataCols, int *iter, SCommitIt
 
   while (true) {
     key1 = (*iter >= pDataCols->numOfRows) ? INT64_MAX : dataColsKeyAt(pDataCols, *iter);
-    SMemRow row = tsdbNextIterRow(pCommitIter->pIter);
-    if (row == NULL || memRowKey(row) > maxKey) {
+    key2 = tsdbNextIterKey(pCommitIter->pIter);
+    if (key2 == TSDB_DATA_TIMESTAMP_NULL || key2 > maxKey) {
       key2 = INT64_MAX;
-    } else {
-      key2 = memRowKey(row);
     }
 
     if (key1 == INT64_MAX && key2 == INT64_MAX) break;
@@ -1489,16 +1774,30 @@ static void tsdbLoadAndMergeFromCache(SDataCols *pDataCols, int *iter, SCommitIt
       pTarget->numOfRows++;
       (*iter)++;
     } else if (key1 > key2) {
-      if (pSchema == NULL || schemaVersion(pSchema) != memRowVersion(row)) {
-        pSchema =
-            tsdbGetTableSchemaImpl(pCommitIter->pTable, false, false, memRowVersion(row), (int8_t)memRowType(row));
-        ASSERT(pSchema != NULL);
-      }
+      SMemIter *pMemIter = pCommitIter->pIter;
+      if (pMemIter->fromChunk) {
+        // copy the memory rows before the next disk row from the column chunk as a whole
+        SMemColChunk *pChunk = pMemIter->pChunk;
+        int           pos = pMemIter->pos;
+        int           nRows = tsdbMemIterChunkRows(pMemIter, MIN(maxKey, key1 - 1), maxRows - pTarget->numOfRows);
+
+        ASSERT(nRows > 0);
+        tdAppendDataColsRange(pTarget, &(pChunk->data), pos, nRows);
+        tsdbMemIterSkipChunkRows(pMemIter, nRows);
+      } else {
+        SMemRow row = tsdbNextIterRow(pMemIter);
+        if (pSchema == NULL || schemaVersion(pSchema) != memRowVersion(row)) {
+          pSchema =
+              tsdbGetTableSchemaImpl(pCommitIter->pTable, false, false, memRowVersion(row), (int8_t)memRowType(row));
+          ASSERT(pSchema != NULL);
+        }
 
-      tdAppendMemRowToDataCol(row, pSchema, pTarget, true, 0);
+        tdAppendMemRowToDataCol(row, pSchema, pTarget, true, 0);
 
-      tSkipListIterNext(pCommitIter->pIter);
+        tsdbMemIterNext(pMemIter);
+      }
     } else {
+      SMemRow row = tsdbNextIterRow(pCommitIter->pIter);
       if (update != TD_ROW_OVERWRITE_UPDATE) {
         //copy disk data
         for (int i = 0; i < pDataCols->numOfCols; i++) {
@@ -1521,7 +1820,7 @@ static void tsdbLoadAndMergeFromCache(SDataCols *pDataCols, int *iter, SCommitIt
                                 update != TD_ROW_PARTIAL_UPDATE ? 0 : -1);
       }
       (*iter)++;
-      tSkipListIterNext(pCommitIter->pIter);
+      tsdbMemIterNext(pCommitIter->pIter);
     }
 
     if (pTarget->numOfRows >= maxRows) break;
@@ -1532,6 +1831,7 @@ static void tsdbResetCommitFile(SCommitH *pCommith) {
   pCommith->isRFileSet = false;
   pCommith->isDFileSame = false;
   pCommith->isLFileSame = false;
+  pCommith->liveSize = 0;
   taosArrayClear(pCommith->aBlkIdx);
 }
 
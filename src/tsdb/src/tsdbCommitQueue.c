@@ -192,6 +192,8 @@ static void *tsdbLoopCommit(void *arg) {
       tsdbCommitData(pRepo, true);
     } else if (req == COMPACT_REQ) {
       tsdbCompactImpl(pRepo);
+    } else if (req == AUTO_COMPACT_REQ) {
+      tsdbAutoCompactImpl(pRepo);
     } else if (req == COMMIT_BOTH_REQ) {
       SControlDataInfo* pCtlDataInfo = (SControlDataInfo* )param;
       if(!pCtlDataInfo->memNull) {
@@ -30,8 +30,16 @@ typedef struct {
   SArray *   aBlkIdx;
   SArray *   aSupBlk;
   SDataCols *pDataCols;
+  int        fid;        // the only FSET to compact, TSDB_IVLD_FID to compact all of them
+  bool       outOfTxn;   // the FSET is written outside of an FS txn, see tsdbAutoCompactFSet
+  int64_t    startUs;    // when the FSET started to be written, to throttle an auto compaction
+  int64_t    wbytes;     // bytes written to the FSET
 } SCompactH;
 
+// the version of the files written by an auto compaction, they are renamed to the version of the FS txn installing
+// them, since commits go on meanwhile and take the following versions
+#define TSDB_COMPACT_TMP_VER UINT32_MAX
+
 #define TSDB_COMPACT_WSET(pComph) (&((pComph)->wSet))
 #define TSDB_COMPACT_REPO(pComph) TSDB_READ_REPO(&((pComph)->readh))
 #define TSDB_COMPACT_HEAD_FILE(pComph) TSDB_DFILE_IN_SET(TSDB_COMPACT_WSET(pComph), TSDB_FILE_HEAD)
@@ -47,10 +55,17 @@ static int  tsdbAsyncCompact(STsdbRepo *pRepo);
 static void tsdbStartCompact(STsdbRepo *pRepo);
 static void tsdbEndCompact(STsdbRepo *pRepo, int eno);
 static int  tsdbCompactMeta(STsdbRepo *pRepo);
-static int  tsdbCompactTSData(STsdbRepo *pRepo);
+static int  tsdbCompactTSData(STsdbRepo *pRepo, int fid);
+static void tsdbCompactRepo(STsdbRepo *pRepo, int fid);
+static void tsdbAutoCompactFSet(STsdbRepo *pRepo, int fid);
+static int  tsdbInstallCompactFSet(SCompactH *pComph, const SDFileSet *pOSet);
+static bool tsdbIsSameFSet(const SDFileSet *pSet1, const SDFileSet *pSet2);
+static SDFileSet *tsdbSearchFSet(STsdbFS *pfs, int fid);
+static void tsdbThrottleCompact(SCompactH *pComph, const SBlock *pBlock);
+static int  tsdbPickAutoCompactFSet(STsdbRepo *pRepo, double *pScore);
 static int  tsdbCompactFSet(SCompactH *pComph, SDFileSet *pSet);
 static bool tsdbShouldCompact(SCompactH *pComph);
-static int  tsdbInitCompactH(SCompactH *pComph, STsdbRepo *pRepo);
+static int  tsdbInitCompactH(SCompactH *pComph, STsdbRepo *pRepo, int fid);
 static void tsdbDestroyCompactH(SCompactH *pComph);
 static int  tsdbInitCompTbArray(SCompactH *pComph);
 static void tsdbDestroyCompTbArray(SCompactH *pComph);
@@ -64,13 +79,79 @@ static int  tsdbWriteBlockToRightFile(SCompactH *pComph, STable *pTable, SDataCo
 enum { TSDB_NO_COMPACT, TSDB_IN_COMPACT, TSDB_WAITING_COMPACT};
 int tsdbCompact(STsdbRepo *pRepo) { return tsdbAsyncCompact(pRepo); }
 
+// An FSET is picked by the auto compaction once one of its ratios reaches the threshold
+#define TSDB_AUTO_COMPACT_SUB_RATIO 0.33   // blocks with sub-blocks / all the blocks
+#define TSDB_AUTO_COMPACT_DEAD_RATIO 0.15  // bytes of .data/.last no block refers to / .data/.last bytes
+#define TSDB_AUTO_COMPACT_LAST_RATIO 0.33  // .last bytes / .data/.last bytes
+
 void *tsdbCompactImpl(STsdbRepo *pRepo) {
+  tsdbCompactRepo(pRepo, TSDB_IVLD_FID);
+  return NULL;
+}
+
+void *tsdbAutoCompactImpl(STsdbRepo *pRepo) {
+  double score = 0;
+  int    fid = pRepo->compactStop ? TSDB_IVLD_FID : tsdbPickAutoCompactFSet(pRepo, &score);
+
+  // the FSET may be gone by retention or a delete since the compaction was scheduled
+  if (fid == TSDB_IVLD_FID) {
+    pRepo->compactState = TSDB_NO_COMPACT;
+    tsem_post(&(pRepo->readyToCommit));
+    tsdbDebug("vgId:%d auto compact over, no FSET to compact", REPO_ID(pRepo));
+    return NULL;
+  }
+
+  tsdbInfo("vgId:%d auto compact FSET %d with score %.2f", REPO_ID(pRepo), fid, score);
+  tsdbAutoCompactFSet(pRepo, fid);
+  return NULL;
+}
+
+/**
+ * Called by the commit thread holding readyToCommit when a commit ends. If an FSET is worth compacting, an auto
+ * compaction is scheduled and readyToCommit is handed over to it, otherwise the caller has to release readyToCommit.
+ *
+ * At most one FSET of a repo is compacted per tsdbAutoCompactInterval seconds, and the compaction releases
+ * readyToCommit while it rewrites the FSET, so it never holds the commits and the writes back for long.
+ */
+bool tsdbScheduleAutoCompact(STsdbRepo *pRepo) {
+  double score = 0;
+
+  if (tsdbAutoCompactInterval <= 0 || pRepo->compactState != TSDB_NO_COMPACT) return false;
+
+  int64_t now = taosGetTimestampSec();
+  if (now - pRepo->lastAutoCompact < tsdbAutoCompactInterval) return false;
+
+  if (tsdbPickAutoCompactFSet(pRepo, &score) == TSDB_IVLD_FID) return false;
+
+  pRepo->lastAutoCompact = now;
+  pRepo->compactState = TSDB_WAITING_COMPACT;
+  if (tsdbScheduleCommit(pRepo, NULL, AUTO_COMPACT_REQ) != 0) {
+    pRepo->compactState = TSDB_NO_COMPACT;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Called holding readyToCommit with compactStop set. An auto compaction rewriting an FSET out of readyToCommit gives
+ * up at the next table and takes readyToCommit again to clean up, so hand it over until the compaction is over.
+ */
+void tsdbWaitAutoCompactStop(STsdbRepo *pRepo) {
+  while (pRepo->compactState == TSDB_IN_COMPACT) {
+    tsem_post(&(pRepo->readyToCommit));
+    taosMsleep(1);
+    tsem_wait(&(pRepo->readyToCommit));
+  }
+}
+
+static void tsdbCompactRepo(STsdbRepo *pRepo, int fid) {
   // Check if there are files in TSDB FS to compact
   if (REPO_FS(pRepo)->cstatus->pmf == NULL) {
     pRepo->compactState = TSDB_NO_COMPACT;
     tsem_post(&(pRepo->readyToCommit));
     tsdbInfo("vgId:%d compact over, no file to compact in FS", REPO_ID(pRepo));
-    return NULL;
+    return;
   }
 
   tsdbStartCompact(pRepo);
@@ -80,18 +161,193 @@ void *tsdbCompactImpl(STsdbRepo *pRepo) {
     goto _err;
   }
 
-  if (tsdbCompactTSData(pRepo) < 0) {
+  if (tsdbCompactTSData(pRepo, fid) < 0) {
     tsdbError("vgId:%d failed to compact TS data since %s", REPO_ID(pRepo), tstrerror(terrno));
     goto _err;
   }
 
   tsdbEndCompact(pRepo, TSDB_CODE_SUCCESS);
-  return NULL;
+  return;
 
 _err:
   pRepo->code = terrno;
   tsdbEndCompact(pRepo, terrno);
-  return NULL;
+}
+
+/**
+ * Rewrite one FSET without holding readyToCommit, so that the commits go on meanwhile. readyToCommit is taken again
+ * only to install the compacted FSET, which happens if no commit, retention, delete or sync changed the FSET since it
+ * was read. Otherwise the output is dropped and a later auto compaction picks the FSET again.
+ */
+static void tsdbAutoCompactFSet(STsdbRepo *pRepo, int fid) {
+  STsdbFS * pfs = REPO_FS(pRepo);
+  SCompactH compactH;
+  SDFileSet oSet;
+  int       code = 0;
+
+  SDFileSet *pSet = tsdbSearchFSet(pfs, fid);
+  if (pfs->cstatus->pmf == NULL || pSet == NULL) {
+    pRepo->compactState = TSDB_NO_COMPACT;
+    tsem_post(&(pRepo->readyToCommit));
+    tsdbDebug("vgId:%d auto compact over, FSET %d is gone", REPO_ID(pRepo), fid);
+    return;
+  }
+  oSet = *pSet;
+
+  if (tsdbInitCompactH(&compactH, pRepo, fid) < 0) {
+    pRepo->compactState = TSDB_NO_COMPACT;
+    tsem_post(&(pRepo->readyToCommit));
+    tsdbError("vgId:%d failed to auto compact FSET %d since %s", REPO_ID(pRepo), fid, tstrerror(terrno));
+    return;
+  }
+  compactH.outOfTxn = true;
+
+  pRepo->compactState = TSDB_IN_COMPACT;
+  tsem_post(&(pRepo->readyToCommit));
+
+  // the files of the FSET are removed by tsdbCompactFSet on failure
+  if (tsdbCompactFSet(&compactH, &oSet) < 0) {
+    tsdbError("vgId:%d failed to auto compact FSET %d since %s", REPO_ID(pRepo), fid, tstrerror(terrno));
+    code = -1;
+  }
+
+  tsem_wait(&(pRepo->readyToCommit));
+
+  if (code == 0) {
+    pSet = tsdbSearchFSet(pfs, fid);
+    if (pRepo->compactStop || pSet == NULL || !tsdbIsSameFSet(pSet, &oSet)) {
+      tsdbInfo("vgId:%d FSET %d is changed while compacting, give up the compacted one", REPO_ID(pRepo), fid);
+      code = -1;
+    } else if (tsdbInstallCompactFSet(&compactH, &oSet) < 0) {
+      tsdbError("vgId:%d failed to install the compacted FSET %d since %s", REPO_ID(pRepo), fid, tstrerror(terrno));
+      code = -1;
+    }
+
+    if (code != 0) tsdbRemoveDFileSet(TSDB_COMPACT_WSET(&compactH));
+  }
+
+  tsdbDestroyCompactH(&compactH);
+  pRepo->compactState = TSDB_NO_COMPACT;
+  tsdbInfo("vgId:%d auto compact FSET %d over, %s", REPO_ID(pRepo), fid, (code == 0) ? "succeed" : "failed");
+  tsem_post(&(pRepo->readyToCommit));
+}
+
+static SDFileSet *tsdbSearchFSet(STsdbFS *pfs, int fid) {
+  SFSIter fsIter;
+
+  tsdbFSIterInit(&fsIter, pfs, TSDB_FS_ITER_FORWARD);
+  tsdbFSIterSeek(&fsIter, fid);
+
+  SDFileSet *pSet = tsdbFSIterNext(&fsIter);
+  return (pSet != NULL && pSet->fid == fid) ? pSet : NULL;
+}
+
+// the files of a FSET are rewritten under new names when changed, and appended to with new sizes otherwise
+static bool tsdbIsSameFSet(const SDFileSet *pSet1, const SDFileSet *pSet2) {
+  if (pSet1->fid != pSet2->fid || pSet1->ver != pSet2->ver) return false;
+
+  for (TSDB_FILE_T ftype = 0; ftype < tsdbGetNFiles((SDFileSet *)pSet1); ftype++) {
+    const SDFile *pDFile1 = TSDB_DFILE_IN_SET(pSet1, ftype);
+    const SDFile *pDFile2 = TSDB_DFILE_IN_SET(pSet2, ftype);
+    if (strcmp(TSDB_FILE_FULL_NAME(pDFile1), TSDB_FILE_FULL_NAME(pDFile2)) != 0 ||
+        pDFile1->info.size != pDFile2->info.size || pDFile1->info.magic != pDFile2->info.magic) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Install the FSET written by an auto compaction in place of pOSet, called with readyToCommit held
+static int tsdbInstallCompactFSet(SCompactH *pComph, const SDFileSet *pOSet) {
+  STsdbRepo *pRepo = TSDB_COMPACT_REPO(pComph);
+  STsdbFS *  pfs = REPO_FS(pRepo);
+  SDFileSet *pWSet = TSDB_COMPACT_WSET(pComph);
+  SDFileSet  nSet;
+  SFSIter    fsIter;
+  SDFileSet *pSet;
+  SDiskID    did = {.level = TSDB_FSET_LEVEL(pWSet), .id = TSDB_FSET_ID(pWSet)};
+
+  tsdbStartFSTxn(pRepo, 0, 0);
+  tsdbUpdateMFile(pfs, pfs->cstatus->pmf);
+
+  tsdbInitDFileSet(&nSet, did, REPO_ID(pRepo), pOSet->fid, FS_TXN_VERSION(pfs), pWSet->ver);
+  for (TSDB_FILE_T ftype = 0; ftype < tsdbGetNFiles(&nSet); ftype++) {
+    SDFile *pWFile = TSDB_DFILE_IN_SET(pWSet, ftype);
+    SDFile *pNFile = TSDB_DFILE_IN_SET(&nSet, ftype);
+
+    pNFile->info = pWFile->info;
+    if (tfsrename(TSDB_FILE_F(pWFile), TSDB_FILE_F(pNFile)) < 0) {
+      terrno = TAOS_SYSTEM_ERROR(errno);
+      // the files renamed already are removed with the FSET
+      for (TSDB_FILE_T t = 0; t < ftype; t++) {
+        tsdbRemoveDFile(TSDB_DFILE_IN_SET(&nSet, t));
+      }
+      tsdbEndFSTxnWithError(pfs);
+      return -1;
+    }
+  }
+
+  tsdbFSIterInit(&fsIter, pfs, TSDB_FS_ITER_FORWARD);
+  while ((pSet = tsdbFSIterNext(&fsIter))) {
+    if (tsdbUpdateDFileSet(pfs, (pSet->fid == pOSet->fid) ? &nSet : pSet) < 0) {
+      tsdbEndFSTxnWithError(pfs);
+      return -1;
+    }
+  }
+
+  return tsdbEndFSTxn(pRepo);
+}
+
+// sleep as long as the FSET is written faster than tsdbAutoCompactRate
+static void tsdbThrottleCompact(SCompactH *pComph, const SBlock *pBlock) {
+  if (!pComph->outOfTxn || tsdbAutoCompactRate <= 0) return;
+
+  pComph->wbytes += pBlock->len;
+
+  int64_t expectUs = pComph->wbytes / tsdbAutoCompactRate;  // bytes / (MB/s) is about us
+  int64_t elapsedUs = taosGetTimestampUs() - pComph->startUs;
+  if (expectUs - elapsedUs >= 1000) {
+    taosMsleep((int32_t)((expectUs - elapsedUs) / 1000));
+  }
+}
+
+// Score the FSETs by the counters kept in their .head files and return the fid of the worst one with a score of at
+// least 1, or TSDB_IVLD_FID if no FSET needs compaction.
+static int tsdbPickAutoCompactFSet(STsdbRepo *pRepo, double *pScore) {
+  SRtn    rtn;
+  SFSIter fsIter;
+  int     fid = TSDB_IVLD_FID;
+
+  *pScore = 0;
+  tsdbGetRtnSnap(pRepo, &rtn);
+  tsdbFSIterInit(&fsIter, REPO_FS(pRepo), TSDB_FS_ITER_FORWARD);
+
+  SDFileSet *pSet = NULL;
+  while ((pSet = tsdbFSIterNext(&fsIter))) {
+    if (pSet->fid < rtn.minFid || TSDB_FSET_LEVEL(pSet) == TFS_MAX_LEVEL) continue;
+
+    SDFInfo *pHeadInfo = &(TSDB_DFILE_IN_SET(pSet, TSDB_FILE_HEAD)->info);
+    int64_t  dsize = (int64_t)TSDB_DFILE_IN_SET(pSet, TSDB_FILE_DATA)->info.size - TSDB_FILE_HEAD_SIZE;
+    int64_t  lsize = (int64_t)TSDB_DFILE_IN_SET(pSet, TSDB_FILE_LAST)->info.size - TSDB_FILE_HEAD_SIZE;
+
+    // a compacted FSET has neither sub-blocks nor dead bytes, do not pick it again for its .last alone
+    if (pHeadInfo->totalBlocks == 0 || dsize + lsize <= 0) continue;
+    if (pHeadInfo->totalSubBlocks == 0 && pHeadInfo->tombSize == 0) continue;
+
+    double subRatio = pHeadInfo->totalSubBlocks * 1.0 / pHeadInfo->totalBlocks;
+    double deadRatio = pHeadInfo->tombSize * 1.0 / (dsize + lsize);
+    double lastRatio = lsize * 1.0 / (dsize + lsize);
+    double score = MAX(subRatio / TSDB_AUTO_COMPACT_SUB_RATIO, deadRatio / TSDB_AUTO_COMPACT_DEAD_RATIO);
+    score = MAX(score, lastRatio / TSDB_AUTO_COMPACT_LAST_RATIO);
+
+    if (score >= 1 && score > *pScore) {
+      *pScore = score;
+      fid = pSet->fid;
+    }
+  }
+
+  return fid;
 }
 
 static int tsdbAsyncCompact(STsdbRepo *pRepo) {
@@ -133,7 +389,7 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
   return 0;
 }
 
-  static int tsdbCompactTSData(STsdbRepo *pRepo) {
+  static int tsdbCompactTSData(STsdbRepo *pRepo, int fid) {
     SCompactH  compactH;
     SDFileSet *pSet = NULL;
 
@@ -145,7 +401,7 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
       return 0;
     }
 
-    if (tsdbInitCompactH(&compactH, pRepo) < 0) {
+    if (tsdbInitCompactH(&compactH, pRepo, fid) < 0) {
       return -1;
     }
 
@@ -163,6 +419,12 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
         continue;
       }
 
+      // An auto compaction leaves the other FSETs as they are
+      if (fid != TSDB_IVLD_FID && pSet->fid != fid) {
+        tsdbUpdateDFileSet(REPO_FS(pRepo), pSet);
+        continue;
+      }
+
       if (tsdbCompactFSet(&compactH, pSet) < 0) {
         tsdbDestroyCompactH(&compactH);
         tsdbError("vgId:%d failed to compact FSET %d since %s", REPO_ID(pRepo), pSet->fid, tstrerror(terrno));
@@ -203,13 +465,15 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
       }
 
       tsdbInitDFileSet(TSDB_COMPACT_WSET(pComph), did, REPO_ID(pRepo), TSDB_FSET_FID(pSet),
-                      FS_TXN_VERSION(REPO_FS(pRepo)), TSDB_LATEST_FSET_VER);
+                      pComph->outOfTxn ? TSDB_COMPACT_TMP_VER : FS_TXN_VERSION(REPO_FS(pRepo)), TSDB_LATEST_FSET_VER);
       if (tsdbCreateDFileSet(TSDB_COMPACT_WSET(pComph), true) < 0) {
         tsdbError("vgId:%d failed to compact FSET %d since %s", REPO_ID(pRepo), pSet->fid, tstrerror(terrno));
         tsdbCompactFSetEnd(pComph);
         return -1;
       }
 
+      pComph->startUs = taosGetTimestampUs();
+      pComph->wbytes = 0;
       if (tsdbCompactFSetImpl(pComph) < 0) {
         tsdbCloseDFileSet(TSDB_COMPACT_WSET(pComph));
         tsdbRemoveDFileSet(TSDB_COMPACT_WSET(pComph));
@@ -218,7 +482,8 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
       }
 
       tsdbCloseDFileSet(TSDB_COMPACT_WSET(pComph));
-      tsdbUpdateDFileSet(REPO_FS(pRepo), TSDB_COMPACT_WSET(pComph));
+      // the FSET written outside of an FS txn is installed by the caller
+      if (!pComph->outOfTxn) tsdbUpdateDFileSet(REPO_FS(pRepo), TSDB_COMPACT_WSET(pComph));
       tsdbDebug("vgId:%d FSET %d compact over", REPO_ID(pRepo), pSet->fid);
     }
 
@@ -227,7 +492,7 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
   }
 
   static bool tsdbShouldCompact(SCompactH *pComph) {
-    if (tsdbForceCompactFile) {
+    if (tsdbForceCompactFile || pComph->fid != TSDB_IVLD_FID) {
       return true;
     }
     STsdbRepo *     pRepo = TSDB_COMPACT_REPO(pComph);
@@ -275,10 +540,11 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
             (tsize * 1.0 / (pDataF->info.size + pLastF->info.size - 2 * TSDB_FILE_HEAD_SIZE) < 0.85));
   }
 
-  static int tsdbInitCompactH(SCompactH *pComph, STsdbRepo *pRepo) {
+  static int tsdbInitCompactH(SCompactH *pComph, STsdbRepo *pRepo, int fid) {
     STsdbCfg *pCfg = REPO_CFG(pRepo);
 
     memset(pComph, 0, sizeof(*pComph));
+    pComph->fid = fid;
 
     TSDB_FSET_SET_CLOSED(TSDB_COMPACT_WSET(pComph));
 
@@ -442,6 +708,11 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
 
       if (pTh->pTable == NULL || pTh->pBlkIdx == NULL) continue;
 
+      if (pComph->outOfTxn && pRepo->compactStop) {
+        terrno = TSDB_CODE_TDB_INVALID_ACTION;
+        return -1;
+      }
+
       pSchema = tsdbGetTableSchemaImpl(pTh->pTable, true, true, -1, -1);
       taosArrayClear(pComph->aSupBlk);
       if ((tdInitDataCols(pComph->pDataCols, pSchema) < 0) || (tdInitDataCols(pReadh->pDCols[0], pSchema) < 0) ||
@@ -539,6 +810,7 @@ static int tsdbCompactMeta(STsdbRepo *pRepo) {
       return -1;
     }
 
+    tsdbThrottleCompact(pComph, &block);
     return 0;
   }
 
@@ -394,6 +394,10 @@ int tsdbEndFSTxn(STsdbRepo *pRepo) {
   // Apply actual change to each file and SDFileSet
   tsdbApplyFSTxnOnDisk(pfs->nstatus, pfs->cstatus);
 
+  if (pRepo->blkCache != NULL) {
+    tsdbBlockCachePurge(pRepo->blkCache, pfs->cstatus->df);
+  }
+
   pfs->intxn = false;
   return 0;
 }
@@ -1243,11 +1247,13 @@ static int tsdbRestoreDFileSet(STsdbRepo *pRepo) {
       nDFiles = 1;
       fset.fid = tfid;
       pDFile->f = *pf;
+      pDFile->ver = tversion;
       isOneFSetFinish = false;
     } else {
       if (fset.fid == tfid) {
         ++nDFiles;
         pDFile->f = *pf;
+        pDFile->ver = tversion;
         // (1) the array ends
         if (index == fArraySize - 1) {
           if (tsdbIsDFileSetValid(nDFiles)) {
@@ -1279,6 +1285,7 @@ static int tsdbRestoreDFileSet(STsdbRepo *pRepo) {
           nDFiles = 1;
           fset.fid = tfid;
           pDFile->f = *pf;
+          pDFile->ver = tversion;
           isOneFSetFinish = false;
           continue;
 #endif
@@ -1340,6 +1347,7 @@ static int tsdbRestoreDFileSet(STsdbRepo *pRepo) {
       nDFiles = 1;
       fset.fid = tfid;
       pDFile->f = *pf;
+      pDFile->ver = tversion;
       isOneFSetFinish = false;
     }
   }
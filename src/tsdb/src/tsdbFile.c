@@ -26,6 +26,7 @@ static const char *TSDB_FNAME_SUFFIX[] = {
 };
 
 static void  tsdbGetFilename(int vid, int fid, uint32_t ver, TSDB_FILE_T ftype, char *fname);
+static uint32_t tsdbParseDFileVer(const SDFile *pDFile);
 static int   tsdbRollBackMFile(SMFile *pMFile);
 static int   tsdbEncodeDFInfo(void **buf, SDFInfo *pInfo);
 static void *tsdbDecodeDFInfo(void *buf, SDFInfo *pInfo, TSDB_FVER_TYPE sfver);
@@ -307,6 +308,7 @@ void tsdbInitDFile(SDFile *pDFile, SDiskID did, int vid, int fid, uint32_t ver,
 
   tsdbGetFilename(vid, fid, ver, ftype, fname);
   tfsInitFile(&(pDFile->f), did.level, did.id, fname);
+  pDFile->ver = ver;
 }
 
 void tsdbInitDFileEx(SDFile *pDFile, SDFile *pODFile) {
@@ -326,6 +328,7 @@ int tsdbEncodeSDFile(void **buf, SDFile *pDFile) {
 void *tsdbDecodeSDFile(void *buf, SDFile *pDFile, uint32_t sfver) {
   buf = tsdbDecodeDFInfo(buf, &(pDFile->info), sfver);
   buf = tfsDecodeFile(buf, &(pDFile->f));
+  pDFile->ver = tsdbParseDFileVer(pDFile);
   TSDB_FILE_SET_CLOSED(pDFile);
 
   return buf;
@@ -346,6 +349,7 @@ static void *tsdbDecodeSDFileEx(void *buf, SDFile *pDFile) {
   buf = tsdbDecodeDFInfo(buf, &(pDFile->info), TSDB_LATEST_SFS_VER);
   buf = taosDecodeString(buf, &aname);
   tstrncpy(TSDB_FILE_FULL_NAME(pDFile), aname, TSDB_FILENAME_LEN);
+  pDFile->ver = tsdbParseDFileVer(pDFile);
   TSDB_FILE_SET_CLOSED(pDFile);
   tfree(aname);
 
@@ -699,6 +703,17 @@ int tsdbParseDFilename(const char *fname, int *vid, int *fid, TSDB_FILE_T *ftype
   return 0;
 }
 
+static uint32_t tsdbParseDFileVer(const SDFile *pDFile) {
+  char        bname[TSDB_FILENAME_LEN];
+  int         vid, fid;
+  TSDB_FILE_T ftype;
+  uint32_t    fnameVer = 0;
+
+  tfsbasename(TSDB_FILE_F(pDFile), bname);
+  tsdbParseDFilename(bname, &vid, &fid, &ftype, &fnameVer);
+  return fnameVer;
+}
+
 static void tsdbGetFilename(int vid, int fid, uint32_t ver, TSDB_FILE_T ftype, char *fname) {
   ASSERT(ftype != TSDB_FILE_MAX);
 
@@ -136,7 +136,9 @@ int tsdbCloseRepo(STsdbRepo *repo, int toCommit) {
     tsdbSyncCommit(repo);
   }
 
+  pRepo->compactStop = 1;
   tsem_wait(&(pRepo->readyToCommit));
+  tsdbWaitAutoCompactStop(pRepo);
 
   tsdbUnRefMemTable(pRepo, pRepo->mem);
   tsdbUnRefMemTable(pRepo, pRepo->imem);
@@ -576,6 +578,7 @@ static STsdbRepo *tsdbNewRepo(STsdbCfg *pCfg, STsdbAppH *pAppH) {
   pRepo->code = TSDB_CODE_SUCCESS;
   pRepo->compactState = 0;
   pRepo->deleteState = 0;
+  pRepo->lastAutoCompact = taosGetTimestampSec();
   pRepo->config = *pCfg;
   if (pAppH) {
     pRepo->appH = *pAppH;
@@ -628,11 +631,21 @@ static STsdbRepo *tsdbNewRepo(STsdbCfg *pCfg, STsdbAppH *pAppH) {
     return NULL;
   }
 
+  if (tsdbBlockCacheSize > 0) {
+    pRepo->blkCache = tsdbNewBlockCache((int64_t)tsdbBlockCacheSize * 1024 * 1024);
+    if (pRepo->blkCache == NULL) {
+      tsdbError("vgId:%d failed to create block cache since %s", REPO_ID(pRepo), tstrerror(terrno));
+      tsdbFreeRepo(pRepo);
+      return NULL;
+    }
+  }
+
   return pRepo;
 }
 
 static void tsdbFreeRepo(STsdbRepo *pRepo) {
   if (pRepo) {
+    tsdbFreeBlockCache(pRepo->blkCache);
     tsdbFreeFS(pRepo->fs);
     tsdbFreeBufPool(pRepo->pPool);
     tsdbFreeMeta(pRepo->tsdbMeta);
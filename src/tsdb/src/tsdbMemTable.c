@@ -19,8 +19,13 @@
 #include "tsdbRowMergeBuf.h"
 #include "tsdbint.h"
 
+extern int8_t tsdbColumnarMem;
+
 #define TSDB_DATA_SKIPLIST_LEVEL 5
 #define TSDB_MAX_INSERT_BATCH 512
+#define TSDB_MEM_CHUNK_MIN_ROWS 16
+#define TSDB_MEM_CHUNK_MAX_ROWS 1024
+#define TSDB_MEM_CHUNK_MAX_SIZE (64 * 1024)
 
 typedef struct {
   int32_t  totalLen;
@@ -36,7 +41,8 @@ typedef struct {
 
 static SMemTable *  tsdbNewMemTable(STsdbRepo *pRepo);
 static void         tsdbFreeMemTable(SMemTable *pMemTable);
-static STableData*  tsdbNewTableData(STsdbCfg *pCfg, STable *pTable);
+static STableData*  tsdbNewTableData(STsdbRepo *pRepo, STable *pTable);
+static void*        tsdbAllocSkipListNode(void *param, int32_t bytes);
 static void         tsdbFreeTableData(STableData *pTableData);
 static char *       tsdbGetTsTupleKey(const void *data);
 static int          tsdbAdjustMemMaxTables(SMemTable *pMemTable, int maxTables);
@@ -50,6 +56,27 @@ static int          tsdbGetSubmitMsgNext(SSubmitMsgIter *pIter, SSubmitBlk **pPB
 static int          tsdbCheckTableSchema(STsdbRepo *pRepo, SSubmitBlk *pBlock, STable *pTable);
 static int          tsdbUpdateTableLatestInfo(STsdbRepo *pRepo, STable *pTable, SMemRow row);
 static int32_t      tsdbInsertControlData(STsdbRepo* pRepo, SSubmitBlk* pBlock, SShellSubmitRspMsg *pRsp, tsem_t** pSem);
+static SMemColChunk*tsdbNewMemColChunk(STsdbRepo *pRepo, STSchema *pSchema, SMemColChunk *pPrev);
+static int          tsdbAppendMemChunkRow(STsdbRepo *pRepo, STable *pTable, STableData *pTableData, SMemRow row);
+static int          tsdbInsertRowsToChunks(STsdbRepo *pRepo, STable *pTable, STableData *pTableData,
+                                           SSubmitBlkIter *pIter, int32_t *pPoints, SMemRow *pLastRow,
+                                           int64_t *pAppended);
+static bool         tsdbSeekMemChunk(SMemColChunk *pTail, TSKEY key, int32_t order, SMemColChunk **ppChunk,
+                                     int32_t *pPos);
+static void         tsdbMemIterMoveChunk(SMemIter *pIter);
+static bool         tsdbMemIterSettle(SMemIter *pIter);
+static SMemRow      tsdbMemIterChunkRow(SMemIter *pIter);
+
+static int          tsdbGetSubmitColumns(SSubmitBlk *pBlock, SSubmitColumn **cols, int ncols);
+static int          tsdbCheckColumnarBlock(STsdbRepo *pRepo, STable *pTable, SSubmitBlk *pBlock, TSKEY minKey,
+                                           TSKEY maxKey, TSKEY now);
+static STableData*  tsdbGetTableDataToInsert(STsdbRepo *pRepo, STable *pTable);
+static int          tsdbInsertColumnarDataToTable(STsdbRepo *pRepo, SSubmitBlk *pBlock, int32_t *pAffectedRows);
+static int          tsdbAppendMemChunkCols(STsdbRepo *pRepo, STableData *pTableData, STSchema *pSchema,
+                                           SSubmitColumn **cols, int32_t rows);
+static void         tsdbColumnarRowToMemRow(STSchema *pSchema, SSubmitColumn **cols, int32_t rows, int32_t idx,
+                                            SMemRow row);
+static SSubmitBlk * tsdbColumnarBlockToRows(SSubmitBlk *pBlock, STSchema *pSchema, SSubmitColumn **cols);
 
 static FORCE_INLINE int tsdbCheckRowRange(STsdbRepo *pRepo, STable *pTable, SMemRow row, TSKEY minKey, TSKEY maxKey,
                                           TSKEY now);
@@ -392,16 +419,16 @@ int tsdbSyncCommit(STsdbRepo *repo) {
  * 
  * The function tries to procceed AS MUCH AS POSSIBLE.
  */
-int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey, int maxRowsToRead, SDataCols *pCols,
+int tsdbLoadDataFromCache(STable *pTable, SMemIter *pIter, TSKEY maxKey, int maxRowsToRead, SDataCols *pCols,
                           TKEY *filterKeys, int nFilterKeys, bool keepDup, SMergeInfo *pMergeInfo) {
   ASSERT(maxRowsToRead > 0 && nFilterKeys >= 0);
   if (pIter == NULL) return 0;
   STSchema * pSchema = NULL;
   TSKEY      rowKey = 0;
   TSKEY      fKey = 0;
+  TKEY       tkey = TKEY_NULL;
   bool       isRowDel = false;
   int        filterIter = 0;
-  SMemRow    row = NULL;
   SMergeInfo mInfo;
 
   if (pMergeInfo == NULL) pMergeInfo = &mInfo;
@@ -411,13 +438,13 @@ int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey
   pMergeInfo->keyLast = INT64_MIN;
   if (pCols) tdResetDataCols(pCols);
 
-  row = tsdbNextIterRow(pIter);
-  if (row == NULL || memRowKey(row) > maxKey) {
+  tkey = tsdbNextIterTKey(pIter);
+  if (tkey == TKEY_NULL || tdGetKey(tkey) > maxKey) {
     rowKey = INT64_MAX;
     isRowDel = false;
   } else {
-    rowKey = memRowKey(row);
-    isRowDel = memRowDeleted(row);
+    rowKey = tdGetKey(tkey);
+    isRowDel = TKEY_IS_DELETED(tkey);
   }
 
   if (filterIter >= nFilterKeys) {
@@ -442,24 +469,42 @@ int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey
     } else if (fKey > rowKey) {
       if (isRowDel) {
         pMergeInfo->rowsDeleteFailed++;
+        tsdbMemIterNext(pIter);
       } else {
         if (pMergeInfo->rowsInserted - pMergeInfo->rowsDeleteSucceed >= maxRowsToRead) break;
         if (pCols && pMergeInfo->nOperations >= pCols->maxPoints) break;
-        pMergeInfo->rowsInserted++;
-        pMergeInfo->nOperations++;
+
+        int nRows = 1;
+        if (pIter->fromChunk) {
+          // copy the rows up to the next filter key straight from the column chunk
+          int maxRows = maxRowsToRead - (pMergeInfo->rowsInserted - pMergeInfo->rowsDeleteSucceed);
+          if (pCols) maxRows = MIN(maxRows, pCols->maxPoints - pMergeInfo->nOperations);
+          SMemColChunk *pChunk = pIter->pChunk;
+          int           pos = pIter->pos;
+
+          nRows = tsdbMemIterChunkRows(pIter, MIN(maxKey, fKey - 1), maxRows);
+          ASSERT(nRows > 0);
+          if (pCols) tdAppendDataColsRange(pCols, &(pChunk->data), pos, nRows);
+          rowKey = dataColsKeyAt(&(pChunk->data), pos + nRows - 1);
+          tsdbMemIterSkipChunkRows(pIter, nRows);
+        } else {
+          tsdbAppendTableRowToCols(pTable, pCols, &pSchema, tsdbNextIterRow(pIter));
+          tsdbMemIterNext(pIter);
+        }
+
         pMergeInfo->keyFirst = MIN(pMergeInfo->keyFirst, rowKey);
+        pMergeInfo->rowsInserted += nRows;
+        pMergeInfo->nOperations += nRows;
         pMergeInfo->keyLast = MAX(pMergeInfo->keyLast, rowKey);
-        tsdbAppendTableRowToCols(pTable, pCols, &pSchema, row);
       }
 
-      tSkipListIterNext(pIter);
-      row = tsdbNextIterRow(pIter);
-      if (row == NULL || memRowKey(row) > maxKey) {
+      tkey = tsdbNextIterTKey(pIter);
+      if (tkey == TKEY_NULL || tdGetKey(tkey) > maxKey) {
         rowKey = INT64_MAX;
         isRowDel = false;
       } else {
-        rowKey = memRowKey(row);
-        isRowDel = memRowDeleted(row);
+        rowKey = tdGetKey(tkey);
+        isRowDel = TKEY_IS_DELETED(tkey);
       }
     } else {
       if (isRowDel) {
@@ -467,7 +512,7 @@ int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey
         if (pCols && pMergeInfo->nOperations >= pCols->maxPoints) break;
         pMergeInfo->rowsDeleteSucceed++;
         pMergeInfo->nOperations++;
-        tsdbAppendTableRowToCols(pTable, pCols, &pSchema, row);
+        tsdbAppendTableRowToCols(pTable, pCols, &pSchema, tsdbNextIterRow(pIter));
       } else {
         if (keepDup) {
           if (pCols && pMergeInfo->nOperations >= pCols->maxPoints) break;
@@ -475,21 +520,21 @@ int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey
           pMergeInfo->nOperations++;
           pMergeInfo->keyFirst = MIN(pMergeInfo->keyFirst, rowKey);
           pMergeInfo->keyLast = MAX(pMergeInfo->keyLast, rowKey);
-          tsdbAppendTableRowToCols(pTable, pCols, &pSchema, row);
+          tsdbAppendTableRowToCols(pTable, pCols, &pSchema, tsdbNextIterRow(pIter));
         } else {
           pMergeInfo->keyFirst = MIN(pMergeInfo->keyFirst, fKey);
           pMergeInfo->keyLast = MAX(pMergeInfo->keyLast, fKey);
         }
       }
 
-      tSkipListIterNext(pIter);
-      row = tsdbNextIterRow(pIter);
-      if (row == NULL || memRowKey(row) > maxKey) {
+      tsdbMemIterNext(pIter);
+      tkey = tsdbNextIterTKey(pIter);
+      if (tkey == TKEY_NULL || tdGetKey(tkey) > maxKey) {
         rowKey = INT64_MAX;
         isRowDel = false;
       } else {
-        rowKey = memRowKey(row);
-        isRowDel = memRowDeleted(row);
+        rowKey = tdGetKey(tkey);
+        isRowDel = TKEY_IS_DELETED(tkey);
       }
 
       filterIter++;
@@ -504,6 +549,145 @@ int tsdbLoadDataFromCache(STable *pTable, SSkipListIterator *pIter, TSKEY maxKey
   return 0;
 }
 
+SMemIter *tsdbCreateMemIter(STable *pTable, STableData *pTableData, const TSKEY *pKey, int32_t order) {
+  SSkipListIterator *pSlIter = NULL;
+  SMemIter *         pIter = (SMemIter *)calloc(1, sizeof(*pIter));
+  if (pIter == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  if (pKey != NULL) {
+    TKEY tkey = keyToTkey(*pKey);
+    pSlIter = tSkipListCreateIterFromVal(pTableData->pData, (const char *)&tkey, TSDB_DATA_TYPE_TIMESTAMP, order);
+  } else {
+    pSlIter = tSkipListCreateIterFromVal(pTableData->pData, NULL, TSDB_DATA_TYPE_TIMESTAMP, order);
+  }
+  if (pSlIter == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    free(pIter);
+    return NULL;
+  }
+  pIter->slIter = *pSlIter;
+  tSkipListDestroyIter(pSlIter);
+
+  pIter->pTable = pTable;
+  pIter->order = (int8_t)order;
+
+  SMemColChunk *pTail = atomic_load_ptr(&(pTableData->pChunkTail));
+  if (pTail != NULL) {
+    pIter->pRowBuf = (SMemRowBuf *)calloc(1, sizeof(SMemRowBuf));
+    if (pIter->pRowBuf == NULL) {
+      terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+      free(pIter);
+      return NULL;
+    }
+
+    TSKEY key = (pKey != NULL) ? *pKey : ((order == TSDB_ORDER_ASC) ? INT64_MIN : INT64_MAX);
+    if (!tsdbSeekMemChunk(pTail, key, order, &(pIter->pChunk), &(pIter->pos))) {
+      pIter->pChunk = NULL;
+      pIter->pos = 0;
+    }
+  }
+
+  return pIter;
+}
+
+void *tsdbDestroyMemIter(SMemIter *pIter) {
+  if (pIter == NULL) return NULL;
+
+  if (pIter->pRowBuf != NULL) {
+    tfree(pIter->pRowBuf->row);
+    free(pIter->pRowBuf);
+  }
+  free(pIter);
+  return NULL;
+}
+
+bool tsdbMemIterNext(SMemIter *pIter) {
+  if (!pIter->started) {
+    pIter->started = true;
+    tSkipListIterNext(&(pIter->slIter));
+  } else if (pIter->fromChunk) {
+    tsdbMemIterMoveChunk(pIter);
+  } else {
+    // the skip list row shadows the chunk row with the same key, so pass both
+    SSkipListNode *node = tSkipListIterGet(&(pIter->slIter));
+    if (node != NULL && pIter->pChunk != NULL &&
+        dataColsKeyAt(&(pIter->pChunk->data), pIter->pos) == memRowKey((SMemRow)SL_GET_NODE_DATA(node))) {
+      tsdbMemIterMoveChunk(pIter);
+    }
+    tSkipListIterNext(&(pIter->slIter));
+  }
+
+  return tsdbMemIterSettle(pIter);
+}
+
+SMemRow tsdbMemIterGet(SMemIter *pIter) {
+  if (!pIter->started) return NULL;
+
+  if (pIter->fromChunk) return tsdbMemIterChunkRow(pIter);
+
+  SSkipListNode *node = tSkipListIterGet(&(pIter->slIter));
+  if (node == NULL) return NULL;
+
+  return (SMemRow)SL_GET_NODE_DATA(node);
+}
+
+/**
+ * Return the number of rows from the current one on that can be taken from its column chunk as a whole, that is
+ * rows of the same chunk not beyond boundKey in the iterating order and before the next skip list row.
+ */
+int tsdbMemIterChunkRows(SMemIter *pIter, TSKEY boundKey, int maxRows) {
+  if (!pIter->started || !pIter->fromChunk || maxRows <= 0) return 0;
+
+  SDataCols *    pData = &(pIter->pChunk->data);
+  SSkipListNode *node = tSkipListIterGet(&(pIter->slIter));
+  int            lo = 0, hi = 0;
+
+  if (pIter->order == TSDB_ORDER_ASC) {
+    if (node != NULL) boundKey = MIN(boundKey, memRowKey((SMemRow)SL_GET_NODE_DATA(node)) - 1);
+    lo = pIter->pos;
+    hi = MIN(atomic_load_32(&(pData->numOfRows)), pIter->pos + maxRows);
+    // find the first row beyond boundKey
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (dataColsKeyAt(pData, mid) <= boundKey) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo - pIter->pos;
+  } else {
+    if (node != NULL) boundKey = MAX(boundKey, memRowKey((SMemRow)SL_GET_NODE_DATA(node)) + 1);
+    lo = MAX(pIter->pos - maxRows + 1, 0);
+    hi = pIter->pos + 1;
+    // find the first row not before boundKey
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (dataColsKeyAt(pData, mid) < boundKey) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return pIter->pos + 1 - lo;
+  }
+}
+
+void tsdbMemIterSkipChunkRows(SMemIter *pIter, int nRows) {
+  ASSERT(pIter->fromChunk && nRows > 0);
+
+  if (pIter->order == TSDB_ORDER_ASC) {
+    pIter->pos += nRows - 1;
+  } else {
+    pIter->pos -= nRows - 1;
+  }
+  tsdbMemIterMoveChunk(pIter);
+  tsdbMemIterSettle(pIter);
+}
+
 // ---------------- LOCAL FUNCTIONS ----------------
 static SMemTable* tsdbNewMemTable(STsdbRepo *pRepo) {
   STsdbMeta *pMeta = pRepo->tsdbMeta;
@@ -559,7 +743,8 @@ static void tsdbFreeMemTable(SMemTable* pMemTable) {
   }
 }
 
-static STableData *tsdbNewTableData(STsdbCfg *pCfg, STable *pTable) {
+static STableData *tsdbNewTableData(STsdbRepo *pRepo, STable *pTable) {
+  STsdbCfg   *pCfg = &(pRepo->config);
   STableData *pTableData = (STableData *)calloc(1, sizeof(*pTableData));
   if (pTableData == NULL) {
     terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
@@ -577,6 +762,13 @@ static STableData *tsdbNewTableData(STsdbCfg *pCfg, STable *pTable) {
   else
     skipListCreateFlags = SL_UPDATE_DUP_KEY;
 
+  // rows are written by the vnode write thread while queries iterate the list concurrently
+  skipListCreateFlags |= SL_LOCK_FREE;
+
+  // partial update merges a new row into the old one, which needs the row format
+  pTableData->columnar = (tsdbColumnarMem && pCfg->update != TD_ROW_PARTIAL_UPDATE);
+  pTableData->pChunkTail = NULL;
+
   pTableData->pData =
       tSkipListCreate(TSDB_DATA_SKIPLIST_LEVEL, TSDB_DATA_TYPE_TIMESTAMP, TYPE_BYTES[TSDB_DATA_TYPE_TIMESTAMP],
                       tkeyComparFn, skipListCreateFlags, tsdbGetTsTupleKey);
@@ -586,6 +778,9 @@ static STableData *tsdbNewTableData(STsdbCfg *pCfg, STable *pTable) {
     return NULL;
   }
 
+  // nodes live in the same buffer blocks as the rows and are freed in bulk with the memtable
+  tSkipListSetNodeAllocator(pTableData->pData, tsdbAllocSkipListNode, pRepo);
+
   T_REF_INC(pTableData);
 
   return pTableData;
@@ -603,6 +798,14 @@ static void tsdbFreeTableData(STableData *pTableData) {
 
 static char *tsdbGetTsTupleKey(const void *data) { return memRowKeys((SMemRow)data); }
 
+static void *tsdbAllocSkipListNode(void *param, int32_t bytes) {
+  // rows of arbitrary length are packed in the buffer block, so align the node for its pointer arrays
+  char *ptr = tsdbAllocBytes((STsdbRepo *)param, bytes + POINTER_BYTES - 1);
+  if (ptr == NULL) return NULL;
+
+  return (void *)ALIGN_NUM((uintptr_t)ptr, POINTER_BYTES);
+}
+
 static int tsdbAdjustMemMaxTables(SMemTable *pMemTable, int maxTables) {
   ASSERT(pMemTable->maxTables < maxTables);
 
@@ -678,6 +881,106 @@ static FORCE_INLINE int tsdbCheckRowRange(STsdbRepo *pRepo, STable *pTable, SMem
   return 0;
 }
 
+// locate the columns of a columnar block, return the number of columns or -1 if the block is messed up
+static int tsdbGetSubmitColumns(SSubmitBlk *pBlock, SSubmitColumn **cols, int ncols) {
+  char *  ptr = pBlock->data + pBlock->schemaLen;
+  int32_t left = pBlock->dataLen;
+  int     n = 0;
+
+  while (left > 0) {
+    SSubmitColumn *pSCol = (SSubmitColumn *)ptr;
+    if (n >= ncols || left < (int32_t)sizeof(SSubmitColumn) || pSCol->len < 0 ||
+        pSCol->len > left - (int32_t)sizeof(SSubmitColumn)) {
+      return -1;
+    }
+
+    cols[n++] = pSCol;
+    ptr += sizeof(SSubmitColumn) + pSCol->len;
+    left -= (int32_t)sizeof(SSubmitColumn) + pSCol->len;
+  }
+
+  return n;
+}
+
+// value of row idx in a column of a columnar block, NULL if it is null
+static FORCE_INLINE void *tsdbSubmitColumnVal(SSubmitColumn *pSCol, int32_t rows, int32_t idx, int16_t bytes) {
+  if (SUBMIT_COL_IS_NULL(pSCol->data, idx)) return NULL;
+
+  char *pVal = pSCol->data + SUBMIT_COL_BITMAP_LEN(rows);
+  if (IS_VAR_DATA_TYPE(pSCol->type)) {
+    return POINTER_SHIFT(pVal, sizeof(VarDataOffsetT) * rows + ((VarDataOffsetT *)pVal)[idx]);
+  }
+
+  return POINTER_SHIFT(pVal, bytes * idx);
+}
+
+static int tsdbCheckColumnarBlock(STsdbRepo *pRepo, STable *pTable, SSubmitBlk *pBlock, TSKEY minKey, TSKEY maxKey,
+                                  TSKEY now) {
+  STSchema *pSchema = tsdbGetTableSchemaImpl(pTable, false, false, pBlock->sversion, -1);
+  if (pSchema == NULL) return -1;
+
+  int32_t         rows = pBlock->numOfRows;
+  int32_t         bmLen = SUBMIT_COL_BITMAP_LEN(rows);
+  int             ncols = schemaNCols(pSchema);
+  SSubmitColumn **cols = malloc(sizeof(SSubmitColumn *) * ncols);
+  if (cols == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  if (rows <= 0 || tsdbGetSubmitColumns(pBlock, cols, ncols) != ncols) goto _err;
+
+  for (int i = 0; i < ncols; i++) {
+    STColumn *     pCol = schemaColAt(pSchema, i);
+    SSubmitColumn *pSCol = cols[i];
+    if (pSCol->colId != colColId(pCol) || pSCol->type != colType(pCol)) goto _err;
+
+    if (!IS_VAR_DATA_TYPE(colType(pCol))) {
+      if (pSCol->len < bmLen + (int64_t)colBytes(pCol) * rows) goto _err;
+      continue;
+    }
+
+    int64_t varLen = (int64_t)pSCol->len - bmLen - (int64_t)sizeof(VarDataOffsetT) * rows;
+    if (varLen < 0) goto _err;
+
+    VarDataOffsetT *offsets = (VarDataOffsetT *)(pSCol->data + bmLen);
+    for (int32_t j = 0; j < rows; j++) {
+      if (SUBMIT_COL_IS_NULL(pSCol->data, j)) continue;
+
+      void *value = tsdbSubmitColumnVal(pSCol, rows, j, colBytes(pCol));
+      if (offsets[j] < 0 || offsets[j] + VARSTR_HEADER_SIZE > varLen || offsets[j] + varDataTLen(value) > varLen ||
+          varDataTLen(value) > colBytes(pCol)) {
+        goto _err;
+      }
+    }
+  }
+
+  for (int32_t j = 0; j < rows; j++) {
+    TSKEY *pKey = tsdbSubmitColumnVal(cols[0], rows, j, TYPE_BYTES[TSDB_DATA_TYPE_TIMESTAMP]);
+    if (pKey == NULL) goto _err;
+
+    if (*pKey < minKey || *pKey > maxKey) {
+      tsdbError("vgId:%d table %s tid %d uid %" PRIu64 " timestamp is out of range! now %" PRId64 " minKey %" PRId64
+                " maxKey %" PRId64 " row key %" PRId64,
+                REPO_ID(pRepo), TABLE_CHAR_NAME(pTable), TABLE_TID(pTable), TABLE_UID(pTable), now, minKey, maxKey,
+                *pKey);
+      terrno = TSDB_CODE_TDB_TIMESTAMP_OUT_OF_RANGE;
+      free(cols);
+      return -1;
+    }
+  }
+
+  free(cols);
+  return 0;
+
+_err:
+  tsdbError("vgId:%d columnar block of table %s tid %d uid %" PRIu64 " is messed up", REPO_ID(pRepo),
+            TABLE_CHAR_NAME(pTable), TABLE_TID(pTable), TABLE_UID(pTable));
+  terrno = TSDB_CODE_TDB_SUBMIT_MSG_MSSED_UP;
+  free(cols);
+  return -1;
+}
+
 static int tsdbScanAndConvertSubmitMsg(STsdbRepo *pRepo, SSubmitMsg *pMsg) {
   ASSERT(pMsg != NULL);
   STsdbMeta *    pMeta = pRepo->tsdbMeta;
@@ -740,7 +1043,11 @@ static int tsdbScanAndConvertSubmitMsg(STsdbRepo *pRepo, SSubmitMsg *pMsg) {
     }
 
     // check each row time invalid if not control block
-    if (!IS_CONTROL_BLOCK(pBlock)) {
+    if (IS_COLUMNAR_BLOCK(pBlock)) {
+      if (tsdbCheckColumnarBlock(pRepo, pTable, pBlock, minKey, maxKey, now) < 0) {
+        return -1;
+      }
+    } else if (!IS_CONTROL_BLOCK(pBlock)) {
       tsdbInitSubmitBlkIter(pBlock, &blkIter);
       while ((row = tsdbGetSubmitBlkNext(&blkIter)) != NULL) {
         if (tsdbCheckRowRange(pRepo, pTable, row, minKey, maxKey, now) < 0) {
@@ -830,6 +1137,40 @@ static void tsdbSetupSkipListHookFns(SSkipList* pSkipList, STsdbRepo *pRepo, STa
   pSkipList->insertHandleFn->args[7] = pLastRow;
 }
 
+static STableData *tsdbGetTableDataToInsert(STsdbRepo *pRepo, STable *pTable) {
+  STsdbMeta * pMeta = pRepo->tsdbMeta;
+  SMemTable * pMemTable = pRepo->mem;
+  STableData *pTableData = NULL;
+
+  if (TABLE_TID(pTable) >= pMemTable->maxTables) {
+    if (tsdbAdjustMemMaxTables(pMemTable, pMeta->maxTables) < 0) {
+      return NULL;
+    }
+  }
+  pTableData = pMemTable->tData[TABLE_TID(pTable)];
+
+  if (pTableData == NULL || pTableData->uid != TABLE_UID(pTable)) {
+    if (pTableData != NULL) {
+      taosWLockLatch(&(pMemTable->latch));
+      pMemTable->tData[TABLE_TID(pTable)] = NULL;
+      tsdbFreeTableData(pTableData);
+      taosWUnLockLatch(&(pMemTable->latch));
+    }
+
+    pTableData = tsdbNewTableData(pRepo, pTable);
+    if (pTableData == NULL) {
+      tsdbError("vgId:%d failed to insert data to table %s uid %" PRId64 " tid %d since %s", REPO_ID(pRepo),
+                TABLE_CHAR_NAME(pTable), TABLE_UID(pTable), TABLE_TID(pTable), tstrerror(terrno));
+      return NULL;
+    }
+
+    pMemTable->tData[TABLE_TID(pTable)] = pTableData;
+  }
+
+  ASSERT((pTableData != NULL) && pTableData->uid == TABLE_UID(pTable));
+  return pTableData;
+}
+
 static int tsdbInsertDataToTable(STsdbRepo* pRepo, SSubmitBlk* pBlock, int32_t *pAffectedRows) {
 
   STsdbMeta       *pMeta = pRepo->tsdbMeta;
@@ -838,7 +1179,10 @@ static int tsdbInsertDataToTable(STsdbRepo* pRepo, SSubmitBlk* pBlock, int32_t *
   SSubmitBlkIter   blkIter = {0};
   SMemTable       *pMemTable = NULL;
   STableData      *pTableData = NULL;
-  STsdbCfg        *pCfg = &(pRepo->config);
+
+  if (IS_COLUMNAR_BLOCK(pBlock)) {
+    return tsdbInsertColumnarDataToTable(pRepo, pBlock, pAffectedRows);
+  }
 
   tsdbInitSubmitBlkIter(pBlock, &blkIter);
   if(blkIter.row == NULL) return 0;
@@ -854,39 +1198,23 @@ static int tsdbInsertDataToTable(STsdbRepo* pRepo, SSubmitBlk* pBlock, int32_t *
 
   ASSERT(pTable != NULL && TABLE_UID(pTable) == pBlock->uid);
 
+  pTableData = tsdbGetTableDataToInsert(pRepo, pTable);
+  if (pTableData == NULL) return -1;
 
-  if (TABLE_TID(pTable) >= pMemTable->maxTables) {
-    if (tsdbAdjustMemMaxTables(pMemTable, pMeta->maxTables) < 0) {
-      return -1;
-    }
-  }
-  pTableData = pMemTable->tData[TABLE_TID(pTable)];
-
-  if (pTableData == NULL || pTableData->uid != TABLE_UID(pTable)) {
-    if (pTableData != NULL) {
-      taosWLockLatch(&(pMemTable->latch));
-      pMemTable->tData[TABLE_TID(pTable)] = NULL;
-      tsdbFreeTableData(pTableData);
-      taosWUnLockLatch(&(pMemTable->latch));
-    }
-
-    pTableData = tsdbNewTableData(pCfg, pTable);
-    if (pTableData == NULL) {
+  SMemRow lastRow = NULL;
+  int64_t osize = SL_SIZE(pTableData->pData);
+  int64_t nAppended = 0;
+  tsdbSetupSkipListHookFns(pTableData->pData, pRepo, pTable, &points, &lastRow);
+  if (pTableData->columnar) {
+    if (tsdbInsertRowsToChunks(pRepo, pTable, pTableData, &blkIter, &points, &lastRow, &nAppended) < 0) {
       tsdbError("vgId:%d failed to insert data to table %s uid %" PRId64 " tid %d since %s", REPO_ID(pRepo),
                 TABLE_CHAR_NAME(pTable), TABLE_UID(pTable), TABLE_TID(pTable), tstrerror(terrno));
       return -1;
     }
-
-    pRepo->mem->tData[TABLE_TID(pTable)] = pTableData;
+  } else {
+    tSkipListPutBatchByIter(pTableData->pData, &blkIter, (iter_next_fn_t)tsdbGetSubmitBlkNext);
   }
-
-  ASSERT((pTableData != NULL) && pTableData->uid == TABLE_UID(pTable));
-
-  SMemRow lastRow = NULL;
-  int64_t osize = SL_SIZE(pTableData->pData);
-  tsdbSetupSkipListHookFns(pTableData->pData, pRepo, pTable, &points, &lastRow);
-  tSkipListPutBatchByIter(pTableData->pData, &blkIter, (iter_next_fn_t)tsdbGetSubmitBlkNext);
-  int64_t dsize = SL_SIZE(pTableData->pData) - osize;
+  int64_t dsize = SL_SIZE(pTableData->pData) - osize + nAppended;
   (*pAffectedRows) += points;
 
   if(lastRow != NULL) {
@@ -910,6 +1238,424 @@ static int tsdbInsertDataToTable(STsdbRepo* pRepo, SSubmitBlk* pBlock, int32_t *
   return 0;
 }
 
+static SMemColChunk *tsdbNewMemColChunk(STsdbRepo *pRepo, STSchema *pSchema, SMemColChunk *pPrev) {
+  int ncols = schemaNCols(pSchema);
+  int rowSize = 0;
+  for (int i = 0; i < ncols; i++) {
+    STColumn *pCol = schemaColAt(pSchema, i);
+    rowSize += colBytes(pCol) + (IS_VAR_DATA_TYPE(colType(pCol)) ? sizeof(VarDataOffsetT) : 0);
+  }
+
+  // chunks of a table grow from small to large, so that tables with few rows do not hold big chunks
+  int maxRows = (pPrev == NULL) ? TSDB_MEM_CHUNK_MIN_ROWS : MIN(pPrev->data.maxPoints * 2, TSDB_MEM_CHUNK_MAX_ROWS);
+  maxRows = MAX(MIN(maxRows, TSDB_MEM_CHUNK_MAX_SIZE / rowSize), 1);
+
+  int size = ALIGN8(sizeof(SMemColChunk)) + ALIGN8(sizeof(SDataCol) * ncols);
+  for (int i = 0; i < ncols; i++) {
+    STColumn *pCol = schemaColAt(pSchema, i);
+    size += ALIGN8(colBytes(pCol) * maxRows);
+    if (IS_VAR_DATA_TYPE(colType(pCol))) size += ALIGN8(sizeof(VarDataOffsetT) * maxRows);
+  }
+
+  char *ptr = tsdbAllocBytes(pRepo, size + 7);
+  if (ptr == NULL) return NULL;
+
+  SMemColChunk *pChunk = (SMemColChunk *)ALIGN8((uintptr_t)ptr);
+  pChunk->next = NULL;
+  pChunk->prev = pPrev;
+  pChunk->pSchema = pSchema;
+
+  SDataCols *pData = &(pChunk->data);
+  pData->maxCols = ncols;
+  pData->maxPoints = maxRows;
+  pData->numOfRows = 0;
+  pData->numOfCols = ncols;
+  pData->sversion = schemaVersion(pSchema);
+  pData->cols = (SDataCol *)POINTER_SHIFT(pChunk, ALIGN8(sizeof(SMemColChunk)));
+
+  char *pBuf = POINTER_SHIFT(pData->cols, ALIGN8(sizeof(SDataCol) * ncols));
+  for (int i = 0; i < ncols; i++) {
+    SDataCol *pCol = pData->cols + i;
+    dataColInit(pCol, schemaColAt(pSchema, i), maxRows);
+    pCol->ts = 0;
+    pCol->pData = pBuf;
+    pCol->spaceSize = pCol->bytes * maxRows;
+    pBuf += ALIGN8(pCol->bytes * maxRows);
+    if (IS_VAR_DATA_TYPE(pCol->type)) {
+      pCol->dataOff = (VarDataOffsetT *)pBuf;
+      pCol->spaceSize += sizeof(VarDataOffsetT) * maxRows;
+      pBuf += ALIGN8(sizeof(VarDataOffsetT) * maxRows);
+    } else {
+      pCol->dataOff = NULL;
+    }
+  }
+
+  return pChunk;
+}
+
+static int tsdbAppendMemChunkRow(STsdbRepo *pRepo, STable *pTable, STableData *pTableData, SMemRow row) {
+  SMemColChunk *pChunk = pTableData->pChunkTail;
+
+  if (pChunk == NULL || pChunk->data.numOfRows >= pChunk->data.maxPoints ||
+      pChunk->data.sversion != memRowVersion(row)) {
+    STSchema *pSchema = tsdbGetTableSchemaImpl(pTable, false, false, memRowVersion(row), (int8_t)memRowType(row));
+    if (pSchema == NULL) return -1;
+
+    if (pChunk == NULL || pChunk->data.numOfRows >= pChunk->data.maxPoints || pChunk->pSchema != pSchema) {
+      pChunk = tsdbNewMemColChunk(pRepo, pSchema, pChunk);
+      if (pChunk == NULL) return -1;
+    }
+  }
+
+  SDataCols *pData = &(pChunk->data);
+  int32_t    kvIdx = 0;
+  for (int i = 0; i < pData->numOfCols; i++) {
+    SDataCol *pCol = pData->cols + i;
+    void *    value = tdGetMemRowDataOfColEx(row, pCol->colId, pCol->type, pCol->offset, &kvIdx);
+    if (value == NULL) value = (void *)getNullValue(pCol->type);
+
+    if (IS_VAR_DATA_TYPE(pCol->type)) {
+      pCol->dataOff[pData->numOfRows] = pCol->len;
+      memcpy(POINTER_SHIFT(pCol->pData, pCol->len), value, varDataTLen(value));
+      pCol->len += varDataTLen(value);
+    } else {
+      memcpy(POINTER_SHIFT(pCol->pData, pCol->len), value, pCol->bytes);
+      pCol->len += pCol->bytes;
+    }
+  }
+
+  // make the row visible only after all its values are in place
+  atomic_store_32(&(pData->numOfRows), pData->numOfRows + 1);
+  if (pChunk != pTableData->pChunkTail) {
+    if (pChunk->prev != NULL) atomic_store_ptr(&(pChunk->prev->next), pChunk);
+    atomic_store_ptr(&(pTableData->pChunkTail), pChunk);
+  }
+
+  return 0;
+}
+
+static int tsdbInsertRowsToChunks(STsdbRepo *pRepo, STable *pTable, STableData *pTableData, SSubmitBlkIter *pIter,
+                                  int32_t *pPoints, SMemRow *pLastRow, int64_t *pAppended) {
+  SMemRow row = NULL;
+
+  while ((row = tsdbGetSubmitBlkNext(pIter)) != NULL) {
+    TKEY          tkey = memRowTKey(row);
+    TSKEY         key = tdGetKey(tkey);
+    SMemColChunk *pTail = pTableData->pChunkTail;
+
+    if (!TKEY_IS_DELETED(tkey) && (pTail == NULL || key > dataColsKeyLast(&(pTail->data)))) {
+      if (tsdbAppendMemChunkRow(pRepo, pTable, pTableData, row) < 0) return -1;
+      (*pPoints)++;
+      (*pAppended)++;
+      *pLastRow = row;
+      continue;
+    }
+
+    if (pRepo->config.update == TD_ROW_DISCARD_UPDATE) {
+      SMemColChunk *pChunk = NULL;
+      int32_t       pos = 0;
+      if (tsdbSeekMemChunk(pTail, key, TSDB_ORDER_ASC, &pChunk, &pos) && dataColsKeyAt(&(pChunk->data), pos) == key) {
+        // for compatiblity, duplicate key inserted when update=0 should be also calculated as affected rows!
+        (*pPoints)++;
+        continue;
+      }
+    }
+
+    // out-of-order rows and rows overwriting a chunk row go to the skip list, which shadows the chunks on reading
+    tSkipListPut(pTableData->pData, row);
+  }
+
+  return 0;
+}
+
+/**
+ * Insert a column-major block. If the table is kept in column chunks and the keys of the block are ascending and after
+ * the last chunk row, the columns are copied into the chunks as they are; otherwise the block is turned into rows.
+ */
+static int tsdbInsertColumnarDataToTable(STsdbRepo *pRepo, SSubmitBlk *pBlock, int32_t *pAffectedRows) {
+  STable *  pTable = pRepo->tsdbMeta->tables[pBlock->tid];
+  STSchema *pSchema = tsdbGetTableSchemaImpl(pTable, false, false, pBlock->sversion, -1);
+  int32_t   rows = pBlock->numOfRows;
+  int       ncols = schemaNCols(pSchema);
+  int       code = -1;
+
+  ASSERT(pTable != NULL && TABLE_UID(pTable) == pBlock->uid);
+
+  SSubmitColumn **cols = malloc(sizeof(SSubmitColumn *) * ncols);
+  if (cols == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return -1;
+  }
+  tsdbGetSubmitColumns(pBlock, cols, ncols);
+
+  tsdbAllocBytes(pRepo, 0);
+  SMemTable * pMemTable = pRepo->mem;
+  STableData *pTableData = tsdbGetTableDataToInsert(pRepo, pTable);
+  if (pTableData == NULL) goto _exit;
+
+  TSKEY *       keys = (TSKEY *)(cols[0]->data + SUBMIT_COL_BITMAP_LEN(rows));
+  SMemColChunk *pTail = pTableData->pChunkTail;
+  bool          append = pTableData->columnar && (pTail == NULL || keys[0] > dataColsKeyLast(&(pTail->data)));
+  for (int32_t j = 1; append && j < rows; j++) {
+    if (keys[j] <= keys[j - 1]) append = false;
+  }
+
+  if (!append) {
+    SSubmitBlk *pRowBlock = tsdbColumnarBlockToRows(pBlock, pSchema, cols);
+    if (pRowBlock != NULL) {
+      code = tsdbInsertDataToTable(pRepo, pRowBlock, pAffectedRows);
+      free(pRowBlock);
+    }
+    goto _exit;
+  }
+
+  if (tsdbAppendMemChunkCols(pRepo, pTableData, pSchema, cols, rows) < 0) {
+    tsdbError("vgId:%d failed to insert data to table %s uid %" PRId64 " tid %d since %s", REPO_ID(pRepo),
+              TABLE_CHAR_NAME(pTable), TABLE_UID(pTable), TABLE_TID(pTable), tstrerror(terrno));
+    goto _exit;
+  }
+
+  if (pMemTable->keyFirst > keys[0]) pMemTable->keyFirst = keys[0];
+  if (pMemTable->keyLast < keys[rows - 1]) pMemTable->keyLast = keys[rows - 1];
+  pMemTable->numOfRows += rows;
+
+  if (pTableData->keyFirst > keys[0]) pTableData->keyFirst = keys[0];
+  if (pTableData->keyLast < keys[rows - 1]) pTableData->keyLast = keys[rows - 1];
+  pTableData->numOfRows += rows;
+
+  SMemRow lastRow = malloc(memRowMaxBytesFromSchema(pSchema));
+  if (lastRow == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    goto _exit;
+  }
+  tsdbColumnarRowToMemRow(pSchema, cols, rows, rows - 1, lastRow);
+  code = tsdbUpdateTableLatestInfo(pRepo, pTable, lastRow);
+  free(lastRow);
+  if (code < 0) goto _exit;
+
+  (*pAffectedRows) += rows;
+  pRepo->stat.pointsWritten += rows * schemaNCols(pSchema);
+  pRepo->stat.totalStorage += rows * schemaVLen(pSchema);
+
+_exit:
+  free(cols);
+  return code;
+}
+
+// append the rows of a columnar block to the column chunks, a whole run of values is copied for fixed length columns
+static int tsdbAppendMemChunkCols(STsdbRepo *pRepo, STableData *pTableData, STSchema *pSchema, SSubmitColumn **cols,
+                                  int32_t rows) {
+  int32_t bmLen = SUBMIT_COL_BITMAP_LEN(rows);
+  int32_t start = 0;
+
+  while (start < rows) {
+    SMemColChunk *pChunk = pTableData->pChunkTail;
+    if (pChunk == NULL || pChunk->data.numOfRows >= pChunk->data.maxPoints || pChunk->pSchema != pSchema) {
+      pChunk = tsdbNewMemColChunk(pRepo, pSchema, pChunk);
+      if (pChunk == NULL) return -1;
+    }
+
+    SDataCols *pData = &(pChunk->data);
+    int32_t    n = MIN(rows - start, pData->maxPoints - pData->numOfRows);
+    for (int i = 0; i < pData->numOfCols; i++) {
+      SDataCol *pCol = pData->cols + i;
+      char *    pBitmap = cols[i]->data;
+      char *    pVal = cols[i]->data + bmLen;
+
+      if (IS_VAR_DATA_TYPE(pCol->type)) {
+        for (int32_t j = 0; j < n; j++) {
+          void *value = tsdbSubmitColumnVal(cols[i], rows, start + j, pCol->bytes);
+          if (value == NULL) value = (void *)getNullValue(pCol->type);
+
+          pCol->dataOff[pData->numOfRows + j] = pCol->len;
+          memcpy(POINTER_SHIFT(pCol->pData, pCol->len), value, varDataTLen(value));
+          pCol->len += varDataTLen(value);
+        }
+      } else if (i == 0) {
+        // the primary key is kept as TKEY in the chunks
+        TKEY *pKey = POINTER_SHIFT(pCol->pData, pCol->len);
+        for (int32_t j = 0; j < n; j++) {
+          pKey[j] = tdGetTKEY(((TSKEY *)pVal)[start + j]);
+        }
+        pCol->len += n * pCol->bytes;
+      } else {
+        memcpy(POINTER_SHIFT(pCol->pData, pCol->len), POINTER_SHIFT(pVal, start * pCol->bytes), n * pCol->bytes);
+        for (int32_t j = 0; j < n; j++) {
+          if (SUBMIT_COL_IS_NULL(pBitmap, start + j)) {
+            setNull(POINTER_SHIFT(pCol->pData, pCol->len + j * pCol->bytes), pCol->type, pCol->bytes);
+          }
+        }
+        pCol->len += n * pCol->bytes;
+      }
+    }
+
+    // make the rows visible only after all their values are in place
+    atomic_store_32(&(pData->numOfRows), pData->numOfRows + n);
+    if (pChunk != pTableData->pChunkTail) {
+      if (pChunk->prev != NULL) atomic_store_ptr(&(pChunk->prev->next), pChunk);
+      atomic_store_ptr(&(pTableData->pChunkTail), pChunk);
+    }
+
+    start += n;
+  }
+
+  return 0;
+}
+
+static void tsdbColumnarRowToMemRow(STSchema *pSchema, SSubmitColumn **cols, int32_t rows, int32_t idx, SMemRow row) {
+  memRowSetType(row, SMEM_ROW_DATA);
+  SDataRow dataRow = memRowDataBody(row);
+  tdInitDataRow(dataRow, pSchema);
+
+  for (int i = 0; i < schemaNCols(pSchema); i++) {
+    STColumn *pCol = schemaColAt(pSchema, i);
+    void *    value = tsdbSubmitColumnVal(cols[i], rows, idx, colBytes(pCol));
+    if (value == NULL) value = (void *)getNullValue(colType(pCol));
+
+    tdAppendColVal(dataRow, value, colType(pCol), colOffset(pCol));
+  }
+}
+
+// turn a columnar block into a row-major one, for the rows that can not be appended to the column chunks
+static SSubmitBlk *tsdbColumnarBlockToRows(SSubmitBlk *pBlock, STSchema *pSchema, SSubmitColumn **cols) {
+  int32_t rows = pBlock->numOfRows;
+  int64_t size = sizeof(SSubmitBlk) + (int64_t)rows * (TD_MEM_ROW_DATA_HEAD_SIZE + schemaFLen(pSchema));
+  for (int i = 0; i < schemaNCols(pSchema); i++) {
+    if (IS_VAR_DATA_TYPE(colType(schemaColAt(pSchema, i)))) {
+      size += cols[i]->len + (int64_t)rows * (VARSTR_HEADER_SIZE + TSDB_NCHAR_SIZE);  // null values included
+    }
+  }
+
+  SSubmitBlk *pRowBlock = malloc(size);
+  if (pRowBlock == NULL) {
+    terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  *pRowBlock = *pBlock;
+  pRowBlock->flag &= ~FLAG_BLK_COLUMNAR;
+  pRowBlock->schemaLen = 0;
+
+  SMemRow row = pRowBlock->data;
+  for (int32_t j = 0; j < rows; j++) {
+    tsdbColumnarRowToMemRow(pSchema, cols, rows, j, row);
+    row = POINTER_SHIFT(row, memRowTLen(row));
+  }
+  pRowBlock->dataLen = (int32_t)((char *)row - pRowBlock->data);
+
+  return pRowBlock;
+}
+
+// first row with key >= key (ASC) or last row with key <= key (DESC) in the chunks linked back from pTail
+static bool tsdbSeekMemChunk(SMemColChunk *pTail, TSKEY key, int32_t order, SMemColChunk **ppChunk,
+                             int32_t *pPos) {
+  SMemColChunk *pChunk = pTail;
+  if (pChunk == NULL) return false;
+
+  while (pChunk->prev != NULL && dataColsKeyAt(&(pChunk->data), 0) > key) {
+    pChunk = pChunk->prev;
+  }
+
+  SDataCols *pData = &(pChunk->data);
+  int32_t    lo = 0;
+  int32_t    hi = atomic_load_32(&(pData->numOfRows));
+  int32_t    nRows = hi;
+  while (lo < hi) {
+    int32_t mid = lo + (hi - lo) / 2;
+    TSKEY   midKey = dataColsKeyAt(pData, mid);
+    if (midKey < key || (order == TSDB_ORDER_DESC && midKey == key)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  if (order == TSDB_ORDER_ASC) {
+    if (lo < nRows) {
+      *ppChunk = pChunk;
+      *pPos = lo;
+    } else {
+      *ppChunk = atomic_load_ptr(&(pChunk->next));
+      *pPos = 0;
+    }
+  } else {
+    *ppChunk = (lo > 0) ? pChunk : NULL;
+    *pPos = lo - 1;
+  }
+
+  return *ppChunk != NULL;
+}
+
+static void tsdbMemIterMoveChunk(SMemIter *pIter) {
+  if (pIter->order == TSDB_ORDER_ASC) {
+    if (++pIter->pos < atomic_load_32(&(pIter->pChunk->data.numOfRows))) return;
+    pIter->pChunk = atomic_load_ptr(&(pIter->pChunk->next));
+    pIter->pos = 0;
+  } else {
+    if (--pIter->pos >= 0) return;
+    pIter->pChunk = pIter->pChunk->prev;
+    pIter->pos = (pIter->pChunk == NULL) ? 0 : atomic_load_32(&(pIter->pChunk->data.numOfRows)) - 1;
+  }
+}
+
+// decide whether the current row comes from the chunk or the skip list, return false if both are exhausted
+static bool tsdbMemIterSettle(SMemIter *pIter) {
+  SSkipListNode *node = tSkipListIterGet(&(pIter->slIter));
+
+  if (pIter->pChunk == NULL) {
+    pIter->fromChunk = false;
+    return node != NULL;
+  }
+
+  if (node == NULL) {
+    pIter->fromChunk = true;
+    return true;
+  }
+
+  TSKEY ckey = dataColsKeyAt(&(pIter->pChunk->data), pIter->pos);
+  TSKEY skey = memRowKey((SMemRow)SL_GET_NODE_DATA(node));
+  pIter->fromChunk = (pIter->order == TSDB_ORDER_ASC) ? (ckey < skey) : (ckey > skey);
+  return true;
+}
+
+// build the current chunk row in the row buffer for the callers that consume SMemRow
+static SMemRow tsdbMemIterChunkRow(SMemIter *pIter) {
+  SMemRowBuf *  pBuf = pIter->pRowBuf;
+  SMemColChunk *pChunk = pIter->pChunk;
+  STSchema *    pSchema = pChunk->pSchema;
+
+  if (pBuf->pChunk == pChunk && pBuf->pos == pIter->pos) return pBuf->row;
+
+  int32_t size = memRowMaxBytesFromSchema(pSchema);
+  if (pBuf->size < size) {
+    void *ptr = realloc(pBuf->row, size);
+    if (ptr == NULL) {
+      terrno = TSDB_CODE_TDB_OUT_OF_MEMORY;
+      return NULL;
+    }
+    pBuf->row = ptr;
+    pBuf->size = size;
+  }
+
+  SDataRow dataRow = memRowDataBody(pBuf->row);
+  memRowSetType(pBuf->row, SMEM_ROW_DATA);
+  tdInitDataRow(dataRow, pSchema);
+  for (int i = 0; i < pChunk->data.numOfCols; i++) {
+    SDataCol *pCol = pChunk->data.cols + i;
+    void *    value = IS_VAR_DATA_TYPE(pCol->type) ? POINTER_SHIFT(pCol->pData, pCol->dataOff[pIter->pos])
+                                                   : POINTER_SHIFT(pCol->pData, pCol->bytes * pIter->pos);
+    if (i == 0) {
+      TSKEY key = tdGetKey(*(TKEY *)value);
+      tdAppendColVal(dataRow, &key, pCol->type, 0);
+    } else {
+      tdAppendColVal(dataRow, value, pCol->type, pCol->offset - TD_DATA_ROW_HEAD_SIZE);
+    }
+  }
+
+  pBuf->pChunk = pChunk;
+  pBuf->pos = pIter->pos;
+  return pBuf->row;
+}
 
 static int tsdbInitSubmitMsgIter(SSubmitMsg *pMsg, SSubmitMsgIter *pIter) {
   if (pMsg == NULL) {
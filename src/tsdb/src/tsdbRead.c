@@ -95,8 +95,8 @@ typedef struct STableCheckInfo {
   int32_t       numOfBlocks:29; // number of qualified data blocks not the original blocks
   uint8_t        chosen:2;       // indicate which iterator should move forward
   bool          initBuf;        // whether to initialize the in-memory skip list iterator or not
-  SSkipListIterator* iter;      // mem buffer skip list iterator
-  SSkipListIterator* iiter;     // imem buffer skip list iterator
+  SMemIter*     iter;           // mem buffer iterator
+  SMemIter*     iiter;          // imem buffer iterator
 } STableCheckInfo;
 
 typedef struct STableBlockInfo {
@@ -129,6 +129,8 @@ typedef struct STsdbQueryHandle {
   STimeWindow    window;           // the primary query time window that applies to all queries
   SDataStatis*   statis;           // query level statistics, only one table block statistics info exists at any time
   int32_t        numOfBlocks;
+  int32_t        readAheadSlot;    // the last block of the current file that the read ahead is issued for
+  int32_t        bloomSlot;        // the block whose bloom filters are loaded in rhelper
   SArray*        pColumns;         // column list, SColumnInfoData array list
   bool           locateStart;
   int32_t        outputCapacity;
@@ -353,8 +355,8 @@ static void resetCheckInfo(STsdbQueryHandle* pQueryHandle) {
   for (int32_t i = 0; i < numOfTables; ++i) {
     STableCheckInfo* pCheckInfo = (STableCheckInfo*) taosArrayGet(pQueryHandle->pTableCheckInfo, i);
     pCheckInfo->lastKey = pQueryHandle->window.skey;
-    pCheckInfo->iter    = tSkipListDestroyIter(pCheckInfo->iter);
-    pCheckInfo->iiter   = tSkipListDestroyIter(pCheckInfo->iiter);
+    pCheckInfo->iter    = tsdbDestroyMemIter(pCheckInfo->iter);
+    pCheckInfo->iiter   = tsdbDestroyMemIter(pCheckInfo->iiter);
     pCheckInfo->initBuf = false;
 
     if (ASCENDING_TRAVERSE(pQueryHandle->order)) {
@@ -792,18 +794,14 @@ static bool initTableMemIterator(STsdbQueryHandle* pHandle, STableCheckInfo* pCh
   if (pMemT && pCheckInfo->tableId.tid < pMemT->maxTables) {
     pMem = pMemT->tData[pCheckInfo->tableId.tid];
     if (pMem != NULL && pMem->uid == pCheckInfo->tableId.uid) { // check uid
-      TKEY tLastKey = keyToTkey(pCheckInfo->lastKey);
-      pCheckInfo->iter =
-          tSkipListCreateIterFromVal(pMem->pData, (const char*)&tLastKey, TSDB_DATA_TYPE_TIMESTAMP, order);
+      pCheckInfo->iter = tsdbCreateMemIter(pCheckInfo->pTableObj, pMem, &pCheckInfo->lastKey, order);
     }
   }
 
   if (pIMemT && pCheckInfo->tableId.tid < pIMemT->maxTables) {
     pIMem = pIMemT->tData[pCheckInfo->tableId.tid];
     if (pIMem != NULL && pIMem->uid == pCheckInfo->tableId.uid) { // check uid
-      TKEY tLastKey = keyToTkey(pCheckInfo->lastKey);
-      pCheckInfo->iiter =
-          tSkipListCreateIterFromVal(pIMem->pData, (const char*)&tLastKey, TSDB_DATA_TYPE_TIMESTAMP, order);
+      pCheckInfo->iiter = tsdbCreateMemIter(pCheckInfo->pTableObj, pIMem, &pCheckInfo->lastKey, order);
     }
   }
 
@@ -812,18 +810,16 @@ static bool initTableMemIterator(STsdbQueryHandle* pHandle, STableCheckInfo* pCh
     return false;
   }
 
-  bool memEmpty  = (pCheckInfo->iter == NULL) || (pCheckInfo->iter != NULL && !tSkipListIterNext(pCheckInfo->iter));
-  bool imemEmpty = (pCheckInfo->iiter == NULL) || (pCheckInfo->iiter != NULL && !tSkipListIterNext(pCheckInfo->iiter));
+  bool memEmpty  = (pCheckInfo->iter == NULL) || (pCheckInfo->iter != NULL && !tsdbMemIterNext(pCheckInfo->iter));
+  bool imemEmpty = (pCheckInfo->iiter == NULL) || (pCheckInfo->iiter != NULL && !tsdbMemIterNext(pCheckInfo->iiter));
   if (memEmpty && imemEmpty) { // buffer is empty
     return false;
   }
 
   if (!memEmpty) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iter);
-    assert(node != NULL);
+    TSKEY key = tsdbNextIterKey(pCheckInfo->iter);  // first timestamp in buffer
+    assert(key != TSDB_DATA_TIMESTAMP_NULL);
 
-    SMemRow row = (SMemRow)SL_GET_NODE_DATA(node);
-    TSKEY   key = memRowKey(row);  // first timestamp in buffer
     tsdbDebug("%p uid:%" PRId64 ", tid:%d check data in mem from skey:%" PRId64 ", order:%d, ts range in buf:%" PRId64
               "-%" PRId64 ", lastKey:%" PRId64 ", numOfRows:%"PRId64", 0x%"PRIx64,
               pHandle, pCheckInfo->tableId.uid, pCheckInfo->tableId.tid, key, order, pMem->keyFirst, pMem->keyLast,
@@ -841,11 +837,9 @@ static bool initTableMemIterator(STsdbQueryHandle* pHandle, STableCheckInfo* pCh
   }
 
   if (!imemEmpty) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iiter);
-    assert(node != NULL);
+    TSKEY key = tsdbNextIterKey(pCheckInfo->iiter);  // first timestamp in buffer
+    assert(key != TSDB_DATA_TIMESTAMP_NULL);
 
-    SMemRow row = (SMemRow)SL_GET_NODE_DATA(node);
-    TSKEY   key = memRowKey(row);  // first timestamp in buffer
     tsdbDebug("%p uid:%" PRId64 ", tid:%d check data in imem from skey:%" PRId64 ", order:%d, ts range in buf:%" PRId64
               "-%" PRId64 ", lastKey:%" PRId64 ", numOfRows:%"PRId64", 0x%"PRIx64,
               pHandle, pCheckInfo->tableId.uid, pCheckInfo->tableId.tid, key, order, pIMem->keyFirst, pIMem->keyLast,
@@ -865,52 +859,37 @@ static bool initTableMemIterator(STsdbQueryHandle* pHandle, STableCheckInfo* pCh
 }
 
 static void destroyTableMemIterator(STableCheckInfo* pCheckInfo) {
-  tSkipListDestroyIter(pCheckInfo->iter);
-  tSkipListDestroyIter(pCheckInfo->iiter);
+  tsdbDestroyMemIter(pCheckInfo->iter);
+  tsdbDestroyMemIter(pCheckInfo->iiter);
 }
 
 static TSKEY extractFirstTraverseKey(STableCheckInfo* pCheckInfo, int32_t order, int32_t update) {
-  SMemRow rmem = NULL, rimem = NULL;
-  if (pCheckInfo->iter) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iter);
-    if (node != NULL) {
-      rmem = (SMemRow)SL_GET_NODE_DATA(node);
-    }
-  }
-
-  if (pCheckInfo->iiter) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iiter);
-    if (node != NULL) {
-      rimem = (SMemRow)SL_GET_NODE_DATA(node);
-    }
-  }
+  TSKEY r1 = tsdbNextIterKey(pCheckInfo->iter);
+  TSKEY r2 = tsdbNextIterKey(pCheckInfo->iiter);
 
-  if (rmem == NULL && rimem == NULL) {
+  if (r1 == TSDB_DATA_TIMESTAMP_NULL && r2 == TSDB_DATA_TIMESTAMP_NULL) {
     return TSKEY_INITIAL_VAL;
   }
 
-  if (rmem != NULL && rimem == NULL) {
+  if (r1 != TSDB_DATA_TIMESTAMP_NULL && r2 == TSDB_DATA_TIMESTAMP_NULL) {
     pCheckInfo->chosen = CHECKINFO_CHOSEN_MEM;
-    return memRowKey(rmem);
+    return r1;
   }
 
-  if (rmem == NULL && rimem != NULL) {
+  if (r1 == TSDB_DATA_TIMESTAMP_NULL && r2 != TSDB_DATA_TIMESTAMP_NULL) {
     pCheckInfo->chosen = CHECKINFO_CHOSEN_IMEM;
-    return memRowKey(rimem);
+    return r2;
   }
 
-  TSKEY r1 = memRowKey(rmem);
-  TSKEY r2 = memRowKey(rimem);
-
   if (r1 == r2) {
     if(update == TD_ROW_DISCARD_UPDATE){
       pCheckInfo->chosen = CHECKINFO_CHOSEN_IMEM;
-      tSkipListIterNext(pCheckInfo->iter);
+      tsdbMemIterNext(pCheckInfo->iter);
       return r2;
     }
     else if(update == TD_ROW_OVERWRITE_UPDATE) {
       pCheckInfo->chosen = CHECKINFO_CHOSEN_MEM;
-      tSkipListIterNext(pCheckInfo->iiter);
+      tsdbMemIterNext(pCheckInfo->iiter);
       return r1;
     } else {
       pCheckInfo->chosen = CHECKINFO_CHOSEN_BOTH;
@@ -938,20 +917,8 @@ static TSKEY extractFirstTraverseKey(STableCheckInfo* pCheckInfo, int32_t order,
 }
 
 static SMemRow getSMemRowInTableMem(STableCheckInfo* pCheckInfo, int32_t order, int32_t update, SMemRow* extraRow) {
-  SMemRow rmem = NULL, rimem = NULL;
-  if (pCheckInfo->iter) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iter);
-    if (node != NULL) {
-      rmem = (SMemRow)SL_GET_NODE_DATA(node);
-    }
-  }
-
-  if (pCheckInfo->iiter) {
-    SSkipListNode* node = tSkipListIterGet(pCheckInfo->iiter);
-    if (node != NULL) {
-      rimem = (SMemRow)SL_GET_NODE_DATA(node);
-    }
-  }
+  SMemRow rmem = tsdbNextIterRow(pCheckInfo->iter);
+  SMemRow rimem = tsdbNextIterRow(pCheckInfo->iiter);
 
   if (rmem == NULL && rimem == NULL) {
     return NULL;
@@ -972,11 +939,11 @@ static SMemRow getSMemRowInTableMem(STableCheckInfo* pCheckInfo, int32_t order,
 
   if (r1 == r2) {
     if (update == TD_ROW_DISCARD_UPDATE) {
-      tSkipListIterNext(pCheckInfo->iter);
+      tsdbMemIterNext(pCheckInfo->iter);
       pCheckInfo->chosen = CHECKINFO_CHOSEN_IMEM;
       return rimem;
     } else if(update == TD_ROW_OVERWRITE_UPDATE){
-      tSkipListIterNext(pCheckInfo->iiter);
+      tsdbMemIterNext(pCheckInfo->iiter);
       pCheckInfo->chosen = CHECKINFO_CHOSEN_MEM;
       return rmem;
     } else {
@@ -1009,7 +976,7 @@ static bool moveToNextRowInMem(STableCheckInfo* pCheckInfo) {
   bool hasNext = false;
   if (pCheckInfo->chosen == CHECKINFO_CHOSEN_MEM) {
     if (pCheckInfo->iter != NULL) {
-      hasNext = tSkipListIterNext(pCheckInfo->iter);
+      hasNext = tsdbMemIterNext(pCheckInfo->iter);
     }
 
     if (hasNext) {
@@ -1017,11 +984,11 @@ static bool moveToNextRowInMem(STableCheckInfo* pCheckInfo) {
     }
 
     if (pCheckInfo->iiter != NULL) {
-      return tSkipListIterGet(pCheckInfo->iiter) != NULL;
+      return tsdbNextIterTKey(pCheckInfo->iiter) != TKEY_NULL;
     }
   } else if (pCheckInfo->chosen == CHECKINFO_CHOSEN_IMEM){
     if (pCheckInfo->iiter != NULL) {
-      hasNext = tSkipListIterNext(pCheckInfo->iiter);
+      hasNext = tsdbMemIterNext(pCheckInfo->iiter);
     }
 
     if (hasNext) {
@@ -1029,14 +996,14 @@ static bool moveToNextRowInMem(STableCheckInfo* pCheckInfo) {
     }
 
     if (pCheckInfo->iter != NULL) {
-      return tSkipListIterGet(pCheckInfo->iter) != NULL;
+      return tsdbNextIterTKey(pCheckInfo->iter) != TKEY_NULL;
     }
   } else {
     if (pCheckInfo->iter != NULL) {
-      hasNext = tSkipListIterNext(pCheckInfo->iter);
+      hasNext = tsdbMemIterNext(pCheckInfo->iter);
     }
     if (pCheckInfo->iiter != NULL) {
-      hasNext = tSkipListIterNext(pCheckInfo->iiter) || hasNext;
+      hasNext = tsdbMemIterNext(pCheckInfo->iiter) || hasNext;
     }
   }
 
@@ -1473,9 +1440,33 @@ static int32_t getFileCompInfo(STsdbQueryHandle* pQueryHandle, int32_t* numOfBlo
   return code;
 }
 
+// Issue the read ahead of the next blocks in scan order once the data of a block is really loaded, so the disk reads
+// them while the current one is processed. Blocks that are answered by the statistics alone are never loaded.
+static void readAheadFileDataBlocks(STsdbQueryHandle* pQueryHandle, int32_t slotIndex) {
+  if (tsdbReadAheadBlocks <= 0) return;
+
+  bool    asc = ASCENDING_TRAVERSE(pQueryHandle->order);
+  int32_t step = asc ? 1 : -1;
+  int32_t start = slotIndex + step;
+  int32_t end = slotIndex + step * tsdbReadAheadBlocks;
+
+  if (pQueryHandle->readAheadSlot >= 0) {
+    start = asc ? MAX(start, pQueryHandle->readAheadSlot + 1) : MIN(start, pQueryHandle->readAheadSlot - 1);
+  }
+  end = asc ? MIN(end, pQueryHandle->numOfBlocks - 1) : MAX(end, 0);
+
+  for (int32_t i = start; asc ? (i <= end) : (i >= end); i += step) {
+    STableBlockInfo* pBlockInfo = &pQueryHandle->pDataBlockInfo[i];
+    tsdbReadAheadBlockData(&pQueryHandle->rhelper, pBlockInfo->compBlock, pBlockInfo->pTableCheckInfo->pCompInfo);
+    pQueryHandle->readAheadSlot = i;
+  }
+}
+
 static int32_t doLoadFileDataBlock(STsdbQueryHandle* pQueryHandle, SBlock* pBlock, STableCheckInfo* pCheckInfo, int32_t slotIndex) {
   int64_t st = taosGetTimestampUs();
 
+  readAheadFileDataBlocks(pQueryHandle, slotIndex);
+
   STSchema *pSchema = tsdbGetTableSchema(pCheckInfo->pTableObj);
   int32_t   code = tdInitDataCols(pQueryHandle->pDataCols, pSchema);
   if (code != TSDB_CODE_SUCCESS) {
@@ -2725,6 +2716,8 @@ static int32_t getFirstFileDataBlock(STsdbQueryHandle* pQueryHandle, bool* exist
   assert(pQueryHandle->pFileGroup != NULL && pQueryHandle->numOfBlocks > 0);
   cur->slot = ASCENDING_TRAVERSE(pQueryHandle->order)? 0:pQueryHandle->numOfBlocks-1;
   cur->fid = pQueryHandle->pFileGroup->fid;
+  pQueryHandle->readAheadSlot = -1;
+  pQueryHandle->bloomSlot = -1;
 
   STableBlockInfo* pBlockInfo = &pQueryHandle->pDataBlockInfo[cur->slot];
   return getDataBlockRv(pQueryHandle, pBlockInfo, exists);
@@ -2971,6 +2964,110 @@ static UNUSED_FUNC void changeQueryHandleForInterpQuery(TsdbQueryHandleT pHandle
   taosArrayPush(pQueryHandle->pTableCheckInfo, &info);
 }
 
+// copy rows [start, start + num) of a memtable column chunk into the result buffer
+static void doCopyRowsFromMemChunk(STsdbQueryHandle* pQueryHandle, int32_t capacity, int32_t numOfRows,
+                                   SDataCols* pCols, int32_t start, int32_t num) {
+  int32_t requiredNumOfCols = (int32_t)taosArrayGetSize(pQueryHandle->pColumns);
+  char*   pData = NULL;
+
+  int32_t i = 0, j = 0;
+  while (i < requiredNumOfCols) {
+    SColumnInfoData* pColInfo = taosArrayGet(pQueryHandle->pColumns, i);
+
+    SDataCol* src = (j < pCols->numOfCols) ? &pCols->cols[j] : NULL;
+    if (src != NULL && src->colId < pColInfo->info.colId) {
+      j++;
+      continue;
+    }
+
+    int32_t bytes = pColInfo->info.bytes;
+    if (ASCENDING_TRAVERSE(pQueryHandle->order)) {
+      pData = (char*)pColInfo->pData + numOfRows * bytes;
+    } else {
+      pData = (char*)pColInfo->pData + (capacity - numOfRows - num) * bytes;
+    }
+
+    if (src != NULL && !isAllRowsNull(src) && pColInfo->info.colId == src->colId) {
+      if (pColInfo->info.colId == PRIMARYKEY_TIMESTAMP_COL_INDEX) {
+        for (int32_t k = 0; k < num; ++k) {
+          ((TSKEY*)pData)[k] = tdGetKey(((TKEY*)src->pData)[start + k]);
+        }
+      } else if (pColInfo->info.type != TSDB_DATA_TYPE_BINARY && pColInfo->info.type != TSDB_DATA_TYPE_NCHAR) {
+        memcpy(pData, (char*)src->pData + bytes * start, bytes * num);
+      } else {
+        char* dst = pData;
+        for (int32_t k = start; k < num + start; ++k) {
+          const char* p = tdGetColDataOfRow(src, k);
+          memcpy(dst, p, varDataTLen(p));
+          dst += bytes;
+        }
+      }
+      j++;
+    } else {
+      if (src != NULL && pColInfo->info.colId == src->colId) j++;
+
+      if (pColInfo->info.type == TSDB_DATA_TYPE_BINARY || pColInfo->info.type == TSDB_DATA_TYPE_NCHAR) {
+        char* dst = pData;
+        for (int32_t k = 0; k < num; ++k) {
+          setVardataNull(dst, pColInfo->info.type);
+          dst += bytes;
+        }
+      } else {
+        setNullN(pData, pColInfo->info.type, bytes, num);
+      }
+    }
+
+    i++;
+  }
+}
+
+// Copy a run of in-order rows straight from the column chunk the next row belongs to. Returns the number of rows
+// copied, 0 if the next row does not come from a chunk or both buffers hold the same key.
+static int32_t tsdbReadChunkRowsFromCache(STableCheckInfo* pCheckInfo, TSKEY maxKey, int32_t capacity,
+                                          int32_t numOfRows, STimeWindow* win, STsdbQueryHandle* pQueryHandle) {
+  bool      asc = ASCENDING_TRAVERSE(pQueryHandle->order);
+  TSKEY     r1 = tsdbNextIterKey(pCheckInfo->iter);
+  TSKEY     r2 = tsdbNextIterKey(pCheckInfo->iiter);
+  SMemIter* pIter = NULL;
+  TSKEY     other = TSDB_DATA_TIMESTAMP_NULL;
+
+  if (r1 == r2) return 0;
+
+  if (r2 == TSDB_DATA_TIMESTAMP_NULL || (r1 != TSDB_DATA_TIMESTAMP_NULL && ((r1 < r2) == asc))) {
+    pIter = pCheckInfo->iter;
+    other = r2;
+  } else {
+    pIter = pCheckInfo->iiter;
+    other = r1;
+  }
+
+  if (!pIter->fromChunk) return 0;
+
+  TSKEY boundKey = maxKey;
+  if (other != TSDB_DATA_TIMESTAMP_NULL) {
+    boundKey = asc ? MIN(maxKey, other - 1) : MAX(maxKey, other + 1);
+  }
+
+  int32_t num = tsdbMemIterChunkRows(pIter, boundKey, capacity - numOfRows);
+  if (num <= 0) return 0;
+
+  SDataCols* pCols = &pIter->pChunk->data;
+  int32_t    start = asc ? pIter->pos : pIter->pos - num + 1;
+  doCopyRowsFromMemChunk(pQueryHandle, capacity, numOfRows, pCols, start, num);
+
+  TSKEY skey = dataColsKeyAt(pCols, pIter->pos);
+  TSKEY ekey = dataColsKeyAt(pCols, asc ? start + num - 1 : start);
+  if (win->skey == INT64_MIN) {
+    win->skey = skey;
+  }
+  win->ekey = ekey;
+
+  pCheckInfo->chosen = (pIter == pCheckInfo->iter) ? CHECKINFO_CHOSEN_MEM : CHECKINFO_CHOSEN_IMEM;
+  tsdbMemIterSkipChunkRows(pIter, num);
+
+  return num;
+}
+
 static int tsdbReadRowsFromCache(STableCheckInfo* pCheckInfo, TSKEY maxKey, int maxRowsToRead, STimeWindow* win,
                                  STsdbQueryHandle* pQueryHandle) {
   int     numOfRows = 0;
@@ -2983,7 +3080,20 @@ static int tsdbReadRowsFromCache(STableCheckInfo* pCheckInfo, TSKEY maxKey, int
   int16_t rv = -1;
   STSchema* pSchema = NULL;
 
-  do {
+  while (true) {
+    int32_t num = tsdbReadChunkRowsFromCache(pCheckInfo, maxKey, maxRowsToRead, numOfRows, win, pQueryHandle);
+    if (num > 0) {
+      numOfRows += num;
+      if (numOfRows >= maxRowsToRead) {
+        break;
+      }
+
+      if (tsdbNextIterTKey(pCheckInfo->iter) == TKEY_NULL && tsdbNextIterTKey(pCheckInfo->iiter) == TKEY_NULL) {
+        break;
+      }
+      continue;
+    }
+
     SMemRow row = getSMemRowInTableMem(pCheckInfo, pQueryHandle->order, pCfg->update, NULL);
     if (row == NULL) {
       break;
@@ -3013,7 +3123,10 @@ static int tsdbReadRowsFromCache(STableCheckInfo* pCheckInfo, TSKEY maxKey, int
       break;
     }
 
-  } while(moveToNextRowInMem(pCheckInfo));
+    if (!moveToNextRowInMem(pCheckInfo)) {
+      break;
+    }
+  }
 
   assert(numOfRows <= maxRowsToRead);
 
@@ -3791,13 +3904,36 @@ int32_t tsdbRetrieveDataBlockStatisInfo(TsdbQueryHandleT* pQueryHandle, SDataSta
   return TSDB_CODE_SUCCESS;
 }
 
-SArray* tsdbRetrieveDataBlock(TsdbQueryHandleT* pQueryHandle, SArray* pIdList) {
+bool tsdbDataBlockMayContain(TsdbQueryHandleT* pQueryHandle, int16_t colId, const void* val, int32_t len) {
+  STsdbQueryHandle* pHandle = (STsdbQueryHandle*) pQueryHandle;
+
+  SQueryFilePos* c = &pHandle->cur;
+  if (c->mixBlock || c->fid == INT32_MIN) {
+    return true;
+  }
+
+  STableBlockInfo* pBlockInfo = &pHandle->pDataBlockInfo[c->slot];
+  if (pBlockInfo->compBlock->numOfSubBlocks > 1) {
+    return true;
+  }
+
+  if (pHandle->bloomSlot != c->slot) {
+    int64_t stime = taosGetTimestampUs();
+    if (tsdbLoadBlockBloom(&pHandle->rhelper, pBlockInfo->compBlock) < 0) {
+      pHandle->rhelper.pBloomBlkData = NULL;
+    }
+    pHandle->bloomSlot = c->slot;
+    pHandle->cost.statisInfoLoadTime += (taosGetTimestampUs() - stime);
+  }
+
+  return tsdbBlockBloomMayContain(&pHandle->rhelper, colId, val, len);
+}
+
+static SArray* tsdbRetrieveDataBlockImpl(STsdbQueryHandle* pHandle) {
   /**
    * In the following two cases, the data has been loaded to SColumnInfoData.
    * 1. data is from cache, 2. data block is not completed qualified to query time range
    */
-  STsdbQueryHandle* pHandle = (STsdbQueryHandle*)pQueryHandle;
-
   if (pHandle->cur.fid == INT32_MIN) {
     return pHandle->pColumns;
   } else {
@@ -3842,6 +3978,30 @@ SArray* tsdbRetrieveDataBlock(TsdbQueryHandleT* pQueryHandle, SArray* pIdList) {
   }
 }
 
+/*
+ * The null flag of a column is computed by the consumer on demand, from the block statistics if there are, so only
+ * reset it for the new block here. The timestamp column never has null value.
+ */
+static void tsdbResetColumnsNullFlag(STsdbQueryHandle* pHandle) {
+  size_t numOfCols = taosArrayGetSize(pHandle->pColumns);
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* pColInfo = taosArrayGet(pHandle->pColumns, i);
+    pColInfo->nullFlag = (pColInfo->info.colId == PRIMARYKEY_TIMESTAMP_COL_INDEX) ? COL_HAS_NO_NULL : COL_NULL_UNKNOWN;
+  }
+}
+
+SArray* tsdbRetrieveDataBlock(TsdbQueryHandleT* pQueryHandle, SArray* pIdList) {
+  STsdbQueryHandle* pHandle = (STsdbQueryHandle*)pQueryHandle;
+
+  SArray* pColumns = tsdbRetrieveDataBlockImpl(pHandle);
+  if (pColumns != NULL) {
+    tsdbResetColumnsNullFlag(pHandle);
+  }
+
+  return pColumns;
+}
+
 void filterPrepare(void* expr, void* param) {
   tExprNode* pExpr = (tExprNode*)expr;
   if (pExpr->_node.info != NULL) {
@@ -4684,6 +4844,16 @@ int64_t tsdbSkipOffset(TsdbQueryHandleT queryHandle) {
   return 0;
 }
 
+void tsdbGetQueryReadCost(TsdbQueryHandleT queryHandle, STsdbReadCost* pCost) {
+  STsdbQueryHandle* pQueryHandle = (STsdbQueryHandle*)queryHandle;
+  if (pQueryHandle == NULL) {
+    memset(pCost, 0, sizeof(*pCost));
+    return;
+  }
+
+  *pCost = pQueryHandle->rhelper.cost;
+}
+
 // add scan table need callback 
 void tsdbAddScanCallback(TsdbQueryHandleT* queryHandle, readover_callback callback, void* param) {
   STsdbQueryHandle* pQueryHandle = (STsdbQueryHandle*)queryHandle;
@@ -69,6 +69,8 @@ void tsdbDestroyReadH(SReadH *pReadh) {
   pReadh->pDCols[0] = tdFreeDataCols(pReadh->pDCols[0]);
   pReadh->pDCols[1] = tdFreeDataCols(pReadh->pDCols[1]);
   pReadh->pAggrBlkData = taosTZfree(pReadh->pAggrBlkData);
+  pReadh->pBloomBuf = taosTZfree(pReadh->pBloomBuf);
+  pReadh->pBloomBlkData = NULL;
   pReadh->pBlkData = taosTZfree(pReadh->pBlkData);
   pReadh->pBlkInfo = taosTZfree(pReadh->pBlkInfo);
   pReadh->cidx = 0;
@@ -91,6 +93,11 @@ int tsdbSetAndOpenReadFSet(SReadH *pReadh, SDFileSet *pSet) {
     return -1;
   }
 
+  if (pReadh->pRepo->blkCache != NULL) {
+    pReadh->dataFVer = tsdbGetDFileVer(TSDB_READ_DATA_FILE(pReadh));
+    pReadh->lastFVer = tsdbGetDFileVer(TSDB_READ_LAST_FILE(pReadh));
+  }
+
   return 0;
 }
 
@@ -396,6 +403,24 @@ int tsdbLoadBlockData(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlkInfo) {
   return 0;
 }
 
+void tsdbReadAheadBlockData(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlkInfo) {
+  ASSERT(pBlock->numOfSubBlocks > 0);
+
+  SBlock *iBlock = pBlock;
+  if (pBlock->numOfSubBlocks > 1) {
+    if (pBlkInfo) {
+      iBlock = (SBlock *)POINTER_SHIFT(pBlkInfo, pBlock->offset);
+    } else {
+      iBlock = (SBlock *)POINTER_SHIFT(pReadh->pBlkInfo, pBlock->offset);
+    }
+  }
+
+  for (int i = 0; i < pBlock->numOfSubBlocks; i++, iBlock++) {
+    SDFile *pDFile = (iBlock->last) ? TSDB_READ_LAST_FILE(pReadh) : TSDB_READ_DATA_FILE(pReadh);
+    tsdbReadAheadDFile(pDFile, iBlock->offset, iBlock->len);
+  }
+}
+
 int tsdbLoadBlockDataCols(SReadH *pReadh, SBlock *pBlock, SBlockInfo *pBlkInfo, int16_t *colIds, int numOfColsIds) {
   ASSERT(pBlock->numOfSubBlocks > 0);
   int8_t update = pReadh->pRepo->config.update;
@@ -515,6 +540,77 @@ int tsdbLoadBlockOffset(SReadH *pReadh, SBlock *pBlock) {
   return tsdbLoadBlockStatisFromDFile(pReadh, pBlock);
 }
 
+int tsdbLoadBlockBloom(SReadH *pReadh, SBlock *pBlock) {
+  ASSERT(pBlock->numOfSubBlocks <= 1);
+
+  pReadh->pBloomBlkData = NULL;
+  if (pBlock->blkVer == TSDB_SBLK_VER_0 || !pBlock->aggrStat) return TSDB_STATIS_NONE;
+
+  SDFile *pDFileAggr = pBlock->last ? TSDB_READ_SMAL_FILE(pReadh) : TSDB_READ_SMAD_FILE(pReadh);
+  int64_t offset = pBlock->aggrOffset + tsdbBlockAggrSize(pBlock->numOfCols, (uint32_t)pBlock->blkVer);
+
+  if (tsdbSeekDFile(pDFileAggr, offset, SEEK_SET) < 0) {
+    tsdbError("vgId:%d failed to load block bloom part while seek file %s to offset %" PRId64 " since %s",
+              TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFileAggr), offset, tstrerror(terrno));
+    return -1;
+  }
+
+  if (tsdbMakeRoom((void **)(&(pReadh->pBloomBuf)), sizeof(SBloomBlkData)) < 0) return -1;
+
+  int64_t nread = tsdbReadDFile(pDFileAggr, pReadh->pBloomBuf, sizeof(SBloomBlkData));
+  if (nread < 0) {
+    tsdbError("vgId:%d failed to load block bloom part while read file %s since %s, offset:%" PRId64,
+              TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFileAggr), tstrerror(terrno), offset);
+    return -1;
+  }
+
+  // the aggr part is the last one of the file or is followed by the aggr part of the next block
+  SBloomBlkData *pBloomBlkData = (SBloomBlkData *)pReadh->pBloomBuf;
+  if (nread < sizeof(SBloomBlkData) || pBloomBlkData->magic != TSDB_BLOOM_MAGIC) return TSDB_STATIS_NONE;
+
+  uint32_t len = pBloomBlkData->len;
+  if (len < sizeof(SBloomBlkData) + sizeof(TSCKSUM) || offset + len > pDFileAggr->info.size) {
+    tsdbWarn("vgId:%d block bloom part in file %s is ignored since its length %u is invalid, offset:%" PRId64,
+             TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFileAggr), len, offset);
+    return TSDB_STATIS_NONE;
+  }
+
+  if (tsdbMakeRoom((void **)(&(pReadh->pBloomBuf)), len) < 0) return -1;
+  pBloomBlkData = (SBloomBlkData *)pReadh->pBloomBuf;
+
+  nread = tsdbReadDFile(pDFileAggr, POINTER_SHIFT(pBloomBlkData, sizeof(SBloomBlkData)), len - sizeof(SBloomBlkData));
+  if (nread < 0) {
+    tsdbError("vgId:%d failed to load block bloom part while read file %s since %s, offset:%" PRId64 " len:%u",
+              TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFileAggr), tstrerror(terrno), offset, len);
+    return -1;
+  }
+
+  if (nread < len - sizeof(SBloomBlkData) || !taosCheckChecksumWhole((uint8_t *)pBloomBlkData, len)) {
+    tsdbWarn("vgId:%d block bloom part in file %s is ignored since it is broken, offset:%" PRId64 " len:%u",
+             TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFileAggr), offset, len);
+    return TSDB_STATIS_NONE;
+  }
+
+  pReadh->pBloomBlkData = pBloomBlkData;
+  return TSDB_STATIS_OK;
+}
+
+// Return false only if no row of the block loaded by tsdbLoadBlockBloom has the value in the column
+bool tsdbBlockBloomMayContain(SReadH *pReadh, int16_t colId, const void *val, int32_t len) {
+  SBloomBlkData *pBloomBlkData = pReadh->pBloomBlkData;
+  if (pBloomBlkData == NULL) return true;
+
+  for (int32_t i = 0; i < pBloomBlkData->numOfCols; i++) {
+    SBloomBlkCol *pBloomBlkCol = pBloomBlkData->cols + i;
+    if (pBloomBlkCol->colId == colId) {
+      return tsdbBloomTest(POINTER_SHIFT(pBloomBlkData, pBloomBlkCol->offset), pBloomBlkCol->nBits,
+                           pBloomBlkCol->nHash, tsdbBloomHash(val, len));
+    }
+  }
+
+  return true;
+}
+
 int tsdbEncodeSBlockIdx(void **buf, SBlockIdx *pIdx) {
   int tlen = 0;
 
@@ -651,6 +747,8 @@ static int tsdbLoadBlockDataImpl(SReadH *pReadh, SBlock *pBlock, SDataCols *pDat
     return -1;
   }
 
+  pReadh->cost.readBytes += pBlock->len;
+
   int32_t tsize = (int32_t)tsdbBlockStatisSize(pBlock->numOfCols, (uint32_t)pBlock->blkVer);
   if (!taosCheckChecksumWhole((uint8_t *)TSDB_READ_BUF(pReadh), tsize)) {
     terrno = TSDB_CODE_TDB_FILE_CORRUPTED;
@@ -705,6 +803,8 @@ static int tsdbLoadBlockDataImpl(SReadH *pReadh, SBlock *pBlock, SDataCols *pDat
         return -1;
       }
 
+      pReadh->cost.decompBytes += pDataCol->len;
+
       if (dcol != 0) {
         ccol++;
       }
@@ -840,11 +940,27 @@ static int tsdbLoadColData(SReadH *pReadh, SDFile *pDFile, SBlock *pBlock, SBloc
   STsdbCfg * pCfg = REPO_CFG(pRepo);
   int        tsize = pDataCol->bytes * pBlock->numOfRows + COMP_OVERFLOW_BYTES;
 
+  int64_t offset = pBlock->offset + tsdbBlockStatisSize(pBlock->numOfCols, (uint32_t)pBlock->blkVer) +
+                   tsdbGetBlockColOffset(pBlockCol);
+
+  SBlockCacheKey key;
+  if (pRepo->blkCache != NULL) {
+    memset(&key, 0, sizeof(key));
+    key.offset = offset;
+    key.fid = TSDB_READ_FSET(pReadh)->fid;
+    key.fver = pBlock->last ? pReadh->lastFVer : pReadh->dataFVer;
+    key.colId = pBlockCol->colId;
+    key.ftype = pBlock->last ? TSDB_FILE_LAST : TSDB_FILE_DATA;
+
+    if (tsdbBlockCacheGet(pRepo->blkCache, &key, pDataCol, pCfg->maxRowsPerFileBlock, pBlock->numOfRows)) {
+      pReadh->cost.cacheHits++;
+      return 0;
+    }
+  }
+
   if (tsdbMakeRoom((void **)(&TSDB_READ_BUF(pReadh)), pBlockCol->len) < 0) return -1;
   if (tsdbMakeRoom((void **)(&TSDB_READ_COMP_BUF(pReadh)), tsize) < 0) return -1;
 
-  int64_t offset = pBlock->offset + tsdbBlockStatisSize(pBlock->numOfCols, (uint32_t)pBlock->blkVer) +
-                   tsdbGetBlockColOffset(pBlockCol);
   if (tsdbSeekDFile(pDFile, offset, SEEK_SET) < 0) {
     tsdbError("vgId:%d failed to load block column data while seek file %s to offset %" PRId64 " since %s",
               TSDB_READ_REPO_ID(pReadh), TSDB_FILE_FULL_NAME(pDFile), offset, tstrerror(terrno));
@@ -873,5 +989,12 @@ static int tsdbLoadColData(SReadH *pReadh, SDFile *pDFile, SBlock *pBlock, SBloc
     return -1;
   }
 
+  pReadh->cost.readBytes += pBlockCol->len;
+  pReadh->cost.decompBytes += pDataCol->len;
+
+  if (pRepo->blkCache != NULL) {
+    tsdbBlockCachePut(pRepo->blkCache, &key, pDataCol);
+  }
+
   return 0;
 }
@@ -36,11 +36,16 @@ extern "C" {
 // For thread safety setting
 #define SL_THREAD_SAFE (uint8_t)0x4
 
+// Lock-free setting: nodes are linked by CAS so readers never block writers, takes precedence over SL_THREAD_SAFE.
+// Only for lists with unique keys (SL_DISCARD_DUP_KEY/SL_UPDATE_DUP_KEY), nodes can not be removed.
+#define SL_LOCK_FREE (uint8_t)0x8
+
 typedef char *SSkipListKey;
 typedef char *(*__sl_key_fn_t)(const void *);
 
 typedef void (*sl_patch_row_fn_t)(void * pDst, const void * pSrc);
 typedef void* (*iter_next_fn_t)(void *iter);
+typedef void* (*sl_alloc_node_fn_t)(void *param, int32_t size);
 
 typedef struct SSkipListNode {
   uint8_t        level;
@@ -71,7 +76,15 @@ typedef struct SSkipListNode {
  *
  *    Memory consumption: the memory alignment causes many memory wasted. So, employ a memory
  *    pool will significantly reduce the total memory consumption, as well as the calloc/malloc operation costs.
+ *    A pool can be attached by tSkipListSetNodeAllocator, nodes are then carved from the pool and released with
+ *    the pool as a whole, instead of being freed one by one.
  *
+ * Note: Lock-free mode (SL_LOCK_FREE).
+ *    The forward pointers are published by compare-and-swap, level 0 first and then the upper levels, so a reader
+ *    always sees a well-ordered list without taking any lock. The backward pointers are only hints in this mode,
+ *    a backward step is validated by walking forward on level 0 until the current node is reached. Since nodes are
+ *    never removed, the hint always points to a predecessor and the walk is short.
+ *    The insertHandleFn is shared by all writers, so the caller must serialize writers if it is installed.
  */
 
 // state struct, record following information:
@@ -123,6 +136,8 @@ typedef struct SSkipList {
   tSkipListState state;  // skiplist state
 #endif
   tGenericSavedFunc* insertHandleFn;
+  sl_alloc_node_fn_t allocFn;     // allocate nodes from an external pool, NULL means calloc
+  void *             allocParam;
 } SSkipList;
 
 typedef struct SSkipListIterator {
@@ -134,15 +149,17 @@ typedef struct SSkipListIterator {
 } SSkipListIterator;
 
 #define SL_IS_THREAD_SAFE(s) (((s)->flags) & SL_THREAD_SAFE)
+#define SL_IS_LOCK_FREE(s) (((s)->flags) & SL_LOCK_FREE)
 #define SL_DUP_MODE(s) (((s)->flags) & ((((uint8_t)1) << 2) - 1))
 #define SL_GET_NODE_KEY(s, n) ((s)->keyFn((n)->pData))
 #define SL_GET_MIN_KEY(s) SL_GET_NODE_KEY(s, SL_NODE_GET_FORWARD_POINTER((s)->pHead, 0))
-#define SL_GET_MAX_KEY(s) SL_GET_NODE_KEY((s), SL_NODE_GET_BACKWARD_POINTER((s)->pTail, 0))
+#define SL_GET_MAX_KEY(s) SL_GET_NODE_KEY((s), SL_NODE_GET_BACKWARD_POINTER((s)->pTail, 0))  // not for SL_LOCK_FREE
 #define SL_SIZE(s) (s)->size
 
 SSkipList *tSkipListCreate(uint8_t maxLevel, uint8_t keyType, uint16_t keyLen, __compar_fn_t comparFn, uint8_t flags,
                            __sl_key_fn_t fn);
 void       tSkipListDestroy(SSkipList *pSkipList);
+void       tSkipListSetNodeAllocator(SSkipList *pSkipList, sl_alloc_node_fn_t fn, void *param);
 SSkipListNode *    tSkipListPut(SSkipList *pSkipList, void *pData);
 void               tSkipListPutBatchByIter(SSkipList *pSkipList, void *iter, iter_next_fn_t iterate);
 SArray *           tSkipListGet(SSkipList *pSkipList, SSkipListKey pKey);
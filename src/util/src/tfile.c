@@ -134,6 +134,17 @@ int32_t tfFtruncate(int64_t tfd, int64_t length) {
   return code;
 }
 
+int32_t tfFallocate(int64_t tfd, int64_t offset, int64_t len) {
+  void *p = taosAcquireRef(tsFileRsetId, tfd);
+  if (p == NULL) return -1;
+
+  int32_t fd = (int32_t)(uintptr_t)p;
+  int32_t code = taosFallocate(fd, offset, len);
+
+  taosReleaseRef(tsFileRsetId, tfd);
+  return code;
+}
+
 int32_t tfStat(int64_t tfd, struct stat *pFstat) {
   void *p = taosAcquireRef(tsFileRsetId, tfd);
   if (p == NULL) return -1;
@@ -28,9 +28,21 @@ static SSkipListIterator *doCreateSkipListIterator(SSkipList *pSkipList, int32_t
 static void tSkipListDoInsert(SSkipList *pSkipList, SSkipListNode **direction, SSkipListNode *pNode, bool isForward);
 static bool tSkipListGetPosToPut(SSkipList *pSkipList, SSkipListNode **backward, void *pData);
 static SSkipListNode *tSkipListNewNode(uint8_t level);
+static SSkipListNode *tSkipListAllocNode(SSkipList *pSkipList, uint8_t level);
 #define tSkipListFreeNode(n) tfree((n))
+#define tSkipListReleaseNode(s, n) \
+  do {                              \
+    if ((s)->allocFn == NULL) {     \
+      tfree((n));                   \
+    }                               \
+  } while (0)
 static SSkipListNode *tSkipListPutImpl(SSkipList *pSkipList, void *pData, SSkipListNode **direction, bool isForward,
                                        bool hasDup);
+static SSkipListNode *tSkipListUpdateDupNode(SSkipList *pSkipList, SSkipListNode *pNode, void *pData);
+static SSkipListNode *tSkipListPutLockFree(SSkipList *pSkipList, void *pData);
+static bool tSkipListGetPosLockFree(SSkipList *pSkipList, const char *pDataKey, SSkipListNode **preds,
+                                    SSkipListNode **succs);
+static SSkipListNode *tSkipListGetPrevNode(SSkipList *pSkipList, SSkipListNode *pNode);
 
 
 static FORCE_INLINE int     tSkipListWLock(SSkipList *pSkipList);
@@ -47,6 +59,11 @@ SSkipList *tSkipListCreate(uint8_t maxLevel, uint8_t keyType, uint16_t keyLen, _
     maxLevel = MAX_SKIP_LIST_LEVEL;
   }
 
+  // duplicated keys can not be ordered consistently among levels without a lock
+  if ((flags & SL_LOCK_FREE) && (flags & ((((uint8_t)1) << 2) - 1)) == SL_ALLOW_DUP_KEY) {
+    flags &= ~SL_LOCK_FREE;
+  }
+
   pSkipList->maxLevel = maxLevel;
   pSkipList->type = keyType;
   pSkipList->len = keyLen;
@@ -64,7 +81,7 @@ SSkipList *tSkipListCreate(uint8_t maxLevel, uint8_t keyType, uint16_t keyLen, _
     return NULL;
   }
 
-  if (SL_IS_THREAD_SAFE(pSkipList)) {
+  if (SL_IS_THREAD_SAFE(pSkipList) && !SL_IS_LOCK_FREE(pSkipList)) {
     pSkipList->lock = (pthread_rwlock_t *)calloc(1, sizeof(pthread_rwlock_t));
     if (pSkipList->lock == NULL) {
       tSkipListDestroy(pSkipList);
@@ -92,9 +109,10 @@ void tSkipListDestroy(SSkipList *pSkipList) {
 
   tSkipListWLock(pSkipList);
 
+  // nodes from an external pool are released together with the pool
   SSkipListNode *pNode = SL_NODE_GET_FORWARD_POINTER(pSkipList->pHead, 0);
 
-  while (pNode != pSkipList->pTail) {
+  while (pSkipList->allocFn == NULL && pNode != pSkipList->pTail) {
     SSkipListNode *pTemp = pNode;
     pNode = SL_NODE_GET_FORWARD_POINTER(pNode, 0);
     tSkipListFreeNode(pTemp);
@@ -113,9 +131,20 @@ void tSkipListDestroy(SSkipList *pSkipList) {
   tfree(pSkipList);
 }
 
+void tSkipListSetNodeAllocator(SSkipList *pSkipList, sl_alloc_node_fn_t fn, void *param) {
+  ASSERT(pSkipList->size == 0);
+
+  pSkipList->allocFn = fn;
+  pSkipList->allocParam = param;
+}
+
 SSkipListNode *tSkipListPut(SSkipList *pSkipList, void *pData) {
   if (pSkipList == NULL || pData == NULL) return NULL;
 
+  if (SL_IS_LOCK_FREE(pSkipList)) {
+    return tSkipListPutLockFree(pSkipList, pData);
+  }
+
   SSkipListNode *backward[MAX_SKIP_LIST_LEVEL] = {0};
   SSkipListNode *pNode = NULL;
 
@@ -137,6 +166,14 @@ void tSkipListPutBatchByIter(SSkipList *pSkipList, void *iter, iter_next_fn_t it
   char *         pDataKey = NULL;
   int            compare = 0;
 
+  if (SL_IS_LOCK_FREE(pSkipList)) {
+    void *pData = NULL;
+    while ((pData = iterate(iter)) != NULL) {
+      tSkipListPutLockFree(pSkipList, pData);
+    }
+    return;
+  }
+
   tSkipListWLock(pSkipList);
 
   void* pData = iterate(iter);
@@ -216,6 +253,11 @@ void tSkipListPutBatchByIter(SSkipList *pSkipList, void *iter, iter_next_fn_t it
 uint32_t tSkipListRemove(SSkipList *pSkipList, SSkipListKey key) {
   uint32_t count = 0;
 
+  if (SL_IS_LOCK_FREE(pSkipList)) {
+    ASSERT(0);
+    return count;
+  }
+
   tSkipListWLock(pSkipList);
 
   SSkipListNode *pNode = getPriorNode(pSkipList, key, TSDB_ORDER_ASC, NULL);
@@ -264,6 +306,11 @@ SArray *tSkipListGet(SSkipList *pSkipList, SSkipListKey key) {
 }
 
 void tSkipListRemoveNode(SSkipList *pSkipList, SSkipListNode *pNode) {
+  if (SL_IS_LOCK_FREE(pSkipList)) {
+    ASSERT(0);
+    return;
+  }
+
   tSkipListWLock(pSkipList);
   tSkipListRemoveNodeImpl(pSkipList, pNode);
   tSkipListCorrectLevel(pSkipList);
@@ -325,14 +372,14 @@ bool tSkipListIterNext(SSkipListIterator *iter) {
       return false;
     }
 
-    iter->cur = SL_NODE_GET_BACKWARD_POINTER(iter->cur, 0);
+    iter->cur = tSkipListGetPrevNode(pSkipList, iter->cur);
 
     // a new node is inserted into between iter->cur and iter->next, ignore it
     if (iter->cur != iter->next && (iter->next != NULL)) {
       iter->cur = iter->next;
     }
 
-    iter->next = SL_NODE_GET_BACKWARD_POINTER(iter->cur, 0);
+    iter->next = tSkipListGetPrevNode(pSkipList, iter->cur);
     iter->step++;
   }
 
@@ -436,7 +483,7 @@ static SSkipListIterator *doCreateSkipListIterator(SSkipList *pSkipList, int32_t
     iter->next = SL_NODE_GET_FORWARD_POINTER(iter->cur, 0);
   } else {
     iter->cur = pSkipList->pTail;
-    iter->next = SL_NODE_GET_BACKWARD_POINTER(iter->cur, 0);
+    iter->next = tSkipListGetPrevNode(pSkipList, iter->cur);
   }
 
   return iter;
@@ -535,7 +582,7 @@ static void tSkipListRemoveNodeImpl(SSkipList *pSkipList, SSkipListNode *pNode)
     SL_NODE_GET_BACKWARD_POINTER(next, j) = prev;
   }
 
-  tSkipListFreeNode(pNode);
+  tSkipListReleaseNode(pSkipList, pNode);
   pSkipList->size--;
 }
 
@@ -623,6 +670,21 @@ static SSkipListNode *getPriorNode(SSkipList *pSkipList, const char *val, int32_
         }
       }
     }
+  } else if (SL_IS_LOCK_FREE(pSkipList)) {
+    // backward pointers are only hints, so find the last node with key not larger than val by a forward search
+    SSkipListNode *px = pSkipList->pHead;
+    for (int32_t i = atomic_load_8(&pSkipList->level) - 1; i >= 0; --i) {
+      SSkipListNode *p = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(px, i));
+      while (p != pSkipList->pTail && comparFn(SL_GET_NODE_KEY(pSkipList, p), val) <= 0) {
+        px = p;
+        p = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(px, i));
+      }
+    }
+
+    if (pCur != NULL && px != pSkipList->pHead) {
+      *pCur = px;
+    }
+    pNode = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(px, 0));
   } else {
     pNode = pSkipList->pTail;
     for (int32_t i = pSkipList->level - 1; i >= 0; --i) {
@@ -677,36 +739,34 @@ static SSkipListNode *tSkipListNewNode(uint8_t level) {
   return pNode;
 }
 
+static SSkipListNode *tSkipListAllocNode(SSkipList *pSkipList, uint8_t level) {
+  if (pSkipList->allocFn == NULL) {
+    return tSkipListNewNode(level);
+  }
+
+  int32_t        tsize = sizeof(SSkipListNode) + sizeof(SSkipListNode *) * level * 2;
+  SSkipListNode *pNode = (SSkipListNode *)(*pSkipList->allocFn)(pSkipList->allocParam, tsize);
+  if (pNode == NULL) return NULL;
+
+  memset(pNode, 0, tsize);
+  pNode->level = level;
+  return pNode;
+}
+
 static SSkipListNode *tSkipListPutImpl(SSkipList *pSkipList, void *pData, SSkipListNode **direction, bool isForward,
                                        bool hasDup) {
   uint8_t        dupMode = SL_DUP_MODE(pSkipList);
   SSkipListNode *pNode = NULL;
 
   if (hasDup && (dupMode != SL_ALLOW_DUP_KEY)) {
-    if (dupMode == SL_UPDATE_DUP_KEY) {
-      if (isForward) {
-        pNode = SL_NODE_GET_FORWARD_POINTER(direction[0], 0);
-      } else {
-        pNode = SL_NODE_GET_BACKWARD_POINTER(direction[0], 0);
-      }
-      if (pSkipList->insertHandleFn) {
-        pSkipList->insertHandleFn->args[0] = pData;
-        pSkipList->insertHandleFn->args[1] = pNode->pData;
-        pData = genericInvoke(pSkipList->insertHandleFn);
-      }
-      if(pData) {
-        atomic_store_ptr(&(pNode->pData), pData);
-      }
+    if (isForward) {
+      pNode = SL_NODE_GET_FORWARD_POINTER(direction[0], 0);
     } else {
-      //for compatiblity, duplicate key inserted when update=0 should be also calculated as affected rows!
-      if(pSkipList->insertHandleFn) {
-        pSkipList->insertHandleFn->args[0] = NULL;
-        pSkipList->insertHandleFn->args[1] = NULL;
-        genericInvoke(pSkipList->insertHandleFn);
-      }
+      pNode = SL_NODE_GET_BACKWARD_POINTER(direction[0], 0);
     }
+    pNode = tSkipListUpdateDupNode(pSkipList, pNode, pData);
   } else {
-    pNode = tSkipListNewNode(getSkipListRandLevel(pSkipList));
+    pNode = tSkipListAllocNode(pSkipList, getSkipListRandLevel(pSkipList));
     if (pNode != NULL) {
       // insertHandleFn will be assigned only for timeseries data,
       // in which case, pData is pointed to an memory to be freed later;
@@ -724,3 +784,144 @@ static SSkipListNode *tSkipListPutImpl(SSkipList *pSkipList, void *pData, SSkipL
 
   return pNode;
 }
+
+static SSkipListNode *tSkipListUpdateDupNode(SSkipList *pSkipList, SSkipListNode *pNode, void *pData) {
+  if (SL_DUP_MODE(pSkipList) == SL_UPDATE_DUP_KEY) {
+    if (pSkipList->insertHandleFn) {
+      pSkipList->insertHandleFn->args[0] = pData;
+      pSkipList->insertHandleFn->args[1] = pNode->pData;
+      pData = genericInvoke(pSkipList->insertHandleFn);
+    }
+    if (pData) {
+      atomic_store_ptr(&(pNode->pData), pData);
+    }
+    return pNode;
+  }
+
+  // for compatiblity, duplicate key inserted when update=0 should be also calculated as affected rows!
+  if (pSkipList->insertHandleFn) {
+    pSkipList->insertHandleFn->args[0] = NULL;
+    pSkipList->insertHandleFn->args[1] = NULL;
+    genericInvoke(pSkipList->insertHandleFn);
+  }
+  return NULL;
+}
+
+// Find the predecessor and successor of the key on every level, return true if the key already exists, in which
+// case succs[0] is the node with the same key.
+static bool tSkipListGetPosLockFree(SSkipList *pSkipList, const char *pDataKey, SSkipListNode **preds,
+                                    SSkipListNode **succs) {
+  SSkipListNode *pTail = pSkipList->pTail;
+  SSkipListNode *px = pSkipList->pHead;
+  int32_t        i = 0;
+
+  // fast path for in-order data: if the last node on level 0 is smaller than the key, the last node on each upper
+  // level is smaller as well, and the backward hints of the tail are exact as long as they still point to the tail.
+  for (; i < pSkipList->maxLevel; ++i) {
+    SSkipListNode *p = atomic_load_ptr(&SL_NODE_GET_BACKWARD_POINTER(pTail, i));
+    if (atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(p, i)) != pTail) break;
+    if (i == 0 && p != pSkipList->pHead && pSkipList->comparFn(SL_GET_NODE_KEY(pSkipList, p), pDataKey) >= 0) break;
+
+    preds[i] = p;
+    succs[i] = pTail;
+  }
+
+  if (i == pSkipList->maxLevel) {
+    return false;
+  }
+
+  for (i = pSkipList->maxLevel - 1; i >= 0; --i) {
+    SSkipListNode *p = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(px, i));
+    while (p != pTail && pSkipList->comparFn(SL_GET_NODE_KEY(pSkipList, p), pDataKey) < 0) {
+      px = p;
+      p = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(px, i));
+    }
+
+    preds[i] = px;
+    succs[i] = p;
+  }
+
+  return (succs[0] != pTail) && (pSkipList->comparFn(SL_GET_NODE_KEY(pSkipList, succs[0]), pDataKey) == 0);
+}
+
+static SSkipListNode *tSkipListPutLockFree(SSkipList *pSkipList, void *pData) {
+  SSkipListNode *preds[MAX_SKIP_LIST_LEVEL] = {0};
+  SSkipListNode *succs[MAX_SKIP_LIST_LEVEL] = {0};
+  char *         pDataKey = pSkipList->keyFn(pData);
+
+  if (tSkipListGetPosLockFree(pSkipList, pDataKey, preds, succs)) {
+    return tSkipListUpdateDupNode(pSkipList, succs[0], pData);
+  }
+
+  SSkipListNode *pNode = tSkipListAllocNode(pSkipList, getSkipListRandLevel(pSkipList));
+  if (pNode == NULL) return NULL;
+
+  pNode->pData = pData;
+
+  // link level 0 first, after which the node is visible to readers
+  while (1) {
+    for (int32_t i = 0; i < pNode->level; ++i) {
+      SL_NODE_GET_FORWARD_POINTER(pNode, i) = succs[i];
+      SL_NODE_GET_BACKWARD_POINTER(pNode, i) = preds[i];
+    }
+
+    if (atomic_val_compare_exchange_ptr(&SL_NODE_GET_FORWARD_POINTER(preds[0], 0), succs[0], pNode) == succs[0]) {
+      break;
+    }
+
+    // another writer won the race with the same key, handle the data as a duplicated one
+    if (tSkipListGetPosLockFree(pSkipList, pDataKey, preds, succs)) {
+      tSkipListReleaseNode(pSkipList, pNode);
+      return tSkipListUpdateDupNode(pSkipList, succs[0], pData);
+    }
+  }
+  atomic_store_ptr(&SL_NODE_GET_BACKWARD_POINTER(succs[0], 0), pNode);
+
+  // the hook may copy the data or count it, so it runs only once the node is linked
+  if (pSkipList->insertHandleFn) {
+    pSkipList->insertHandleFn->args[0] = pData;
+    pSkipList->insertHandleFn->args[1] = NULL;
+    pData = genericInvoke(pSkipList->insertHandleFn);
+    if (pData) {
+      atomic_store_ptr(&(pNode->pData), pData);
+    }
+  }
+
+  for (int32_t i = 1; i < pNode->level; ++i) {
+    while (1) {
+      atomic_store_ptr(&SL_NODE_GET_FORWARD_POINTER(pNode, i), succs[i]);
+      atomic_store_ptr(&SL_NODE_GET_BACKWARD_POINTER(pNode, i), preds[i]);
+      if (atomic_val_compare_exchange_ptr(&SL_NODE_GET_FORWARD_POINTER(preds[i], i), succs[i], pNode) == succs[i]) {
+        break;
+      }
+
+      // the node itself is found on the lower levels, only the positions on the upper levels matter
+      tSkipListGetPosLockFree(pSkipList, pDataKey, preds, succs);
+    }
+    atomic_store_ptr(&SL_NODE_GET_BACKWARD_POINTER(succs[i], i), pNode);
+  }
+
+  uint8_t level = atomic_load_8(&pSkipList->level);
+  while (level < pNode->level) {
+    uint8_t old = atomic_val_compare_exchange_8(&pSkipList->level, level, pNode->level);
+    if (old == level) break;
+    level = old;
+  }
+
+  atomic_add_fetch_32(&pSkipList->size, 1);
+  return pNode;
+}
+
+// In lock-free mode, the backward pointer is a hint to some predecessor, walk forward on level 0 from it.
+static SSkipListNode *tSkipListGetPrevNode(SSkipList *pSkipList, SSkipListNode *pNode) {
+  if (!SL_IS_LOCK_FREE(pSkipList) || pNode == pSkipList->pHead) {
+    return SL_NODE_GET_BACKWARD_POINTER(pNode, 0);
+  }
+
+  SSkipListNode *p = atomic_load_ptr(&SL_NODE_GET_BACKWARD_POINTER(pNode, 0));
+  while (1) {
+    SSkipListNode *next = atomic_load_ptr(&SL_NODE_GET_FORWARD_POINTER(p, 0));
+    if (next == pNode) return p;
+    p = next;
+  }
+}
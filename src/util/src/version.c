@@ -0,0 +1,7 @@
+char version[12] = "2.7.0.0";
+char compatible_version[12] = "2.0.0.0";
+char gitinfo[48] = "f3e418db51c394b5849f395a3ca88aea88e150be";
+char gitinfoOfInternal[48] = "f3e418db51c394b5849f395a3ca88aea88e150be";
+char buildinfo[64] = "Built at 2026-10-17 13:02:00";
+
+void libtaos_2_7_0_0_Linux_x32_stable() {};
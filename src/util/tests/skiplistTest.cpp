@@ -6,6 +6,7 @@
 
 #include "os.h"
 #include "taosmsg.h"
+#include "tfunctional.h"
 #include "tskiplist.h"
 #include "tutil.h"
 
@@ -377,4 +378,225 @@ TEST(testCase, skiplist_test) {
       free(pKeys);*/
 }
 
-#endif
\ No newline at end of file
+#endif
+
+namespace {
+
+char* getInt64Key(const void* data) { return (char*)(data); }
+
+struct SSkipListPutParam {
+  SSkipList* pSkipList;
+  int64_t*   keys;
+  int32_t    numOfKeys;
+  int32_t    numOfThreads;
+  int32_t    tid;
+};
+
+void* skiplistWriteFn(void* param) {
+  SSkipListPutParam* p = (SSkipListPutParam*)param;
+  for (int32_t i = p->tid; i < p->numOfKeys; i += p->numOfThreads) {
+    tSkipListPut(p->pSkipList, &p->keys[i]);
+  }
+  return NULL;
+}
+
+void* skiplistReadFn(void* param) {
+  SSkipListPutParam* p = (SSkipListPutParam*)param;
+  for (int32_t i = 0; i < 20; ++i) {
+    SSkipListIterator* iter = tSkipListCreateIterFromVal(p->pSkipList, NULL, TSDB_DATA_TYPE_BIGINT,
+                                                         (i % 2 == 0) ? TSDB_ORDER_ASC : TSDB_ORDER_DESC);
+    int64_t prev = (i % 2 == 0) ? INT64_MIN : INT64_MAX;
+    while (tSkipListIterNext(iter)) {
+      int64_t key = *(int64_t*)SL_GET_NODE_KEY(p->pSkipList, tSkipListIterGet(iter));
+      EXPECT_TRUE((i % 2 == 0) ? (key > prev) : (key < prev));
+      prev = key;
+    }
+    tSkipListDestroyIter(iter);
+  }
+  return NULL;
+}
+
+// returns the insert throughput in rows/s, with the same number of reader threads iterating concurrently
+void skiplistConcurrentPut(uint8_t flags, int32_t numOfThreads, int64_t* keys, int32_t numOfKeys) {
+  SSkipList* pSkipList = tSkipListCreate(5, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t),
+                                         getKeyComparFunc(TSDB_DATA_TYPE_BIGINT, TSDB_ORDER_ASC), flags, getInt64Key);
+
+  pthread_t            writers[16], readers[16];
+  SSkipListPutParam  params[16];
+
+  for (int32_t i = 0; i < numOfThreads; ++i) {
+    params[i] = {pSkipList, keys, numOfKeys, numOfThreads, i};
+    pthread_create(&writers[i], NULL, skiplistWriteFn, &params[i]);
+    pthread_create(&readers[i], NULL, skiplistReadFn, &params[i]);
+  }
+
+  for (int32_t i = 0; i < numOfThreads; ++i) {
+    pthread_join(writers[i], NULL);
+  }
+
+  for (int32_t i = 0; i < numOfThreads; ++i) {
+    pthread_join(readers[i], NULL);
+  }
+
+  EXPECT_EQ(SL_SIZE(pSkipList), (uint32_t)numOfKeys);
+
+  int32_t            n = 0;
+  SSkipListIterator* iter = tSkipListCreateIter(pSkipList);
+  while (tSkipListIterNext(iter)) {
+    EXPECT_EQ(*(int64_t*)SL_GET_NODE_KEY(pSkipList, tSkipListIterGet(iter)), n);
+    n++;
+  }
+  tSkipListDestroyIter(iter);
+  EXPECT_EQ(n, numOfKeys);
+
+  tSkipListDestroy(pSkipList);
+}
+
+}  // namespace
+
+TEST(testCase, skiplist_lock_free_test) {
+  const int32_t numOfKeys = 200000;
+  int64_t*      keys = (int64_t*)malloc(sizeof(int64_t) * numOfKeys);
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    keys[i] = i;
+  }
+
+  for (int32_t numOfThreads = 1; numOfThreads <= 8; numOfThreads *= 2) {
+    skiplistConcurrentPut(SL_DISCARD_DUP_KEY | SL_THREAD_SAFE, numOfThreads, keys, numOfKeys);
+    skiplistConcurrentPut(SL_DISCARD_DUP_KEY | SL_LOCK_FREE, numOfThreads, keys, numOfKeys);
+  }
+
+  // out of order and duplicated keys
+  SSkipList* pSkipList = tSkipListCreate(5, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t),
+                                         getKeyComparFunc(TSDB_DATA_TYPE_BIGINT, TSDB_ORDER_ASC),
+                                         SL_UPDATE_DUP_KEY | SL_LOCK_FREE, getInt64Key);
+  for (int32_t i = numOfKeys - 1; i >= 0; i -= 2) {
+    tSkipListPut(pSkipList, &keys[i]);
+  }
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    tSkipListPut(pSkipList, &keys[i]);
+  }
+  ASSERT_EQ(SL_SIZE(pSkipList), (uint32_t)numOfKeys);
+
+  int64_t            val = 1000;
+  SSkipListIterator* iter = tSkipListCreateIterFromVal(pSkipList, (const char*)&val, TSDB_DATA_TYPE_BIGINT, TSDB_ORDER_DESC);
+  int64_t            expect = val;
+  while (tSkipListIterNext(iter)) {
+    ASSERT_EQ(*(int64_t*)SL_GET_NODE_KEY(pSkipList, tSkipListIterGet(iter)), expect);
+    expect--;
+  }
+  ASSERT_EQ(expect, -1);
+  tSkipListDestroyIter(iter);
+
+  tSkipListDestroy(pSkipList);
+  free(keys);
+}
+
+namespace {
+
+// counts the new rows in args[2] and the duplicated ones in args[3], like the memtable hook counts points
+void* skiplistCountHook(void** args) {
+  if (args[1] == NULL && args[0] != NULL) {
+    (*(int32_t*)args[2])++;
+  } else {
+    (*(int32_t*)args[3])++;
+  }
+  return args[0];
+}
+
+}  // namespace
+
+// the insert hook is invoked once per linked node, and never for the node given up on a duplicated key
+TEST(testCase, skiplist_lock_free_hook_test) {
+  const int32_t numOfKeys = 10000;
+  int64_t*      keys = (int64_t*)malloc(sizeof(int64_t) * numOfKeys);
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    keys[i] = i;
+  }
+
+  SSkipList* pSkipList = tSkipListCreate(5, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t),
+                                         getKeyComparFunc(TSDB_DATA_TYPE_BIGINT, TSDB_ORDER_ASC),
+                                         SL_UPDATE_DUP_KEY | SL_LOCK_FREE, getInt64Key);
+  int32_t numOfNew = 0, numOfDup = 0;
+  pSkipList->insertHandleFn = genericSavedFuncInit((GenericVaFunc)skiplistCountHook, 4);
+  pSkipList->insertHandleFn->args[2] = &numOfNew;
+  pSkipList->insertHandleFn->args[3] = &numOfDup;
+
+  for (int32_t i = numOfKeys - 1; i >= 0; i -= 2) {
+    tSkipListPut(pSkipList, &keys[i]);
+  }
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    tSkipListPut(pSkipList, &keys[i]);
+  }
+
+  ASSERT_EQ(SL_SIZE(pSkipList), (uint32_t)numOfKeys);
+  EXPECT_EQ(numOfNew, numOfKeys);
+  EXPECT_EQ(numOfDup, numOfKeys / 2);
+
+  SSkipListIterator* iter = tSkipListCreateIter(pSkipList);
+  int64_t            expect = 0;
+  while (tSkipListIterNext(iter)) {
+    SSkipListNode* pNode = tSkipListIterGet(iter);
+    ASSERT_EQ(pNode->pData, (void*)&keys[expect]);
+    expect++;
+  }
+  EXPECT_EQ(expect, numOfKeys);
+  tSkipListDestroyIter(iter);
+
+  tSkipListDestroy(pSkipList);
+  free(keys);
+}
+
+namespace {
+
+struct SBumpPool {
+  char*   buf;
+  int32_t offset;
+  int32_t size;
+};
+
+void* bumpPoolAlloc(void* param, int32_t size) {
+  SBumpPool* pPool = (SBumpPool*)param;
+  size = ALIGN8(size);
+  if (pPool->offset + size > pPool->size) return NULL;
+
+  void* p = pPool->buf + pPool->offset;
+  pPool->offset += size;
+  return p;
+}
+
+}  // namespace
+
+TEST(testCase, skiplist_node_allocator_test) {
+  const int32_t numOfKeys = 10000;
+  int64_t*      keys = (int64_t*)malloc(sizeof(int64_t) * numOfKeys);
+  SBumpPool     pool = {(char*)malloc(4 * 1024 * 1024), 0, 4 * 1024 * 1024};
+
+  SSkipList* pSkipList = tSkipListCreate(5, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t),
+                                         getKeyComparFunc(TSDB_DATA_TYPE_BIGINT, TSDB_ORDER_ASC),
+                                         SL_DISCARD_DUP_KEY | SL_LOCK_FREE, getInt64Key);
+  tSkipListSetNodeAllocator(pSkipList, bumpPoolAlloc, &pool);
+
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    keys[i] = (i * 7919) % numOfKeys;
+    tSkipListPut(pSkipList, &keys[i]);
+  }
+  ASSERT_EQ(SL_SIZE(pSkipList), (uint32_t)numOfKeys);
+  ASSERT_GT(pool.offset, 0);
+
+  int64_t            expect = 0;
+  SSkipListIterator* iter = tSkipListCreateIter(pSkipList);
+  while (tSkipListIterNext(iter)) {
+    SSkipListNode* pNode = tSkipListIterGet(iter);
+    ASSERT_TRUE((char*)pNode >= pool.buf && (char*)pNode < pool.buf + pool.offset);
+    ASSERT_EQ(*(int64_t*)SL_GET_NODE_KEY(pSkipList, pNode), expect);
+    expect++;
+  }
+  tSkipListDestroyIter(iter);
+  ASSERT_EQ(expect, numOfKeys);
+
+  // nodes are not freed by the skip list
+  tSkipListDestroy(pSkipList);
+  free(pool.buf);
+  free(keys);
+}
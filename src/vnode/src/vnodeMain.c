@@ -360,6 +360,8 @@ int32_t vnodeOpen(int32_t vgId) {
 
   sprintf(temp, "%s/wal", walRootDir);
   pVnode->walCfg.vgId = pVnode->vgId;
+  pVnode->walCfg.groupCommit = tsWalGroupCommit;
+  pVnode->walCfg.preallocSize = tsWalPreallocSize;
   pVnode->wal = walOpen(temp, &pVnode->walCfg);
   if (pVnode->wal == NULL) { 
     vnodeCleanUp(pVnode);
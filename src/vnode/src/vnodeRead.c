@@ -33,10 +33,10 @@ static int32_t  vnodeNotifyCurrentQhandle(void* handle, uint64_t qId, void* qhan
 int32_t vnodeInitRead(void) {
   vnodeProcessReadMsgFp[TSDB_MSG_TYPE_QUERY] = vnodeProcessQueryMsg;
   vnodeProcessReadMsgFp[TSDB_MSG_TYPE_FETCH] = vnodeProcessFetchMsg;
-  return 0;
+  return qInitQueryPartitionPool();
 }
 
-void vnodeCleanupRead() {}
+void vnodeCleanupRead() { qCleanupQueryPartitionPool(); }
 
 //
 // After the fetch request enters the vnode queue, if the vnode cannot provide services, the process function are
@@ -39,6 +39,9 @@ extern int32_t wDebugFlag;
 #define WAL_PATH_LEN   (TSDB_FILENAME_LEN + 12)
 #define WAL_FILE_LEN   (WAL_PATH_LEN + 32)
 #define WAL_FILE_NUM   1 // 3
+#define WAL_GROUP_SIZE (4 * 1024 * 1024)  // flush the group commit buffer once it holds so many bytes
+#define WAL_SPARE      "spare"            // recycled wal file, must not start with WAL_PREFIX
+#define WAL_SPARE_TMP  "spare.tmp"
 
 typedef struct {
   uint64_t version;
@@ -51,15 +54,24 @@ typedef struct {
   int32_t  fsyncPeriod;
   int32_t  fsyncSeq;
   int8_t   stop;
-  int8_t   reserved[3];
+  int8_t   groupCommit;
+  int8_t   recycle;   // an old wal file is moved aside as WAL_SPARE_TMP, to be zero filled by the wal thread
+  int8_t   reserved[1];
+  int32_t  groupLen;  // bytes buffered in pGroup
+  int32_t  groupCap;
+  char *   pGroup;    // records written but not yet flushed to the file in group commit mode
+  int64_t  preallocSize;
+  int64_t  offset;    // end of the records in the current file, the file may be longer if preallocated
   char     path[WAL_PATH_LEN];
   char     name[WAL_FILE_LEN];
   pthread_mutex_t mutex;
 } SWal;
 
 int32_t walGetNextFile(SWal *pWal, int64_t *nextFileId);
+int32_t walFlushGroup(SWal *pWal);
 int32_t walGetOldFile(SWal *pWal, int64_t curFileId, int32_t minDiff, int64_t *oldFileId);
 int32_t walGetNewFile(SWal *pWal, int64_t *newFileId);
+void    walRecycleFile(SWal *pWal);
 
 #ifdef __cplusplus
 }
@@ -75,6 +75,9 @@ void *walOpen(char *path, SWalCfg *pCfg) {
   pWal->level = pCfg->walLevel;
   pWal->keep = pCfg->keep;
   pWal->fsyncPeriod = pCfg->fsyncPeriod;
+  pWal->groupCommit = pCfg->groupCommit;
+  // the kept wal file is reopened in append mode, so it can not be preallocated
+  if (pCfg->keep != TAOS_WAL_KEEP) pWal->preallocSize = (int64_t)pCfg->preallocSize * 1024 * 1024;
   tstrncpy(pWal->path, path, sizeof(pWal->path));
   pthread_mutex_init(&pWal->mutex, NULL);
 
@@ -92,7 +95,8 @@ void *walOpen(char *path, SWalCfg *pCfg) {
     return NULL;
   }
 
-  wDebug("vgId:%d, wal:%p is opened, level:%d fsyncPeriod:%d", pWal->vgId, pWal, pWal->level, pWal->fsyncPeriod);
+  wDebug("vgId:%d, wal:%p is opened, level:%d fsyncPeriod:%d groupCommit:%d", pWal->vgId, pWal, pWal->level,
+         pWal->fsyncPeriod, pWal->groupCommit);
 
   return pWal;
 }
@@ -133,17 +137,45 @@ void walClose(void *handle) {
 
   SWal *pWal = handle;
   pthread_mutex_lock(&pWal->mutex);
+  walFlushGroup(pWal);
   tfClose(pWal->tfd);
   pthread_mutex_unlock(&pWal->mutex);
   taosRemoveRef(tsWal.refId, pWal->rid);
 }
 
+// a wal file moved aside but not zero filled before the last stop is dropped, and so is a spare file that can not be
+// reused: it is kept only if it is zero filled up to the preallocated size
+static void walCheckSpareFile(SWal *pWal) {
+  char name[WAL_FILE_LEN];
+  snprintf(name, sizeof(name), "%s/%s", pWal->path, WAL_SPARE_TMP);
+  if (remove(name) == 0) {
+    wInfo("vgId:%d, file:%s, it is not recycled and removed", pWal->vgId, name);
+  }
+
+  snprintf(name, sizeof(name), "%s/%s", pWal->path, WAL_SPARE);
+  int64_t tfd = tfOpen(name, O_RDONLY);
+  if (!tfValid(tfd)) return;
+
+  struct stat fstat;
+  SWalHead    head;
+  bool        valid = (pWal->preallocSize > 0) && (tfStat(tfd, &fstat) == 0) && (fstat.st_size >= pWal->preallocSize) &&
+               (tfRead(tfd, &head, sizeof(SWalHead)) == sizeof(SWalHead)) && (head.signature == 0);
+  tfClose(tfd);
+
+  if (!valid) {
+    remove(name);
+    wInfo("vgId:%d, file:%s, it can not be reused and is removed", pWal->vgId, name);
+  }
+}
+
 static int32_t walInitObj(SWal *pWal) {
   if (taosMkdirP(pWal->path, 1) != 0) {
     wError("vgId:%d, path:%s, failed to create directory since %s", pWal->vgId, pWal->path, strerror(errno));
     return TAOS_SYSTEM_ERROR(errno);
   }
 
+  walCheckSpareFile(pWal);
+
   wDebug("vgId:%d, object is initialized", pWal->vgId);
   return TSDB_CODE_SUCCESS;
 }
@@ -154,6 +186,7 @@ static void walFreeObj(void *wal) {
 
   tfClose(pWal->tfd);
   pthread_mutex_destroy(&pWal->mutex);
+  tfree(pWal->pGroup);
   tfree(pWal);
 }
 
@@ -190,12 +223,23 @@ static void walFsyncAll() {
   }
 }
 
+static void walRecycleAll() {
+  SWal *pWal = taosIterateRef(tsWal.refId, 0);
+  while (pWal) {
+    if (atomic_load_8(&pWal->recycle)) {
+      walRecycleFile(pWal);
+    }
+    pWal = taosIterateRef(tsWal.refId, pWal->rid);
+  }
+}
+
 static void *walThreadFunc(void *param) {
   int stop = 0;
   setThreadName("wal");
   while (1) {
     walUpdateSeq();
     walFsyncAll();
+    walRecycleAll();
 
     pthread_mutex_lock(&tsWal.mutex);
     stop = tsWal.stop;
@@ -25,6 +25,72 @@
 
 static int32_t walRestoreWalFile(SWal *pWal, void *pVnode, FWalWrite writeFp, char *name, int64_t fileId);
 
+static int64_t walOpenNewFile(SWal *pWal) {
+  bool reused = false;
+  if (pWal->preallocSize > 0) {
+    char spare[WAL_FILE_LEN];
+    snprintf(spare, sizeof(spare), "%s/%s", pWal->path, WAL_SPARE);
+    reused = (rename(spare, pWal->name) == 0);
+  }
+
+  int64_t tfd = tfOpenM(pWal->name, O_WRONLY | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  if (!tfValid(tfd) || pWal->preallocSize <= 0) return tfd;
+
+  if (reused) {
+    wDebug("vgId:%d, file:%s, it is recycled from spare", pWal->vgId, pWal->name);
+  } else if (tfFallocate(tfd, 0, pWal->preallocSize) != 0) {
+    wWarn("vgId:%d, file:%s, failed to preallocate %" PRId64 " bytes since %s", pWal->vgId, pWal->name,
+          pWal->preallocSize, strerror(errno));
+  }
+
+  return tfd;
+}
+
+// zero fill the wal file moved aside by walRemoveOneOldFile and keep it as the spare file for the next walRenew,
+// it runs in the wal thread so that neither the writes nor the commit wait for it
+void walRecycleFile(SWal *pWal) {
+  char name[WAL_FILE_LEN];
+  char spare[WAL_FILE_LEN];
+  snprintf(name, sizeof(name), "%s/%s", pWal->path, WAL_SPARE_TMP);
+  snprintf(spare, sizeof(spare), "%s/%s", pWal->path, WAL_SPARE);
+
+  int64_t tfd = tfOpen(name, O_WRONLY);
+  int32_t code = tfValid(tfd) ? 0 : -1;
+  int64_t size = pWal->preallocSize;
+  char *  buf = NULL;
+
+  if (code == 0) {
+    struct stat fstat;
+    if (tfStat(tfd, &fstat) == 0 && fstat.st_size > size) size = fstat.st_size;
+
+    int32_t bufLen = 1024 * 1024;
+    buf = calloc(1, bufLen);
+    if (buf == NULL) code = -1;
+
+    for (int64_t offset = 0; code == 0 && offset < size; offset += bufLen) {
+      int64_t len = MIN(bufLen, size - offset);
+      if (tfWrite(tfd, buf, len) != len) code = -1;
+    }
+    if (code == 0) code = tfFsync(tfd);
+
+    tfree(buf);
+    tfClose(tfd);
+  }
+
+  pthread_mutex_lock(&pWal->mutex);
+  if (code != 0) {
+    wError("vgId:%d, file:%s, failed to zero fill for recycle since %s", pWal->vgId, name, strerror(errno));
+    remove(name);
+  } else if (rename(name, spare) < 0) {
+    wError("vgId:%d, file:%s, failed to rename to %s since %s", pWal->vgId, name, spare, strerror(errno));
+    remove(name);
+  } else {
+    wInfo("vgId:%d, wal file of %" PRId64 " bytes is zero filled and kept as spare", pWal->vgId, size);
+  }
+  pWal->recycle = 0;
+  pthread_mutex_unlock(&pWal->mutex);
+}
+
 int32_t walRenew(void *handle) {
   if (handle == NULL) return 0;
 
@@ -39,6 +105,9 @@ int32_t walRenew(void *handle) {
   pthread_mutex_lock(&pWal->mutex);
 
   if (tfValid(pWal->tfd)) {
+    walFlushGroup(pWal);
+    // drop the unused preallocated space, a closed wal file ends at its last record
+    if (pWal->preallocSize > 0) tfFtruncate(pWal->tfd, pWal->offset);
     tfClose(pWal->tfd);
     wDebug("vgId:%d, file:%s, it is closed while renew", pWal->vgId, pWal->name);
   }
@@ -51,7 +120,8 @@ int32_t walRenew(void *handle) {
   }
 
   snprintf(pWal->name, sizeof(pWal->name), "%s/%s%" PRId64, pWal->path, WAL_PREFIX, pWal->fileId);
-  pWal->tfd = tfOpenM(pWal->name, O_WRONLY | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  pWal->tfd = walOpenNewFile(pWal);
+  pWal->offset = 0;
 
   if (!tfValid(pWal->tfd)) {
     code = TAOS_SYSTEM_ERROR(errno);
@@ -73,13 +143,26 @@ void walRemoveOneOldFile(void *handle) {
 
   pthread_mutex_lock(&pWal->mutex);
 
-  // remove the oldest wal file
+  // remove the oldest wal file, or move it aside to be recycled if there is no spare file yet
   int64_t oldFileId = -1;
   if (walGetOldFile(pWal, pWal->fileId, WAL_FILE_NUM, &oldFileId) == 0) {
     char walName[WAL_FILE_LEN] = {0};
     snprintf(walName, sizeof(walName), "%s/%s%" PRId64, pWal->path, WAL_PREFIX, oldFileId);
 
-    if (remove(walName) < 0) {
+    // the file is zero filled later by the wal thread, see walRecycleFile
+    bool recycle = false;
+    if (pWal->preallocSize > 0 && !pWal->recycle) {
+      char spare[WAL_FILE_LEN];
+      char tmpName[WAL_FILE_LEN];
+      snprintf(spare, sizeof(spare), "%s/%s", pWal->path, WAL_SPARE);
+      snprintf(tmpName, sizeof(tmpName), "%s/%s", pWal->path, WAL_SPARE_TMP);
+      recycle = (access(spare, F_OK) != 0 && rename(walName, tmpName) == 0);
+    }
+
+    if (recycle) {
+      pWal->recycle = 1;
+      wInfo("vgId:%d, file:%s, it is moved aside to be recycled", pWal->vgId, walName);
+    } else if (remove(walName) < 0) {
       wError("vgId:%d, file:%s, failed to remove since %s", pWal->vgId, walName, strerror(errno));
     } else {
       wInfo("vgId:%d, file:%s, it is removed", pWal->vgId, walName);
@@ -97,6 +180,7 @@ void walRemoveAllOldFiles(void *handle) {
 
   pthread_mutex_lock(&pWal->mutex);
   
+  walFlushGroup(pWal);
   tfClose(pWal->tfd);
   wDebug("vgId:%d, file:%s, it is closed before remove all wals", pWal->vgId, pWal->name);
 
@@ -134,6 +218,47 @@ static int walValidateChecksum(SWalHead *pHead) {
 
 #endif
 
+int32_t walFlushGroup(SWal *pWal) {
+  if (pWal->groupLen <= 0) return 0;
+
+  int32_t code = 0;
+  int32_t len = pWal->groupLen;
+  pWal->groupLen = 0;
+
+  if (tfWrite(pWal->tfd, pWal->pGroup, len) != len) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    wError("vgId:%d, file:%s, failed to write group of %d bytes since %s", pWal->vgId, pWal->name, len,
+           strerror(errno));
+  } else {
+    wTrace("vgId:%d, write wal group, fileId:%" PRId64 " tfd:%" PRId64 " len:%d", pWal->vgId, pWal->fileId, pWal->tfd,
+           len);
+    pWal->offset += len;
+  }
+
+  return code;
+}
+
+static int32_t walAppendGroup(SWal *pWal, SWalHead *pHead, int32_t contLen) {
+  if (pWal->groupLen + contLen > pWal->groupCap) {
+    int32_t code = walFlushGroup(pWal);
+    if (code != 0) return code;
+
+    if (contLen > pWal->groupCap) {
+      int32_t cap = MAX(contLen, WAL_GROUP_SIZE);
+      char *  pGroup = realloc(pWal->pGroup, cap);
+      if (pGroup == NULL) return TSDB_CODE_COM_OUT_OF_MEMORY;
+
+      pWal->pGroup = pGroup;
+      pWal->groupCap = cap;
+    }
+  }
+
+  memcpy(pWal->pGroup + pWal->groupLen, pHead, contLen);
+  pWal->groupLen += contLen;
+
+  return 0;
+}
+
 int32_t walWrite(void *handle, SWalHead *pHead) {
   if (handle == NULL) return -1;
 
@@ -157,13 +282,21 @@ int32_t walWrite(void *handle, SWalHead *pHead) {
 
   pthread_mutex_lock(&pWal->mutex);
 
-  if (tfWrite(pWal->tfd, pHead, contLen) != contLen) {
+  if (pWal->groupCommit) {
+    code = walAppendGroup(pWal, pHead, contLen);
+    if (code == 0) {
+      wTrace("vgId:%d, append wal to group, fileId:%" PRId64 " hver:%" PRId64 " wver:%" PRIu64 " len:%d glen:%d",
+             pWal->vgId, pWal->fileId, pHead->version, pWal->version, pHead->len, pWal->groupLen);
+      pWal->version = pHead->version;
+    }
+  } else if (tfWrite(pWal->tfd, pHead, contLen) != contLen) {
     code = TAOS_SYSTEM_ERROR(errno);
     wError("vgId:%d, file:%s, failed to write since %s", pWal->vgId, pWal->name, strerror(errno));
   } else {
     wTrace("vgId:%d, write wal, fileId:%" PRId64 " tfd:%" PRId64 " hver:%" PRId64 " wver:%" PRIu64 " len:%d", pWal->vgId,
            pWal->fileId, pWal->tfd, pHead->version, pWal->version, pHead->len);
     pWal->version = pHead->version;
+    pWal->offset += contLen;
   }
 
   pthread_mutex_unlock(&pWal->mutex);
@@ -173,16 +306,26 @@ int32_t walWrite(void *handle, SWalHead *pHead) {
   return code;
 }
 
-void walFsync(void *handle, bool forceFsync) {
-  SWal *pWal = handle;
-  if (pWal == NULL || !tfValid(pWal->tfd)) return;
+int32_t walFsync(void *handle, bool forceFsync) {
+  SWal *  pWal = handle;
+  int32_t code = 0;
+  if (pWal == NULL || !tfValid(pWal->tfd)) return code;
+
+  if (pWal->groupCommit) {
+    pthread_mutex_lock(&pWal->mutex);
+    code = walFlushGroup(pWal);
+    pthread_mutex_unlock(&pWal->mutex);
+  }
 
   if (forceFsync || (pWal->level == TAOS_WAL_FSYNC && pWal->fsyncPeriod == 0)) {
     wTrace("vgId:%d, fileId:%" PRId64 ", do fsync", pWal->vgId, pWal->fileId);
     if (tfFsync(pWal->tfd) < 0) {
       wError("vgId:%d, fileId:%" PRId64 ", fsync failed since %s", pWal->vgId, pWal->fileId, strerror(errno));
+      if (code == 0) code = TAOS_SYSTEM_ERROR(errno);
     }
   }
+
+  return code;
 }
 
 int32_t walRestore(void *handle, void *pVnode, FWalWrite writeFp) {
@@ -239,6 +382,9 @@ int32_t walGetWalFile(void *handle, char *fileName, int64_t *fileId) {
 
   pthread_mutex_lock(&(pWal->mutex));
 
+  // the records of the current file must be visible to the reader
+  walFlushGroup(pWal);
+
   int32_t code = walGetNextFile(pWal, fileId);
   if (code >= 0) {
     sprintf(fileName, "wal/%s%" PRId64, WAL_PREFIX, *fileId);
@@ -257,6 +403,9 @@ static void walFtruncate(SWal *pWal, int64_t tfd, int64_t offset) {
 }
 
 static int32_t walSkipCorruptedRecord(SWal *pWal, SWalHead *pHead, int64_t tfd, int64_t *offset) {
+  // the records of a preallocated file are written one after another, the first corrupted one ends the file
+  if (pWal->preallocSize > 0) return TSDB_CODE_WAL_FILE_CORRUPTED;
+
   int64_t pos = *offset;
   while (1) {
     pos++;
@@ -436,7 +585,9 @@ static int32_t walRestoreWalFile(SWal *pWal, void *pVnode, FWalWrite writeFp, ch
 
   int32_t   code = TSDB_CODE_SUCCESS;
   int64_t   offset = 0;
+  uint64_t  lastVer = 0;
   SWalHead *pHead = buffer;
+  SWalHead  zeroHead = {0};
 
   while (1) {
     int32_t ret = (int32_t)tfRead(tfd, pHead, sizeof(SWalHead));
@@ -454,6 +605,12 @@ static int32_t walRestoreWalFile(SWal *pWal, void *pVnode, FWalWrite writeFp, ch
       break;
     }
 
+    // a preallocated or recycled wal file is zero filled beyond its last record
+    if (memcmp(pHead, &zeroHead, sizeof(SWalHead)) == 0) {
+      wDebug("vgId:%d, file:%s, end of records at offset:%" PRId64, pWal->vgId, name, offset);
+      break;
+    }
+
 #if defined(WAL_CHECKSUM_WHOLE)
     if ((pHead->sver == 0 && !walValidateChecksum(pHead)) || pHead->sver < 0 || pHead->sver > 2) {
       wError("vgId:%d, file:%s, wal head cksum is messed up, hver:%" PRIu64 " len:%d offset:%" PRId64, pWal->vgId, name,
@@ -538,6 +695,13 @@ static int32_t walRestoreWalFile(SWal *pWal, void *pVnode, FWalWrite writeFp, ch
     wTrace("vgId:%d, restore wal, fileId:%" PRId64 " hver:%" PRIu64 " wver:%" PRIu64 " len:%d offset:%" PRId64,
            pWal->vgId, fileId, pHead->version, pWal->version, pHead->len, offset);
 
+    if (pWal->preallocSize > 0 && pHead->version <= lastVer) {
+      wInfo("vgId:%d, file:%s, end of records at hver:%" PRIu64 " lastver:%" PRIu64, pWal->vgId, name, pHead->version,
+            lastVer);
+      break;
+    }
+    lastVer = pHead->version;
+
     pWal->version = pHead->version;
 
     // wInfo("writeFp: %ld", offset);
@@ -582,8 +746,9 @@ int64_t walGetFSize(twalh handle) {
   SWal *pWal = handle;
   if (pWal == NULL) return 0;
   struct stat _fstat;
+  if (pWal->preallocSize > 0) return pWal->offset + pWal->groupLen;
   if (tfStat(pWal->tfd, &_fstat) == 0) {
-    return _fstat.st_size;
+    return _fstat.st_size + pWal->groupLen;
   };
   return 0;
 }
\ No newline at end of file
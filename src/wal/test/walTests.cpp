@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <iostream>
+#include <vector>
+
+#include "os.h"
+#include "taoserror.h"
+#include "tfile.h"
+#include "twal.h"
+
+namespace {
+
+const char* walPath = "/tmp/walTests";
+
+struct SRestored {
+  std::vector<uint64_t> versions;
+  int32_t               numOfCorrupted;
+};
+
+// the content of a record is its version repeated, so a record restored from a wrong offset is detected
+SWalHead* createHead(uint64_t version, int32_t len) {
+  SWalHead* pHead = (SWalHead*)calloc(1, sizeof(SWalHead) + len);
+  pHead->msgType = 0;
+  pHead->version = version;
+  pHead->len = len;
+  for (int32_t i = 0; i < len; ++i) {
+    pHead->cont[i] = (char)(version + i);
+  }
+
+  return pHead;
+}
+
+void writeRecords(twalh pWal, uint64_t* version, int32_t numOfRecords, int32_t len) {
+  for (int32_t i = 0; i < numOfRecords; ++i) {
+    *version += 1;
+    SWalHead* pHead = createHead(*version, len + i % 7);
+    ASSERT_EQ(walWrite(pWal, pHead), 0);
+    free(pHead);
+  }
+}
+
+int32_t restoreRecord(void* ahandle, void* data, int32_t qtype, void* pMsg) {
+  SRestored* pRestored = (SRestored*)ahandle;
+  SWalHead*  pHead = (SWalHead*)data;
+
+  for (int32_t i = 0; i < pHead->len; ++i) {
+    if (pHead->cont[i] != (char)(pHead->version + i)) {
+      pRestored->numOfCorrupted += 1;
+      break;
+    }
+  }
+
+  pRestored->versions.push_back(pHead->version);
+  return 0;
+}
+
+// reopen the wal as a restarted vnode does, and check that the versions are restored in order and without a gap
+void checkRestored(SWalCfg* pCfg, uint64_t firstVersion, uint64_t lastVersion) {
+  twalh pWal = walOpen((char*)walPath, pCfg);
+  ASSERT_NE(pWal, (twalh)NULL);
+
+  SRestored restored = {};
+  ASSERT_EQ(walRestore(pWal, &restored, restoreRecord), 0);
+  walClose(pWal);
+
+  EXPECT_EQ(restored.numOfCorrupted, 0);
+  ASSERT_EQ(restored.versions.size(), lastVersion - firstVersion + 1);
+  for (size_t i = 0; i < restored.versions.size(); ++i) {
+    ASSERT_EQ(restored.versions[i], firstVersion + i);
+  }
+}
+
+int64_t getFileSize(const char* name) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s", walPath, name);
+
+  struct stat fstat;
+  if (stat(path, &fstat) != 0) {
+    return -1;
+  }
+
+  return fstat.st_size;
+}
+
+SWalCfg getCfg(int8_t groupCommit, int32_t preallocSize) {
+  SWalCfg cfg = {0};
+  cfg.vgId = 1;
+  cfg.fsyncPeriod = 0;
+  cfg.walLevel = TAOS_WAL_FSYNC;
+  cfg.keep = TAOS_WAL_NOT_KEEP;
+  cfg.groupCommit = groupCommit;
+  cfg.preallocSize = preallocSize;
+  return cfg;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+
+  tfInit();
+  walInit();
+  int ret = RUN_ALL_TESTS();
+  walCleanUp();
+  tfCleanup();
+
+  return ret;
+}
+
+// the records are buffered until walFsync, or until the buffer is full, and each is restored once in order
+TEST(testCase, walGroupCommitTest) {
+  taosRemoveDir((char*)walPath);
+
+  SWalCfg  cfg = getCfg(1, 0);
+  uint64_t version = 0;
+  twalh    pWal = walOpen((char*)walPath, &cfg);
+  ASSERT_NE(pWal, (twalh)NULL);
+  ASSERT_EQ(walRenew(pWal), 0);
+
+  writeRecords(pWal, &version, 100, 100);
+  EXPECT_EQ(getFileSize("wal1"), 0);
+  int64_t size = walGetFSize(pWal);
+  EXPECT_GT(size, 100 * 100);
+
+  ASSERT_EQ(walFsync(pWal, false), 0);
+  EXPECT_EQ(getFileSize("wal1"), size);
+  EXPECT_EQ(walGetFSize(pWal), size);
+
+  // more than the buffer of a group, the records are written before walFsync
+  writeRecords(pWal, &version, 100, 64 * 1024);
+  EXPECT_GT(getFileSize("wal1"), size);
+  EXPECT_LT(getFileSize("wal1"), walGetFSize(pWal));
+
+  ASSERT_EQ(walFsync(pWal, false), 0);
+  EXPECT_EQ(getFileSize("wal1"), walGetFSize(pWal));
+
+  // the buffered records are written before the file is renewed, and before it is closed
+  writeRecords(pWal, &version, 10, 100);
+  ASSERT_EQ(walRenew(pWal), 0);
+  writeRecords(pWal, &version, 10, 100);
+  walClose(pWal);
+
+  EXPECT_GT(getFileSize("wal2"), 10 * 100);
+  checkRestored(&cfg, 1, version);
+}
+
+// an old record is not written again
+TEST(testCase, walGroupCommitVersionTest) {
+  taosRemoveDir((char*)walPath);
+
+  SWalCfg  cfg = getCfg(1, 0);
+  uint64_t version = 0;
+  twalh    pWal = walOpen((char*)walPath, &cfg);
+  ASSERT_NE(pWal, (twalh)NULL);
+  ASSERT_EQ(walRenew(pWal), 0);
+
+  writeRecords(pWal, &version, 10, 100);
+  EXPECT_EQ(walGetVersion(pWal), version);
+
+  SWalHead* pHead = createHead(5, 100);
+  ASSERT_EQ(walWrite(pWal, pHead), 0);
+  free(pHead);
+
+  ASSERT_EQ(walFsync(pWal, true), 0);
+  walClose(pWal);
+
+  checkRestored(&cfg, 1, version);
+}
+
+// a preallocated file is truncated to its records when renewed, and an old file is zero filled and reused by the next
+// renew, the zero filled tail ends the records when restored
+TEST(testCase, walPreallocTest) {
+  taosRemoveDir((char*)walPath);
+
+  const int64_t preallocSize = 1024 * 1024;
+  SWalCfg       cfg = getCfg(0, 1);
+  uint64_t      version = 0;
+  twalh         pWal = walOpen((char*)walPath, &cfg);
+  ASSERT_NE(pWal, (twalh)NULL);
+  ASSERT_EQ(walRenew(pWal), 0);
+  EXPECT_EQ(getFileSize("wal1"), preallocSize);
+
+  writeRecords(pWal, &version, 100, 100);
+  int64_t size = walGetFSize(pWal);
+  EXPECT_GT(size, 100 * 100);
+  EXPECT_LT(size, preallocSize);
+  EXPECT_EQ(getFileSize("wal1"), preallocSize);
+
+  ASSERT_EQ(walRenew(pWal), 0);
+  EXPECT_EQ(getFileSize("wal1"), size);
+  EXPECT_EQ(getFileSize("wal2"), preallocSize);
+  writeRecords(pWal, &version, 100, 100);
+
+  // the old file is moved aside, and kept as the spare file once zero filled by the wal thread
+  walRemoveOneOldFile(pWal);
+  EXPECT_EQ(getFileSize("wal1"), -1);
+  for (int32_t i = 0; i < 30 && getFileSize("spare") < 0; ++i) {
+    taosMsleep(100);
+  }
+  ASSERT_EQ(getFileSize("spare"), preallocSize);
+  EXPECT_EQ(getFileSize("spare.tmp"), -1);
+
+  char path[256];
+  snprintf(path, sizeof(path), "%s/spare", walPath);
+  FILE* fp = fopen(path, "r");
+  ASSERT_NE(fp, (FILE*)NULL);
+  int64_t numOfZeros = 0;
+  int     c;
+  while ((c = fgetc(fp)) == 0) {
+    numOfZeros++;
+  }
+  fclose(fp);
+  EXPECT_EQ(numOfZeros, preallocSize);
+
+  // the spare file is renamed to the new file instead of preallocating one
+  ASSERT_EQ(walRenew(pWal), 0);
+  EXPECT_EQ(getFileSize("spare"), -1);
+  EXPECT_EQ(getFileSize("wal3"), preallocSize);
+  uint64_t firstVersion = version + 1;
+  writeRecords(pWal, &version, 100, 100);
+
+  walRemoveOneOldFile(pWal);
+  EXPECT_EQ(getFileSize("wal2"), -1);
+  for (int32_t i = 0; i < 30 && getFileSize("spare") < 0; ++i) {
+    taosMsleep(100);
+  }
+  EXPECT_EQ(getFileSize("spare"), preallocSize);
+  walClose(pWal);
+
+  // only the records of the current file are restored, and a file moved aside but not zero filled before the stop is
+  // removed when reopened, the spare file is kept
+  snprintf(path, sizeof(path), "%s/spare.tmp", walPath);
+  fp = fopen(path, "w");
+  ASSERT_NE(fp, (FILE*)NULL);
+  fputs("wal", fp);
+  fclose(fp);
+
+  checkRestored(&cfg, firstVersion, version);
+  EXPECT_EQ(getFileSize("spare.tmp"), -1);
+  EXPECT_EQ(getFileSize("spare"), preallocSize);
+}
@@ -0,0 +1,252 @@
+// the order by of an outer query keeps its rows under the sortBufferSize of the client, the rows beyond it are sorted
+// in runs spilled to disk and merged, the results must be the same as sorting all of them in memory
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <taos.h>
+
+#define NUM_OF_ROWS  100000  // about 4MB of rows, several sorted runs of a sort buffer of 1MB
+#define ROWS_PER_SQL 500
+#define NUM_OF_KEYS  50000
+
+static int64_t startTs = 1626006833639;
+
+static void check(int cond, const char *msg) {
+  if (!cond) {
+    printf("\033[31mfailed: %s\033[0m\n", msg);
+    exit(1);
+  }
+
+  printf("\033[32mpassed: %s\033[0m\n", msg);
+}
+
+static void executeSql(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  int       code = taos_errno(res);
+  if (code != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  taos_free_result(res);
+}
+
+static TAOS_RES *query(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  if (taos_errno(res) != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  return res;
+}
+
+// row i: c1 = i * 7919 % 50000, so every key is in two rows far from each other, and null in every thousandth row,
+// c2 = 'k<i * 7919 % 100003>' zero padded, so the strings are ordered as their numbers
+static int isNullRow(int i) { return i % 1000 == 999; }
+static int c1Of(int i) { return (int)((int64_t)i * 7919 % NUM_OF_KEYS); }
+static int c2Of(int i) { return (int)((int64_t)i * 7919 % 100003); }
+
+static void prepareData(TAOS *taos) {
+  executeSql(taos, "drop database if exists es_db");
+  executeSql(taos, "create database es_db");
+  executeSql(taos, "use es_db");
+  executeSql(taos, "create table tb (ts timestamp, c1 int, c2 binary(16), c3 double)");
+
+  char *sql = malloc(ROWS_PER_SQL * 96 + 32);
+  for (int i = 0; i < NUM_OF_ROWS; i += ROWS_PER_SQL) {
+    int len = sprintf(sql, "insert into tb values");
+    for (int j = i; j < i + ROWS_PER_SQL; ++j) {
+      if (isNullRow(j)) {
+        len += sprintf(sql + len, " (%" PRId64 ", null, 'k%06d', %d.5)", startTs + j, c2Of(j), j);
+      } else {
+        len += sprintf(sql + len, " (%" PRId64 ", %d, 'k%06d', %d.5)", startTs + j, c1Of(j), c2Of(j), j);
+      }
+    }
+
+    executeSql(taos, sql);
+  }
+
+  free(sql);
+}
+
+static int compareInt(const void *p1, const void *p2) {
+  int v1 = *(const int *)p1, v2 = *(const int *)p2;
+  return (v1 < v2) ? -1 : ((v1 > v2) ? 1 : 0);
+}
+
+// the keys of the rows sorted in memory, the nulls are not included
+static int *sortedKeys(int (*keyOf)(int), int *numOfKeys) {
+  int *keys = malloc(NUM_OF_ROWS * sizeof(int));
+  int  n = 0;
+  for (int i = 0; i < NUM_OF_ROWS; ++i) {
+    if (keyOf == c1Of && isNullRow(i)) continue;
+    keys[n++] = keyOf(i);
+  }
+
+  qsort(keys, (size_t)n, sizeof(int), compareInt);
+  *numOfKeys = n;
+  return keys;
+}
+
+// fetch the rows of (ts, c1, c2) and check that each of them is intact, i.e. its columns are of the same row
+static int fetchRows(TAOS_RES *res, int *c1, int *c1Null, int *c2, int maxRows) {
+  int      numOfRows = 0;
+  int      intact = 1;
+  TAOS_ROW row = NULL;
+  while ((row = taos_fetch_row(res)) != NULL) {
+    int *length = taos_fetch_lengths(res);
+    if (numOfRows >= maxRows) {
+      numOfRows++;
+      continue;
+    }
+
+    int  i = (int)(*(int64_t *)row[0] - startTs);
+    char buf[32] = {0};
+    memcpy(buf, row[2], (size_t)length[2]);
+
+    c1Null[numOfRows] = (row[1] == NULL);
+    c1[numOfRows] = (row[1] == NULL) ? 0 : *(int32_t *)row[1];
+    c2[numOfRows] = atoi(buf + 1);
+
+    if (i < 0 || i >= NUM_OF_ROWS || c1Null[numOfRows] != isNullRow(i) ||
+        (!c1Null[numOfRows] && c1[numOfRows] != c1Of(i)) || c2[numOfRows] != c2Of(i)) {
+      intact = 0;
+    }
+
+    numOfRows++;
+  }
+
+  check(taos_errno(res) == 0, "fetch all the rows");
+  check(intact, "the rows are intact");
+  return numOfRows;
+}
+
+static void orderByInt(TAOS *taos, int asc) {
+  int  numOfKeys = 0;
+  int *keys = sortedKeys(c1Of, &numOfKeys);
+  int *c1 = calloc(NUM_OF_ROWS, sizeof(int));
+  int *c1Null = calloc(NUM_OF_ROWS, sizeof(int));
+  int *c2 = calloc(NUM_OF_ROWS, sizeof(int));
+
+  TAOS_RES *res = query(taos, asc ? "select * from (select ts, c1, c2 from tb) order by c1"
+                                  : "select * from (select ts, c1, c2 from tb) order by c1 desc");
+  int       numOfRows = fetchRows(res, c1, c1Null, c2, NUM_OF_ROWS);
+  taos_free_result(res);
+  check(numOfRows == NUM_OF_ROWS, "all the rows are sorted");
+
+  // the nulls are the least values
+  int numOfNulls = NUM_OF_ROWS - numOfKeys;
+  int nullMatched = 1, keyMatched = 1;
+  for (int k = 0; k < NUM_OF_ROWS; ++k) {
+    int isNull = asc ? (k < numOfNulls) : (k >= numOfKeys);
+    if (c1Null[k] != isNull) {
+      nullMatched = 0;
+    } else if (!isNull && c1[k] != keys[asc ? (k - numOfNulls) : (numOfKeys - 1 - k)]) {
+      keyMatched = 0;
+    }
+  }
+
+  check(nullMatched, asc ? "the nulls are first in ascending order" : "the nulls are last in descending order");
+  check(keyMatched, asc ? "the keys are in ascending order" : "the keys are in descending order");
+
+  free(keys);
+  free(c1);
+  free(c1Null);
+  free(c2);
+}
+
+static void orderByBinary(TAOS *taos) {
+  int  numOfKeys = 0;
+  int *keys = sortedKeys(c2Of, &numOfKeys);
+  int *c1 = calloc(NUM_OF_ROWS, sizeof(int));
+  int *c1Null = calloc(NUM_OF_ROWS, sizeof(int));
+  int *c2 = calloc(NUM_OF_ROWS, sizeof(int));
+
+  TAOS_RES *res = query(taos, "select * from (select ts, c1, c2 from tb) order by c2");
+  int       numOfRows = fetchRows(res, c1, c1Null, c2, NUM_OF_ROWS);
+  taos_free_result(res);
+  check(numOfRows == NUM_OF_ROWS, "all the rows are sorted by a binary column");
+
+  int keyMatched = 1;
+  for (int k = 0; k < NUM_OF_ROWS; ++k) {
+    if (c2[k] != keys[k]) keyMatched = 0;
+  }
+  check(keyMatched, "the binary values are in order");
+
+  free(keys);
+  free(c1);
+  free(c1Null);
+  free(c2);
+}
+
+// a limit with an offset too large for the top n rows in the sort buffer is sorted with the runs as well
+static void orderByLimit(TAOS *taos) {
+  int  numOfKeys = 0;
+  int *keys = sortedKeys(c1Of, &numOfKeys);
+  int  numOfNulls = NUM_OF_ROWS - numOfKeys;
+  int  c1[10], c1Null[10], c2[10];
+
+  TAOS_RES *res = query(taos, "select * from (select ts, c1, c2 from tb) order by c1 limit 10 offset 90000");
+  int       numOfRows = fetchRows(res, c1, c1Null, c2, 10);
+  taos_free_result(res);
+
+  int matched = (numOfRows == 10);
+  for (int k = 0; k < numOfRows && k < 10; ++k) {
+    if (c1Null[k] || c1[k] != keys[90000 + k - numOfNulls]) matched = 0;
+  }
+  check(matched, "the rows of a large offset");
+
+  res = query(taos, "select * from (select ts, c1, c2 from tb) order by c1 desc limit 10 offset 5");
+  numOfRows = fetchRows(res, c1, c1Null, c2, 10);
+  taos_free_result(res);
+
+  matched = (numOfRows == 10);
+  for (int k = 0; k < numOfRows && k < 10; ++k) {
+    if (c1Null[k] || c1[k] != keys[numOfKeys - 1 - 5 - k]) matched = 0;
+  }
+  check(matched, "the rows of a small limit");
+
+  free(keys);
+}
+
+int main(int argc, char *argv[]) {
+  // a sort buffer of 1MB, the rows beyond half of it are spilled
+  setConfRet ret = taos_set_config("{\"sortBufferSize\":\"1\"}");
+  if (ret.retCode != SET_CONF_RET_SUCC) {
+    printf("\033[31mfailed to set sortBufferSize, reason:%s\033[0m\n", ret.retMsg);
+    exit(1);
+  }
+
+  // the config dir of the client, e.g. when the server is not on the default port
+  if (argc > 1) {
+    taos_options(TSDB_OPTION_CONFIGDIR, argv[1]);
+  }
+
+  TAOS *taos = taos_connect("127.0.0.1", "root", "taosdata", NULL, 0);
+  if (taos == NULL) {
+    printf("\033[31mfailed to connect to db, reason:%s\033[0m\n", taos_errstr(taos));
+    exit(1);
+  }
+
+  prepareData(taos);
+
+  printf("************  order by an int column  *************\n");
+  orderByInt(taos, 1);
+  orderByInt(taos, 0);
+
+  printf("************  order by a binary column  *************\n");
+  orderByBinary(taos);
+
+  printf("************  order by with limit  *************\n");
+  orderByLimit(taos);
+
+  executeSql(taos, "drop database es_db");
+  taos_close(taos);
+  taos_cleanup();
+
+  printf("done\n");
+  return 0;
+}
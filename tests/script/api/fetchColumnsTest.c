@@ -0,0 +1,279 @@
+// taos_fetch_block_columns returns the blocks of a result as typed columns, the values are referenced in the retrieved
+// blocks, the nulls are in the validity bitmaps and the var-length values are located by their offsets and lengths
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <taos.h>
+
+#define NUM_OF_ROWS  10000  // more than the rows of one retrieved block
+#define ROWS_PER_SQL 500
+
+static int64_t startTs = 1626006833639;
+
+static void check(int cond, const char *msg) {
+  if (!cond) {
+    printf("\033[31mfailed: %s\033[0m\n", msg);
+    exit(1);
+  }
+
+  printf("\033[32mpassed: %s\033[0m\n", msg);
+}
+
+static void executeSql(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  int       code = taos_errno(res);
+  if (code != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  taos_free_result(res);
+}
+
+static TAOS_RES *query(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  if (taos_errno(res) != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  return res;
+}
+
+static int isNullRow(int i) { return i % 5 == 0; }
+
+// row i: c1 = i % 100, c2 = i, c3 = i * 10, c4 = i * 0.5, c5 = i * 0.25, c6 = i % 2, c7 = 'b<i>', c8 = 'n<i>', and c2,
+// c7 and c8 are null in every fifth row
+static void prepareData(TAOS *taos) {
+  executeSql(taos, "drop database if exists fc_db");
+  executeSql(taos, "create database fc_db");
+  executeSql(taos, "use fc_db");
+  executeSql(taos, "create table tb (ts timestamp, c1 tinyint, c2 int, c3 bigint, c4 float, c5 double, c6 bool, "
+                   "c7 binary(16), c8 nchar(8))");
+
+  char *sql = malloc(ROWS_PER_SQL * 128 + 32);
+  for (int i = 0; i < NUM_OF_ROWS; i += ROWS_PER_SQL) {
+    int len = sprintf(sql, "insert into tb values");
+    for (int j = i; j < i + ROWS_PER_SQL; ++j) {
+      if (isNullRow(j)) {
+        len += sprintf(sql + len, " (%" PRId64 ", %d, null, %d, %d.5, %d.25, %d, null, null)", startTs + j, j % 100,
+                       j * 10, j / 2, j / 4, j % 2);
+      } else {
+        len += sprintf(sql + len, " (%" PRId64 ", %d, %d, %d, %d.5, %d.25, %d, 'b%d', 'n%d')", startTs + j, j % 100, j,
+                       j * 10, j / 2, j / 4, j % 2, j, j);
+      }
+    }
+
+    executeSql(taos, sql);
+  }
+
+  free(sql);
+}
+
+// the width of a value slot of the retrieved block, including the length header of binary and nchar values
+static int16_t slotBytes(const TAOS_FIELD *pField) {
+  if (pField->type == TSDB_DATA_TYPE_BINARY) {
+    return (int16_t)(pField->bytes + (int)sizeof(int16_t));
+  } else if (pField->type == TSDB_DATA_TYPE_NCHAR) {
+    return (int16_t)(pField->bytes * 4 + (int)sizeof(int16_t));
+  }
+
+  return pField->bytes;
+}
+
+static int isNotNull(const TAOS_COLUMN *pCol, int k) { return (pCol->bitmap[k >> 3] >> (k & 7)) & 1; }
+
+static int checkString(const TAOS_COLUMN *pCol, int k, const char *prefix, int i) {
+  char expect[32];
+  int  len = sprintf(expect, "%s%d", prefix, i);
+  return pCol->length[k] == len && memcmp(pCol->data + pCol->offset[k], expect, (size_t)len) == 0;
+}
+
+static void fetchAllColumns(TAOS *taos) {
+  TAOS_RES   *res = query(taos, "select * from tb");
+  TAOS_FIELD *fields = taos_fetch_fields(res);
+  int         numOfFields = taos_num_fields(res);
+
+  int typeMatched = 1, valueMatched = 1, nullMatched = 1, varMatched = 1;
+  int numOfBlocks = 0, total = 0;
+
+  TAOS_COLUMN *columns = NULL;
+  int          rows = 0;
+  while ((rows = taos_fetch_block_columns(res, &columns)) > 0) {
+    numOfBlocks++;
+
+    for (int j = 0; j < numOfFields; ++j) {
+      if (columns[j].type != fields[j].type || columns[j].bytes != slotBytes(&fields[j]) ||
+          columns[j].numOfRows != rows) {
+        typeMatched = 0;
+      }
+    }
+
+    for (int k = 0; k < rows; ++k) {
+      int i = total + k;
+      int nullExpected = isNullRow(i);
+
+      if (*(int64_t *)(columns[0].data + k * columns[0].bytes) != startTs + i ||
+          *(int8_t *)(columns[1].data + k * columns[1].bytes) != i % 100 ||
+          *(int64_t *)(columns[3].data + k * columns[3].bytes) != (int64_t)i * 10 ||
+          *(float *)(columns[4].data + k * columns[4].bytes) != (float)(i / 2) + 0.5f ||
+          *(double *)(columns[5].data + k * columns[5].bytes) != (double)(i / 4) + 0.25 ||
+          *(int8_t *)(columns[6].data + k * columns[6].bytes) != i % 2) {
+        valueMatched = 0;
+      }
+
+      if (!isNotNull(&columns[0], k) || !isNotNull(&columns[1], k) || !isNotNull(&columns[6], k) ||
+          isNotNull(&columns[2], k) == nullExpected || isNotNull(&columns[7], k) == nullExpected ||
+          isNotNull(&columns[8], k) == nullExpected) {
+        nullMatched = 0;
+      }
+
+      if (nullExpected) {
+        if (columns[7].length[k] != 0 || columns[8].length[k] != 0) {
+          varMatched = 0;
+        }
+        continue;
+      }
+
+      if (*(int32_t *)(columns[2].data + k * columns[2].bytes) != i) {
+        valueMatched = 0;
+      }
+
+      if (!checkString(&columns[7], k, "b", i) || !checkString(&columns[8], k, "n", i)) {
+        varMatched = 0;
+      }
+    }
+
+    total += rows;
+  }
+
+  check(columns == NULL, "no columns after the last block");
+  check(taos_errno(res) == 0, "fetch all the blocks");
+  taos_free_result(res);
+
+  check(total == NUM_OF_ROWS, "all the rows are fetched");
+  check(numOfBlocks > 1, "the rows are fetched in several blocks");
+  check(typeMatched, "the types, widths and rows of the columns");
+  check(valueMatched, "the values of the fixed-length columns");
+  check(nullMatched, "the nulls are in the bitmaps");
+  check(varMatched, "the binary and nchar values are located by their offsets and lengths");
+}
+
+// the values of the columns are the same as the values of taos_fetch_row
+static void compareWithRows(TAOS *taos) {
+  const char *sql = "select ts, c2, c7, c8 from tb where c3 >= 50000 and c3 < 80000";
+
+  TAOS_RES *res = query(taos, sql);
+  int       numOfRows = 0;
+  int64_t  *ts = calloc(NUM_OF_ROWS, sizeof(int64_t));
+  int32_t  *c2 = calloc(NUM_OF_ROWS, sizeof(int32_t));
+  char     *c2Null = calloc(NUM_OF_ROWS, 1);
+  char     (*c8)[32] = calloc(NUM_OF_ROWS, 32);
+
+  TAOS_ROW row = NULL;
+  while ((row = taos_fetch_row(res)) != NULL) {
+    int *length = taos_fetch_lengths(res);
+
+    ts[numOfRows] = *(int64_t *)row[0];
+    c2Null[numOfRows] = (row[1] == NULL);
+    c2[numOfRows] = (row[1] == NULL) ? 0 : *(int32_t *)row[1];
+    if (row[3] != NULL) {
+      memcpy(c8[numOfRows], row[3], (size_t)length[3]);
+    }
+
+    numOfRows++;
+  }
+  taos_free_result(res);
+
+  res = query(taos, sql);
+  int matched = 1, total = 0, rows = 0;
+
+  TAOS_COLUMN *columns = NULL;
+  while ((rows = taos_fetch_block_columns(res, &columns)) > 0) {
+    for (int k = 0; k < rows && total + k < numOfRows; ++k) {
+      int i = total + k;
+      if (*(int64_t *)(columns[0].data + k * columns[0].bytes) != ts[i] || isNotNull(&columns[1], k) == c2Null[i]) {
+        matched = 0;
+      } else if (!c2Null[i] && *(int32_t *)(columns[1].data + k * columns[1].bytes) != c2[i]) {
+        matched = 0;
+      } else if (isNotNull(&columns[3], k) &&
+                 ((size_t)columns[3].length[k] != strlen(c8[i]) ||
+                  memcmp(columns[3].data + columns[3].offset[k], c8[i], (size_t)columns[3].length[k]) != 0)) {
+        matched = 0;
+      }
+    }
+
+    total += rows;
+  }
+  taos_free_result(res);
+
+  check(numOfRows == 3000 && total == numOfRows, "the same rows as taos_fetch_row");
+  check(matched, "the same values as taos_fetch_row");
+
+  free(ts);
+  free(c2);
+  free(c2Null);
+  free(c8);
+}
+
+static void fetchAggregation(TAOS *taos) {
+  TAOS_RES *res = query(taos, "select count(*), count(c2), sum(c3), last(c7) from tb");
+
+  TAOS_COLUMN *columns = NULL;
+  int          rows = taos_fetch_block_columns(res, &columns);
+  check(rows == 1, "one row of the aggregation");
+  check(columns[0].type == TSDB_DATA_TYPE_BIGINT && *(int64_t *)columns[0].data == NUM_OF_ROWS, "the count of rows");
+  check(*(int64_t *)columns[1].data == NUM_OF_ROWS - NUM_OF_ROWS / 5, "the count of a column with nulls");
+  check(*(int64_t *)columns[2].data == (int64_t)NUM_OF_ROWS * (NUM_OF_ROWS - 1) * 5, "the sum of a column");
+  check(checkString(&columns[3], 0, "b", NUM_OF_ROWS - 1), "the last value of a binary column");
+  check(taos_fetch_block_columns(res, &columns) == 0, "no more blocks");
+  taos_free_result(res);
+}
+
+static void fetchEmpty(TAOS *taos) {
+  TAOS_COLUMN *columns = NULL;
+
+  TAOS_RES *res = query(taos, "select * from tb where ts < 0");
+  check(taos_fetch_block_columns(res, &columns) == 0 && columns == NULL, "no columns of an empty result");
+  taos_free_result(res);
+
+  res = query(taos, "insert into tb values (now, 1, 1, 1, 1, 1, 1, 'b', 'n')");
+  check(taos_fetch_block_columns(res, &columns) == 0 && columns == NULL, "no columns of an insert");
+  taos_free_result(res);
+}
+
+int main(int argc, char *argv[]) {
+  // the config dir of the client, e.g. when the server is not on the default port
+  if (argc > 1) {
+    taos_options(TSDB_OPTION_CONFIGDIR, argv[1]);
+  }
+
+  TAOS *taos = taos_connect("127.0.0.1", "root", "taosdata", NULL, 0);
+  if (taos == NULL) {
+    printf("\033[31mfailed to connect to db, reason:%s\033[0m\n", taos_errstr(taos));
+    exit(1);
+  }
+
+  prepareData(taos);
+
+  printf("************  fetch all the columns  *************\n");
+  fetchAllColumns(taos);
+
+  printf("************  compare with the rows  *************\n");
+  compareWithRows(taos);
+
+  printf("************  fetch an aggregation  *************\n");
+  fetchAggregation(taos);
+
+  printf("************  fetch nothing  *************\n");
+  fetchEmpty(taos);
+
+  executeSql(taos, "drop database fc_db");
+  taos_close(taos);
+  taos_cleanup();
+
+  printf("done\n");
+  return 0;
+}
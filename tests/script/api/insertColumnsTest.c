@@ -0,0 +1,298 @@
+// taos_insert_columns writes the column arrays of a table in column-major submit blocks, the arrays are split into
+// several blocks and messages when they are long, and the rows that are not after the last row of the table go
+// through the row path of the vnode
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <taos.h>
+
+#define NUM_OF_COLS 8
+#define NUM_OF_ROWS 100000  // more than the rows of one submit block
+#define BINARY_LEN  16
+#define NCHAR_LEN   8
+
+static int64_t startTs = 1626006833639;
+
+typedef struct {
+  int64_t *ts;
+  int8_t  *c1;
+  int32_t *c2;
+  int64_t *c3;
+  double  *c4;
+  int8_t  *c5;
+  char    *c6;
+  char    *c7;
+  int32_t *c6Len;
+  int32_t *c7Len;
+  char    *c2Null;
+  char    *c6Null;
+
+  TAOS_MULTI_BIND bind[NUM_OF_COLS];
+} SColumns;
+
+static void check(int cond, const char *msg) {
+  if (!cond) {
+    printf("\033[31mfailed: %s\033[0m\n", msg);
+    exit(1);
+  }
+
+  printf("\033[32mpassed: %s\033[0m\n", msg);
+}
+
+static void executeSql(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  int       code = taos_errno(res);
+  if (code != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  taos_free_result(res);
+}
+
+static int64_t queryInt(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  if (taos_errno(res) != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  int64_t     val = 0;
+  TAOS_ROW    row = taos_fetch_row(res);
+  TAOS_FIELD *fields = taos_fetch_fields(res);
+  if (row != NULL && row[0] != NULL) {
+    switch (fields[0].type) {
+      case TSDB_DATA_TYPE_TIMESTAMP:
+      case TSDB_DATA_TYPE_BIGINT:
+        val = *(int64_t *)row[0];
+        break;
+      case TSDB_DATA_TYPE_INT:
+        val = *(int32_t *)row[0];
+        break;
+      case TSDB_DATA_TYPE_DOUBLE:
+        val = (int64_t)(*(double *)row[0]);
+        break;
+      default:
+        break;
+    }
+  }
+
+  taos_free_result(res);
+  return val;
+}
+
+static void queryString(TAOS *taos, const char *sql, char *str, int32_t size) {
+  TAOS_RES *res = taos_query(taos, sql);
+  TAOS_ROW  row = taos_fetch_row(res);
+  str[0] = 0;
+  if (row != NULL && row[0] != NULL) {
+    int *length = taos_fetch_lengths(res);
+    snprintf(str, (size_t)size, "%.*s", length[0], (char *)row[0]);
+  }
+
+  taos_free_result(res);
+}
+
+static void setBind(TAOS_MULTI_BIND *pBind, int type, void *buffer, uintptr_t bufLen, int32_t *length, char *isNull,
+                    int num) {
+  pBind->buffer_type = type;
+  pBind->buffer = buffer;
+  pBind->buffer_length = bufLen;
+  pBind->length = length;
+  pBind->is_null = isNull;
+  pBind->num = num;
+}
+
+/*
+ * Row i has the key startTs + step * i + offset and the value i in every column, c2 and c6 are null in every 7th row,
+ * c6 and c7 hold the row number as text.
+ */
+static void initColumns(SColumns *pCols, int num, int64_t step, int64_t offset) {
+  pCols->ts = calloc((size_t)num, sizeof(int64_t));
+  pCols->c1 = calloc((size_t)num, sizeof(int8_t));
+  pCols->c2 = calloc((size_t)num, sizeof(int32_t));
+  pCols->c3 = calloc((size_t)num, sizeof(int64_t));
+  pCols->c4 = calloc((size_t)num, sizeof(double));
+  pCols->c5 = calloc((size_t)num, sizeof(int8_t));
+  pCols->c6 = calloc((size_t)num, BINARY_LEN);
+  pCols->c7 = calloc((size_t)num, NCHAR_LEN);
+  pCols->c6Len = calloc((size_t)num, sizeof(int32_t));
+  pCols->c7Len = calloc((size_t)num, sizeof(int32_t));
+  pCols->c2Null = calloc((size_t)num, 1);
+  pCols->c6Null = calloc((size_t)num, 1);
+
+  for (int i = 0; i < num; ++i) {
+    pCols->ts[i] = startTs + step * i + offset;
+    pCols->c1[i] = (int8_t)(i % 128);
+    pCols->c2[i] = i;
+    pCols->c3[i] = (int64_t)i * 1000;
+    pCols->c4[i] = i + 0.5;
+    pCols->c5[i] = (int8_t)(i & 1);
+    pCols->c6Len[i] = snprintf(pCols->c6 + (size_t)i * BINARY_LEN, BINARY_LEN, "b%d", i);
+    pCols->c7Len[i] = snprintf(pCols->c7 + (size_t)i * NCHAR_LEN, NCHAR_LEN, "n%d", i % 100000);
+    pCols->c2Null[i] = (i % 7 == 0);
+    pCols->c6Null[i] = (i % 7 == 0);
+  }
+
+  setBind(&pCols->bind[0], TSDB_DATA_TYPE_TIMESTAMP, pCols->ts, sizeof(int64_t), NULL, NULL, num);
+  setBind(&pCols->bind[1], TSDB_DATA_TYPE_TINYINT, pCols->c1, sizeof(int8_t), NULL, NULL, num);
+  setBind(&pCols->bind[2], TSDB_DATA_TYPE_INT, pCols->c2, sizeof(int32_t), NULL, pCols->c2Null, num);
+  setBind(&pCols->bind[3], TSDB_DATA_TYPE_BIGINT, pCols->c3, sizeof(int64_t), NULL, NULL, num);
+  setBind(&pCols->bind[4], TSDB_DATA_TYPE_DOUBLE, pCols->c4, sizeof(double), NULL, NULL, num);
+  setBind(&pCols->bind[5], TSDB_DATA_TYPE_BOOL, pCols->c5, sizeof(int8_t), NULL, NULL, num);
+  setBind(&pCols->bind[6], TSDB_DATA_TYPE_BINARY, pCols->c6, BINARY_LEN, pCols->c6Len, pCols->c6Null, num);
+  setBind(&pCols->bind[7], TSDB_DATA_TYPE_NCHAR, pCols->c7, NCHAR_LEN, pCols->c7Len, NULL, num);
+}
+
+static void destroyColumns(SColumns *pCols) {
+  free(pCols->ts);
+  free(pCols->c1);
+  free(pCols->c2);
+  free(pCols->c3);
+  free(pCols->c4);
+  free(pCols->c5);
+  free(pCols->c6);
+  free(pCols->c7);
+  free(pCols->c6Len);
+  free(pCols->c7Len);
+  free(pCols->c2Null);
+  free(pCols->c6Null);
+}
+
+// returns the affected rows, or -1 if failed
+static int insertColumns(TAOS *taos, const char *table, TAOS_MULTI_BIND *bind, int numOfCols) {
+  TAOS_RES *res = taos_insert_columns(taos, table, bind, numOfCols);
+  int       code = taos_errno(res);
+  int       rows = -1;
+  if (code == 0) {
+    rows = taos_affected_rows(res);
+  } else {
+    printf("insert columns of %s failed, reason:%s\n", table, taos_errstr(res));
+  }
+
+  taos_free_result(res);
+  return rows;
+}
+
+static void insertInOrder(TAOS *taos) {
+  SColumns cols = {0};
+  initColumns(&cols, NUM_OF_ROWS, 1, 0);
+
+  int64_t sumOfC2 = 0;
+  int64_t sumOfC3 = 0;
+  for (int i = 0; i < NUM_OF_ROWS; ++i) {
+    sumOfC2 += cols.c2Null[i] ? 0 : cols.c2[i];
+    sumOfC3 += cols.c3[i];
+  }
+
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS) == NUM_OF_ROWS, "insert the columns in several blocks");
+  check(queryInt(taos, "select count(*) from tb") == NUM_OF_ROWS, "all the rows are inserted");
+  check(queryInt(taos, "select count(c2) from tb") == NUM_OF_ROWS - (NUM_OF_ROWS + 6) / 7, "the null values");
+  check(queryInt(taos, "select count(c6) from tb") == NUM_OF_ROWS - (NUM_OF_ROWS + 6) / 7, "the null binary values");
+  check(queryInt(taos, "select sum(c2) from tb") == sumOfC2, "the int values");
+  check(queryInt(taos, "select sum(c3) from tb") == sumOfC3, "the bigint values");
+  check(queryInt(taos, "select first(ts) from tb") == startTs, "the first key");
+  check(queryInt(taos, "select last(ts) from tb") == startTs + NUM_OF_ROWS - 1, "the last key");
+
+  char sql[256];
+  char str[64];
+  snprintf(sql, sizeof(sql), "select c6 from tb where ts = %" PRId64, startTs + 40001);
+  queryString(taos, sql, str, sizeof(str));
+  check(strcmp(str, "b40001") == 0, "the binary value of a row in a later block");
+
+  snprintf(sql, sizeof(sql), "select c7 from tb where ts = %" PRId64, startTs + 99999);
+  queryString(taos, sql, str, sizeof(str));
+  check(strcmp(str, "n99999") == 0, "the nchar value of the last row");
+
+  snprintf(sql, sizeof(sql), "select c4 from tb where ts = %" PRId64, startTs + 12345);
+  check(queryInt(taos, sql) == 12345, "the double value of a row");
+
+  destroyColumns(&cols);
+}
+
+static void insertOutOfOrder(TAOS *taos) {
+  // the keys between and before the existing keys, every other one is duplicated and dropped
+  SColumns cols = {0};
+  initColumns(&cols, 1000, -1, 999);
+
+  check(insertColumns(taos, "tb_ooo", cols.bind, NUM_OF_COLS) == 1000, "insert the columns in descending key order");
+  check(queryInt(taos, "select count(*) from tb_ooo") == 1000, "the rows in descending key order");
+  check(queryInt(taos, "select first(ts) from tb_ooo") == startTs, "the smallest key is first");
+
+  SColumns dup = {0};
+  initColumns(&dup, 1000, 2, 500);
+  check(insertColumns(taos, "tb_ooo", dup.bind, NUM_OF_COLS) == 1000, "insert the columns over the existing keys");
+  check(queryInt(taos, "select count(*) from tb_ooo") == 1000 + 750, "the duplicated keys are dropped");
+  check(queryInt(taos, "select last(ts) from tb_ooo") == startTs + 500 + 2 * 999, "the largest key is last");
+
+  destroyColumns(&cols);
+  destroyColumns(&dup);
+}
+
+static void insertInvalid(TAOS *taos) {
+  SColumns cols = {0};
+  initColumns(&cols, 10, 1, 0);
+
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS - 1) < 0, "the columns of the table must be bound");
+  check(insertColumns(taos, "st", cols.bind, NUM_OF_COLS) < 0, "the columns of a super table are not inserted");
+  check(insertColumns(taos, "tb_none", cols.bind, NUM_OF_COLS) < 0, "the table must exist");
+
+  cols.bind[2].buffer_type = TSDB_DATA_TYPE_BIGINT;
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS) < 0, "the buffer type must be the column type");
+  cols.bind[2].buffer_type = TSDB_DATA_TYPE_INT;
+
+  cols.bind[3].num = 9;
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS) < 0, "the columns must have the same rows");
+  cols.bind[3].num = 10;
+
+  char tsNull[10] = {0, 0, 1};
+  cols.bind[0].is_null = tsNull;
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS) < 0, "the key must not be null");
+  cols.bind[0].is_null = NULL;
+
+  cols.c6Len[5] = BINARY_LEN + 1;
+  check(insertColumns(taos, "tb", cols.bind, NUM_OF_COLS) < 0, "the binary value must fit the column");
+
+  check(queryInt(taos, "select count(*) from tb") == NUM_OF_ROWS, "no rows are inserted by the failed calls");
+  destroyColumns(&cols);
+}
+
+int main(int argc, char *argv[]) {
+  // the config dir of the client, e.g. when the server is not on the default port
+  if (argc > 1) {
+    taos_options(TSDB_OPTION_CONFIGDIR, argv[1]);
+  }
+
+  TAOS *taos = taos_connect("127.0.0.1", "root", "taosdata", NULL, 0);
+  if (taos == NULL) {
+    printf("\033[31mfailed to connect to db, reason:%s\033[0m\n", taos_errstr(taos));
+    exit(1);
+  }
+
+  executeSql(taos, "drop database if exists col_db");
+  executeSql(taos, "create database col_db");
+  executeSql(taos, "use col_db");
+  executeSql(taos,
+             "create table st (ts timestamp, c1 tinyint, c2 int, c3 bigint, c4 double, c5 bool, c6 binary(16), "
+             "c7 nchar(8)) tags (t1 int)");
+  executeSql(taos, "create table tb using st tags (1)");
+  executeSql(taos, "create table tb_ooo using st tags (2)");
+
+  printf("************  insert columns in key order  *************\n");
+  insertInOrder(taos);
+
+  printf("************  insert columns out of key order  *************\n");
+  insertOutOfOrder(taos);
+
+  printf("************  insert invalid columns  *************\n");
+  insertInvalid(taos);
+
+  executeSql(taos, "drop database col_db");
+  taos_close(taos);
+  taos_cleanup();
+
+  printf("done\n");
+  return 0;
+}
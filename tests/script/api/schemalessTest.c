@@ -0,0 +1,244 @@
+// schemaless insert of the influxdb line protocol, the child tables are created automatically, a child table that is
+// cached by the client but dropped by another client is created again, and the schema changes are applied in retries
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <taos.h>
+#include <unistd.h>
+
+#define NUM_OF_TABLES 1500  // more than the child tables of one meta request
+
+static int toWorker[2];
+static int fromWorker[2];
+
+static void check(int cond, const char *msg) {
+  if (!cond) {
+    printf("\033[31mfailed: %s\033[0m\n", msg);
+    exit(1);
+  }
+
+  printf("\033[32mpassed: %s\033[0m\n", msg);
+}
+
+/*
+ * The table metas are cached by the process, so the tables are dropped by another process, forked before the client
+ * is initialized, to keep the metas cached by this one.
+ */
+static void startWorker() {
+  if (pipe(toWorker) != 0 || pipe(fromWorker) != 0) {
+    exit(1);
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    exit(1);
+  } else if (pid > 0) {
+    close(toWorker[0]);
+    close(fromWorker[1]);
+    return;
+  }
+
+  close(toWorker[1]);
+  close(fromWorker[0]);
+
+  TAOS *taos = NULL;
+  char  sql[1024];
+  int   len = 0;
+  while (read(toWorker[0], &len, sizeof(len)) == sizeof(len) && len < sizeof(sql) &&
+         read(toWorker[0], sql, (size_t)len) == len) {
+    sql[len] = 0;
+    if (taos == NULL) {
+      taos = taos_connect("127.0.0.1", "root", "taosdata", NULL, 0);
+    }
+
+    TAOS_RES *res = taos_query(taos, sql);
+    int       code = taos_errno(res);
+    taos_free_result(res);
+    if (write(fromWorker[1], &code, sizeof(code)) != sizeof(code)) {
+      break;
+    }
+  }
+
+  taos_close(taos);
+  taos_cleanup();
+  exit(0);
+}
+
+static int queryByWorker(const char *sql) {
+  int len = (int)strlen(sql);
+  int code = -1;
+  if (write(toWorker[1], &len, sizeof(len)) != sizeof(len) || write(toWorker[1], sql, (size_t)len) != len ||
+      read(fromWorker[0], &code, sizeof(code)) != sizeof(code)) {
+    return -1;
+  }
+
+  return code;
+}
+
+static void stopWorker() {
+  close(toWorker[1]);
+  close(fromWorker[0]);
+  wait(NULL);
+}
+
+static void executeSql(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  int       code = taos_errno(res);
+  if (code != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  taos_free_result(res);
+}
+
+static int64_t queryInt(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  if (taos_errno(res) != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  int64_t   val = 0;
+  TAOS_ROW  row = taos_fetch_row(res);
+  TAOS_FIELD *fields = taos_fetch_fields(res);
+  if (row != NULL && row[0] != NULL) {
+    switch (fields[0].type) {
+      case TSDB_DATA_TYPE_BIGINT:
+        val = *(int64_t *)row[0];
+        break;
+      case TSDB_DATA_TYPE_INT:
+        val = *(int32_t *)row[0];
+        break;
+      case TSDB_DATA_TYPE_DOUBLE:
+        val = (int64_t)(*(double *)row[0]);
+        break;
+      default:
+        break;
+    }
+  }
+
+  taos_free_result(res);
+  return val;
+}
+
+static int64_t queryRows(TAOS *taos, const char *sql) {
+  TAOS_RES *res = taos_query(taos, sql);
+  if (taos_errno(res) != 0) {
+    printf("\033[31mfailed to execute %s, reason:%s\033[0m\n", sql, taos_errstr(res));
+    exit(1);
+  }
+
+  int64_t rows = 0;
+  while (taos_fetch_row(res) != NULL) {
+    rows++;
+  }
+
+  taos_free_result(res);
+  return rows;
+}
+
+static int insertLines(TAOS *taos, char **lines, int numOfLines) {
+  TAOS_RES *res = taos_schemaless_insert(taos, lines, numOfLines, TSDB_SML_LINE_PROTOCOL, TSDB_SML_TIMESTAMP_MILLI_SECONDS);
+  int       code = taos_errno(res);
+  if (code != 0) {
+    printf("schemaless insert failed, reason:%s\n", taos_errstr(res));
+  }
+
+  taos_free_result(res);
+  return code;
+}
+
+// one point of each child table, in the id order
+static int insertRound(TAOS *taos, int64_t ts, const char *extraField) {
+  char **lines = calloc(NUM_OF_TABLES, sizeof(char *));
+  for (int i = 0; i < NUM_OF_TABLES; ++i) {
+    lines[i] = calloc(1, 256);
+    snprintf(lines[i], 256, "sml_st,id=t%d c1=%di32,c2=%d.5%s %" PRId64, i, i, i, extraField, ts);
+  }
+
+  int code = insertLines(taos, lines, NUM_OF_TABLES);
+
+  for (int i = 0; i < NUM_OF_TABLES; ++i) {
+    free(lines[i]);
+  }
+  free(lines);
+  return code;
+}
+
+static void getChildTableName(TAOS *taos, const char *id, char *name) {
+  char sql[256];
+  snprintf(sql, sizeof(sql), "select tbname from sml_st where id = '%s'", id);
+
+  TAOS_RES *res = taos_query(taos, sql);
+  TAOS_ROW  row = taos_fetch_row(res);
+  check(row != NULL, "get the name of a child table");
+
+  int *length = taos_fetch_lengths(res);
+  memcpy(name, row[0], (size_t)length[0]);
+  name[length[0]] = 0;
+  taos_free_result(res);
+}
+
+static void dropChildTableByWorker(TAOS *taos, const char *id) {
+  char name[256] = {0};
+  getChildTableName(taos, id, name);
+
+  char sql[512];
+  snprintf(sql, sizeof(sql), "drop table sml_db.`%s`", name);
+  check(queryByWorker(sql) == 0, "drop a cached child table by another client");
+}
+
+int main(int argc, char *argv[]) {
+  // the config dir of the client, e.g. when the server is not on the default port
+  if (argc > 1) {
+    taos_options(TSDB_OPTION_CONFIGDIR, argv[1]);
+  }
+
+  startWorker();
+
+  TAOS *taos = taos_connect("127.0.0.1", "root", "taosdata", NULL, 0);
+  if (taos == NULL) {
+    printf("\033[31mfailed to connect to db, reason:%s\033[0m\n", taos_errstr(taos));
+    exit(1);
+  }
+
+  executeSql(taos, "drop database if exists sml_db");
+  executeSql(taos, "create database sml_db");
+  executeSql(taos, "use sml_db");
+
+  int64_t ts = 1626006833639;
+
+  printf("************  auto create child tables  *************\n");
+  check(insertRound(taos, ts, "") == 0, "insert the points of new child tables");
+  check(insertRound(taos, ts + 1, "") == 0, "insert the points of the created child tables");
+  check(queryRows(taos, "select tbname from sml_st") == NUM_OF_TABLES, "all the child tables are created");
+  check(queryInt(taos, "select count(*) from sml_st") == NUM_OF_TABLES * 2, "all the points are inserted");
+  check(queryInt(taos, "select sum(c1) from sml_st where id = 't7'") == 14, "the points are in their child tables");
+
+  printf("************  cached but dropped child tables  *************\n");
+  dropChildTableByWorker(taos, "t5");
+  dropChildTableByWorker(taos, "t1499");
+  check(insertRound(taos, ts + 2, "") == 0, "insert the points of the dropped child tables");
+  check(queryRows(taos, "select tbname from sml_st") == NUM_OF_TABLES, "the dropped child tables are created again");
+  check(queryInt(taos, "select count(*) from sml_st where id = 't5'") == 1, "the point is in the new child table");
+  check(queryInt(taos, "select count(*) from sml_st") == NUM_OF_TABLES * 3 - 4, "the other points are inserted");
+
+  printf("************  schema change and retry  *************\n");
+  dropChildTableByWorker(taos, "t9");
+  check(insertRound(taos, ts + 3, ",c3=3i64") == 0, "insert the points with a new column");
+  check(queryInt(taos, "select count(c3) from sml_st") == NUM_OF_TABLES, "the new column is written");
+  check(queryInt(taos, "select sum(c3) from sml_st") == NUM_OF_TABLES * 3, "the values of the new column");
+  check(queryInt(taos, "select count(*) from sml_st where id = 't9'") == 1, "the point is in the new child table");
+
+  executeSql(taos, "drop database sml_db");
+  taos_close(taos);
+  taos_cleanup();
+
+  stopWorker();
+  printf("done\n");
+  return 0;
+}
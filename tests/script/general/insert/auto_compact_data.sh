@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# write the rows of a round to a csv file: a row every second from 2020-10-01, each round shifted by its number of
+# milliseconds, so the rows of every round are out of order with the committed ones
+file=$1
+round=$2
+rows=$3
+
+pad=$(printf 'x%.0s' {1..100})
+awk -v round=$round -v rows=$rows -v pad=$pad 'BEGIN {
+  for (i = 0; i < rows; i++) {
+    printf "%.0f,%d,\x27%s\x27\n", 1601481600000 + i * 1000 + round, i, pad
+  }
+}' > $file
@@ -0,0 +1,2025 @@
+# cd /root/repo/tests/script; sh/stop_dnodes.sh;
+# cd /root/repo/tests/script; sh/deploy.sh -n dnode1 -i 1;
+# cd /root/repo/tests/script; sh/cfg.sh -n dnode1 -c walLevel -v 1;
+# cd /root/repo/tests/script; sh/exec.sh -n dnode1 -s start;
+# sleep 2000;
+drop database pa_tn_db0;
+create database pa_tn_db0;
+use pa_tn_db0;
+create table pa_tn_mt0 (ts timestamp, c1 int, c2 int, c3 int, c4 binary(8)) TAGS(t1 int);
+create table pa_tn_tb0 using pa_tn_mt0 tags( 0 );
+insert into pa_tn_tb0 values ( 1601481600000 , 0 , NULL , 0 , 'b0' );
+insert into pa_tn_tb0 values ( 1601481601000 , 37 , 37 , 1 , 'b37' );
+insert into pa_tn_tb0 values ( 1601481602000 , 74 , 74 , 2 , 'b74' );
+insert into pa_tn_tb0 values ( 1601481603000 , 111 , 111 , 3 , 'b111' );
+insert into pa_tn_tb0 values ( 1601481604000 , 148 , 148 , 4 , 'b148' );
+insert into pa_tn_tb0 values ( 1601481605000 , 185 , 185 , 5 , 'b185' );
+insert into pa_tn_tb0 values ( 1601481606000 , 222 , 222 , 6 , 'b222' );
+insert into pa_tn_tb0 values ( 1601481607000 , 259 , 259 , 7 , 'b259' );
+insert into pa_tn_tb0 values ( 1601481608000 , 296 , 296 , 8 , 'b296' );
+insert into pa_tn_tb0 values ( 1601481609000 , 333 , 333 , 9 , 'b333' );
+insert into pa_tn_tb0 values ( 1601481610000 , 370 , 370 , 0 , 'b370' );
+insert into pa_tn_tb0 values ( 1601481611000 , 407 , 407 , 1 , 'b407' );
+insert into pa_tn_tb0 values ( 1601481612000 , 444 , 444 , 2 , 'b444' );
+insert into pa_tn_tb0 values ( 1601481613000 , 481 , 481 , 3 , 'b481' );
+insert into pa_tn_tb0 values ( 1601481614000 , 518 , 518 , 4 , 'b518' );
+insert into pa_tn_tb0 values ( 1601481615000 , 555 , 555 , 5 , 'b555' );
+insert into pa_tn_tb0 values ( 1601481616000 , 592 , 592 , 6 , 'b592' );
+insert into pa_tn_tb0 values ( 1601481617000 , 629 , 629 , 7 , 'b629' );
+insert into pa_tn_tb0 values ( 1601481618000 , 666 , 666 , 8 , 'b666' );
+insert into pa_tn_tb0 values ( 1601481619000 , 703 , 703 , 9 , 'b703' );
+insert into pa_tn_tb0 values ( 1601481620000 , 740 , 740 , 0 , 'b740' );
+insert into pa_tn_tb0 values ( 1601481621000 , 777 , 777 , 1 , 'b777' );
+insert into pa_tn_tb0 values ( 1601481622000 , 814 , 814 , 2 , 'b814' );
+insert into pa_tn_tb0 values ( 1601481623000 , 851 , 851 , 3 , 'b851' );
+insert into pa_tn_tb0 values ( 1601481624000 , 888 , 888 , 4 , 'b888' );
+insert into pa_tn_tb0 values ( 1601481625000 , 925 , 925 , 5 , 'b925' );
+insert into pa_tn_tb0 values ( 1601481626000 , 962 , 962 , 6 , 'b962' );
+insert into pa_tn_tb0 values ( 1601481627000 , 999 , 999 , 7 , 'b999' );
+insert into pa_tn_tb0 values ( 1601481628000 , 36 , 36 , 8 , 'b36' );
+insert into pa_tn_tb0 values ( 1601481629000 , 73 , 73 , 9 , 'b73' );
+insert into pa_tn_tb0 values ( 1601481630000 , 110 , 110 , 0 , 'b110' );
+insert into pa_tn_tb0 values ( 1601481631000 , 147 , 147 , 1 , 'b147' );
+insert into pa_tn_tb0 values ( 1601481632000 , 184 , 184 , 2 , 'b184' );
+insert into pa_tn_tb0 values ( 1601481633000 , 221 , 221 , 3 , 'b221' );
+insert into pa_tn_tb0 values ( 1601481634000 , 258 , 258 , 4 , 'b258' );
+insert into pa_tn_tb0 values ( 1601481635000 , 295 , 295 , 5 , 'b295' );
+insert into pa_tn_tb0 values ( 1601481636000 , 332 , 332 , 6 , 'b332' );
+insert into pa_tn_tb0 values ( 1601481637000 , 369 , 369 , 7 , 'b369' );
+insert into pa_tn_tb0 values ( 1601481638000 , 406 , 406 , 8 , 'b406' );
+insert into pa_tn_tb0 values ( 1601481639000 , 443 , 443 , 9 , 'b443' );
+insert into pa_tn_tb0 values ( 1601481640000 , 480 , 480 , 0 , 'b480' );
+insert into pa_tn_tb0 values ( 1601481641000 , 517 , 517 , 1 , 'b517' );
+insert into pa_tn_tb0 values ( 1601481642000 , 554 , 554 , 2 , 'b554' );
+insert into pa_tn_tb0 values ( 1601481643000 , 591 , 591 , 3 , 'b591' );
+insert into pa_tn_tb0 values ( 1601481644000 , 628 , 628 , 4 , 'b628' );
+insert into pa_tn_tb0 values ( 1601481645000 , 665 , 665 , 5 , 'b665' );
+insert into pa_tn_tb0 values ( 1601481646000 , 702 , 702 , 6 , 'b702' );
+insert into pa_tn_tb0 values ( 1601481647000 , 739 , 739 , 7 , 'b739' );
+insert into pa_tn_tb0 values ( 1601481648000 , 776 , 776 , 8 , 'b776' );
+insert into pa_tn_tb0 values ( 1601481649000 , 813 , 813 , 9 , 'b813' );
+insert into pa_tn_tb0 values ( 1601481650000 , 850 , NULL , 0 , 'b850' );
+insert into pa_tn_tb0 values ( 1601481651000 , 887 , 887 , 1 , 'b887' );
+insert into pa_tn_tb0 values ( 1601481652000 , 924 , 924 , 2 , 'b924' );
+insert into pa_tn_tb0 values ( 1601481653000 , 961 , 961 , 3 , 'b961' );
+insert into pa_tn_tb0 values ( 1601481654000 , 998 , 998 , 4 , 'b998' );
+insert into pa_tn_tb0 values ( 1601481655000 , 35 , 35 , 5 , 'b35' );
+insert into pa_tn_tb0 values ( 1601481656000 , 72 , 72 , 6 , 'b72' );
+insert into pa_tn_tb0 values ( 1601481657000 , 109 , 109 , 7 , 'b109' );
+insert into pa_tn_tb0 values ( 1601481658000 , 146 , 146 , 8 , 'b146' );
+insert into pa_tn_tb0 values ( 1601481659000 , 183 , 183 , 9 , 'b183' );
+insert into pa_tn_tb0 values ( 1601481660000 , 220 , 220 , 0 , 'b220' );
+insert into pa_tn_tb0 values ( 1601481661000 , 257 , 257 , 1 , 'b257' );
+insert into pa_tn_tb0 values ( 1601481662000 , 294 , 294 , 2 , 'b294' );
+insert into pa_tn_tb0 values ( 1601481663000 , 331 , 331 , 3 , 'b331' );
+insert into pa_tn_tb0 values ( 1601481664000 , 368 , 368 , 4 , 'b368' );
+insert into pa_tn_tb0 values ( 1601481665000 , 405 , 405 , 5 , 'b405' );
+insert into pa_tn_tb0 values ( 1601481666000 , 442 , 442 , 6 , 'b442' );
+insert into pa_tn_tb0 values ( 1601481667000 , 479 , 479 , 7 , 'b479' );
+insert into pa_tn_tb0 values ( 1601481668000 , 516 , 516 , 8 , 'b516' );
+insert into pa_tn_tb0 values ( 1601481669000 , 553 , 553 , 9 , 'b553' );
+insert into pa_tn_tb0 values ( 1601481670000 , 590 , 590 , 0 , 'b590' );
+insert into pa_tn_tb0 values ( 1601481671000 , 627 , 627 , 1 , 'b627' );
+insert into pa_tn_tb0 values ( 1601481672000 , 664 , 664 , 2 , 'b664' );
+insert into pa_tn_tb0 values ( 1601481673000 , 701 , 701 , 3 , 'b701' );
+insert into pa_tn_tb0 values ( 1601481674000 , 738 , 738 , 4 , 'b738' );
+insert into pa_tn_tb0 values ( 1601481675000 , 775 , 775 , 5 , 'b775' );
+insert into pa_tn_tb0 values ( 1601481676000 , 812 , 812 , 6 , 'b812' );
+insert into pa_tn_tb0 values ( 1601481677000 , 849 , 849 , 7 , 'b849' );
+insert into pa_tn_tb0 values ( 1601481678000 , 886 , 886 , 8 , 'b886' );
+insert into pa_tn_tb0 values ( 1601481679000 , 923 , 923 , 9 , 'b923' );
+insert into pa_tn_tb0 values ( 1601481680000 , 960 , 960 , 0 , 'b960' );
+insert into pa_tn_tb0 values ( 1601481681000 , 997 , 997 , 1 , 'b997' );
+insert into pa_tn_tb0 values ( 1601481682000 , 34 , 34 , 2 , 'b34' );
+insert into pa_tn_tb0 values ( 1601481683000 , 71 , 71 , 3 , 'b71' );
+insert into pa_tn_tb0 values ( 1601481684000 , 108 , 108 , 4 , 'b108' );
+insert into pa_tn_tb0 values ( 1601481685000 , 145 , 145 , 5 , 'b145' );
+insert into pa_tn_tb0 values ( 1601481686000 , 182 , 182 , 6 , 'b182' );
+insert into pa_tn_tb0 values ( 1601481687000 , 219 , 219 , 7 , 'b219' );
+insert into pa_tn_tb0 values ( 1601481688000 , 256 , 256 , 8 , 'b256' );
+insert into pa_tn_tb0 values ( 1601481689000 , 293 , 293 , 9 , 'b293' );
+insert into pa_tn_tb0 values ( 1601481690000 , 330 , 330 , 0 , 'b330' );
+insert into pa_tn_tb0 values ( 1601481691000 , 367 , 367 , 1 , 'b367' );
+insert into pa_tn_tb0 values ( 1601481692000 , 404 , 404 , 2 , 'b404' );
+insert into pa_tn_tb0 values ( 1601481693000 , 441 , 441 , 3 , 'b441' );
+insert into pa_tn_tb0 values ( 1601481694000 , 478 , 478 , 4 , 'b478' );
+insert into pa_tn_tb0 values ( 1601481695000 , 515 , 515 , 5 , 'b515' );
+insert into pa_tn_tb0 values ( 1601481696000 , 552 , 552 , 6 , 'b552' );
+insert into pa_tn_tb0 values ( 1601481697000 , 589 , 589 , 7 , 'b589' );
+insert into pa_tn_tb0 values ( 1601481698000 , 626 , 626 , 8 , 'b626' );
+insert into pa_tn_tb0 values ( 1601481699000 , 663 , 663 , 9 , 'b663' );
+insert into pa_tn_tb0 values ( 1601481700000 , 700 , NULL , 0 , 'b700' );
+insert into pa_tn_tb0 values ( 1601481701000 , 737 , 737 , 1 , 'b737' );
+insert into pa_tn_tb0 values ( 1601481702000 , 774 , 774 , 2 , 'b774' );
+insert into pa_tn_tb0 values ( 1601481703000 , 811 , 811 , 3 , 'b811' );
+insert into pa_tn_tb0 values ( 1601481704000 , 848 , 848 , 4 , 'b848' );
+insert into pa_tn_tb0 values ( 1601481705000 , 885 , 885 , 5 , 'b885' );
+insert into pa_tn_tb0 values ( 1601481706000 , 922 , 922 , 6 , 'b922' );
+insert into pa_tn_tb0 values ( 1601481707000 , 959 , 959 , 7 , 'b959' );
+insert into pa_tn_tb0 values ( 1601481708000 , 996 , 996 , 8 , 'b996' );
+insert into pa_tn_tb0 values ( 1601481709000 , 33 , 33 , 9 , 'b33' );
+insert into pa_tn_tb0 values ( 1601481710000 , 70 , 70 , 0 , 'b70' );
+insert into pa_tn_tb0 values ( 1601481711000 , 107 , 107 , 1 , 'b107' );
+insert into pa_tn_tb0 values ( 1601481712000 , 144 , 144 , 2 , 'b144' );
+insert into pa_tn_tb0 values ( 1601481713000 , 181 , 181 , 3 , 'b181' );
+insert into pa_tn_tb0 values ( 1601481714000 , 218 , 218 , 4 , 'b218' );
+insert into pa_tn_tb0 values ( 1601481715000 , 255 , 255 , 5 , 'b255' );
+insert into pa_tn_tb0 values ( 1601481716000 , 292 , 292 , 6 , 'b292' );
+insert into pa_tn_tb0 values ( 1601481717000 , 329 , 329 , 7 , 'b329' );
+insert into pa_tn_tb0 values ( 1601481718000 , 366 , 366 , 8 , 'b366' );
+insert into pa_tn_tb0 values ( 1601481719000 , 403 , 403 , 9 , 'b403' );
+insert into pa_tn_tb0 values ( 1601481720000 , 440 , 440 , 0 , 'b440' );
+insert into pa_tn_tb0 values ( 1601481721000 , 477 , 477 , 1 , 'b477' );
+insert into pa_tn_tb0 values ( 1601481722000 , 514 , 514 , 2 , 'b514' );
+insert into pa_tn_tb0 values ( 1601481723000 , 551 , 551 , 3 , 'b551' );
+insert into pa_tn_tb0 values ( 1601481724000 , 588 , 588 , 4 , 'b588' );
+insert into pa_tn_tb0 values ( 1601481725000 , 625 , 625 , 5 , 'b625' );
+insert into pa_tn_tb0 values ( 1601481726000 , 662 , 662 , 6 , 'b662' );
+insert into pa_tn_tb0 values ( 1601481727000 , 699 , 699 , 7 , 'b699' );
+insert into pa_tn_tb0 values ( 1601481728000 , 736 , 736 , 8 , 'b736' );
+insert into pa_tn_tb0 values ( 1601481729000 , 773 , 773 , 9 , 'b773' );
+insert into pa_tn_tb0 values ( 1601481730000 , 810 , 810 , 0 , 'b810' );
+insert into pa_tn_tb0 values ( 1601481731000 , 847 , 847 , 1 , 'b847' );
+insert into pa_tn_tb0 values ( 1601481732000 , 884 , 884 , 2 , 'b884' );
+insert into pa_tn_tb0 values ( 1601481733000 , 921 , 921 , 3 , 'b921' );
+insert into pa_tn_tb0 values ( 1601481734000 , 958 , 958 , 4 , 'b958' );
+insert into pa_tn_tb0 values ( 1601481735000 , 995 , 995 , 5 , 'b995' );
+insert into pa_tn_tb0 values ( 1601481736000 , 32 , 32 , 6 , 'b32' );
+insert into pa_tn_tb0 values ( 1601481737000 , 69 , 69 , 7 , 'b69' );
+insert into pa_tn_tb0 values ( 1601481738000 , 106 , 106 , 8 , 'b106' );
+insert into pa_tn_tb0 values ( 1601481739000 , 143 , 143 , 9 , 'b143' );
+insert into pa_tn_tb0 values ( 1601481740000 , 180 , 180 , 0 , 'b180' );
+insert into pa_tn_tb0 values ( 1601481741000 , 217 , 217 , 1 , 'b217' );
+insert into pa_tn_tb0 values ( 1601481742000 , 254 , 254 , 2 , 'b254' );
+insert into pa_tn_tb0 values ( 1601481743000 , 291 , 291 , 3 , 'b291' );
+insert into pa_tn_tb0 values ( 1601481744000 , 328 , 328 , 4 , 'b328' );
+insert into pa_tn_tb0 values ( 1601481745000 , 365 , 365 , 5 , 'b365' );
+insert into pa_tn_tb0 values ( 1601481746000 , 402 , 402 , 6 , 'b402' );
+insert into pa_tn_tb0 values ( 1601481747000 , 439 , 439 , 7 , 'b439' );
+insert into pa_tn_tb0 values ( 1601481748000 , 476 , 476 , 8 , 'b476' );
+insert into pa_tn_tb0 values ( 1601481749000 , 513 , 513 , 9 , 'b513' );
+insert into pa_tn_tb0 values ( 1601481750000 , 550 , NULL , 0 , 'b550' );
+insert into pa_tn_tb0 values ( 1601481751000 , 587 , 587 , 1 , 'b587' );
+insert into pa_tn_tb0 values ( 1601481752000 , 624 , 624 , 2 , 'b624' );
+insert into pa_tn_tb0 values ( 1601481753000 , 661 , 661 , 3 , 'b661' );
+insert into pa_tn_tb0 values ( 1601481754000 , 698 , 698 , 4 , 'b698' );
+insert into pa_tn_tb0 values ( 1601481755000 , 735 , 735 , 5 , 'b735' );
+insert into pa_tn_tb0 values ( 1601481756000 , 772 , 772 , 6 , 'b772' );
+insert into pa_tn_tb0 values ( 1601481757000 , 809 , 809 , 7 , 'b809' );
+insert into pa_tn_tb0 values ( 1601481758000 , 846 , 846 , 8 , 'b846' );
+insert into pa_tn_tb0 values ( 1601481759000 , 883 , 883 , 9 , 'b883' );
+insert into pa_tn_tb0 values ( 1601481760000 , 920 , 920 , 0 , 'b920' );
+insert into pa_tn_tb0 values ( 1601481761000 , 957 , 957 , 1 , 'b957' );
+insert into pa_tn_tb0 values ( 1601481762000 , 994 , 994 , 2 , 'b994' );
+insert into pa_tn_tb0 values ( 1601481763000 , 31 , 31 , 3 , 'b31' );
+insert into pa_tn_tb0 values ( 1601481764000 , 68 , 68 , 4 , 'b68' );
+insert into pa_tn_tb0 values ( 1601481765000 , 105 , 105 , 5 , 'b105' );
+insert into pa_tn_tb0 values ( 1601481766000 , 142 , 142 , 6 , 'b142' );
+insert into pa_tn_tb0 values ( 1601481767000 , 179 , 179 , 7 , 'b179' );
+insert into pa_tn_tb0 values ( 1601481768000 , 216 , 216 , 8 , 'b216' );
+insert into pa_tn_tb0 values ( 1601481769000 , 253 , 253 , 9 , 'b253' );
+insert into pa_tn_tb0 values ( 1601481770000 , 290 , 290 , 0 , 'b290' );
+insert into pa_tn_tb0 values ( 1601481771000 , 327 , 327 , 1 , 'b327' );
+insert into pa_tn_tb0 values ( 1601481772000 , 364 , 364 , 2 , 'b364' );
+insert into pa_tn_tb0 values ( 1601481773000 , 401 , 401 , 3 , 'b401' );
+insert into pa_tn_tb0 values ( 1601481774000 , 438 , 438 , 4 , 'b438' );
+insert into pa_tn_tb0 values ( 1601481775000 , 475 , 475 , 5 , 'b475' );
+insert into pa_tn_tb0 values ( 1601481776000 , 512 , 512 , 6 , 'b512' );
+insert into pa_tn_tb0 values ( 1601481777000 , 549 , 549 , 7 , 'b549' );
+insert into pa_tn_tb0 values ( 1601481778000 , 586 , 586 , 8 , 'b586' );
+insert into pa_tn_tb0 values ( 1601481779000 , 623 , 623 , 9 , 'b623' );
+insert into pa_tn_tb0 values ( 1601481780000 , 660 , 660 , 0 , 'b660' );
+insert into pa_tn_tb0 values ( 1601481781000 , 697 , 697 , 1 , 'b697' );
+insert into pa_tn_tb0 values ( 1601481782000 , 734 , 734 , 2 , 'b734' );
+insert into pa_tn_tb0 values ( 1601481783000 , 771 , 771 , 3 , 'b771' );
+insert into pa_tn_tb0 values ( 1601481784000 , 808 , 808 , 4 , 'b808' );
+insert into pa_tn_tb0 values ( 1601481785000 , 845 , 845 , 5 , 'b845' );
+insert into pa_tn_tb0 values ( 1601481786000 , 882 , 882 , 6 , 'b882' );
+insert into pa_tn_tb0 values ( 1601481787000 , 919 , 919 , 7 , 'b919' );
+insert into pa_tn_tb0 values ( 1601481788000 , 956 , 956 , 8 , 'b956' );
+insert into pa_tn_tb0 values ( 1601481789000 , 993 , 993 , 9 , 'b993' );
+insert into pa_tn_tb0 values ( 1601481790000 , 30 , 30 , 0 , 'b30' );
+insert into pa_tn_tb0 values ( 1601481791000 , 67 , 67 , 1 , 'b67' );
+insert into pa_tn_tb0 values ( 1601481792000 , 104 , 104 , 2 , 'b104' );
+insert into pa_tn_tb0 values ( 1601481793000 , 141 , 141 , 3 , 'b141' );
+insert into pa_tn_tb0 values ( 1601481794000 , 178 , 178 , 4 , 'b178' );
+insert into pa_tn_tb0 values ( 1601481795000 , 215 , 215 , 5 , 'b215' );
+insert into pa_tn_tb0 values ( 1601481796000 , 252 , 252 , 6 , 'b252' );
+insert into pa_tn_tb0 values ( 1601481797000 , 289 , 289 , 7 , 'b289' );
+insert into pa_tn_tb0 values ( 1601481798000 , 326 , 326 , 8 , 'b326' );
+insert into pa_tn_tb0 values ( 1601481799000 , 363 , 363 , 9 , 'b363' );
+insert into pa_tn_tb0 values ( 1601481800000 , 400 , NULL , 0 , 'b400' );
+insert into pa_tn_tb0 values ( 1601481801000 , 437 , 437 , 1 , 'b437' );
+insert into pa_tn_tb0 values ( 1601481802000 , 474 , 474 , 2 , 'b474' );
+insert into pa_tn_tb0 values ( 1601481803000 , 511 , 511 , 3 , 'b511' );
+insert into pa_tn_tb0 values ( 1601481804000 , 548 , 548 , 4 , 'b548' );
+insert into pa_tn_tb0 values ( 1601481805000 , 585 , 585 , 5 , 'b585' );
+insert into pa_tn_tb0 values ( 1601481806000 , 622 , 622 , 6 , 'b622' );
+insert into pa_tn_tb0 values ( 1601481807000 , 659 , 659 , 7 , 'b659' );
+insert into pa_tn_tb0 values ( 1601481808000 , 696 , 696 , 8 , 'b696' );
+insert into pa_tn_tb0 values ( 1601481809000 , 733 , 733 , 9 , 'b733' );
+insert into pa_tn_tb0 values ( 1601481810000 , 770 , 770 , 0 , 'b770' );
+insert into pa_tn_tb0 values ( 1601481811000 , 807 , 807 , 1 , 'b807' );
+insert into pa_tn_tb0 values ( 1601481812000 , 844 , 844 , 2 , 'b844' );
+insert into pa_tn_tb0 values ( 1601481813000 , 881 , 881 , 3 , 'b881' );
+insert into pa_tn_tb0 values ( 1601481814000 , 918 , 918 , 4 , 'b918' );
+insert into pa_tn_tb0 values ( 1601481815000 , 955 , 955 , 5 , 'b955' );
+insert into pa_tn_tb0 values ( 1601481816000 , 992 , 992 , 6 , 'b992' );
+insert into pa_tn_tb0 values ( 1601481817000 , 29 , 29 , 7 , 'b29' );
+insert into pa_tn_tb0 values ( 1601481818000 , 66 , 66 , 8 , 'b66' );
+insert into pa_tn_tb0 values ( 1601481819000 , 103 , 103 , 9 , 'b103' );
+insert into pa_tn_tb0 values ( 1601481820000 , 140 , 140 , 0 , 'b140' );
+insert into pa_tn_tb0 values ( 1601481821000 , 177 , 177 , 1 , 'b177' );
+insert into pa_tn_tb0 values ( 1601481822000 , 214 , 214 , 2 , 'b214' );
+insert into pa_tn_tb0 values ( 1601481823000 , 251 , 251 , 3 , 'b251' );
+insert into pa_tn_tb0 values ( 1601481824000 , 288 , 288 , 4 , 'b288' );
+insert into pa_tn_tb0 values ( 1601481825000 , 325 , 325 , 5 , 'b325' );
+insert into pa_tn_tb0 values ( 1601481826000 , 362 , 362 , 6 , 'b362' );
+insert into pa_tn_tb0 values ( 1601481827000 , 399 , 399 , 7 , 'b399' );
+insert into pa_tn_tb0 values ( 1601481828000 , 436 , 436 , 8 , 'b436' );
+insert into pa_tn_tb0 values ( 1601481829000 , 473 , 473 , 9 , 'b473' );
+insert into pa_tn_tb0 values ( 1601481830000 , 510 , 510 , 0 , 'b510' );
+insert into pa_tn_tb0 values ( 1601481831000 , 547 , 547 , 1 , 'b547' );
+insert into pa_tn_tb0 values ( 1601481832000 , 584 , 584 , 2 , 'b584' );
+insert into pa_tn_tb0 values ( 1601481833000 , 621 , 621 , 3 , 'b621' );
+insert into pa_tn_tb0 values ( 1601481834000 , 658 , 658 , 4 , 'b658' );
+insert into pa_tn_tb0 values ( 1601481835000 , 695 , 695 , 5 , 'b695' );
+insert into pa_tn_tb0 values ( 1601481836000 , 732 , 732 , 6 , 'b732' );
+insert into pa_tn_tb0 values ( 1601481837000 , 769 , 769 , 7 , 'b769' );
+insert into pa_tn_tb0 values ( 1601481838000 , 806 , 806 , 8 , 'b806' );
+insert into pa_tn_tb0 values ( 1601481839000 , 843 , 843 , 9 , 'b843' );
+insert into pa_tn_tb0 values ( 1601481840000 , 880 , 880 , 0 , 'b880' );
+insert into pa_tn_tb0 values ( 1601481841000 , 917 , 917 , 1 , 'b917' );
+insert into pa_tn_tb0 values ( 1601481842000 , 954 , 954 , 2 , 'b954' );
+insert into pa_tn_tb0 values ( 1601481843000 , 991 , 991 , 3 , 'b991' );
+insert into pa_tn_tb0 values ( 1601481844000 , 28 , 28 , 4 , 'b28' );
+insert into pa_tn_tb0 values ( 1601481845000 , 65 , 65 , 5 , 'b65' );
+insert into pa_tn_tb0 values ( 1601481846000 , 102 , 102 , 6 , 'b102' );
+insert into pa_tn_tb0 values ( 1601481847000 , 139 , 139 , 7 , 'b139' );
+insert into pa_tn_tb0 values ( 1601481848000 , 176 , 176 , 8 , 'b176' );
+insert into pa_tn_tb0 values ( 1601481849000 , 213 , 213 , 9 , 'b213' );
+insert into pa_tn_tb0 values ( 1601481850000 , 250 , NULL , 0 , 'b250' );
+insert into pa_tn_tb0 values ( 1601481851000 , 287 , 287 , 1 , 'b287' );
+insert into pa_tn_tb0 values ( 1601481852000 , 324 , 324 , 2 , 'b324' );
+insert into pa_tn_tb0 values ( 1601481853000 , 361 , 361 , 3 , 'b361' );
+insert into pa_tn_tb0 values ( 1601481854000 , 398 , 398 , 4 , 'b398' );
+insert into pa_tn_tb0 values ( 1601481855000 , 435 , 435 , 5 , 'b435' );
+insert into pa_tn_tb0 values ( 1601481856000 , 472 , 472 , 6 , 'b472' );
+insert into pa_tn_tb0 values ( 1601481857000 , 509 , 509 , 7 , 'b509' );
+insert into pa_tn_tb0 values ( 1601481858000 , 546 , 546 , 8 , 'b546' );
+insert into pa_tn_tb0 values ( 1601481859000 , 583 , 583 , 9 , 'b583' );
+insert into pa_tn_tb0 values ( 1601481860000 , 620 , 620 , 0 , 'b620' );
+insert into pa_tn_tb0 values ( 1601481861000 , 657 , 657 , 1 , 'b657' );
+insert into pa_tn_tb0 values ( 1601481862000 , 694 , 694 , 2 , 'b694' );
+insert into pa_tn_tb0 values ( 1601481863000 , 731 , 731 , 3 , 'b731' );
+insert into pa_tn_tb0 values ( 1601481864000 , 768 , 768 , 4 , 'b768' );
+insert into pa_tn_tb0 values ( 1601481865000 , 805 , 805 , 5 , 'b805' );
+insert into pa_tn_tb0 values ( 1601481866000 , 842 , 842 , 6 , 'b842' );
+insert into pa_tn_tb0 values ( 1601481867000 , 879 , 879 , 7 , 'b879' );
+insert into pa_tn_tb0 values ( 1601481868000 , 916 , 916 , 8 , 'b916' );
+insert into pa_tn_tb0 values ( 1601481869000 , 953 , 953 , 9 , 'b953' );
+insert into pa_tn_tb0 values ( 1601481870000 , 990 , 990 , 0 , 'b990' );
+insert into pa_tn_tb0 values ( 1601481871000 , 27 , 27 , 1 , 'b27' );
+insert into pa_tn_tb0 values ( 1601481872000 , 64 , 64 , 2 , 'b64' );
+insert into pa_tn_tb0 values ( 1601481873000 , 101 , 101 , 3 , 'b101' );
+insert into pa_tn_tb0 values ( 1601481874000 , 138 , 138 , 4 , 'b138' );
+insert into pa_tn_tb0 values ( 1601481875000 , 175 , 175 , 5 , 'b175' );
+insert into pa_tn_tb0 values ( 1601481876000 , 212 , 212 , 6 , 'b212' );
+insert into pa_tn_tb0 values ( 1601481877000 , 249 , 249 , 7 , 'b249' );
+insert into pa_tn_tb0 values ( 1601481878000 , 286 , 286 , 8 , 'b286' );
+insert into pa_tn_tb0 values ( 1601481879000 , 323 , 323 , 9 , 'b323' );
+insert into pa_tn_tb0 values ( 1601481880000 , 360 , 360 , 0 , 'b360' );
+insert into pa_tn_tb0 values ( 1601481881000 , 397 , 397 , 1 , 'b397' );
+insert into pa_tn_tb0 values ( 1601481882000 , 434 , 434 , 2 , 'b434' );
+insert into pa_tn_tb0 values ( 1601481883000 , 471 , 471 , 3 , 'b471' );
+insert into pa_tn_tb0 values ( 1601481884000 , 508 , 508 , 4 , 'b508' );
+insert into pa_tn_tb0 values ( 1601481885000 , 545 , 545 , 5 , 'b545' );
+insert into pa_tn_tb0 values ( 1601481886000 , 582 , 582 , 6 , 'b582' );
+insert into pa_tn_tb0 values ( 1601481887000 , 619 , 619 , 7 , 'b619' );
+insert into pa_tn_tb0 values ( 1601481888000 , 656 , 656 , 8 , 'b656' );
+insert into pa_tn_tb0 values ( 1601481889000 , 693 , 693 , 9 , 'b693' );
+insert into pa_tn_tb0 values ( 1601481890000 , 730 , 730 , 0 , 'b730' );
+insert into pa_tn_tb0 values ( 1601481891000 , 767 , 767 , 1 , 'b767' );
+insert into pa_tn_tb0 values ( 1601481892000 , 804 , 804 , 2 , 'b804' );
+insert into pa_tn_tb0 values ( 1601481893000 , 841 , 841 , 3 , 'b841' );
+insert into pa_tn_tb0 values ( 1601481894000 , 878 , 878 , 4 , 'b878' );
+insert into pa_tn_tb0 values ( 1601481895000 , 915 , 915 , 5 , 'b915' );
+insert into pa_tn_tb0 values ( 1601481896000 , 952 , 952 , 6 , 'b952' );
+insert into pa_tn_tb0 values ( 1601481897000 , 989 , 989 , 7 , 'b989' );
+insert into pa_tn_tb0 values ( 1601481898000 , 26 , 26 , 8 , 'b26' );
+insert into pa_tn_tb0 values ( 1601481899000 , 63 , 63 , 9 , 'b63' );
+insert into pa_tn_tb0 values ( 1601481900000 , 100 , NULL , 0 , 'b100' );
+insert into pa_tn_tb0 values ( 1601481901000 , 137 , 137 , 1 , 'b137' );
+insert into pa_tn_tb0 values ( 1601481902000 , 174 , 174 , 2 , 'b174' );
+insert into pa_tn_tb0 values ( 1601481903000 , 211 , 211 , 3 , 'b211' );
+insert into pa_tn_tb0 values ( 1601481904000 , 248 , 248 , 4 , 'b248' );
+insert into pa_tn_tb0 values ( 1601481905000 , 285 , 285 , 5 , 'b285' );
+insert into pa_tn_tb0 values ( 1601481906000 , 322 , 322 , 6 , 'b322' );
+insert into pa_tn_tb0 values ( 1601481907000 , 359 , 359 , 7 , 'b359' );
+insert into pa_tn_tb0 values ( 1601481908000 , 396 , 396 , 8 , 'b396' );
+insert into pa_tn_tb0 values ( 1601481909000 , 433 , 433 , 9 , 'b433' );
+insert into pa_tn_tb0 values ( 1601481910000 , 470 , 470 , 0 , 'b470' );
+insert into pa_tn_tb0 values ( 1601481911000 , 507 , 507 , 1 , 'b507' );
+insert into pa_tn_tb0 values ( 1601481912000 , 544 , 544 , 2 , 'b544' );
+insert into pa_tn_tb0 values ( 1601481913000 , 581 , 581 , 3 , 'b581' );
+insert into pa_tn_tb0 values ( 1601481914000 , 618 , 618 , 4 , 'b618' );
+insert into pa_tn_tb0 values ( 1601481915000 , 655 , 655 , 5 , 'b655' );
+insert into pa_tn_tb0 values ( 1601481916000 , 692 , 692 , 6 , 'b692' );
+insert into pa_tn_tb0 values ( 1601481917000 , 729 , 729 , 7 , 'b729' );
+insert into pa_tn_tb0 values ( 1601481918000 , 766 , 766 , 8 , 'b766' );
+insert into pa_tn_tb0 values ( 1601481919000 , 803 , 803 , 9 , 'b803' );
+insert into pa_tn_tb0 values ( 1601481920000 , 840 , 840 , 0 , 'b840' );
+insert into pa_tn_tb0 values ( 1601481921000 , 877 , 877 , 1 , 'b877' );
+insert into pa_tn_tb0 values ( 1601481922000 , 914 , 914 , 2 , 'b914' );
+insert into pa_tn_tb0 values ( 1601481923000 , 951 , 951 , 3 , 'b951' );
+insert into pa_tn_tb0 values ( 1601481924000 , 988 , 988 , 4 , 'b988' );
+insert into pa_tn_tb0 values ( 1601481925000 , 25 , 25 , 5 , 'b25' );
+insert into pa_tn_tb0 values ( 1601481926000 , 62 , 62 , 6 , 'b62' );
+insert into pa_tn_tb0 values ( 1601481927000 , 99 , 99 , 7 , 'b99' );
+insert into pa_tn_tb0 values ( 1601481928000 , 136 , 136 , 8 , 'b136' );
+insert into pa_tn_tb0 values ( 1601481929000 , 173 , 173 , 9 , 'b173' );
+insert into pa_tn_tb0 values ( 1601481930000 , 210 , 210 , 0 , 'b210' );
+insert into pa_tn_tb0 values ( 1601481931000 , 247 , 247 , 1 , 'b247' );
+insert into pa_tn_tb0 values ( 1601481932000 , 284 , 284 , 2 , 'b284' );
+insert into pa_tn_tb0 values ( 1601481933000 , 321 , 321 , 3 , 'b321' );
+insert into pa_tn_tb0 values ( 1601481934000 , 358 , 358 , 4 , 'b358' );
+insert into pa_tn_tb0 values ( 1601481935000 , 395 , 395 , 5 , 'b395' );
+insert into pa_tn_tb0 values ( 1601481936000 , 432 , 432 , 6 , 'b432' );
+insert into pa_tn_tb0 values ( 1601481937000 , 469 , 469 , 7 , 'b469' );
+insert into pa_tn_tb0 values ( 1601481938000 , 506 , 506 , 8 , 'b506' );
+insert into pa_tn_tb0 values ( 1601481939000 , 543 , 543 , 9 , 'b543' );
+insert into pa_tn_tb0 values ( 1601481940000 , 580 , 580 , 0 , 'b580' );
+insert into pa_tn_tb0 values ( 1601481941000 , 617 , 617 , 1 , 'b617' );
+insert into pa_tn_tb0 values ( 1601481942000 , 654 , 654 , 2 , 'b654' );
+insert into pa_tn_tb0 values ( 1601481943000 , 691 , 691 , 3 , 'b691' );
+insert into pa_tn_tb0 values ( 1601481944000 , 728 , 728 , 4 , 'b728' );
+insert into pa_tn_tb0 values ( 1601481945000 , 765 , 765 , 5 , 'b765' );
+insert into pa_tn_tb0 values ( 1601481946000 , 802 , 802 , 6 , 'b802' );
+insert into pa_tn_tb0 values ( 1601481947000 , 839 , 839 , 7 , 'b839' );
+insert into pa_tn_tb0 values ( 1601481948000 , 876 , 876 , 8 , 'b876' );
+insert into pa_tn_tb0 values ( 1601481949000 , 913 , 913 , 9 , 'b913' );
+insert into pa_tn_tb0 values ( 1601481950000 , 950 , NULL , 0 , 'b950' );
+insert into pa_tn_tb0 values ( 1601481951000 , 987 , 987 , 1 , 'b987' );
+insert into pa_tn_tb0 values ( 1601481952000 , 24 , 24 , 2 , 'b24' );
+insert into pa_tn_tb0 values ( 1601481953000 , 61 , 61 , 3 , 'b61' );
+insert into pa_tn_tb0 values ( 1601481954000 , 98 , 98 , 4 , 'b98' );
+insert into pa_tn_tb0 values ( 1601481955000 , 135 , 135 , 5 , 'b135' );
+insert into pa_tn_tb0 values ( 1601481956000 , 172 , 172 , 6 , 'b172' );
+insert into pa_tn_tb0 values ( 1601481957000 , 209 , 209 , 7 , 'b209' );
+insert into pa_tn_tb0 values ( 1601481958000 , 246 , 246 , 8 , 'b246' );
+insert into pa_tn_tb0 values ( 1601481959000 , 283 , 283 , 9 , 'b283' );
+insert into pa_tn_tb0 values ( 1601481960000 , 320 , 320 , 0 , 'b320' );
+insert into pa_tn_tb0 values ( 1601481961000 , 357 , 357 , 1 , 'b357' );
+insert into pa_tn_tb0 values ( 1601481962000 , 394 , 394 , 2 , 'b394' );
+insert into pa_tn_tb0 values ( 1601481963000 , 431 , 431 , 3 , 'b431' );
+insert into pa_tn_tb0 values ( 1601481964000 , 468 , 468 , 4 , 'b468' );
+insert into pa_tn_tb0 values ( 1601481965000 , 505 , 505 , 5 , 'b505' );
+insert into pa_tn_tb0 values ( 1601481966000 , 542 , 542 , 6 , 'b542' );
+insert into pa_tn_tb0 values ( 1601481967000 , 579 , 579 , 7 , 'b579' );
+insert into pa_tn_tb0 values ( 1601481968000 , 616 , 616 , 8 , 'b616' );
+insert into pa_tn_tb0 values ( 1601481969000 , 653 , 653 , 9 , 'b653' );
+insert into pa_tn_tb0 values ( 1601481970000 , 690 , 690 , 0 , 'b690' );
+insert into pa_tn_tb0 values ( 1601481971000 , 727 , 727 , 1 , 'b727' );
+insert into pa_tn_tb0 values ( 1601481972000 , 764 , 764 , 2 , 'b764' );
+insert into pa_tn_tb0 values ( 1601481973000 , 801 , 801 , 3 , 'b801' );
+insert into pa_tn_tb0 values ( 1601481974000 , 838 , 838 , 4 , 'b838' );
+insert into pa_tn_tb0 values ( 1601481975000 , 875 , 875 , 5 , 'b875' );
+insert into pa_tn_tb0 values ( 1601481976000 , 912 , 912 , 6 , 'b912' );
+insert into pa_tn_tb0 values ( 1601481977000 , 949 , 949 , 7 , 'b949' );
+insert into pa_tn_tb0 values ( 1601481978000 , 986 , 986 , 8 , 'b986' );
+insert into pa_tn_tb0 values ( 1601481979000 , 23 , 23 , 9 , 'b23' );
+insert into pa_tn_tb0 values ( 1601481980000 , 60 , 60 , 0 , 'b60' );
+insert into pa_tn_tb0 values ( 1601481981000 , 97 , 97 , 1 , 'b97' );
+insert into pa_tn_tb0 values ( 1601481982000 , 134 , 134 , 2 , 'b134' );
+insert into pa_tn_tb0 values ( 1601481983000 , 171 , 171 , 3 , 'b171' );
+insert into pa_tn_tb0 values ( 1601481984000 , 208 , 208 , 4 , 'b208' );
+insert into pa_tn_tb0 values ( 1601481985000 , 245 , 245 , 5 , 'b245' );
+insert into pa_tn_tb0 values ( 1601481986000 , 282 , 282 , 6 , 'b282' );
+insert into pa_tn_tb0 values ( 1601481987000 , 319 , 319 , 7 , 'b319' );
+insert into pa_tn_tb0 values ( 1601481988000 , 356 , 356 , 8 , 'b356' );
+insert into pa_tn_tb0 values ( 1601481989000 , 393 , 393 , 9 , 'b393' );
+insert into pa_tn_tb0 values ( 1601481990000 , 430 , 430 , 0 , 'b430' );
+insert into pa_tn_tb0 values ( 1601481991000 , 467 , 467 , 1 , 'b467' );
+insert into pa_tn_tb0 values ( 1601481992000 , 504 , 504 , 2 , 'b504' );
+insert into pa_tn_tb0 values ( 1601481993000 , 541 , 541 , 3 , 'b541' );
+insert into pa_tn_tb0 values ( 1601481994000 , 578 , 578 , 4 , 'b578' );
+insert into pa_tn_tb0 values ( 1601481995000 , 615 , 615 , 5 , 'b615' );
+insert into pa_tn_tb0 values ( 1601481996000 , 652 , 652 , 6 , 'b652' );
+insert into pa_tn_tb0 values ( 1601481997000 , 689 , 689 , 7 , 'b689' );
+insert into pa_tn_tb0 values ( 1601481998000 , 726 , 726 , 8 , 'b726' );
+insert into pa_tn_tb0 values ( 1601481999000 , 763 , 763 , 9 , 'b763' );
+insert into pa_tn_tb0 values ( 1601482000000 , 800 , NULL , 0 , 'b800' );
+insert into pa_tn_tb0 values ( 1601482001000 , 837 , 837 , 1 , 'b837' );
+insert into pa_tn_tb0 values ( 1601482002000 , 874 , 874 , 2 , 'b874' );
+insert into pa_tn_tb0 values ( 1601482003000 , 911 , 911 , 3 , 'b911' );
+insert into pa_tn_tb0 values ( 1601482004000 , 948 , 948 , 4 , 'b948' );
+insert into pa_tn_tb0 values ( 1601482005000 , 985 , 985 , 5 , 'b985' );
+insert into pa_tn_tb0 values ( 1601482006000 , 22 , 22 , 6 , 'b22' );
+insert into pa_tn_tb0 values ( 1601482007000 , 59 , 59 , 7 , 'b59' );
+insert into pa_tn_tb0 values ( 1601482008000 , 96 , 96 , 8 , 'b96' );
+insert into pa_tn_tb0 values ( 1601482009000 , 133 , 133 , 9 , 'b133' );
+insert into pa_tn_tb0 values ( 1601482010000 , 170 , 170 , 0 , 'b170' );
+insert into pa_tn_tb0 values ( 1601482011000 , 207 , 207 , 1 , 'b207' );
+insert into pa_tn_tb0 values ( 1601482012000 , 244 , 244 , 2 , 'b244' );
+insert into pa_tn_tb0 values ( 1601482013000 , 281 , 281 , 3 , 'b281' );
+insert into pa_tn_tb0 values ( 1601482014000 , 318 , 318 , 4 , 'b318' );
+insert into pa_tn_tb0 values ( 1601482015000 , 355 , 355 , 5 , 'b355' );
+insert into pa_tn_tb0 values ( 1601482016000 , 392 , 392 , 6 , 'b392' );
+insert into pa_tn_tb0 values ( 1601482017000 , 429 , 429 , 7 , 'b429' );
+insert into pa_tn_tb0 values ( 1601482018000 , 466 , 466 , 8 , 'b466' );
+insert into pa_tn_tb0 values ( 1601482019000 , 503 , 503 , 9 , 'b503' );
+insert into pa_tn_tb0 values ( 1601482020000 , 540 , 540 , 0 , 'b540' );
+insert into pa_tn_tb0 values ( 1601482021000 , 577 , 577 , 1 , 'b577' );
+insert into pa_tn_tb0 values ( 1601482022000 , 614 , 614 , 2 , 'b614' );
+insert into pa_tn_tb0 values ( 1601482023000 , 651 , 651 , 3 , 'b651' );
+insert into pa_tn_tb0 values ( 1601482024000 , 688 , 688 , 4 , 'b688' );
+insert into pa_tn_tb0 values ( 1601482025000 , 725 , 725 , 5 , 'b725' );
+insert into pa_tn_tb0 values ( 1601482026000 , 762 , 762 , 6 , 'b762' );
+insert into pa_tn_tb0 values ( 1601482027000 , 799 , 799 , 7 , 'b799' );
+insert into pa_tn_tb0 values ( 1601482028000 , 836 , 836 , 8 , 'b836' );
+insert into pa_tn_tb0 values ( 1601482029000 , 873 , 873 , 9 , 'b873' );
+insert into pa_tn_tb0 values ( 1601482030000 , 910 , 910 , 0 , 'b910' );
+insert into pa_tn_tb0 values ( 1601482031000 , 947 , 947 , 1 , 'b947' );
+insert into pa_tn_tb0 values ( 1601482032000 , 984 , 984 , 2 , 'b984' );
+insert into pa_tn_tb0 values ( 1601482033000 , 21 , 21 , 3 , 'b21' );
+insert into pa_tn_tb0 values ( 1601482034000 , 58 , 58 , 4 , 'b58' );
+insert into pa_tn_tb0 values ( 1601482035000 , 95 , 95 , 5 , 'b95' );
+insert into pa_tn_tb0 values ( 1601482036000 , 132 , 132 , 6 , 'b132' );
+insert into pa_tn_tb0 values ( 1601482037000 , 169 , 169 , 7 , 'b169' );
+insert into pa_tn_tb0 values ( 1601482038000 , 206 , 206 , 8 , 'b206' );
+insert into pa_tn_tb0 values ( 1601482039000 , 243 , 243 , 9 , 'b243' );
+insert into pa_tn_tb0 values ( 1601482040000 , 280 , 280 , 0 , 'b280' );
+insert into pa_tn_tb0 values ( 1601482041000 , 317 , 317 , 1 , 'b317' );
+insert into pa_tn_tb0 values ( 1601482042000 , 354 , 354 , 2 , 'b354' );
+insert into pa_tn_tb0 values ( 1601482043000 , 391 , 391 , 3 , 'b391' );
+insert into pa_tn_tb0 values ( 1601482044000 , 428 , 428 , 4 , 'b428' );
+insert into pa_tn_tb0 values ( 1601482045000 , 465 , 465 , 5 , 'b465' );
+insert into pa_tn_tb0 values ( 1601482046000 , 502 , 502 , 6 , 'b502' );
+insert into pa_tn_tb0 values ( 1601482047000 , 539 , 539 , 7 , 'b539' );
+insert into pa_tn_tb0 values ( 1601482048000 , 576 , 576 , 8 , 'b576' );
+insert into pa_tn_tb0 values ( 1601482049000 , 613 , 613 , 9 , 'b613' );
+insert into pa_tn_tb0 values ( 1601482050000 , 650 , NULL , 0 , 'b650' );
+insert into pa_tn_tb0 values ( 1601482051000 , 687 , 687 , 1 , 'b687' );
+insert into pa_tn_tb0 values ( 1601482052000 , 724 , 724 , 2 , 'b724' );
+insert into pa_tn_tb0 values ( 1601482053000 , 761 , 761 , 3 , 'b761' );
+insert into pa_tn_tb0 values ( 1601482054000 , 798 , 798 , 4 , 'b798' );
+insert into pa_tn_tb0 values ( 1601482055000 , 835 , 835 , 5 , 'b835' );
+insert into pa_tn_tb0 values ( 1601482056000 , 872 , 872 , 6 , 'b872' );
+insert into pa_tn_tb0 values ( 1601482057000 , 909 , 909 , 7 , 'b909' );
+insert into pa_tn_tb0 values ( 1601482058000 , 946 , 946 , 8 , 'b946' );
+insert into pa_tn_tb0 values ( 1601482059000 , 983 , 983 , 9 , 'b983' );
+insert into pa_tn_tb0 values ( 1601482060000 , 20 , 20 , 0 , 'b20' );
+insert into pa_tn_tb0 values ( 1601482061000 , 57 , 57 , 1 , 'b57' );
+insert into pa_tn_tb0 values ( 1601482062000 , 94 , 94 , 2 , 'b94' );
+insert into pa_tn_tb0 values ( 1601482063000 , 131 , 131 , 3 , 'b131' );
+insert into pa_tn_tb0 values ( 1601482064000 , 168 , 168 , 4 , 'b168' );
+insert into pa_tn_tb0 values ( 1601482065000 , 205 , 205 , 5 , 'b205' );
+insert into pa_tn_tb0 values ( 1601482066000 , 242 , 242 , 6 , 'b242' );
+insert into pa_tn_tb0 values ( 1601482067000 , 279 , 279 , 7 , 'b279' );
+insert into pa_tn_tb0 values ( 1601482068000 , 316 , 316 , 8 , 'b316' );
+insert into pa_tn_tb0 values ( 1601482069000 , 353 , 353 , 9 , 'b353' );
+insert into pa_tn_tb0 values ( 1601482070000 , 390 , 390 , 0 , 'b390' );
+insert into pa_tn_tb0 values ( 1601482071000 , 427 , 427 , 1 , 'b427' );
+insert into pa_tn_tb0 values ( 1601482072000 , 464 , 464 , 2 , 'b464' );
+insert into pa_tn_tb0 values ( 1601482073000 , 501 , 501 , 3 , 'b501' );
+insert into pa_tn_tb0 values ( 1601482074000 , 538 , 538 , 4 , 'b538' );
+insert into pa_tn_tb0 values ( 1601482075000 , 575 , 575 , 5 , 'b575' );
+insert into pa_tn_tb0 values ( 1601482076000 , 612 , 612 , 6 , 'b612' );
+insert into pa_tn_tb0 values ( 1601482077000 , 649 , 649 , 7 , 'b649' );
+insert into pa_tn_tb0 values ( 1601482078000 , 686 , 686 , 8 , 'b686' );
+insert into pa_tn_tb0 values ( 1601482079000 , 723 , 723 , 9 , 'b723' );
+insert into pa_tn_tb0 values ( 1601482080000 , 760 , 760 , 0 , 'b760' );
+insert into pa_tn_tb0 values ( 1601482081000 , 797 , 797 , 1 , 'b797' );
+insert into pa_tn_tb0 values ( 1601482082000 , 834 , 834 , 2 , 'b834' );
+insert into pa_tn_tb0 values ( 1601482083000 , 871 , 871 , 3 , 'b871' );
+insert into pa_tn_tb0 values ( 1601482084000 , 908 , 908 , 4 , 'b908' );
+insert into pa_tn_tb0 values ( 1601482085000 , 945 , 945 , 5 , 'b945' );
+insert into pa_tn_tb0 values ( 1601482086000 , 982 , 982 , 6 , 'b982' );
+insert into pa_tn_tb0 values ( 1601482087000 , 19 , 19 , 7 , 'b19' );
+insert into pa_tn_tb0 values ( 1601482088000 , 56 , 56 , 8 , 'b56' );
+insert into pa_tn_tb0 values ( 1601482089000 , 93 , 93 , 9 , 'b93' );
+insert into pa_tn_tb0 values ( 1601482090000 , 130 , 130 , 0 , 'b130' );
+insert into pa_tn_tb0 values ( 1601482091000 , 167 , 167 , 1 , 'b167' );
+insert into pa_tn_tb0 values ( 1601482092000 , 204 , 204 , 2 , 'b204' );
+insert into pa_tn_tb0 values ( 1601482093000 , 241 , 241 , 3 , 'b241' );
+insert into pa_tn_tb0 values ( 1601482094000 , 278 , 278 , 4 , 'b278' );
+insert into pa_tn_tb0 values ( 1601482095000 , 315 , 315 , 5 , 'b315' );
+insert into pa_tn_tb0 values ( 1601482096000 , 352 , 352 , 6 , 'b352' );
+insert into pa_tn_tb0 values ( 1601482097000 , 389 , 389 , 7 , 'b389' );
+insert into pa_tn_tb0 values ( 1601482098000 , 426 , 426 , 8 , 'b426' );
+insert into pa_tn_tb0 values ( 1601482099000 , 463 , 463 , 9 , 'b463' );
+insert into pa_tn_tb0 values ( 1601482100000 , 500 , NULL , 0 , 'b500' );
+insert into pa_tn_tb0 values ( 1601482101000 , 537 , 537 , 1 , 'b537' );
+insert into pa_tn_tb0 values ( 1601482102000 , 574 , 574 , 2 , 'b574' );
+insert into pa_tn_tb0 values ( 1601482103000 , 611 , 611 , 3 , 'b611' );
+insert into pa_tn_tb0 values ( 1601482104000 , 648 , 648 , 4 , 'b648' );
+insert into pa_tn_tb0 values ( 1601482105000 , 685 , 685 , 5 , 'b685' );
+insert into pa_tn_tb0 values ( 1601482106000 , 722 , 722 , 6 , 'b722' );
+insert into pa_tn_tb0 values ( 1601482107000 , 759 , 759 , 7 , 'b759' );
+insert into pa_tn_tb0 values ( 1601482108000 , 796 , 796 , 8 , 'b796' );
+insert into pa_tn_tb0 values ( 1601482109000 , 833 , 833 , 9 , 'b833' );
+insert into pa_tn_tb0 values ( 1601482110000 , 870 , 870 , 0 , 'b870' );
+insert into pa_tn_tb0 values ( 1601482111000 , 907 , 907 , 1 , 'b907' );
+insert into pa_tn_tb0 values ( 1601482112000 , 944 , 944 , 2 , 'b944' );
+insert into pa_tn_tb0 values ( 1601482113000 , 981 , 981 , 3 , 'b981' );
+insert into pa_tn_tb0 values ( 1601482114000 , 18 , 18 , 4 , 'b18' );
+insert into pa_tn_tb0 values ( 1601482115000 , 55 , 55 , 5 , 'b55' );
+insert into pa_tn_tb0 values ( 1601482116000 , 92 , 92 , 6 , 'b92' );
+insert into pa_tn_tb0 values ( 1601482117000 , 129 , 129 , 7 , 'b129' );
+insert into pa_tn_tb0 values ( 1601482118000 , 166 , 166 , 8 , 'b166' );
+insert into pa_tn_tb0 values ( 1601482119000 , 203 , 203 , 9 , 'b203' );
+insert into pa_tn_tb0 values ( 1601482120000 , 240 , 240 , 0 , 'b240' );
+insert into pa_tn_tb0 values ( 1601482121000 , 277 , 277 , 1 , 'b277' );
+insert into pa_tn_tb0 values ( 1601482122000 , 314 , 314 , 2 , 'b314' );
+insert into pa_tn_tb0 values ( 1601482123000 , 351 , 351 , 3 , 'b351' );
+insert into pa_tn_tb0 values ( 1601482124000 , 388 , 388 , 4 , 'b388' );
+insert into pa_tn_tb0 values ( 1601482125000 , 425 , 425 , 5 , 'b425' );
+insert into pa_tn_tb0 values ( 1601482126000 , 462 , 462 , 6 , 'b462' );
+insert into pa_tn_tb0 values ( 1601482127000 , 499 , 499 , 7 , 'b499' );
+insert into pa_tn_tb0 values ( 1601482128000 , 536 , 536 , 8 , 'b536' );
+insert into pa_tn_tb0 values ( 1601482129000 , 573 , 573 , 9 , 'b573' );
+insert into pa_tn_tb0 values ( 1601482130000 , 610 , 610 , 0 , 'b610' );
+insert into pa_tn_tb0 values ( 1601482131000 , 647 , 647 , 1 , 'b647' );
+insert into pa_tn_tb0 values ( 1601482132000 , 684 , 684 , 2 , 'b684' );
+insert into pa_tn_tb0 values ( 1601482133000 , 721 , 721 , 3 , 'b721' );
+insert into pa_tn_tb0 values ( 1601482134000 , 758 , 758 , 4 , 'b758' );
+insert into pa_tn_tb0 values ( 1601482135000 , 795 , 795 , 5 , 'b795' );
+insert into pa_tn_tb0 values ( 1601482136000 , 832 , 832 , 6 , 'b832' );
+insert into pa_tn_tb0 values ( 1601482137000 , 869 , 869 , 7 , 'b869' );
+insert into pa_tn_tb0 values ( 1601482138000 , 906 , 906 , 8 , 'b906' );
+insert into pa_tn_tb0 values ( 1601482139000 , 943 , 943 , 9 , 'b943' );
+insert into pa_tn_tb0 values ( 1601482140000 , 980 , 980 , 0 , 'b980' );
+insert into pa_tn_tb0 values ( 1601482141000 , 17 , 17 , 1 , 'b17' );
+insert into pa_tn_tb0 values ( 1601482142000 , 54 , 54 , 2 , 'b54' );
+insert into pa_tn_tb0 values ( 1601482143000 , 91 , 91 , 3 , 'b91' );
+insert into pa_tn_tb0 values ( 1601482144000 , 128 , 128 , 4 , 'b128' );
+insert into pa_tn_tb0 values ( 1601482145000 , 165 , 165 , 5 , 'b165' );
+insert into pa_tn_tb0 values ( 1601482146000 , 202 , 202 , 6 , 'b202' );
+insert into pa_tn_tb0 values ( 1601482147000 , 239 , 239 , 7 , 'b239' );
+insert into pa_tn_tb0 values ( 1601482148000 , 276 , 276 , 8 , 'b276' );
+insert into pa_tn_tb0 values ( 1601482149000 , 313 , 313 , 9 , 'b313' );
+insert into pa_tn_tb0 values ( 1601482150000 , 350 , NULL , 0 , 'b350' );
+insert into pa_tn_tb0 values ( 1601482151000 , 387 , 387 , 1 , 'b387' );
+insert into pa_tn_tb0 values ( 1601482152000 , 424 , 424 , 2 , 'b424' );
+insert into pa_tn_tb0 values ( 1601482153000 , 461 , 461 , 3 , 'b461' );
+insert into pa_tn_tb0 values ( 1601482154000 , 498 , 498 , 4 , 'b498' );
+insert into pa_tn_tb0 values ( 1601482155000 , 535 , 535 , 5 , 'b535' );
+insert into pa_tn_tb0 values ( 1601482156000 , 572 , 572 , 6 , 'b572' );
+insert into pa_tn_tb0 values ( 1601482157000 , 609 , 609 , 7 , 'b609' );
+insert into pa_tn_tb0 values ( 1601482158000 , 646 , 646 , 8 , 'b646' );
+insert into pa_tn_tb0 values ( 1601482159000 , 683 , 683 , 9 , 'b683' );
+insert into pa_tn_tb0 values ( 1601482160000 , 720 , 720 , 0 , 'b720' );
+insert into pa_tn_tb0 values ( 1601482161000 , 757 , 757 , 1 , 'b757' );
+insert into pa_tn_tb0 values ( 1601482162000 , 794 , 794 , 2 , 'b794' );
+insert into pa_tn_tb0 values ( 1601482163000 , 831 , 831 , 3 , 'b831' );
+insert into pa_tn_tb0 values ( 1601482164000 , 868 , 868 , 4 , 'b868' );
+insert into pa_tn_tb0 values ( 1601482165000 , 905 , 905 , 5 , 'b905' );
+insert into pa_tn_tb0 values ( 1601482166000 , 942 , 942 , 6 , 'b942' );
+insert into pa_tn_tb0 values ( 1601482167000 , 979 , 979 , 7 , 'b979' );
+insert into pa_tn_tb0 values ( 1601482168000 , 16 , 16 , 8 , 'b16' );
+insert into pa_tn_tb0 values ( 1601482169000 , 53 , 53 , 9 , 'b53' );
+insert into pa_tn_tb0 values ( 1601482170000 , 90 , 90 , 0 , 'b90' );
+insert into pa_tn_tb0 values ( 1601482171000 , 127 , 127 , 1 , 'b127' );
+insert into pa_tn_tb0 values ( 1601482172000 , 164 , 164 , 2 , 'b164' );
+insert into pa_tn_tb0 values ( 1601482173000 , 201 , 201 , 3 , 'b201' );
+insert into pa_tn_tb0 values ( 1601482174000 , 238 , 238 , 4 , 'b238' );
+insert into pa_tn_tb0 values ( 1601482175000 , 275 , 275 , 5 , 'b275' );
+insert into pa_tn_tb0 values ( 1601482176000 , 312 , 312 , 6 , 'b312' );
+insert into pa_tn_tb0 values ( 1601482177000 , 349 , 349 , 7 , 'b349' );
+insert into pa_tn_tb0 values ( 1601482178000 , 386 , 386 , 8 , 'b386' );
+insert into pa_tn_tb0 values ( 1601482179000 , 423 , 423 , 9 , 'b423' );
+insert into pa_tn_tb0 values ( 1601482180000 , 460 , 460 , 0 , 'b460' );
+insert into pa_tn_tb0 values ( 1601482181000 , 497 , 497 , 1 , 'b497' );
+insert into pa_tn_tb0 values ( 1601482182000 , 534 , 534 , 2 , 'b534' );
+insert into pa_tn_tb0 values ( 1601482183000 , 571 , 571 , 3 , 'b571' );
+insert into pa_tn_tb0 values ( 1601482184000 , 608 , 608 , 4 , 'b608' );
+insert into pa_tn_tb0 values ( 1601482185000 , 645 , 645 , 5 , 'b645' );
+insert into pa_tn_tb0 values ( 1601482186000 , 682 , 682 , 6 , 'b682' );
+insert into pa_tn_tb0 values ( 1601482187000 , 719 , 719 , 7 , 'b719' );
+insert into pa_tn_tb0 values ( 1601482188000 , 756 , 756 , 8 , 'b756' );
+insert into pa_tn_tb0 values ( 1601482189000 , 793 , 793 , 9 , 'b793' );
+insert into pa_tn_tb0 values ( 1601482190000 , 830 , 830 , 0 , 'b830' );
+insert into pa_tn_tb0 values ( 1601482191000 , 867 , 867 , 1 , 'b867' );
+insert into pa_tn_tb0 values ( 1601482192000 , 904 , 904 , 2 , 'b904' );
+insert into pa_tn_tb0 values ( 1601482193000 , 941 , 941 , 3 , 'b941' );
+insert into pa_tn_tb0 values ( 1601482194000 , 978 , 978 , 4 , 'b978' );
+insert into pa_tn_tb0 values ( 1601482195000 , 15 , 15 , 5 , 'b15' );
+insert into pa_tn_tb0 values ( 1601482196000 , 52 , 52 , 6 , 'b52' );
+insert into pa_tn_tb0 values ( 1601482197000 , 89 , 89 , 7 , 'b89' );
+insert into pa_tn_tb0 values ( 1601482198000 , 126 , 126 , 8 , 'b126' );
+insert into pa_tn_tb0 values ( 1601482199000 , 163 , 163 , 9 , 'b163' );
+insert into pa_tn_tb0 values ( 1601482200000 , 200 , NULL , 0 , 'b200' );
+insert into pa_tn_tb0 values ( 1601482201000 , 237 , 237 , 1 , 'b237' );
+insert into pa_tn_tb0 values ( 1601482202000 , 274 , 274 , 2 , 'b274' );
+insert into pa_tn_tb0 values ( 1601482203000 , 311 , 311 , 3 , 'b311' );
+insert into pa_tn_tb0 values ( 1601482204000 , 348 , 348 , 4 , 'b348' );
+insert into pa_tn_tb0 values ( 1601482205000 , 385 , 385 , 5 , 'b385' );
+insert into pa_tn_tb0 values ( 1601482206000 , 422 , 422 , 6 , 'b422' );
+insert into pa_tn_tb0 values ( 1601482207000 , 459 , 459 , 7 , 'b459' );
+insert into pa_tn_tb0 values ( 1601482208000 , 496 , 496 , 8 , 'b496' );
+insert into pa_tn_tb0 values ( 1601482209000 , 533 , 533 , 9 , 'b533' );
+insert into pa_tn_tb0 values ( 1601482210000 , 570 , 570 , 0 , 'b570' );
+insert into pa_tn_tb0 values ( 1601482211000 , 607 , 607 , 1 , 'b607' );
+insert into pa_tn_tb0 values ( 1601482212000 , 644 , 644 , 2 , 'b644' );
+insert into pa_tn_tb0 values ( 1601482213000 , 681 , 681 , 3 , 'b681' );
+insert into pa_tn_tb0 values ( 1601482214000 , 718 , 718 , 4 , 'b718' );
+insert into pa_tn_tb0 values ( 1601482215000 , 755 , 755 , 5 , 'b755' );
+insert into pa_tn_tb0 values ( 1601482216000 , 792 , 792 , 6 , 'b792' );
+insert into pa_tn_tb0 values ( 1601482217000 , 829 , 829 , 7 , 'b829' );
+insert into pa_tn_tb0 values ( 1601482218000 , 866 , 866 , 8 , 'b866' );
+insert into pa_tn_tb0 values ( 1601482219000 , 903 , 903 , 9 , 'b903' );
+insert into pa_tn_tb0 values ( 1601482220000 , 940 , 940 , 0 , 'b940' );
+insert into pa_tn_tb0 values ( 1601482221000 , 977 , 977 , 1 , 'b977' );
+insert into pa_tn_tb0 values ( 1601482222000 , 14 , 14 , 2 , 'b14' );
+insert into pa_tn_tb0 values ( 1601482223000 , 51 , 51 , 3 , 'b51' );
+insert into pa_tn_tb0 values ( 1601482224000 , 88 , 88 , 4 , 'b88' );
+insert into pa_tn_tb0 values ( 1601482225000 , 125 , 125 , 5 , 'b125' );
+insert into pa_tn_tb0 values ( 1601482226000 , 162 , 162 , 6 , 'b162' );
+insert into pa_tn_tb0 values ( 1601482227000 , 199 , 199 , 7 , 'b199' );
+insert into pa_tn_tb0 values ( 1601482228000 , 236 , 236 , 8 , 'b236' );
+insert into pa_tn_tb0 values ( 1601482229000 , 273 , 273 , 9 , 'b273' );
+insert into pa_tn_tb0 values ( 1601482230000 , 310 , 310 , 0 , 'b310' );
+insert into pa_tn_tb0 values ( 1601482231000 , 347 , 347 , 1 , 'b347' );
+insert into pa_tn_tb0 values ( 1601482232000 , 384 , 384 , 2 , 'b384' );
+insert into pa_tn_tb0 values ( 1601482233000 , 421 , 421 , 3 , 'b421' );
+insert into pa_tn_tb0 values ( 1601482234000 , 458 , 458 , 4 , 'b458' );
+insert into pa_tn_tb0 values ( 1601482235000 , 495 , 495 , 5 , 'b495' );
+insert into pa_tn_tb0 values ( 1601482236000 , 532 , 532 , 6 , 'b532' );
+insert into pa_tn_tb0 values ( 1601482237000 , 569 , 569 , 7 , 'b569' );
+insert into pa_tn_tb0 values ( 1601482238000 , 606 , 606 , 8 , 'b606' );
+insert into pa_tn_tb0 values ( 1601482239000 , 643 , 643 , 9 , 'b643' );
+insert into pa_tn_tb0 values ( 1601482240000 , 680 , 680 , 0 , 'b680' );
+insert into pa_tn_tb0 values ( 1601482241000 , 717 , 717 , 1 , 'b717' );
+insert into pa_tn_tb0 values ( 1601482242000 , 754 , 754 , 2 , 'b754' );
+insert into pa_tn_tb0 values ( 1601482243000 , 791 , 791 , 3 , 'b791' );
+insert into pa_tn_tb0 values ( 1601482244000 , 828 , 828 , 4 , 'b828' );
+insert into pa_tn_tb0 values ( 1601482245000 , 865 , 865 , 5 , 'b865' );
+insert into pa_tn_tb0 values ( 1601482246000 , 902 , 902 , 6 , 'b902' );
+insert into pa_tn_tb0 values ( 1601482247000 , 939 , 939 , 7 , 'b939' );
+insert into pa_tn_tb0 values ( 1601482248000 , 976 , 976 , 8 , 'b976' );
+insert into pa_tn_tb0 values ( 1601482249000 , 13 , 13 , 9 , 'b13' );
+insert into pa_tn_tb0 values ( 1601482250000 , 50 , NULL , 0 , 'b50' );
+insert into pa_tn_tb0 values ( 1601482251000 , 87 , 87 , 1 , 'b87' );
+insert into pa_tn_tb0 values ( 1601482252000 , 124 , 124 , 2 , 'b124' );
+insert into pa_tn_tb0 values ( 1601482253000 , 161 , 161 , 3 , 'b161' );
+insert into pa_tn_tb0 values ( 1601482254000 , 198 , 198 , 4 , 'b198' );
+insert into pa_tn_tb0 values ( 1601482255000 , 235 , 235 , 5 , 'b235' );
+insert into pa_tn_tb0 values ( 1601482256000 , 272 , 272 , 6 , 'b272' );
+insert into pa_tn_tb0 values ( 1601482257000 , 309 , 309 , 7 , 'b309' );
+insert into pa_tn_tb0 values ( 1601482258000 , 346 , 346 , 8 , 'b346' );
+insert into pa_tn_tb0 values ( 1601482259000 , 383 , 383 , 9 , 'b383' );
+insert into pa_tn_tb0 values ( 1601482260000 , 420 , 420 , 0 , 'b420' );
+insert into pa_tn_tb0 values ( 1601482261000 , 457 , 457 , 1 , 'b457' );
+insert into pa_tn_tb0 values ( 1601482262000 , 494 , 494 , 2 , 'b494' );
+insert into pa_tn_tb0 values ( 1601482263000 , 531 , 531 , 3 , 'b531' );
+insert into pa_tn_tb0 values ( 1601482264000 , 568 , 568 , 4 , 'b568' );
+insert into pa_tn_tb0 values ( 1601482265000 , 605 , 605 , 5 , 'b605' );
+insert into pa_tn_tb0 values ( 1601482266000 , 642 , 642 , 6 , 'b642' );
+insert into pa_tn_tb0 values ( 1601482267000 , 679 , 679 , 7 , 'b679' );
+insert into pa_tn_tb0 values ( 1601482268000 , 716 , 716 , 8 , 'b716' );
+insert into pa_tn_tb0 values ( 1601482269000 , 753 , 753 , 9 , 'b753' );
+insert into pa_tn_tb0 values ( 1601482270000 , 790 , 790 , 0 , 'b790' );
+insert into pa_tn_tb0 values ( 1601482271000 , 827 , 827 , 1 , 'b827' );
+insert into pa_tn_tb0 values ( 1601482272000 , 864 , 864 , 2 , 'b864' );
+insert into pa_tn_tb0 values ( 1601482273000 , 901 , 901 , 3 , 'b901' );
+insert into pa_tn_tb0 values ( 1601482274000 , 938 , 938 , 4 , 'b938' );
+insert into pa_tn_tb0 values ( 1601482275000 , 975 , 975 , 5 , 'b975' );
+insert into pa_tn_tb0 values ( 1601482276000 , 12 , 12 , 6 , 'b12' );
+insert into pa_tn_tb0 values ( 1601482277000 , 49 , 49 , 7 , 'b49' );
+insert into pa_tn_tb0 values ( 1601482278000 , 86 , 86 , 8 , 'b86' );
+insert into pa_tn_tb0 values ( 1601482279000 , 123 , 123 , 9 , 'b123' );
+insert into pa_tn_tb0 values ( 1601482280000 , 160 , 160 , 0 , 'b160' );
+insert into pa_tn_tb0 values ( 1601482281000 , 197 , 197 , 1 , 'b197' );
+insert into pa_tn_tb0 values ( 1601482282000 , 234 , 234 , 2 , 'b234' );
+insert into pa_tn_tb0 values ( 1601482283000 , 271 , 271 , 3 , 'b271' );
+insert into pa_tn_tb0 values ( 1601482284000 , 308 , 308 , 4 , 'b308' );
+insert into pa_tn_tb0 values ( 1601482285000 , 345 , 345 , 5 , 'b345' );
+insert into pa_tn_tb0 values ( 1601482286000 , 382 , 382 , 6 , 'b382' );
+insert into pa_tn_tb0 values ( 1601482287000 , 419 , 419 , 7 , 'b419' );
+insert into pa_tn_tb0 values ( 1601482288000 , 456 , 456 , 8 , 'b456' );
+insert into pa_tn_tb0 values ( 1601482289000 , 493 , 493 , 9 , 'b493' );
+insert into pa_tn_tb0 values ( 1601482290000 , 530 , 530 , 0 , 'b530' );
+insert into pa_tn_tb0 values ( 1601482291000 , 567 , 567 , 1 , 'b567' );
+insert into pa_tn_tb0 values ( 1601482292000 , 604 , 604 , 2 , 'b604' );
+insert into pa_tn_tb0 values ( 1601482293000 , 641 , 641 , 3 , 'b641' );
+insert into pa_tn_tb0 values ( 1601482294000 , 678 , 678 , 4 , 'b678' );
+insert into pa_tn_tb0 values ( 1601482295000 , 715 , 715 , 5 , 'b715' );
+insert into pa_tn_tb0 values ( 1601482296000 , 752 , 752 , 6 , 'b752' );
+insert into pa_tn_tb0 values ( 1601482297000 , 789 , 789 , 7 , 'b789' );
+insert into pa_tn_tb0 values ( 1601482298000 , 826 , 826 , 8 , 'b826' );
+insert into pa_tn_tb0 values ( 1601482299000 , 863 , 863 , 9 , 'b863' );
+insert into pa_tn_tb0 values ( 1601482300000 , 900 , NULL , 0 , 'b900' );
+insert into pa_tn_tb0 values ( 1601482301000 , 937 , 937 , 1 , 'b937' );
+insert into pa_tn_tb0 values ( 1601482302000 , 974 , 974 , 2 , 'b974' );
+insert into pa_tn_tb0 values ( 1601482303000 , 11 , 11 , 3 , 'b11' );
+insert into pa_tn_tb0 values ( 1601482304000 , 48 , 48 , 4 , 'b48' );
+insert into pa_tn_tb0 values ( 1601482305000 , 85 , 85 , 5 , 'b85' );
+insert into pa_tn_tb0 values ( 1601482306000 , 122 , 122 , 6 , 'b122' );
+insert into pa_tn_tb0 values ( 1601482307000 , 159 , 159 , 7 , 'b159' );
+insert into pa_tn_tb0 values ( 1601482308000 , 196 , 196 , 8 , 'b196' );
+insert into pa_tn_tb0 values ( 1601482309000 , 233 , 233 , 9 , 'b233' );
+insert into pa_tn_tb0 values ( 1601482310000 , 270 , 270 , 0 , 'b270' );
+insert into pa_tn_tb0 values ( 1601482311000 , 307 , 307 , 1 , 'b307' );
+insert into pa_tn_tb0 values ( 1601482312000 , 344 , 344 , 2 , 'b344' );
+insert into pa_tn_tb0 values ( 1601482313000 , 381 , 381 , 3 , 'b381' );
+insert into pa_tn_tb0 values ( 1601482314000 , 418 , 418 , 4 , 'b418' );
+insert into pa_tn_tb0 values ( 1601482315000 , 455 , 455 , 5 , 'b455' );
+insert into pa_tn_tb0 values ( 1601482316000 , 492 , 492 , 6 , 'b492' );
+insert into pa_tn_tb0 values ( 1601482317000 , 529 , 529 , 7 , 'b529' );
+insert into pa_tn_tb0 values ( 1601482318000 , 566 , 566 , 8 , 'b566' );
+insert into pa_tn_tb0 values ( 1601482319000 , 603 , 603 , 9 , 'b603' );
+insert into pa_tn_tb0 values ( 1601482320000 , 640 , 640 , 0 , 'b640' );
+insert into pa_tn_tb0 values ( 1601482321000 , 677 , 677 , 1 , 'b677' );
+insert into pa_tn_tb0 values ( 1601482322000 , 714 , 714 , 2 , 'b714' );
+insert into pa_tn_tb0 values ( 1601482323000 , 751 , 751 , 3 , 'b751' );
+insert into pa_tn_tb0 values ( 1601482324000 , 788 , 788 , 4 , 'b788' );
+insert into pa_tn_tb0 values ( 1601482325000 , 825 , 825 , 5 , 'b825' );
+insert into pa_tn_tb0 values ( 1601482326000 , 862 , 862 , 6 , 'b862' );
+insert into pa_tn_tb0 values ( 1601482327000 , 899 , 899 , 7 , 'b899' );
+insert into pa_tn_tb0 values ( 1601482328000 , 936 , 936 , 8 , 'b936' );
+insert into pa_tn_tb0 values ( 1601482329000 , 973 , 973 , 9 , 'b973' );
+insert into pa_tn_tb0 values ( 1601482330000 , 10 , 10 , 0 , 'b10' );
+insert into pa_tn_tb0 values ( 1601482331000 , 47 , 47 , 1 , 'b47' );
+insert into pa_tn_tb0 values ( 1601482332000 , 84 , 84 , 2 , 'b84' );
+insert into pa_tn_tb0 values ( 1601482333000 , 121 , 121 , 3 , 'b121' );
+insert into pa_tn_tb0 values ( 1601482334000 , 158 , 158 , 4 , 'b158' );
+insert into pa_tn_tb0 values ( 1601482335000 , 195 , 195 , 5 , 'b195' );
+insert into pa_tn_tb0 values ( 1601482336000 , 232 , 232 , 6 , 'b232' );
+insert into pa_tn_tb0 values ( 1601482337000 , 269 , 269 , 7 , 'b269' );
+insert into pa_tn_tb0 values ( 1601482338000 , 306 , 306 , 8 , 'b306' );
+insert into pa_tn_tb0 values ( 1601482339000 , 343 , 343 , 9 , 'b343' );
+insert into pa_tn_tb0 values ( 1601482340000 , 380 , 380 , 0 , 'b380' );
+insert into pa_tn_tb0 values ( 1601482341000 , 417 , 417 , 1 , 'b417' );
+insert into pa_tn_tb0 values ( 1601482342000 , 454 , 454 , 2 , 'b454' );
+insert into pa_tn_tb0 values ( 1601482343000 , 491 , 491 , 3 , 'b491' );
+insert into pa_tn_tb0 values ( 1601482344000 , 528 , 528 , 4 , 'b528' );
+insert into pa_tn_tb0 values ( 1601482345000 , 565 , 565 , 5 , 'b565' );
+insert into pa_tn_tb0 values ( 1601482346000 , 602 , 602 , 6 , 'b602' );
+insert into pa_tn_tb0 values ( 1601482347000 , 639 , 639 , 7 , 'b639' );
+insert into pa_tn_tb0 values ( 1601482348000 , 676 , 676 , 8 , 'b676' );
+insert into pa_tn_tb0 values ( 1601482349000 , 713 , 713 , 9 , 'b713' );
+insert into pa_tn_tb0 values ( 1601482350000 , 750 , NULL , 0 , 'b750' );
+insert into pa_tn_tb0 values ( 1601482351000 , 787 , 787 , 1 , 'b787' );
+insert into pa_tn_tb0 values ( 1601482352000 , 824 , 824 , 2 , 'b824' );
+insert into pa_tn_tb0 values ( 1601482353000 , 861 , 861 , 3 , 'b861' );
+insert into pa_tn_tb0 values ( 1601482354000 , 898 , 898 , 4 , 'b898' );
+insert into pa_tn_tb0 values ( 1601482355000 , 935 , 935 , 5 , 'b935' );
+insert into pa_tn_tb0 values ( 1601482356000 , 972 , 972 , 6 , 'b972' );
+insert into pa_tn_tb0 values ( 1601482357000 , 9 , 9 , 7 , 'b9' );
+insert into pa_tn_tb0 values ( 1601482358000 , 46 , 46 , 8 , 'b46' );
+insert into pa_tn_tb0 values ( 1601482359000 , 83 , 83 , 9 , 'b83' );
+insert into pa_tn_tb0 values ( 1601482360000 , 120 , 120 , 0 , 'b120' );
+insert into pa_tn_tb0 values ( 1601482361000 , 157 , 157 , 1 , 'b157' );
+insert into pa_tn_tb0 values ( 1601482362000 , 194 , 194 , 2 , 'b194' );
+insert into pa_tn_tb0 values ( 1601482363000 , 231 , 231 , 3 , 'b231' );
+insert into pa_tn_tb0 values ( 1601482364000 , 268 , 268 , 4 , 'b268' );
+insert into pa_tn_tb0 values ( 1601482365000 , 305 , 305 , 5 , 'b305' );
+insert into pa_tn_tb0 values ( 1601482366000 , 342 , 342 , 6 , 'b342' );
+insert into pa_tn_tb0 values ( 1601482367000 , 379 , 379 , 7 , 'b379' );
+insert into pa_tn_tb0 values ( 1601482368000 , 416 , 416 , 8 , 'b416' );
+insert into pa_tn_tb0 values ( 1601482369000 , 453 , 453 , 9 , 'b453' );
+insert into pa_tn_tb0 values ( 1601482370000 , 490 , 490 , 0 , 'b490' );
+insert into pa_tn_tb0 values ( 1601482371000 , 527 , 527 , 1 , 'b527' );
+insert into pa_tn_tb0 values ( 1601482372000 , 564 , 564 , 2 , 'b564' );
+insert into pa_tn_tb0 values ( 1601482373000 , 601 , 601 , 3 , 'b601' );
+insert into pa_tn_tb0 values ( 1601482374000 , 638 , 638 , 4 , 'b638' );
+insert into pa_tn_tb0 values ( 1601482375000 , 675 , 675 , 5 , 'b675' );
+insert into pa_tn_tb0 values ( 1601482376000 , 712 , 712 , 6 , 'b712' );
+insert into pa_tn_tb0 values ( 1601482377000 , 749 , 749 , 7 , 'b749' );
+insert into pa_tn_tb0 values ( 1601482378000 , 786 , 786 , 8 , 'b786' );
+insert into pa_tn_tb0 values ( 1601482379000 , 823 , 823 , 9 , 'b823' );
+insert into pa_tn_tb0 values ( 1601482380000 , 860 , 860 , 0 , 'b860' );
+insert into pa_tn_tb0 values ( 1601482381000 , 897 , 897 , 1 , 'b897' );
+insert into pa_tn_tb0 values ( 1601482382000 , 934 , 934 , 2 , 'b934' );
+insert into pa_tn_tb0 values ( 1601482383000 , 971 , 971 , 3 , 'b971' );
+insert into pa_tn_tb0 values ( 1601482384000 , 8 , 8 , 4 , 'b8' );
+insert into pa_tn_tb0 values ( 1601482385000 , 45 , 45 , 5 , 'b45' );
+insert into pa_tn_tb0 values ( 1601482386000 , 82 , 82 , 6 , 'b82' );
+insert into pa_tn_tb0 values ( 1601482387000 , 119 , 119 , 7 , 'b119' );
+insert into pa_tn_tb0 values ( 1601482388000 , 156 , 156 , 8 , 'b156' );
+insert into pa_tn_tb0 values ( 1601482389000 , 193 , 193 , 9 , 'b193' );
+insert into pa_tn_tb0 values ( 1601482390000 , 230 , 230 , 0 , 'b230' );
+insert into pa_tn_tb0 values ( 1601482391000 , 267 , 267 , 1 , 'b267' );
+insert into pa_tn_tb0 values ( 1601482392000 , 304 , 304 , 2 , 'b304' );
+insert into pa_tn_tb0 values ( 1601482393000 , 341 , 341 , 3 , 'b341' );
+insert into pa_tn_tb0 values ( 1601482394000 , 378 , 378 , 4 , 'b378' );
+insert into pa_tn_tb0 values ( 1601482395000 , 415 , 415 , 5 , 'b415' );
+insert into pa_tn_tb0 values ( 1601482396000 , 452 , 452 , 6 , 'b452' );
+insert into pa_tn_tb0 values ( 1601482397000 , 489 , 489 , 7 , 'b489' );
+insert into pa_tn_tb0 values ( 1601482398000 , 526 , 526 , 8 , 'b526' );
+insert into pa_tn_tb0 values ( 1601482399000 , 563 , 563 , 9 , 'b563' );
+insert into pa_tn_tb0 values ( 1601482400000 , 600 , NULL , 0 , 'b600' );
+insert into pa_tn_tb0 values ( 1601482401000 , 637 , 637 , 1 , 'b637' );
+insert into pa_tn_tb0 values ( 1601482402000 , 674 , 674 , 2 , 'b674' );
+insert into pa_tn_tb0 values ( 1601482403000 , 711 , 711 , 3 , 'b711' );
+insert into pa_tn_tb0 values ( 1601482404000 , 748 , 748 , 4 , 'b748' );
+insert into pa_tn_tb0 values ( 1601482405000 , 785 , 785 , 5 , 'b785' );
+insert into pa_tn_tb0 values ( 1601482406000 , 822 , 822 , 6 , 'b822' );
+insert into pa_tn_tb0 values ( 1601482407000 , 859 , 859 , 7 , 'b859' );
+insert into pa_tn_tb0 values ( 1601482408000 , 896 , 896 , 8 , 'b896' );
+insert into pa_tn_tb0 values ( 1601482409000 , 933 , 933 , 9 , 'b933' );
+insert into pa_tn_tb0 values ( 1601482410000 , 970 , 970 , 0 , 'b970' );
+insert into pa_tn_tb0 values ( 1601482411000 , 7 , 7 , 1 , 'b7' );
+insert into pa_tn_tb0 values ( 1601482412000 , 44 , 44 , 2 , 'b44' );
+insert into pa_tn_tb0 values ( 1601482413000 , 81 , 81 , 3 , 'b81' );
+insert into pa_tn_tb0 values ( 1601482414000 , 118 , 118 , 4 , 'b118' );
+insert into pa_tn_tb0 values ( 1601482415000 , 155 , 155 , 5 , 'b155' );
+insert into pa_tn_tb0 values ( 1601482416000 , 192 , 192 , 6 , 'b192' );
+insert into pa_tn_tb0 values ( 1601482417000 , 229 , 229 , 7 , 'b229' );
+insert into pa_tn_tb0 values ( 1601482418000 , 266 , 266 , 8 , 'b266' );
+insert into pa_tn_tb0 values ( 1601482419000 , 303 , 303 , 9 , 'b303' );
+insert into pa_tn_tb0 values ( 1601482420000 , 340 , 340 , 0 , 'b340' );
+insert into pa_tn_tb0 values ( 1601482421000 , 377 , 377 , 1 , 'b377' );
+insert into pa_tn_tb0 values ( 1601482422000 , 414 , 414 , 2 , 'b414' );
+insert into pa_tn_tb0 values ( 1601482423000 , 451 , 451 , 3 , 'b451' );
+insert into pa_tn_tb0 values ( 1601482424000 , 488 , 488 , 4 , 'b488' );
+insert into pa_tn_tb0 values ( 1601482425000 , 525 , 525 , 5 , 'b525' );
+insert into pa_tn_tb0 values ( 1601482426000 , 562 , 562 , 6 , 'b562' );
+insert into pa_tn_tb0 values ( 1601482427000 , 599 , 599 , 7 , 'b599' );
+insert into pa_tn_tb0 values ( 1601482428000 , 636 , 636 , 8 , 'b636' );
+insert into pa_tn_tb0 values ( 1601482429000 , 673 , 673 , 9 , 'b673' );
+insert into pa_tn_tb0 values ( 1601482430000 , 710 , 710 , 0 , 'b710' );
+insert into pa_tn_tb0 values ( 1601482431000 , 747 , 747 , 1 , 'b747' );
+insert into pa_tn_tb0 values ( 1601482432000 , 784 , 784 , 2 , 'b784' );
+insert into pa_tn_tb0 values ( 1601482433000 , 821 , 821 , 3 , 'b821' );
+insert into pa_tn_tb0 values ( 1601482434000 , 858 , 858 , 4 , 'b858' );
+insert into pa_tn_tb0 values ( 1601482435000 , 895 , 895 , 5 , 'b895' );
+insert into pa_tn_tb0 values ( 1601482436000 , 932 , 932 , 6 , 'b932' );
+insert into pa_tn_tb0 values ( 1601482437000 , 969 , 969 , 7 , 'b969' );
+insert into pa_tn_tb0 values ( 1601482438000 , 6 , 6 , 8 , 'b6' );
+insert into pa_tn_tb0 values ( 1601482439000 , 43 , 43 , 9 , 'b43' );
+insert into pa_tn_tb0 values ( 1601482440000 , 80 , 80 , 0 , 'b80' );
+insert into pa_tn_tb0 values ( 1601482441000 , 117 , 117 , 1 , 'b117' );
+insert into pa_tn_tb0 values ( 1601482442000 , 154 , 154 , 2 , 'b154' );
+insert into pa_tn_tb0 values ( 1601482443000 , 191 , 191 , 3 , 'b191' );
+insert into pa_tn_tb0 values ( 1601482444000 , 228 , 228 , 4 , 'b228' );
+insert into pa_tn_tb0 values ( 1601482445000 , 265 , 265 , 5 , 'b265' );
+insert into pa_tn_tb0 values ( 1601482446000 , 302 , 302 , 6 , 'b302' );
+insert into pa_tn_tb0 values ( 1601482447000 , 339 , 339 , 7 , 'b339' );
+insert into pa_tn_tb0 values ( 1601482448000 , 376 , 376 , 8 , 'b376' );
+insert into pa_tn_tb0 values ( 1601482449000 , 413 , 413 , 9 , 'b413' );
+insert into pa_tn_tb0 values ( 1601482450000 , 450 , NULL , 0 , 'b450' );
+insert into pa_tn_tb0 values ( 1601482451000 , 487 , 487 , 1 , 'b487' );
+insert into pa_tn_tb0 values ( 1601482452000 , 524 , 524 , 2 , 'b524' );
+insert into pa_tn_tb0 values ( 1601482453000 , 561 , 561 , 3 , 'b561' );
+insert into pa_tn_tb0 values ( 1601482454000 , 598 , 598 , 4 , 'b598' );
+insert into pa_tn_tb0 values ( 1601482455000 , 635 , 635 , 5 , 'b635' );
+insert into pa_tn_tb0 values ( 1601482456000 , 672 , 672 , 6 , 'b672' );
+insert into pa_tn_tb0 values ( 1601482457000 , 709 , 709 , 7 , 'b709' );
+insert into pa_tn_tb0 values ( 1601482458000 , 746 , 746 , 8 , 'b746' );
+insert into pa_tn_tb0 values ( 1601482459000 , 783 , 783 , 9 , 'b783' );
+insert into pa_tn_tb0 values ( 1601482460000 , 820 , 820 , 0 , 'b820' );
+insert into pa_tn_tb0 values ( 1601482461000 , 857 , 857 , 1 , 'b857' );
+insert into pa_tn_tb0 values ( 1601482462000 , 894 , 894 , 2 , 'b894' );
+insert into pa_tn_tb0 values ( 1601482463000 , 931 , 931 , 3 , 'b931' );
+insert into pa_tn_tb0 values ( 1601482464000 , 968 , 968 , 4 , 'b968' );
+insert into pa_tn_tb0 values ( 1601482465000 , 5 , 5 , 5 , 'b5' );
+insert into pa_tn_tb0 values ( 1601482466000 , 42 , 42 , 6 , 'b42' );
+insert into pa_tn_tb0 values ( 1601482467000 , 79 , 79 , 7 , 'b79' );
+insert into pa_tn_tb0 values ( 1601482468000 , 116 , 116 , 8 , 'b116' );
+insert into pa_tn_tb0 values ( 1601482469000 , 153 , 153 , 9 , 'b153' );
+insert into pa_tn_tb0 values ( 1601482470000 , 190 , 190 , 0 , 'b190' );
+insert into pa_tn_tb0 values ( 1601482471000 , 227 , 227 , 1 , 'b227' );
+insert into pa_tn_tb0 values ( 1601482472000 , 264 , 264 , 2 , 'b264' );
+insert into pa_tn_tb0 values ( 1601482473000 , 301 , 301 , 3 , 'b301' );
+insert into pa_tn_tb0 values ( 1601482474000 , 338 , 338 , 4 , 'b338' );
+insert into pa_tn_tb0 values ( 1601482475000 , 375 , 375 , 5 , 'b375' );
+insert into pa_tn_tb0 values ( 1601482476000 , 412 , 412 , 6 , 'b412' );
+insert into pa_tn_tb0 values ( 1601482477000 , 449 , 449 , 7 , 'b449' );
+insert into pa_tn_tb0 values ( 1601482478000 , 486 , 486 , 8 , 'b486' );
+insert into pa_tn_tb0 values ( 1601482479000 , 523 , 523 , 9 , 'b523' );
+insert into pa_tn_tb0 values ( 1601482480000 , 560 , 560 , 0 , 'b560' );
+insert into pa_tn_tb0 values ( 1601482481000 , 597 , 597 , 1 , 'b597' );
+insert into pa_tn_tb0 values ( 1601482482000 , 634 , 634 , 2 , 'b634' );
+insert into pa_tn_tb0 values ( 1601482483000 , 671 , 671 , 3 , 'b671' );
+insert into pa_tn_tb0 values ( 1601482484000 , 708 , 708 , 4 , 'b708' );
+insert into pa_tn_tb0 values ( 1601482485000 , 745 , 745 , 5 , 'b745' );
+insert into pa_tn_tb0 values ( 1601482486000 , 782 , 782 , 6 , 'b782' );
+insert into pa_tn_tb0 values ( 1601482487000 , 819 , 819 , 7 , 'b819' );
+insert into pa_tn_tb0 values ( 1601482488000 , 856 , 856 , 8 , 'b856' );
+insert into pa_tn_tb0 values ( 1601482489000 , 893 , 893 , 9 , 'b893' );
+insert into pa_tn_tb0 values ( 1601482490000 , 930 , 930 , 0 , 'b930' );
+insert into pa_tn_tb0 values ( 1601482491000 , 967 , 967 , 1 , 'b967' );
+insert into pa_tn_tb0 values ( 1601482492000 , 4 , 4 , 2 , 'b4' );
+insert into pa_tn_tb0 values ( 1601482493000 , 41 , 41 , 3 , 'b41' );
+insert into pa_tn_tb0 values ( 1601482494000 , 78 , 78 , 4 , 'b78' );
+insert into pa_tn_tb0 values ( 1601482495000 , 115 , 115 , 5 , 'b115' );
+insert into pa_tn_tb0 values ( 1601482496000 , 152 , 152 , 6 , 'b152' );
+insert into pa_tn_tb0 values ( 1601482497000 , 189 , 189 , 7 , 'b189' );
+insert into pa_tn_tb0 values ( 1601482498000 , 226 , 226 , 8 , 'b226' );
+insert into pa_tn_tb0 values ( 1601482499000 , 263 , 263 , 9 , 'b263' );
+insert into pa_tn_tb0 values ( 1601482500000 , 300 , NULL , 0 , 'b300' );
+insert into pa_tn_tb0 values ( 1601482501000 , 337 , 337 , 1 , 'b337' );
+insert into pa_tn_tb0 values ( 1601482502000 , 374 , 374 , 2 , 'b374' );
+insert into pa_tn_tb0 values ( 1601482503000 , 411 , 411 , 3 , 'b411' );
+insert into pa_tn_tb0 values ( 1601482504000 , 448 , 448 , 4 , 'b448' );
+insert into pa_tn_tb0 values ( 1601482505000 , 485 , 485 , 5 , 'b485' );
+insert into pa_tn_tb0 values ( 1601482506000 , 522 , 522 , 6 , 'b522' );
+insert into pa_tn_tb0 values ( 1601482507000 , 559 , 559 , 7 , 'b559' );
+insert into pa_tn_tb0 values ( 1601482508000 , 596 , 596 , 8 , 'b596' );
+insert into pa_tn_tb0 values ( 1601482509000 , 633 , 633 , 9 , 'b633' );
+insert into pa_tn_tb0 values ( 1601482510000 , 670 , 670 , 0 , 'b670' );
+insert into pa_tn_tb0 values ( 1601482511000 , 707 , 707 , 1 , 'b707' );
+insert into pa_tn_tb0 values ( 1601482512000 , 744 , 744 , 2 , 'b744' );
+insert into pa_tn_tb0 values ( 1601482513000 , 781 , 781 , 3 , 'b781' );
+insert into pa_tn_tb0 values ( 1601482514000 , 818 , 818 , 4 , 'b818' );
+insert into pa_tn_tb0 values ( 1601482515000 , 855 , 855 , 5 , 'b855' );
+insert into pa_tn_tb0 values ( 1601482516000 , 892 , 892 , 6 , 'b892' );
+insert into pa_tn_tb0 values ( 1601482517000 , 929 , 929 , 7 , 'b929' );
+insert into pa_tn_tb0 values ( 1601482518000 , 966 , 966 , 8 , 'b966' );
+insert into pa_tn_tb0 values ( 1601482519000 , 3 , 3 , 9 , 'b3' );
+insert into pa_tn_tb0 values ( 1601482520000 , 40 , 40 , 0 , 'b40' );
+insert into pa_tn_tb0 values ( 1601482521000 , 77 , 77 , 1 , 'b77' );
+insert into pa_tn_tb0 values ( 1601482522000 , 114 , 114 , 2 , 'b114' );
+insert into pa_tn_tb0 values ( 1601482523000 , 151 , 151 , 3 , 'b151' );
+insert into pa_tn_tb0 values ( 1601482524000 , 188 , 188 , 4 , 'b188' );
+insert into pa_tn_tb0 values ( 1601482525000 , 225 , 225 , 5 , 'b225' );
+insert into pa_tn_tb0 values ( 1601482526000 , 262 , 262 , 6 , 'b262' );
+insert into pa_tn_tb0 values ( 1601482527000 , 299 , 299 , 7 , 'b299' );
+insert into pa_tn_tb0 values ( 1601482528000 , 336 , 336 , 8 , 'b336' );
+insert into pa_tn_tb0 values ( 1601482529000 , 373 , 373 , 9 , 'b373' );
+insert into pa_tn_tb0 values ( 1601482530000 , 410 , 410 , 0 , 'b410' );
+insert into pa_tn_tb0 values ( 1601482531000 , 447 , 447 , 1 , 'b447' );
+insert into pa_tn_tb0 values ( 1601482532000 , 484 , 484 , 2 , 'b484' );
+insert into pa_tn_tb0 values ( 1601482533000 , 521 , 521 , 3 , 'b521' );
+insert into pa_tn_tb0 values ( 1601482534000 , 558 , 558 , 4 , 'b558' );
+insert into pa_tn_tb0 values ( 1601482535000 , 595 , 595 , 5 , 'b595' );
+insert into pa_tn_tb0 values ( 1601482536000 , 632 , 632 , 6 , 'b632' );
+insert into pa_tn_tb0 values ( 1601482537000 , 669 , 669 , 7 , 'b669' );
+insert into pa_tn_tb0 values ( 1601482538000 , 706 , 706 , 8 , 'b706' );
+insert into pa_tn_tb0 values ( 1601482539000 , 743 , 743 , 9 , 'b743' );
+insert into pa_tn_tb0 values ( 1601482540000 , 780 , 780 , 0 , 'b780' );
+insert into pa_tn_tb0 values ( 1601482541000 , 817 , 817 , 1 , 'b817' );
+insert into pa_tn_tb0 values ( 1601482542000 , 854 , 854 , 2 , 'b854' );
+insert into pa_tn_tb0 values ( 1601482543000 , 891 , 891 , 3 , 'b891' );
+insert into pa_tn_tb0 values ( 1601482544000 , 928 , 928 , 4 , 'b928' );
+insert into pa_tn_tb0 values ( 1601482545000 , 965 , 965 , 5 , 'b965' );
+insert into pa_tn_tb0 values ( 1601482546000 , 2 , 2 , 6 , 'b2' );
+insert into pa_tn_tb0 values ( 1601482547000 , 39 , 39 , 7 , 'b39' );
+insert into pa_tn_tb0 values ( 1601482548000 , 76 , 76 , 8 , 'b76' );
+insert into pa_tn_tb0 values ( 1601482549000 , 113 , 113 , 9 , 'b113' );
+insert into pa_tn_tb0 values ( 1601482550000 , 150 , NULL , 0 , 'b150' );
+insert into pa_tn_tb0 values ( 1601482551000 , 187 , 187 , 1 , 'b187' );
+insert into pa_tn_tb0 values ( 1601482552000 , 224 , 224 , 2 , 'b224' );
+insert into pa_tn_tb0 values ( 1601482553000 , 261 , 261 , 3 , 'b261' );
+insert into pa_tn_tb0 values ( 1601482554000 , 298 , 298 , 4 , 'b298' );
+insert into pa_tn_tb0 values ( 1601482555000 , 335 , 335 , 5 , 'b335' );
+insert into pa_tn_tb0 values ( 1601482556000 , 372 , 372 , 6 , 'b372' );
+insert into pa_tn_tb0 values ( 1601482557000 , 409 , 409 , 7 , 'b409' );
+insert into pa_tn_tb0 values ( 1601482558000 , 446 , 446 , 8 , 'b446' );
+insert into pa_tn_tb0 values ( 1601482559000 , 483 , 483 , 9 , 'b483' );
+insert into pa_tn_tb0 values ( 1601482560000 , 520 , 520 , 0 , 'b520' );
+insert into pa_tn_tb0 values ( 1601482561000 , 557 , 557 , 1 , 'b557' );
+insert into pa_tn_tb0 values ( 1601482562000 , 594 , 594 , 2 , 'b594' );
+insert into pa_tn_tb0 values ( 1601482563000 , 631 , 631 , 3 , 'b631' );
+insert into pa_tn_tb0 values ( 1601482564000 , 668 , 668 , 4 , 'b668' );
+insert into pa_tn_tb0 values ( 1601482565000 , 705 , 705 , 5 , 'b705' );
+insert into pa_tn_tb0 values ( 1601482566000 , 742 , 742 , 6 , 'b742' );
+insert into pa_tn_tb0 values ( 1601482567000 , 779 , 779 , 7 , 'b779' );
+insert into pa_tn_tb0 values ( 1601482568000 , 816 , 816 , 8 , 'b816' );
+insert into pa_tn_tb0 values ( 1601482569000 , 853 , 853 , 9 , 'b853' );
+insert into pa_tn_tb0 values ( 1601482570000 , 890 , 890 , 0 , 'b890' );
+insert into pa_tn_tb0 values ( 1601482571000 , 927 , 927 , 1 , 'b927' );
+insert into pa_tn_tb0 values ( 1601482572000 , 964 , 964 , 2 , 'b964' );
+insert into pa_tn_tb0 values ( 1601482573000 , 1 , 1 , 3 , 'b1' );
+insert into pa_tn_tb0 values ( 1601482574000 , 38 , 38 , 4 , 'b38' );
+insert into pa_tn_tb0 values ( 1601482575000 , 75 , 75 , 5 , 'b75' );
+insert into pa_tn_tb0 values ( 1601482576000 , 112 , 112 , 6 , 'b112' );
+insert into pa_tn_tb0 values ( 1601482577000 , 149 , 149 , 7 , 'b149' );
+insert into pa_tn_tb0 values ( 1601482578000 , 186 , 186 , 8 , 'b186' );
+insert into pa_tn_tb0 values ( 1601482579000 , 223 , 223 , 9 , 'b223' );
+insert into pa_tn_tb0 values ( 1601482580000 , 260 , 260 , 0 , 'b260' );
+insert into pa_tn_tb0 values ( 1601482581000 , 297 , 297 , 1 , 'b297' );
+insert into pa_tn_tb0 values ( 1601482582000 , 334 , 334 , 2 , 'b334' );
+insert into pa_tn_tb0 values ( 1601482583000 , 371 , 371 , 3 , 'b371' );
+insert into pa_tn_tb0 values ( 1601482584000 , 408 , 408 , 4 , 'b408' );
+insert into pa_tn_tb0 values ( 1601482585000 , 445 , 445 , 5 , 'b445' );
+insert into pa_tn_tb0 values ( 1601482586000 , 482 , 482 , 6 , 'b482' );
+insert into pa_tn_tb0 values ( 1601482587000 , 519 , 519 , 7 , 'b519' );
+insert into pa_tn_tb0 values ( 1601482588000 , 556 , 556 , 8 , 'b556' );
+insert into pa_tn_tb0 values ( 1601482589000 , 593 , 593 , 9 , 'b593' );
+insert into pa_tn_tb0 values ( 1601482590000 , 630 , 630 , 0 , 'b630' );
+insert into pa_tn_tb0 values ( 1601482591000 , 667 , 667 , 1 , 'b667' );
+insert into pa_tn_tb0 values ( 1601482592000 , 704 , 704 , 2 , 'b704' );
+insert into pa_tn_tb0 values ( 1601482593000 , 741 , 741 , 3 , 'b741' );
+insert into pa_tn_tb0 values ( 1601482594000 , 778 , 778 , 4 , 'b778' );
+insert into pa_tn_tb0 values ( 1601482595000 , 815 , 815 , 5 , 'b815' );
+insert into pa_tn_tb0 values ( 1601482596000 , 852 , 852 , 6 , 'b852' );
+insert into pa_tn_tb0 values ( 1601482597000 , 889 , 889 , 7 , 'b889' );
+insert into pa_tn_tb0 values ( 1601482598000 , 926 , 926 , 8 , 'b926' );
+insert into pa_tn_tb0 values ( 1601482599000 , 963 , 963 , 9 , 'b963' );
+create table pa_tn_tb1 using pa_tn_mt0 tags( 1 );
+insert into pa_tn_tb1 values ( 1601481600000 , 1000 , NULL , 0 , 'b1000' );
+insert into pa_tn_tb1 values ( 1601481601000 , 1037 , 1037 , 1 , 'b1037' );
+insert into pa_tn_tb1 values ( 1601481602000 , 1074 , 1074 , 2 , 'b1074' );
+insert into pa_tn_tb1 values ( 1601481603000 , 1111 , 1111 , 3 , 'b1111' );
+insert into pa_tn_tb1 values ( 1601481604000 , 1148 , 1148 , 4 , 'b1148' );
+insert into pa_tn_tb1 values ( 1601481605000 , 1185 , 1185 , 5 , 'b1185' );
+insert into pa_tn_tb1 values ( 1601481606000 , 1222 , 1222 , 6 , 'b1222' );
+insert into pa_tn_tb1 values ( 1601481607000 , 1259 , 1259 , 7 , 'b1259' );
+insert into pa_tn_tb1 values ( 1601481608000 , 1296 , 1296 , 8 , 'b1296' );
+insert into pa_tn_tb1 values ( 1601481609000 , 1333 , 1333 , 9 , 'b1333' );
+insert into pa_tn_tb1 values ( 1601481610000 , 1370 , 1370 , 0 , 'b1370' );
+insert into pa_tn_tb1 values ( 1601481611000 , 1407 , 1407 , 1 , 'b1407' );
+insert into pa_tn_tb1 values ( 1601481612000 , 1444 , 1444 , 2 , 'b1444' );
+insert into pa_tn_tb1 values ( 1601481613000 , 1481 , 1481 , 3 , 'b1481' );
+insert into pa_tn_tb1 values ( 1601481614000 , 1518 , 1518 , 4 , 'b1518' );
+insert into pa_tn_tb1 values ( 1601481615000 , 1555 , 1555 , 5 , 'b1555' );
+insert into pa_tn_tb1 values ( 1601481616000 , 1592 , 1592 , 6 , 'b1592' );
+insert into pa_tn_tb1 values ( 1601481617000 , 1629 , 1629 , 7 , 'b1629' );
+insert into pa_tn_tb1 values ( 1601481618000 , 1666 , 1666 , 8 , 'b1666' );
+insert into pa_tn_tb1 values ( 1601481619000 , 1703 , 1703 , 9 , 'b1703' );
+insert into pa_tn_tb1 values ( 1601481620000 , 1740 , 1740 , 0 , 'b1740' );
+insert into pa_tn_tb1 values ( 1601481621000 , 1777 , 1777 , 1 , 'b1777' );
+insert into pa_tn_tb1 values ( 1601481622000 , 1814 , 1814 , 2 , 'b1814' );
+insert into pa_tn_tb1 values ( 1601481623000 , 1851 , 1851 , 3 , 'b1851' );
+insert into pa_tn_tb1 values ( 1601481624000 , 1888 , 1888 , 4 , 'b1888' );
+insert into pa_tn_tb1 values ( 1601481625000 , 1925 , 1925 , 5 , 'b1925' );
+insert into pa_tn_tb1 values ( 1601481626000 , 1962 , 1962 , 6 , 'b1962' );
+insert into pa_tn_tb1 values ( 1601481627000 , 1999 , 1999 , 7 , 'b1999' );
+insert into pa_tn_tb1 values ( 1601481628000 , 1036 , 1036 , 8 , 'b1036' );
+insert into pa_tn_tb1 values ( 1601481629000 , 1073 , 1073 , 9 , 'b1073' );
+insert into pa_tn_tb1 values ( 1601481630000 , 1110 , 1110 , 0 , 'b1110' );
+insert into pa_tn_tb1 values ( 1601481631000 , 1147 , 1147 , 1 , 'b1147' );
+insert into pa_tn_tb1 values ( 1601481632000 , 1184 , 1184 , 2 , 'b1184' );
+insert into pa_tn_tb1 values ( 1601481633000 , 1221 , 1221 , 3 , 'b1221' );
+insert into pa_tn_tb1 values ( 1601481634000 , 1258 , 1258 , 4 , 'b1258' );
+insert into pa_tn_tb1 values ( 1601481635000 , 1295 , 1295 , 5 , 'b1295' );
+insert into pa_tn_tb1 values ( 1601481636000 , 1332 , 1332 , 6 , 'b1332' );
+insert into pa_tn_tb1 values ( 1601481637000 , 1369 , 1369 , 7 , 'b1369' );
+insert into pa_tn_tb1 values ( 1601481638000 , 1406 , 1406 , 8 , 'b1406' );
+insert into pa_tn_tb1 values ( 1601481639000 , 1443 , 1443 , 9 , 'b1443' );
+insert into pa_tn_tb1 values ( 1601481640000 , 1480 , 1480 , 0 , 'b1480' );
+insert into pa_tn_tb1 values ( 1601481641000 , 1517 , 1517 , 1 , 'b1517' );
+insert into pa_tn_tb1 values ( 1601481642000 , 1554 , 1554 , 2 , 'b1554' );
+insert into pa_tn_tb1 values ( 1601481643000 , 1591 , 1591 , 3 , 'b1591' );
+insert into pa_tn_tb1 values ( 1601481644000 , 1628 , 1628 , 4 , 'b1628' );
+insert into pa_tn_tb1 values ( 1601481645000 , 1665 , 1665 , 5 , 'b1665' );
+insert into pa_tn_tb1 values ( 1601481646000 , 1702 , 1702 , 6 , 'b1702' );
+insert into pa_tn_tb1 values ( 1601481647000 , 1739 , 1739 , 7 , 'b1739' );
+insert into pa_tn_tb1 values ( 1601481648000 , 1776 , 1776 , 8 , 'b1776' );
+insert into pa_tn_tb1 values ( 1601481649000 , 1813 , 1813 , 9 , 'b1813' );
+insert into pa_tn_tb1 values ( 1601481650000 , 1850 , NULL , 0 , 'b1850' );
+insert into pa_tn_tb1 values ( 1601481651000 , 1887 , 1887 , 1 , 'b1887' );
+insert into pa_tn_tb1 values ( 1601481652000 , 1924 , 1924 , 2 , 'b1924' );
+insert into pa_tn_tb1 values ( 1601481653000 , 1961 , 1961 , 3 , 'b1961' );
+insert into pa_tn_tb1 values ( 1601481654000 , 1998 , 1998 , 4 , 'b1998' );
+insert into pa_tn_tb1 values ( 1601481655000 , 1035 , 1035 , 5 , 'b1035' );
+insert into pa_tn_tb1 values ( 1601481656000 , 1072 , 1072 , 6 , 'b1072' );
+insert into pa_tn_tb1 values ( 1601481657000 , 1109 , 1109 , 7 , 'b1109' );
+insert into pa_tn_tb1 values ( 1601481658000 , 1146 , 1146 , 8 , 'b1146' );
+insert into pa_tn_tb1 values ( 1601481659000 , 1183 , 1183 , 9 , 'b1183' );
+insert into pa_tn_tb1 values ( 1601481660000 , 1220 , 1220 , 0 , 'b1220' );
+insert into pa_tn_tb1 values ( 1601481661000 , 1257 , 1257 , 1 , 'b1257' );
+insert into pa_tn_tb1 values ( 1601481662000 , 1294 , 1294 , 2 , 'b1294' );
+insert into pa_tn_tb1 values ( 1601481663000 , 1331 , 1331 , 3 , 'b1331' );
+insert into pa_tn_tb1 values ( 1601481664000 , 1368 , 1368 , 4 , 'b1368' );
+insert into pa_tn_tb1 values ( 1601481665000 , 1405 , 1405 , 5 , 'b1405' );
+insert into pa_tn_tb1 values ( 1601481666000 , 1442 , 1442 , 6 , 'b1442' );
+insert into pa_tn_tb1 values ( 1601481667000 , 1479 , 1479 , 7 , 'b1479' );
+insert into pa_tn_tb1 values ( 1601481668000 , 1516 , 1516 , 8 , 'b1516' );
+insert into pa_tn_tb1 values ( 1601481669000 , 1553 , 1553 , 9 , 'b1553' );
+insert into pa_tn_tb1 values ( 1601481670000 , 1590 , 1590 , 0 , 'b1590' );
+insert into pa_tn_tb1 values ( 1601481671000 , 1627 , 1627 , 1 , 'b1627' );
+insert into pa_tn_tb1 values ( 1601481672000 , 1664 , 1664 , 2 , 'b1664' );
+insert into pa_tn_tb1 values ( 1601481673000 , 1701 , 1701 , 3 , 'b1701' );
+insert into pa_tn_tb1 values ( 1601481674000 , 1738 , 1738 , 4 , 'b1738' );
+insert into pa_tn_tb1 values ( 1601481675000 , 1775 , 1775 , 5 , 'b1775' );
+insert into pa_tn_tb1 values ( 1601481676000 , 1812 , 1812 , 6 , 'b1812' );
+insert into pa_tn_tb1 values ( 1601481677000 , 1849 , 1849 , 7 , 'b1849' );
+insert into pa_tn_tb1 values ( 1601481678000 , 1886 , 1886 , 8 , 'b1886' );
+insert into pa_tn_tb1 values ( 1601481679000 , 1923 , 1923 , 9 , 'b1923' );
+insert into pa_tn_tb1 values ( 1601481680000 , 1960 , 1960 , 0 , 'b1960' );
+insert into pa_tn_tb1 values ( 1601481681000 , 1997 , 1997 , 1 , 'b1997' );
+insert into pa_tn_tb1 values ( 1601481682000 , 1034 , 1034 , 2 , 'b1034' );
+insert into pa_tn_tb1 values ( 1601481683000 , 1071 , 1071 , 3 , 'b1071' );
+insert into pa_tn_tb1 values ( 1601481684000 , 1108 , 1108 , 4 , 'b1108' );
+insert into pa_tn_tb1 values ( 1601481685000 , 1145 , 1145 , 5 , 'b1145' );
+insert into pa_tn_tb1 values ( 1601481686000 , 1182 , 1182 , 6 , 'b1182' );
+insert into pa_tn_tb1 values ( 1601481687000 , 1219 , 1219 , 7 , 'b1219' );
+insert into pa_tn_tb1 values ( 1601481688000 , 1256 , 1256 , 8 , 'b1256' );
+insert into pa_tn_tb1 values ( 1601481689000 , 1293 , 1293 , 9 , 'b1293' );
+insert into pa_tn_tb1 values ( 1601481690000 , 1330 , 1330 , 0 , 'b1330' );
+insert into pa_tn_tb1 values ( 1601481691000 , 1367 , 1367 , 1 , 'b1367' );
+insert into pa_tn_tb1 values ( 1601481692000 , 1404 , 1404 , 2 , 'b1404' );
+insert into pa_tn_tb1 values ( 1601481693000 , 1441 , 1441 , 3 , 'b1441' );
+insert into pa_tn_tb1 values ( 1601481694000 , 1478 , 1478 , 4 , 'b1478' );
+insert into pa_tn_tb1 values ( 1601481695000 , 1515 , 1515 , 5 , 'b1515' );
+insert into pa_tn_tb1 values ( 1601481696000 , 1552 , 1552 , 6 , 'b1552' );
+insert into pa_tn_tb1 values ( 1601481697000 , 1589 , 1589 , 7 , 'b1589' );
+insert into pa_tn_tb1 values ( 1601481698000 , 1626 , 1626 , 8 , 'b1626' );
+insert into pa_tn_tb1 values ( 1601481699000 , 1663 , 1663 , 9 , 'b1663' );
+insert into pa_tn_tb1 values ( 1601481700000 , 1700 , NULL , 0 , 'b1700' );
+insert into pa_tn_tb1 values ( 1601481701000 , 1737 , 1737 , 1 , 'b1737' );
+insert into pa_tn_tb1 values ( 1601481702000 , 1774 , 1774 , 2 , 'b1774' );
+insert into pa_tn_tb1 values ( 1601481703000 , 1811 , 1811 , 3 , 'b1811' );
+insert into pa_tn_tb1 values ( 1601481704000 , 1848 , 1848 , 4 , 'b1848' );
+insert into pa_tn_tb1 values ( 1601481705000 , 1885 , 1885 , 5 , 'b1885' );
+insert into pa_tn_tb1 values ( 1601481706000 , 1922 , 1922 , 6 , 'b1922' );
+insert into pa_tn_tb1 values ( 1601481707000 , 1959 , 1959 , 7 , 'b1959' );
+insert into pa_tn_tb1 values ( 1601481708000 , 1996 , 1996 , 8 , 'b1996' );
+insert into pa_tn_tb1 values ( 1601481709000 , 1033 , 1033 , 9 , 'b1033' );
+insert into pa_tn_tb1 values ( 1601481710000 , 1070 , 1070 , 0 , 'b1070' );
+insert into pa_tn_tb1 values ( 1601481711000 , 1107 , 1107 , 1 , 'b1107' );
+insert into pa_tn_tb1 values ( 1601481712000 , 1144 , 1144 , 2 , 'b1144' );
+insert into pa_tn_tb1 values ( 1601481713000 , 1181 , 1181 , 3 , 'b1181' );
+insert into pa_tn_tb1 values ( 1601481714000 , 1218 , 1218 , 4 , 'b1218' );
+insert into pa_tn_tb1 values ( 1601481715000 , 1255 , 1255 , 5 , 'b1255' );
+insert into pa_tn_tb1 values ( 1601481716000 , 1292 , 1292 , 6 , 'b1292' );
+insert into pa_tn_tb1 values ( 1601481717000 , 1329 , 1329 , 7 , 'b1329' );
+insert into pa_tn_tb1 values ( 1601481718000 , 1366 , 1366 , 8 , 'b1366' );
+insert into pa_tn_tb1 values ( 1601481719000 , 1403 , 1403 , 9 , 'b1403' );
+insert into pa_tn_tb1 values ( 1601481720000 , 1440 , 1440 , 0 , 'b1440' );
+insert into pa_tn_tb1 values ( 1601481721000 , 1477 , 1477 , 1 , 'b1477' );
+insert into pa_tn_tb1 values ( 1601481722000 , 1514 , 1514 , 2 , 'b1514' );
+insert into pa_tn_tb1 values ( 1601481723000 , 1551 , 1551 , 3 , 'b1551' );
+insert into pa_tn_tb1 values ( 1601481724000 , 1588 , 1588 , 4 , 'b1588' );
+insert into pa_tn_tb1 values ( 1601481725000 , 1625 , 1625 , 5 , 'b1625' );
+insert into pa_tn_tb1 values ( 1601481726000 , 1662 , 1662 , 6 , 'b1662' );
+insert into pa_tn_tb1 values ( 1601481727000 , 1699 , 1699 , 7 , 'b1699' );
+insert into pa_tn_tb1 values ( 1601481728000 , 1736 , 1736 , 8 , 'b1736' );
+insert into pa_tn_tb1 values ( 1601481729000 , 1773 , 1773 , 9 , 'b1773' );
+insert into pa_tn_tb1 values ( 1601481730000 , 1810 , 1810 , 0 , 'b1810' );
+insert into pa_tn_tb1 values ( 1601481731000 , 1847 , 1847 , 1 , 'b1847' );
+insert into pa_tn_tb1 values ( 1601481732000 , 1884 , 1884 , 2 , 'b1884' );
+insert into pa_tn_tb1 values ( 1601481733000 , 1921 , 1921 , 3 , 'b1921' );
+insert into pa_tn_tb1 values ( 1601481734000 , 1958 , 1958 , 4 , 'b1958' );
+insert into pa_tn_tb1 values ( 1601481735000 , 1995 , 1995 , 5 , 'b1995' );
+insert into pa_tn_tb1 values ( 1601481736000 , 1032 , 1032 , 6 , 'b1032' );
+insert into pa_tn_tb1 values ( 1601481737000 , 1069 , 1069 , 7 , 'b1069' );
+insert into pa_tn_tb1 values ( 1601481738000 , 1106 , 1106 , 8 , 'b1106' );
+insert into pa_tn_tb1 values ( 1601481739000 , 1143 , 1143 , 9 , 'b1143' );
+insert into pa_tn_tb1 values ( 1601481740000 , 1180 , 1180 , 0 , 'b1180' );
+insert into pa_tn_tb1 values ( 1601481741000 , 1217 , 1217 , 1 , 'b1217' );
+insert into pa_tn_tb1 values ( 1601481742000 , 1254 , 1254 , 2 , 'b1254' );
+insert into pa_tn_tb1 values ( 1601481743000 , 1291 , 1291 , 3 , 'b1291' );
+insert into pa_tn_tb1 values ( 1601481744000 , 1328 , 1328 , 4 , 'b1328' );
+insert into pa_tn_tb1 values ( 1601481745000 , 1365 , 1365 , 5 , 'b1365' );
+insert into pa_tn_tb1 values ( 1601481746000 , 1402 , 1402 , 6 , 'b1402' );
+insert into pa_tn_tb1 values ( 1601481747000 , 1439 , 1439 , 7 , 'b1439' );
+insert into pa_tn_tb1 values ( 1601481748000 , 1476 , 1476 , 8 , 'b1476' );
+insert into pa_tn_tb1 values ( 1601481749000 , 1513 , 1513 , 9 , 'b1513' );
+insert into pa_tn_tb1 values ( 1601481750000 , 1550 , NULL , 0 , 'b1550' );
+insert into pa_tn_tb1 values ( 1601481751000 , 1587 , 1587 , 1 , 'b1587' );
+insert into pa_tn_tb1 values ( 1601481752000 , 1624 , 1624 , 2 , 'b1624' );
+insert into pa_tn_tb1 values ( 1601481753000 , 1661 , 1661 , 3 , 'b1661' );
+insert into pa_tn_tb1 values ( 1601481754000 , 1698 , 1698 , 4 , 'b1698' );
+insert into pa_tn_tb1 values ( 1601481755000 , 1735 , 1735 , 5 , 'b1735' );
+insert into pa_tn_tb1 values ( 1601481756000 , 1772 , 1772 , 6 , 'b1772' );
+insert into pa_tn_tb1 values ( 1601481757000 , 1809 , 1809 , 7 , 'b1809' );
+insert into pa_tn_tb1 values ( 1601481758000 , 1846 , 1846 , 8 , 'b1846' );
+insert into pa_tn_tb1 values ( 1601481759000 , 1883 , 1883 , 9 , 'b1883' );
+insert into pa_tn_tb1 values ( 1601481760000 , 1920 , 1920 , 0 , 'b1920' );
+insert into pa_tn_tb1 values ( 1601481761000 , 1957 , 1957 , 1 , 'b1957' );
+insert into pa_tn_tb1 values ( 1601481762000 , 1994 , 1994 , 2 , 'b1994' );
+insert into pa_tn_tb1 values ( 1601481763000 , 1031 , 1031 , 3 , 'b1031' );
+insert into pa_tn_tb1 values ( 1601481764000 , 1068 , 1068 , 4 , 'b1068' );
+insert into pa_tn_tb1 values ( 1601481765000 , 1105 , 1105 , 5 , 'b1105' );
+insert into pa_tn_tb1 values ( 1601481766000 , 1142 , 1142 , 6 , 'b1142' );
+insert into pa_tn_tb1 values ( 1601481767000 , 1179 , 1179 , 7 , 'b1179' );
+insert into pa_tn_tb1 values ( 1601481768000 , 1216 , 1216 , 8 , 'b1216' );
+insert into pa_tn_tb1 values ( 1601481769000 , 1253 , 1253 , 9 , 'b1253' );
+insert into pa_tn_tb1 values ( 1601481770000 , 1290 , 1290 , 0 , 'b1290' );
+insert into pa_tn_tb1 values ( 1601481771000 , 1327 , 1327 , 1 , 'b1327' );
+insert into pa_tn_tb1 values ( 1601481772000 , 1364 , 1364 , 2 , 'b1364' );
+insert into pa_tn_tb1 values ( 1601481773000 , 1401 , 1401 , 3 , 'b1401' );
+insert into pa_tn_tb1 values ( 1601481774000 , 1438 , 1438 , 4 , 'b1438' );
+insert into pa_tn_tb1 values ( 1601481775000 , 1475 , 1475 , 5 , 'b1475' );
+insert into pa_tn_tb1 values ( 1601481776000 , 1512 , 1512 , 6 , 'b1512' );
+insert into pa_tn_tb1 values ( 1601481777000 , 1549 , 1549 , 7 , 'b1549' );
+insert into pa_tn_tb1 values ( 1601481778000 , 1586 , 1586 , 8 , 'b1586' );
+insert into pa_tn_tb1 values ( 1601481779000 , 1623 , 1623 , 9 , 'b1623' );
+insert into pa_tn_tb1 values ( 1601481780000 , 1660 , 1660 , 0 , 'b1660' );
+insert into pa_tn_tb1 values ( 1601481781000 , 1697 , 1697 , 1 , 'b1697' );
+insert into pa_tn_tb1 values ( 1601481782000 , 1734 , 1734 , 2 , 'b1734' );
+insert into pa_tn_tb1 values ( 1601481783000 , 1771 , 1771 , 3 , 'b1771' );
+insert into pa_tn_tb1 values ( 1601481784000 , 1808 , 1808 , 4 , 'b1808' );
+insert into pa_tn_tb1 values ( 1601481785000 , 1845 , 1845 , 5 , 'b1845' );
+insert into pa_tn_tb1 values ( 1601481786000 , 1882 , 1882 , 6 , 'b1882' );
+insert into pa_tn_tb1 values ( 1601481787000 , 1919 , 1919 , 7 , 'b1919' );
+insert into pa_tn_tb1 values ( 1601481788000 , 1956 , 1956 , 8 , 'b1956' );
+insert into pa_tn_tb1 values ( 1601481789000 , 1993 , 1993 , 9 , 'b1993' );
+insert into pa_tn_tb1 values ( 1601481790000 , 1030 , 1030 , 0 , 'b1030' );
+insert into pa_tn_tb1 values ( 1601481791000 , 1067 , 1067 , 1 , 'b1067' );
+insert into pa_tn_tb1 values ( 1601481792000 , 1104 , 1104 , 2 , 'b1104' );
+insert into pa_tn_tb1 values ( 1601481793000 , 1141 , 1141 , 3 , 'b1141' );
+insert into pa_tn_tb1 values ( 1601481794000 , 1178 , 1178 , 4 , 'b1178' );
+insert into pa_tn_tb1 values ( 1601481795000 , 1215 , 1215 , 5 , 'b1215' );
+insert into pa_tn_tb1 values ( 1601481796000 , 1252 , 1252 , 6 , 'b1252' );
+insert into pa_tn_tb1 values ( 1601481797000 , 1289 , 1289 , 7 , 'b1289' );
+insert into pa_tn_tb1 values ( 1601481798000 , 1326 , 1326 , 8 , 'b1326' );
+insert into pa_tn_tb1 values ( 1601481799000 , 1363 , 1363 , 9 , 'b1363' );
+insert into pa_tn_tb1 values ( 1601481800000 , 1400 , NULL , 0 , 'b1400' );
+insert into pa_tn_tb1 values ( 1601481801000 , 1437 , 1437 , 1 , 'b1437' );
+insert into pa_tn_tb1 values ( 1601481802000 , 1474 , 1474 , 2 , 'b1474' );
+insert into pa_tn_tb1 values ( 1601481803000 , 1511 , 1511 , 3 , 'b1511' );
+insert into pa_tn_tb1 values ( 1601481804000 , 1548 , 1548 , 4 , 'b1548' );
+insert into pa_tn_tb1 values ( 1601481805000 , 1585 , 1585 , 5 , 'b1585' );
+insert into pa_tn_tb1 values ( 1601481806000 , 1622 , 1622 , 6 , 'b1622' );
+insert into pa_tn_tb1 values ( 1601481807000 , 1659 , 1659 , 7 , 'b1659' );
+insert into pa_tn_tb1 values ( 1601481808000 , 1696 , 1696 , 8 , 'b1696' );
+insert into pa_tn_tb1 values ( 1601481809000 , 1733 , 1733 , 9 , 'b1733' );
+insert into pa_tn_tb1 values ( 1601481810000 , 1770 , 1770 , 0 , 'b1770' );
+insert into pa_tn_tb1 values ( 1601481811000 , 1807 , 1807 , 1 , 'b1807' );
+insert into pa_tn_tb1 values ( 1601481812000 , 1844 , 1844 , 2 , 'b1844' );
+insert into pa_tn_tb1 values ( 1601481813000 , 1881 , 1881 , 3 , 'b1881' );
+insert into pa_tn_tb1 values ( 1601481814000 , 1918 , 1918 , 4 , 'b1918' );
+insert into pa_tn_tb1 values ( 1601481815000 , 1955 , 1955 , 5 , 'b1955' );
+insert into pa_tn_tb1 values ( 1601481816000 , 1992 , 1992 , 6 , 'b1992' );
+insert into pa_tn_tb1 values ( 1601481817000 , 1029 , 1029 , 7 , 'b1029' );
+insert into pa_tn_tb1 values ( 1601481818000 , 1066 , 1066 , 8 , 'b1066' );
+insert into pa_tn_tb1 values ( 1601481819000 , 1103 , 1103 , 9 , 'b1103' );
+insert into pa_tn_tb1 values ( 1601481820000 , 1140 , 1140 , 0 , 'b1140' );
+insert into pa_tn_tb1 values ( 1601481821000 , 1177 , 1177 , 1 , 'b1177' );
+insert into pa_tn_tb1 values ( 1601481822000 , 1214 , 1214 , 2 , 'b1214' );
+insert into pa_tn_tb1 values ( 1601481823000 , 1251 , 1251 , 3 , 'b1251' );
+insert into pa_tn_tb1 values ( 1601481824000 , 1288 , 1288 , 4 , 'b1288' );
+insert into pa_tn_tb1 values ( 1601481825000 , 1325 , 1325 , 5 , 'b1325' );
+insert into pa_tn_tb1 values ( 1601481826000 , 1362 , 1362 , 6 , 'b1362' );
+insert into pa_tn_tb1 values ( 1601481827000 , 1399 , 1399 , 7 , 'b1399' );
+insert into pa_tn_tb1 values ( 1601481828000 , 1436 , 1436 , 8 , 'b1436' );
+insert into pa_tn_tb1 values ( 1601481829000 , 1473 , 1473 , 9 , 'b1473' );
+insert into pa_tn_tb1 values ( 1601481830000 , 1510 , 1510 , 0 , 'b1510' );
+insert into pa_tn_tb1 values ( 1601481831000 , 1547 , 1547 , 1 , 'b1547' );
+insert into pa_tn_tb1 values ( 1601481832000 , 1584 , 1584 , 2 , 'b1584' );
+insert into pa_tn_tb1 values ( 1601481833000 , 1621 , 1621 , 3 , 'b1621' );
+insert into pa_tn_tb1 values ( 1601481834000 , 1658 , 1658 , 4 , 'b1658' );
+insert into pa_tn_tb1 values ( 1601481835000 , 1695 , 1695 , 5 , 'b1695' );
+insert into pa_tn_tb1 values ( 1601481836000 , 1732 , 1732 , 6 , 'b1732' );
+insert into pa_tn_tb1 values ( 1601481837000 , 1769 , 1769 , 7 , 'b1769' );
+insert into pa_tn_tb1 values ( 1601481838000 , 1806 , 1806 , 8 , 'b1806' );
+insert into pa_tn_tb1 values ( 1601481839000 , 1843 , 1843 , 9 , 'b1843' );
+insert into pa_tn_tb1 values ( 1601481840000 , 1880 , 1880 , 0 , 'b1880' );
+insert into pa_tn_tb1 values ( 1601481841000 , 1917 , 1917 , 1 , 'b1917' );
+insert into pa_tn_tb1 values ( 1601481842000 , 1954 , 1954 , 2 , 'b1954' );
+insert into pa_tn_tb1 values ( 1601481843000 , 1991 , 1991 , 3 , 'b1991' );
+insert into pa_tn_tb1 values ( 1601481844000 , 1028 , 1028 , 4 , 'b1028' );
+insert into pa_tn_tb1 values ( 1601481845000 , 1065 , 1065 , 5 , 'b1065' );
+insert into pa_tn_tb1 values ( 1601481846000 , 1102 , 1102 , 6 , 'b1102' );
+insert into pa_tn_tb1 values ( 1601481847000 , 1139 , 1139 , 7 , 'b1139' );
+insert into pa_tn_tb1 values ( 1601481848000 , 1176 , 1176 , 8 , 'b1176' );
+insert into pa_tn_tb1 values ( 1601481849000 , 1213 , 1213 , 9 , 'b1213' );
+insert into pa_tn_tb1 values ( 1601481850000 , 1250 , NULL , 0 , 'b1250' );
+insert into pa_tn_tb1 values ( 1601481851000 , 1287 , 1287 , 1 , 'b1287' );
+insert into pa_tn_tb1 values ( 1601481852000 , 1324 , 1324 , 2 , 'b1324' );
+insert into pa_tn_tb1 values ( 1601481853000 , 1361 , 1361 , 3 , 'b1361' );
+insert into pa_tn_tb1 values ( 1601481854000 , 1398 , 1398 , 4 , 'b1398' );
+insert into pa_tn_tb1 values ( 1601481855000 , 1435 , 1435 , 5 , 'b1435' );
+insert into pa_tn_tb1 values ( 1601481856000 , 1472 , 1472 , 6 , 'b1472' );
+insert into pa_tn_tb1 values ( 1601481857000 , 1509 , 1509 , 7 , 'b1509' );
+insert into pa_tn_tb1 values ( 1601481858000 , 1546 , 1546 , 8 , 'b1546' );
+insert into pa_tn_tb1 values ( 1601481859000 , 1583 , 1583 , 9 , 'b1583' );
+insert into pa_tn_tb1 values ( 1601481860000 , 1620 , 1620 , 0 , 'b1620' );
+insert into pa_tn_tb1 values ( 1601481861000 , 1657 , 1657 , 1 , 'b1657' );
+insert into pa_tn_tb1 values ( 1601481862000 , 1694 , 1694 , 2 , 'b1694' );
+insert into pa_tn_tb1 values ( 1601481863000 , 1731 , 1731 , 3 , 'b1731' );
+insert into pa_tn_tb1 values ( 1601481864000 , 1768 , 1768 , 4 , 'b1768' );
+insert into pa_tn_tb1 values ( 1601481865000 , 1805 , 1805 , 5 , 'b1805' );
+insert into pa_tn_tb1 values ( 1601481866000 , 1842 , 1842 , 6 , 'b1842' );
+insert into pa_tn_tb1 values ( 1601481867000 , 1879 , 1879 , 7 , 'b1879' );
+insert into pa_tn_tb1 values ( 1601481868000 , 1916 , 1916 , 8 , 'b1916' );
+insert into pa_tn_tb1 values ( 1601481869000 , 1953 , 1953 , 9 , 'b1953' );
+insert into pa_tn_tb1 values ( 1601481870000 , 1990 , 1990 , 0 , 'b1990' );
+insert into pa_tn_tb1 values ( 1601481871000 , 1027 , 1027 , 1 , 'b1027' );
+insert into pa_tn_tb1 values ( 1601481872000 , 1064 , 1064 , 2 , 'b1064' );
+insert into pa_tn_tb1 values ( 1601481873000 , 1101 , 1101 , 3 , 'b1101' );
+insert into pa_tn_tb1 values ( 1601481874000 , 1138 , 1138 , 4 , 'b1138' );
+insert into pa_tn_tb1 values ( 1601481875000 , 1175 , 1175 , 5 , 'b1175' );
+insert into pa_tn_tb1 values ( 1601481876000 , 1212 , 1212 , 6 , 'b1212' );
+insert into pa_tn_tb1 values ( 1601481877000 , 1249 , 1249 , 7 , 'b1249' );
+insert into pa_tn_tb1 values ( 1601481878000 , 1286 , 1286 , 8 , 'b1286' );
+insert into pa_tn_tb1 values ( 1601481879000 , 1323 , 1323 , 9 , 'b1323' );
+insert into pa_tn_tb1 values ( 1601481880000 , 1360 , 1360 , 0 , 'b1360' );
+insert into pa_tn_tb1 values ( 1601481881000 , 1397 , 1397 , 1 , 'b1397' );
+insert into pa_tn_tb1 values ( 1601481882000 , 1434 , 1434 , 2 , 'b1434' );
+insert into pa_tn_tb1 values ( 1601481883000 , 1471 , 1471 , 3 , 'b1471' );
+insert into pa_tn_tb1 values ( 1601481884000 , 1508 , 1508 , 4 , 'b1508' );
+insert into pa_tn_tb1 values ( 1601481885000 , 1545 , 1545 , 5 , 'b1545' );
+insert into pa_tn_tb1 values ( 1601481886000 , 1582 , 1582 , 6 , 'b1582' );
+insert into pa_tn_tb1 values ( 1601481887000 , 1619 , 1619 , 7 , 'b1619' );
+insert into pa_tn_tb1 values ( 1601481888000 , 1656 , 1656 , 8 , 'b1656' );
+insert into pa_tn_tb1 values ( 1601481889000 , 1693 , 1693 , 9 , 'b1693' );
+insert into pa_tn_tb1 values ( 1601481890000 , 1730 , 1730 , 0 , 'b1730' );
+insert into pa_tn_tb1 values ( 1601481891000 , 1767 , 1767 , 1 , 'b1767' );
+insert into pa_tn_tb1 values ( 1601481892000 , 1804 , 1804 , 2 , 'b1804' );
+insert into pa_tn_tb1 values ( 1601481893000 , 1841 , 1841 , 3 , 'b1841' );
+insert into pa_tn_tb1 values ( 1601481894000 , 1878 , 1878 , 4 , 'b1878' );
+insert into pa_tn_tb1 values ( 1601481895000 , 1915 , 1915 , 5 , 'b1915' );
+insert into pa_tn_tb1 values ( 1601481896000 , 1952 , 1952 , 6 , 'b1952' );
+insert into pa_tn_tb1 values ( 1601481897000 , 1989 , 1989 , 7 , 'b1989' );
+insert into pa_tn_tb1 values ( 1601481898000 , 1026 , 1026 , 8 , 'b1026' );
+insert into pa_tn_tb1 values ( 1601481899000 , 1063 , 1063 , 9 , 'b1063' );
+insert into pa_tn_tb1 values ( 1601481900000 , 1100 , NULL , 0 , 'b1100' );
+insert into pa_tn_tb1 values ( 1601481901000 , 1137 , 1137 , 1 , 'b1137' );
+insert into pa_tn_tb1 values ( 1601481902000 , 1174 , 1174 , 2 , 'b1174' );
+insert into pa_tn_tb1 values ( 1601481903000 , 1211 , 1211 , 3 , 'b1211' );
+insert into pa_tn_tb1 values ( 1601481904000 , 1248 , 1248 , 4 , 'b1248' );
+insert into pa_tn_tb1 values ( 1601481905000 , 1285 , 1285 , 5 , 'b1285' );
+insert into pa_tn_tb1 values ( 1601481906000 , 1322 , 1322 , 6 , 'b1322' );
+insert into pa_tn_tb1 values ( 1601481907000 , 1359 , 1359 , 7 , 'b1359' );
+insert into pa_tn_tb1 values ( 1601481908000 , 1396 , 1396 , 8 , 'b1396' );
+insert into pa_tn_tb1 values ( 1601481909000 , 1433 , 1433 , 9 , 'b1433' );
+insert into pa_tn_tb1 values ( 1601481910000 , 1470 , 1470 , 0 , 'b1470' );
+insert into pa_tn_tb1 values ( 1601481911000 , 1507 , 1507 , 1 , 'b1507' );
+insert into pa_tn_tb1 values ( 1601481912000 , 1544 , 1544 , 2 , 'b1544' );
+insert into pa_tn_tb1 values ( 1601481913000 , 1581 , 1581 , 3 , 'b1581' );
+insert into pa_tn_tb1 values ( 1601481914000 , 1618 , 1618 , 4 , 'b1618' );
+insert into pa_tn_tb1 values ( 1601481915000 , 1655 , 1655 , 5 , 'b1655' );
+insert into pa_tn_tb1 values ( 1601481916000 , 1692 , 1692 , 6 , 'b1692' );
+insert into pa_tn_tb1 values ( 1601481917000 , 1729 , 1729 , 7 , 'b1729' );
+insert into pa_tn_tb1 values ( 1601481918000 , 1766 , 1766 , 8 , 'b1766' );
+insert into pa_tn_tb1 values ( 1601481919000 , 1803 , 1803 , 9 , 'b1803' );
+insert into pa_tn_tb1 values ( 1601481920000 , 1840 , 1840 , 0 , 'b1840' );
+insert into pa_tn_tb1 values ( 1601481921000 , 1877 , 1877 , 1 , 'b1877' );
+insert into pa_tn_tb1 values ( 1601481922000 , 1914 , 1914 , 2 , 'b1914' );
+insert into pa_tn_tb1 values ( 1601481923000 , 1951 , 1951 , 3 , 'b1951' );
+insert into pa_tn_tb1 values ( 1601481924000 , 1988 , 1988 , 4 , 'b1988' );
+insert into pa_tn_tb1 values ( 1601481925000 , 1025 , 1025 , 5 , 'b1025' );
+insert into pa_tn_tb1 values ( 1601481926000 , 1062 , 1062 , 6 , 'b1062' );
+insert into pa_tn_tb1 values ( 1601481927000 , 1099 , 1099 , 7 , 'b1099' );
+insert into pa_tn_tb1 values ( 1601481928000 , 1136 , 1136 , 8 , 'b1136' );
+insert into pa_tn_tb1 values ( 1601481929000 , 1173 , 1173 , 9 , 'b1173' );
+insert into pa_tn_tb1 values ( 1601481930000 , 1210 , 1210 , 0 , 'b1210' );
+insert into pa_tn_tb1 values ( 1601481931000 , 1247 , 1247 , 1 , 'b1247' );
+insert into pa_tn_tb1 values ( 1601481932000 , 1284 , 1284 , 2 , 'b1284' );
+insert into pa_tn_tb1 values ( 1601481933000 , 1321 , 1321 , 3 , 'b1321' );
+insert into pa_tn_tb1 values ( 1601481934000 , 1358 , 1358 , 4 , 'b1358' );
+insert into pa_tn_tb1 values ( 1601481935000 , 1395 , 1395 , 5 , 'b1395' );
+insert into pa_tn_tb1 values ( 1601481936000 , 1432 , 1432 , 6 , 'b1432' );
+insert into pa_tn_tb1 values ( 1601481937000 , 1469 , 1469 , 7 , 'b1469' );
+insert into pa_tn_tb1 values ( 1601481938000 , 1506 , 1506 , 8 , 'b1506' );
+insert into pa_tn_tb1 values ( 1601481939000 , 1543 , 1543 , 9 , 'b1543' );
+insert into pa_tn_tb1 values ( 1601481940000 , 1580 , 1580 , 0 , 'b1580' );
+insert into pa_tn_tb1 values ( 1601481941000 , 1617 , 1617 , 1 , 'b1617' );
+insert into pa_tn_tb1 values ( 1601481942000 , 1654 , 1654 , 2 , 'b1654' );
+insert into pa_tn_tb1 values ( 1601481943000 , 1691 , 1691 , 3 , 'b1691' );
+insert into pa_tn_tb1 values ( 1601481944000 , 1728 , 1728 , 4 , 'b1728' );
+insert into pa_tn_tb1 values ( 1601481945000 , 1765 , 1765 , 5 , 'b1765' );
+insert into pa_tn_tb1 values ( 1601481946000 , 1802 , 1802 , 6 , 'b1802' );
+insert into pa_tn_tb1 values ( 1601481947000 , 1839 , 1839 , 7 , 'b1839' );
+insert into pa_tn_tb1 values ( 1601481948000 , 1876 , 1876 , 8 , 'b1876' );
+insert into pa_tn_tb1 values ( 1601481949000 , 1913 , 1913 , 9 , 'b1913' );
+insert into pa_tn_tb1 values ( 1601481950000 , 1950 , NULL , 0 , 'b1950' );
+insert into pa_tn_tb1 values ( 1601481951000 , 1987 , 1987 , 1 , 'b1987' );
+insert into pa_tn_tb1 values ( 1601481952000 , 1024 , 1024 , 2 , 'b1024' );
+insert into pa_tn_tb1 values ( 1601481953000 , 1061 , 1061 , 3 , 'b1061' );
+insert into pa_tn_tb1 values ( 1601481954000 , 1098 , 1098 , 4 , 'b1098' );
+insert into pa_tn_tb1 values ( 1601481955000 , 1135 , 1135 , 5 , 'b1135' );
+insert into pa_tn_tb1 values ( 1601481956000 , 1172 , 1172 , 6 , 'b1172' );
+insert into pa_tn_tb1 values ( 1601481957000 , 1209 , 1209 , 7 , 'b1209' );
+insert into pa_tn_tb1 values ( 1601481958000 , 1246 , 1246 , 8 , 'b1246' );
+insert into pa_tn_tb1 values ( 1601481959000 , 1283 , 1283 , 9 , 'b1283' );
+insert into pa_tn_tb1 values ( 1601481960000 , 1320 , 1320 , 0 , 'b1320' );
+insert into pa_tn_tb1 values ( 1601481961000 , 1357 , 1357 , 1 , 'b1357' );
+insert into pa_tn_tb1 values ( 1601481962000 , 1394 , 1394 , 2 , 'b1394' );
+insert into pa_tn_tb1 values ( 1601481963000 , 1431 , 1431 , 3 , 'b1431' );
+insert into pa_tn_tb1 values ( 1601481964000 , 1468 , 1468 , 4 , 'b1468' );
+insert into pa_tn_tb1 values ( 1601481965000 , 1505 , 1505 , 5 , 'b1505' );
+insert into pa_tn_tb1 values ( 1601481966000 , 1542 , 1542 , 6 , 'b1542' );
+insert into pa_tn_tb1 values ( 1601481967000 , 1579 , 1579 , 7 , 'b1579' );
+insert into pa_tn_tb1 values ( 1601481968000 , 1616 , 1616 , 8 , 'b1616' );
+insert into pa_tn_tb1 values ( 1601481969000 , 1653 , 1653 , 9 , 'b1653' );
+insert into pa_tn_tb1 values ( 1601481970000 , 1690 , 1690 , 0 , 'b1690' );
+insert into pa_tn_tb1 values ( 1601481971000 , 1727 , 1727 , 1 , 'b1727' );
+insert into pa_tn_tb1 values ( 1601481972000 , 1764 , 1764 , 2 , 'b1764' );
+insert into pa_tn_tb1 values ( 1601481973000 , 1801 , 1801 , 3 , 'b1801' );
+insert into pa_tn_tb1 values ( 1601481974000 , 1838 , 1838 , 4 , 'b1838' );
+insert into pa_tn_tb1 values ( 1601481975000 , 1875 , 1875 , 5 , 'b1875' );
+insert into pa_tn_tb1 values ( 1601481976000 , 1912 , 1912 , 6 , 'b1912' );
+insert into pa_tn_tb1 values ( 1601481977000 , 1949 , 1949 , 7 , 'b1949' );
+insert into pa_tn_tb1 values ( 1601481978000 , 1986 , 1986 , 8 , 'b1986' );
+insert into pa_tn_tb1 values ( 1601481979000 , 1023 , 1023 , 9 , 'b1023' );
+insert into pa_tn_tb1 values ( 1601481980000 , 1060 , 1060 , 0 , 'b1060' );
+insert into pa_tn_tb1 values ( 1601481981000 , 1097 , 1097 , 1 , 'b1097' );
+insert into pa_tn_tb1 values ( 1601481982000 , 1134 , 1134 , 2 , 'b1134' );
+insert into pa_tn_tb1 values ( 1601481983000 , 1171 , 1171 , 3 , 'b1171' );
+insert into pa_tn_tb1 values ( 1601481984000 , 1208 , 1208 , 4 , 'b1208' );
+insert into pa_tn_tb1 values ( 1601481985000 , 1245 , 1245 , 5 , 'b1245' );
+insert into pa_tn_tb1 values ( 1601481986000 , 1282 , 1282 , 6 , 'b1282' );
+insert into pa_tn_tb1 values ( 1601481987000 , 1319 , 1319 , 7 , 'b1319' );
+insert into pa_tn_tb1 values ( 1601481988000 , 1356 , 1356 , 8 , 'b1356' );
+insert into pa_tn_tb1 values ( 1601481989000 , 1393 , 1393 , 9 , 'b1393' );
+insert into pa_tn_tb1 values ( 1601481990000 , 1430 , 1430 , 0 , 'b1430' );
+insert into pa_tn_tb1 values ( 1601481991000 , 1467 , 1467 , 1 , 'b1467' );
+insert into pa_tn_tb1 values ( 1601481992000 , 1504 , 1504 , 2 , 'b1504' );
+insert into pa_tn_tb1 values ( 1601481993000 , 1541 , 1541 , 3 , 'b1541' );
+insert into pa_tn_tb1 values ( 1601481994000 , 1578 , 1578 , 4 , 'b1578' );
+insert into pa_tn_tb1 values ( 1601481995000 , 1615 , 1615 , 5 , 'b1615' );
+insert into pa_tn_tb1 values ( 1601481996000 , 1652 , 1652 , 6 , 'b1652' );
+insert into pa_tn_tb1 values ( 1601481997000 , 1689 , 1689 , 7 , 'b1689' );
+insert into pa_tn_tb1 values ( 1601481998000 , 1726 , 1726 , 8 , 'b1726' );
+insert into pa_tn_tb1 values ( 1601481999000 , 1763 , 1763 , 9 , 'b1763' );
+insert into pa_tn_tb1 values ( 1601482000000 , 1800 , NULL , 0 , 'b1800' );
+insert into pa_tn_tb1 values ( 1601482001000 , 1837 , 1837 , 1 , 'b1837' );
+insert into pa_tn_tb1 values ( 1601482002000 , 1874 , 1874 , 2 , 'b1874' );
+insert into pa_tn_tb1 values ( 1601482003000 , 1911 , 1911 , 3 , 'b1911' );
+insert into pa_tn_tb1 values ( 1601482004000 , 1948 , 1948 , 4 , 'b1948' );
+insert into pa_tn_tb1 values ( 1601482005000 , 1985 , 1985 , 5 , 'b1985' );
+insert into pa_tn_tb1 values ( 1601482006000 , 1022 , 1022 , 6 , 'b1022' );
+insert into pa_tn_tb1 values ( 1601482007000 , 1059 , 1059 , 7 , 'b1059' );
+insert into pa_tn_tb1 values ( 1601482008000 , 1096 , 1096 , 8 , 'b1096' );
+insert into pa_tn_tb1 values ( 1601482009000 , 1133 , 1133 , 9 , 'b1133' );
+insert into pa_tn_tb1 values ( 1601482010000 , 1170 , 1170 , 0 , 'b1170' );
+insert into pa_tn_tb1 values ( 1601482011000 , 1207 , 1207 , 1 , 'b1207' );
+insert into pa_tn_tb1 values ( 1601482012000 , 1244 , 1244 , 2 , 'b1244' );
+insert into pa_tn_tb1 values ( 1601482013000 , 1281 , 1281 , 3 , 'b1281' );
+insert into pa_tn_tb1 values ( 1601482014000 , 1318 , 1318 , 4 , 'b1318' );
+insert into pa_tn_tb1 values ( 1601482015000 , 1355 , 1355 , 5 , 'b1355' );
+insert into pa_tn_tb1 values ( 1601482016000 , 1392 , 1392 , 6 , 'b1392' );
+insert into pa_tn_tb1 values ( 1601482017000 , 1429 , 1429 , 7 , 'b1429' );
+insert into pa_tn_tb1 values ( 1601482018000 , 1466 , 1466 , 8 , 'b1466' );
+insert into pa_tn_tb1 values ( 1601482019000 , 1503 , 1503 , 9 , 'b1503' );
+insert into pa_tn_tb1 values ( 1601482020000 , 1540 , 1540 , 0 , 'b1540' );
+insert into pa_tn_tb1 values ( 1601482021000 , 1577 , 1577 , 1 , 'b1577' );
+insert into pa_tn_tb1 values ( 1601482022000 , 1614 , 1614 , 2 , 'b1614' );
+insert into pa_tn_tb1 values ( 1601482023000 , 1651 , 1651 , 3 , 'b1651' );
+insert into pa_tn_tb1 values ( 1601482024000 , 1688 , 1688 , 4 , 'b1688' );
+insert into pa_tn_tb1 values ( 1601482025000 , 1725 , 1725 , 5 , 'b1725' );
+insert into pa_tn_tb1 values ( 1601482026000 , 1762 , 1762 , 6 , 'b1762' );
+insert into pa_tn_tb1 values ( 1601482027000 , 1799 , 1799 , 7 , 'b1799' );
+insert into pa_tn_tb1 values ( 1601482028000 , 1836 , 1836 , 8 , 'b1836' );
+insert into pa_tn_tb1 values ( 1601482029000 , 1873 , 1873 , 9 , 'b1873' );
+insert into pa_tn_tb1 values ( 1601482030000 , 1910 , 1910 , 0 , 'b1910' );
+insert into pa_tn_tb1 values ( 1601482031000 , 1947 , 1947 , 1 , 'b1947' );
+insert into pa_tn_tb1 values ( 1601482032000 , 1984 , 1984 , 2 , 'b1984' );
+insert into pa_tn_tb1 values ( 1601482033000 , 1021 , 1021 , 3 , 'b1021' );
+insert into pa_tn_tb1 values ( 1601482034000 , 1058 , 1058 , 4 , 'b1058' );
+insert into pa_tn_tb1 values ( 1601482035000 , 1095 , 1095 , 5 , 'b1095' );
+insert into pa_tn_tb1 values ( 1601482036000 , 1132 , 1132 , 6 , 'b1132' );
+insert into pa_tn_tb1 values ( 1601482037000 , 1169 , 1169 , 7 , 'b1169' );
+insert into pa_tn_tb1 values ( 1601482038000 , 1206 , 1206 , 8 , 'b1206' );
+insert into pa_tn_tb1 values ( 1601482039000 , 1243 , 1243 , 9 , 'b1243' );
+insert into pa_tn_tb1 values ( 1601482040000 , 1280 , 1280 , 0 , 'b1280' );
+insert into pa_tn_tb1 values ( 1601482041000 , 1317 , 1317 , 1 , 'b1317' );
+insert into pa_tn_tb1 values ( 1601482042000 , 1354 , 1354 , 2 , 'b1354' );
+insert into pa_tn_tb1 values ( 1601482043000 , 1391 , 1391 , 3 , 'b1391' );
+insert into pa_tn_tb1 values ( 1601482044000 , 1428 , 1428 , 4 , 'b1428' );
+insert into pa_tn_tb1 values ( 1601482045000 , 1465 , 1465 , 5 , 'b1465' );
+insert into pa_tn_tb1 values ( 1601482046000 , 1502 , 1502 , 6 , 'b1502' );
+insert into pa_tn_tb1 values ( 1601482047000 , 1539 , 1539 , 7 , 'b1539' );
+insert into pa_tn_tb1 values ( 1601482048000 , 1576 , 1576 , 8 , 'b1576' );
+insert into pa_tn_tb1 values ( 1601482049000 , 1613 , 1613 , 9 , 'b1613' );
+insert into pa_tn_tb1 values ( 1601482050000 , 1650 , NULL , 0 , 'b1650' );
+insert into pa_tn_tb1 values ( 1601482051000 , 1687 , 1687 , 1 , 'b1687' );
+insert into pa_tn_tb1 values ( 1601482052000 , 1724 , 1724 , 2 , 'b1724' );
+insert into pa_tn_tb1 values ( 1601482053000 , 1761 , 1761 , 3 , 'b1761' );
+insert into pa_tn_tb1 values ( 1601482054000 , 1798 , 1798 , 4 , 'b1798' );
+insert into pa_tn_tb1 values ( 1601482055000 , 1835 , 1835 , 5 , 'b1835' );
+insert into pa_tn_tb1 values ( 1601482056000 , 1872 , 1872 , 6 , 'b1872' );
+insert into pa_tn_tb1 values ( 1601482057000 , 1909 , 1909 , 7 , 'b1909' );
+insert into pa_tn_tb1 values ( 1601482058000 , 1946 , 1946 , 8 , 'b1946' );
+insert into pa_tn_tb1 values ( 1601482059000 , 1983 , 1983 , 9 , 'b1983' );
+insert into pa_tn_tb1 values ( 1601482060000 , 1020 , 1020 , 0 , 'b1020' );
+insert into pa_tn_tb1 values ( 1601482061000 , 1057 , 1057 , 1 , 'b1057' );
+insert into pa_tn_tb1 values ( 1601482062000 , 1094 , 1094 , 2 , 'b1094' );
+insert into pa_tn_tb1 values ( 1601482063000 , 1131 , 1131 , 3 , 'b1131' );
+insert into pa_tn_tb1 values ( 1601482064000 , 1168 , 1168 , 4 , 'b1168' );
+insert into pa_tn_tb1 values ( 1601482065000 , 1205 , 1205 , 5 , 'b1205' );
+insert into pa_tn_tb1 values ( 1601482066000 , 1242 , 1242 , 6 , 'b1242' );
+insert into pa_tn_tb1 values ( 1601482067000 , 1279 , 1279 , 7 , 'b1279' );
+insert into pa_tn_tb1 values ( 1601482068000 , 1316 , 1316 , 8 , 'b1316' );
+insert into pa_tn_tb1 values ( 1601482069000 , 1353 , 1353 , 9 , 'b1353' );
+insert into pa_tn_tb1 values ( 1601482070000 , 1390 , 1390 , 0 , 'b1390' );
+insert into pa_tn_tb1 values ( 1601482071000 , 1427 , 1427 , 1 , 'b1427' );
+insert into pa_tn_tb1 values ( 1601482072000 , 1464 , 1464 , 2 , 'b1464' );
+insert into pa_tn_tb1 values ( 1601482073000 , 1501 , 1501 , 3 , 'b1501' );
+insert into pa_tn_tb1 values ( 1601482074000 , 1538 , 1538 , 4 , 'b1538' );
+insert into pa_tn_tb1 values ( 1601482075000 , 1575 , 1575 , 5 , 'b1575' );
+insert into pa_tn_tb1 values ( 1601482076000 , 1612 , 1612 , 6 , 'b1612' );
+insert into pa_tn_tb1 values ( 1601482077000 , 1649 , 1649 , 7 , 'b1649' );
+insert into pa_tn_tb1 values ( 1601482078000 , 1686 , 1686 , 8 , 'b1686' );
+insert into pa_tn_tb1 values ( 1601482079000 , 1723 , 1723 , 9 , 'b1723' );
+insert into pa_tn_tb1 values ( 1601482080000 , 1760 , 1760 , 0 , 'b1760' );
+insert into pa_tn_tb1 values ( 1601482081000 , 1797 , 1797 , 1 , 'b1797' );
+insert into pa_tn_tb1 values ( 1601482082000 , 1834 , 1834 , 2 , 'b1834' );
+insert into pa_tn_tb1 values ( 1601482083000 , 1871 , 1871 , 3 , 'b1871' );
+insert into pa_tn_tb1 values ( 1601482084000 , 1908 , 1908 , 4 , 'b1908' );
+insert into pa_tn_tb1 values ( 1601482085000 , 1945 , 1945 , 5 , 'b1945' );
+insert into pa_tn_tb1 values ( 1601482086000 , 1982 , 1982 , 6 , 'b1982' );
+insert into pa_tn_tb1 values ( 1601482087000 , 1019 , 1019 , 7 , 'b1019' );
+insert into pa_tn_tb1 values ( 1601482088000 , 1056 , 1056 , 8 , 'b1056' );
+insert into pa_tn_tb1 values ( 1601482089000 , 1093 , 1093 , 9 , 'b1093' );
+insert into pa_tn_tb1 values ( 1601482090000 , 1130 , 1130 , 0 , 'b1130' );
+insert into pa_tn_tb1 values ( 1601482091000 , 1167 , 1167 , 1 , 'b1167' );
+insert into pa_tn_tb1 values ( 1601482092000 , 1204 , 1204 , 2 , 'b1204' );
+insert into pa_tn_tb1 values ( 1601482093000 , 1241 , 1241 , 3 , 'b1241' );
+insert into pa_tn_tb1 values ( 1601482094000 , 1278 , 1278 , 4 , 'b1278' );
+insert into pa_tn_tb1 values ( 1601482095000 , 1315 , 1315 , 5 , 'b1315' );
+insert into pa_tn_tb1 values ( 1601482096000 , 1352 , 1352 , 6 , 'b1352' );
+insert into pa_tn_tb1 values ( 1601482097000 , 1389 , 1389 , 7 , 'b1389' );
+insert into pa_tn_tb1 values ( 1601482098000 , 1426 , 1426 , 8 , 'b1426' );
+insert into pa_tn_tb1 values ( 1601482099000 , 1463 , 1463 , 9 , 'b1463' );
+insert into pa_tn_tb1 values ( 1601482100000 , 1500 , NULL , 0 , 'b1500' );
+insert into pa_tn_tb1 values ( 1601482101000 , 1537 , 1537 , 1 , 'b1537' );
+insert into pa_tn_tb1 values ( 1601482102000 , 1574 , 1574 , 2 , 'b1574' );
+insert into pa_tn_tb1 values ( 1601482103000 , 1611 , 1611 , 3 , 'b1611' );
+insert into pa_tn_tb1 values ( 1601482104000 , 1648 , 1648 , 4 , 'b1648' );
+insert into pa_tn_tb1 values ( 1601482105000 , 1685 , 1685 , 5 , 'b1685' );
+insert into pa_tn_tb1 values ( 1601482106000 , 1722 , 1722 , 6 , 'b1722' );
+insert into pa_tn_tb1 values ( 1601482107000 , 1759 , 1759 , 7 , 'b1759' );
+insert into pa_tn_tb1 values ( 1601482108000 , 1796 , 1796 , 8 , 'b1796' );
+insert into pa_tn_tb1 values ( 1601482109000 , 1833 , 1833 , 9 , 'b1833' );
+insert into pa_tn_tb1 values ( 1601482110000 , 1870 , 1870 , 0 , 'b1870' );
+insert into pa_tn_tb1 values ( 1601482111000 , 1907 , 1907 , 1 , 'b1907' );
+insert into pa_tn_tb1 values ( 1601482112000 , 1944 , 1944 , 2 , 'b1944' );
+insert into pa_tn_tb1 values ( 1601482113000 , 1981 , 1981 , 3 , 'b1981' );
+insert into pa_tn_tb1 values ( 1601482114000 , 1018 , 1018 , 4 , 'b1018' );
+insert into pa_tn_tb1 values ( 1601482115000 , 1055 , 1055 , 5 , 'b1055' );
+insert into pa_tn_tb1 values ( 1601482116000 , 1092 , 1092 , 6 , 'b1092' );
+insert into pa_tn_tb1 values ( 1601482117000 , 1129 , 1129 , 7 , 'b1129' );
+insert into pa_tn_tb1 values ( 1601482118000 , 1166 , 1166 , 8 , 'b1166' );
+insert into pa_tn_tb1 values ( 1601482119000 , 1203 , 1203 , 9 , 'b1203' );
+insert into pa_tn_tb1 values ( 1601482120000 , 1240 , 1240 , 0 , 'b1240' );
+insert into pa_tn_tb1 values ( 1601482121000 , 1277 , 1277 , 1 , 'b1277' );
+insert into pa_tn_tb1 values ( 1601482122000 , 1314 , 1314 , 2 , 'b1314' );
+insert into pa_tn_tb1 values ( 1601482123000 , 1351 , 1351 , 3 , 'b1351' );
+insert into pa_tn_tb1 values ( 1601482124000 , 1388 , 1388 , 4 , 'b1388' );
+insert into pa_tn_tb1 values ( 1601482125000 , 1425 , 1425 , 5 , 'b1425' );
+insert into pa_tn_tb1 values ( 1601482126000 , 1462 , 1462 , 6 , 'b1462' );
+insert into pa_tn_tb1 values ( 1601482127000 , 1499 , 1499 , 7 , 'b1499' );
+insert into pa_tn_tb1 values ( 1601482128000 , 1536 , 1536 , 8 , 'b1536' );
+insert into pa_tn_tb1 values ( 1601482129000 , 1573 , 1573 , 9 , 'b1573' );
+insert into pa_tn_tb1 values ( 1601482130000 , 1610 , 1610 , 0 , 'b1610' );
+insert into pa_tn_tb1 values ( 1601482131000 , 1647 , 1647 , 1 , 'b1647' );
+insert into pa_tn_tb1 values ( 1601482132000 , 1684 , 1684 , 2 , 'b1684' );
+insert into pa_tn_tb1 values ( 1601482133000 , 1721 , 1721 , 3 , 'b1721' );
+insert into pa_tn_tb1 values ( 1601482134000 , 1758 , 1758 , 4 , 'b1758' );
+insert into pa_tn_tb1 values ( 1601482135000 , 1795 , 1795 , 5 , 'b1795' );
+insert into pa_tn_tb1 values ( 1601482136000 , 1832 , 1832 , 6 , 'b1832' );
+insert into pa_tn_tb1 values ( 1601482137000 , 1869 , 1869 , 7 , 'b1869' );
+insert into pa_tn_tb1 values ( 1601482138000 , 1906 , 1906 , 8 , 'b1906' );
+insert into pa_tn_tb1 values ( 1601482139000 , 1943 , 1943 , 9 , 'b1943' );
+insert into pa_tn_tb1 values ( 1601482140000 , 1980 , 1980 , 0 , 'b1980' );
+insert into pa_tn_tb1 values ( 1601482141000 , 1017 , 1017 , 1 , 'b1017' );
+insert into pa_tn_tb1 values ( 1601482142000 , 1054 , 1054 , 2 , 'b1054' );
+insert into pa_tn_tb1 values ( 1601482143000 , 1091 , 1091 , 3 , 'b1091' );
+insert into pa_tn_tb1 values ( 1601482144000 , 1128 , 1128 , 4 , 'b1128' );
+insert into pa_tn_tb1 values ( 1601482145000 , 1165 , 1165 , 5 , 'b1165' );
+insert into pa_tn_tb1 values ( 1601482146000 , 1202 , 1202 , 6 , 'b1202' );
+insert into pa_tn_tb1 values ( 1601482147000 , 1239 , 1239 , 7 , 'b1239' );
+insert into pa_tn_tb1 values ( 1601482148000 , 1276 , 1276 , 8 , 'b1276' );
+insert into pa_tn_tb1 values ( 1601482149000 , 1313 , 1313 , 9 , 'b1313' );
+insert into pa_tn_tb1 values ( 1601482150000 , 1350 , NULL , 0 , 'b1350' );
+insert into pa_tn_tb1 values ( 1601482151000 , 1387 , 1387 , 1 , 'b1387' );
+insert into pa_tn_tb1 values ( 1601482152000 , 1424 , 1424 , 2 , 'b1424' );
+insert into pa_tn_tb1 values ( 1601482153000 , 1461 , 1461 , 3 , 'b1461' );
+insert into pa_tn_tb1 values ( 1601482154000 , 1498 , 1498 , 4 , 'b1498' );
+insert into pa_tn_tb1 values ( 1601482155000 , 1535 , 1535 , 5 , 'b1535' );
+insert into pa_tn_tb1 values ( 1601482156000 , 1572 , 1572 , 6 , 'b1572' );
+insert into pa_tn_tb1 values ( 1601482157000 , 1609 , 1609 , 7 , 'b1609' );
+insert into pa_tn_tb1 values ( 1601482158000 , 1646 , 1646 , 8 , 'b1646' );
+insert into pa_tn_tb1 values ( 1601482159000 , 1683 , 1683 , 9 , 'b1683' );
+insert into pa_tn_tb1 values ( 1601482160000 , 1720 , 1720 , 0 , 'b1720' );
+insert into pa_tn_tb1 values ( 1601482161000 , 1757 , 1757 , 1 , 'b1757' );
+insert into pa_tn_tb1 values ( 1601482162000 , 1794 , 1794 , 2 , 'b1794' );
+insert into pa_tn_tb1 values ( 1601482163000 , 1831 , 1831 , 3 , 'b1831' );
+insert into pa_tn_tb1 values ( 1601482164000 , 1868 , 1868 , 4 , 'b1868' );
+insert into pa_tn_tb1 values ( 1601482165000 , 1905 , 1905 , 5 , 'b1905' );
+insert into pa_tn_tb1 values ( 1601482166000 , 1942 , 1942 , 6 , 'b1942' );
+insert into pa_tn_tb1 values ( 1601482167000 , 1979 , 1979 , 7 , 'b1979' );
+insert into pa_tn_tb1 values ( 1601482168000 , 1016 , 1016 , 8 , 'b1016' );
+insert into pa_tn_tb1 values ( 1601482169000 , 1053 , 1053 , 9 , 'b1053' );
+insert into pa_tn_tb1 values ( 1601482170000 , 1090 , 1090 , 0 , 'b1090' );
+insert into pa_tn_tb1 values ( 1601482171000 , 1127 , 1127 , 1 , 'b1127' );
+insert into pa_tn_tb1 values ( 1601482172000 , 1164 , 1164 , 2 , 'b1164' );
+insert into pa_tn_tb1 values ( 1601482173000 , 1201 , 1201 , 3 , 'b1201' );
+insert into pa_tn_tb1 values ( 1601482174000 , 1238 , 1238 , 4 , 'b1238' );
+insert into pa_tn_tb1 values ( 1601482175000 , 1275 , 1275 , 5 , 'b1275' );
+insert into pa_tn_tb1 values ( 1601482176000 , 1312 , 1312 , 6 , 'b1312' );
+insert into pa_tn_tb1 values ( 1601482177000 , 1349 , 1349 , 7 , 'b1349' );
+insert into pa_tn_tb1 values ( 1601482178000 , 1386 , 1386 , 8 , 'b1386' );
+insert into pa_tn_tb1 values ( 1601482179000 , 1423 , 1423 , 9 , 'b1423' );
+insert into pa_tn_tb1 values ( 1601482180000 , 1460 , 1460 , 0 , 'b1460' );
+insert into pa_tn_tb1 values ( 1601482181000 , 1497 , 1497 , 1 , 'b1497' );
+insert into pa_tn_tb1 values ( 1601482182000 , 1534 , 1534 , 2 , 'b1534' );
+insert into pa_tn_tb1 values ( 1601482183000 , 1571 , 1571 , 3 , 'b1571' );
+insert into pa_tn_tb1 values ( 1601482184000 , 1608 , 1608 , 4 , 'b1608' );
+insert into pa_tn_tb1 values ( 1601482185000 , 1645 , 1645 , 5 , 'b1645' );
+insert into pa_tn_tb1 values ( 1601482186000 , 1682 , 1682 , 6 , 'b1682' );
+insert into pa_tn_tb1 values ( 1601482187000 , 1719 , 1719 , 7 , 'b1719' );
+insert into pa_tn_tb1 values ( 1601482188000 , 1756 , 1756 , 8 , 'b1756' );
+insert into pa_tn_tb1 values ( 1601482189000 , 1793 , 1793 , 9 , 'b1793' );
+insert into pa_tn_tb1 values ( 1601482190000 , 1830 , 1830 , 0 , 'b1830' );
+insert into pa_tn_tb1 values ( 1601482191000 , 1867 , 1867 , 1 , 'b1867' );
+insert into pa_tn_tb1 values ( 1601482192000 , 1904 , 1904 , 2 , 'b1904' );
+insert into pa_tn_tb1 values ( 1601482193000 , 1941 , 1941 , 3 , 'b1941' );
+insert into pa_tn_tb1 values ( 1601482194000 , 1978 , 1978 , 4 , 'b1978' );
+insert into pa_tn_tb1 values ( 1601482195000 , 1015 , 1015 , 5 , 'b1015' );
+insert into pa_tn_tb1 values ( 1601482196000 , 1052 , 1052 , 6 , 'b1052' );
+insert into pa_tn_tb1 values ( 1601482197000 , 1089 , 1089 , 7 , 'b1089' );
+insert into pa_tn_tb1 values ( 1601482198000 , 1126 , 1126 , 8 , 'b1126' );
+insert into pa_tn_tb1 values ( 1601482199000 , 1163 , 1163 , 9 , 'b1163' );
+insert into pa_tn_tb1 values ( 1601482200000 , 1200 , NULL , 0 , 'b1200' );
+insert into pa_tn_tb1 values ( 1601482201000 , 1237 , 1237 , 1 , 'b1237' );
+insert into pa_tn_tb1 values ( 1601482202000 , 1274 , 1274 , 2 , 'b1274' );
+insert into pa_tn_tb1 values ( 1601482203000 , 1311 , 1311 , 3 , 'b1311' );
+insert into pa_tn_tb1 values ( 1601482204000 , 1348 , 1348 , 4 , 'b1348' );
+insert into pa_tn_tb1 values ( 1601482205000 , 1385 , 1385 , 5 , 'b1385' );
+insert into pa_tn_tb1 values ( 1601482206000 , 1422 , 1422 , 6 , 'b1422' );
+insert into pa_tn_tb1 values ( 1601482207000 , 1459 , 1459 , 7 , 'b1459' );
+insert into pa_tn_tb1 values ( 1601482208000 , 1496 , 1496 , 8 , 'b1496' );
+insert into pa_tn_tb1 values ( 1601482209000 , 1533 , 1533 , 9 , 'b1533' );
+insert into pa_tn_tb1 values ( 1601482210000 , 1570 , 1570 , 0 , 'b1570' );
+insert into pa_tn_tb1 values ( 1601482211000 , 1607 , 1607 , 1 , 'b1607' );
+insert into pa_tn_tb1 values ( 1601482212000 , 1644 , 1644 , 2 , 'b1644' );
+insert into pa_tn_tb1 values ( 1601482213000 , 1681 , 1681 , 3 , 'b1681' );
+insert into pa_tn_tb1 values ( 1601482214000 , 1718 , 1718 , 4 , 'b1718' );
+insert into pa_tn_tb1 values ( 1601482215000 , 1755 , 1755 , 5 , 'b1755' );
+insert into pa_tn_tb1 values ( 1601482216000 , 1792 , 1792 , 6 , 'b1792' );
+insert into pa_tn_tb1 values ( 1601482217000 , 1829 , 1829 , 7 , 'b1829' );
+insert into pa_tn_tb1 values ( 1601482218000 , 1866 , 1866 , 8 , 'b1866' );
+insert into pa_tn_tb1 values ( 1601482219000 , 1903 , 1903 , 9 , 'b1903' );
+insert into pa_tn_tb1 values ( 1601482220000 , 1940 , 1940 , 0 , 'b1940' );
+insert into pa_tn_tb1 values ( 1601482221000 , 1977 , 1977 , 1 , 'b1977' );
+insert into pa_tn_tb1 values ( 1601482222000 , 1014 , 1014 , 2 , 'b1014' );
+insert into pa_tn_tb1 values ( 1601482223000 , 1051 , 1051 , 3 , 'b1051' );
+insert into pa_tn_tb1 values ( 1601482224000 , 1088 , 1088 , 4 , 'b1088' );
+insert into pa_tn_tb1 values ( 1601482225000 , 1125 , 1125 , 5 , 'b1125' );
+insert into pa_tn_tb1 values ( 1601482226000 , 1162 , 1162 , 6 , 'b1162' );
+insert into pa_tn_tb1 values ( 1601482227000 , 1199 , 1199 , 7 , 'b1199' );
+insert into pa_tn_tb1 values ( 1601482228000 , 1236 , 1236 , 8 , 'b1236' );
+insert into pa_tn_tb1 values ( 1601482229000 , 1273 , 1273 , 9 , 'b1273' );
+insert into pa_tn_tb1 values ( 1601482230000 , 1310 , 1310 , 0 , 'b1310' );
+insert into pa_tn_tb1 values ( 1601482231000 , 1347 , 1347 , 1 , 'b1347' );
+insert into pa_tn_tb1 values ( 1601482232000 , 1384 , 1384 , 2 , 'b1384' );
+insert into pa_tn_tb1 values ( 1601482233000 , 1421 , 1421 , 3 , 'b1421' );
+insert into pa_tn_tb1 values ( 1601482234000 , 1458 , 1458 , 4 , 'b1458' );
+insert into pa_tn_tb1 values ( 1601482235000 , 1495 , 1495 , 5 , 'b1495' );
+insert into pa_tn_tb1 values ( 1601482236000 , 1532 , 1532 , 6 , 'b1532' );
+insert into pa_tn_tb1 values ( 1601482237000 , 1569 , 1569 , 7 , 'b1569' );
+insert into pa_tn_tb1 values ( 1601482238000 , 1606 , 1606 , 8 , 'b1606' );
+insert into pa_tn_tb1 values ( 1601482239000 , 1643 , 1643 , 9 , 'b1643' );
+insert into pa_tn_tb1 values ( 1601482240000 , 1680 , 1680 , 0 , 'b1680' );
+insert into pa_tn_tb1 values ( 1601482241000 , 1717 , 1717 , 1 , 'b1717' );
+insert into pa_tn_tb1 values ( 1601482242000 , 1754 , 1754 , 2 , 'b1754' );
+insert into pa_tn_tb1 values ( 1601482243000 , 1791 , 1791 , 3 , 'b1791' );
+insert into pa_tn_tb1 values ( 1601482244000 , 1828 , 1828 , 4 , 'b1828' );
+insert into pa_tn_tb1 values ( 1601482245000 , 1865 , 1865 , 5 , 'b1865' );
+insert into pa_tn_tb1 values ( 1601482246000 , 1902 , 1902 , 6 , 'b1902' );
+insert into pa_tn_tb1 values ( 1601482247000 , 1939 , 1939 , 7 , 'b1939' );
+insert into pa_tn_tb1 values ( 1601482248000 , 1976 , 1976 , 8 , 'b1976' );
+insert into pa_tn_tb1 values ( 1601482249000 , 1013 , 1013 , 9 , 'b1013' );
+insert into pa_tn_tb1 values ( 1601482250000 , 1050 , NULL , 0 , 'b1050' );
+insert into pa_tn_tb1 values ( 1601482251000 , 1087 , 1087 , 1 , 'b1087' );
+insert into pa_tn_tb1 values ( 1601482252000 , 1124 , 1124 , 2 , 'b1124' );
+insert into pa_tn_tb1 values ( 1601482253000 , 1161 , 1161 , 3 , 'b1161' );
+insert into pa_tn_tb1 values ( 1601482254000 , 1198 , 1198 , 4 , 'b1198' );
+insert into pa_tn_tb1 values ( 1601482255000 , 1235 , 1235 , 5 , 'b1235' );
+insert into pa_tn_tb1 values ( 1601482256000 , 1272 , 1272 , 6 , 'b1272' );
+insert into pa_tn_tb1 values ( 1601482257000 , 1309 , 1309 , 7 , 'b1309' );
+insert into pa_tn_tb1 values ( 1601482258000 , 1346 , 1346 , 8 , 'b1346' );
+insert into pa_tn_tb1 values ( 1601482259000 , 1383 , 1383 , 9 , 'b1383' );
+insert into pa_tn_tb1 values ( 1601482260000 , 1420 , 1420 , 0 , 'b1420' );
+insert into pa_tn_tb1 values ( 1601482261000 , 1457 , 1457 , 1 , 'b1457' );
+insert into pa_tn_tb1 values ( 1601482262000 , 1494 , 1494 , 2 , 'b1494' );
+insert into pa_tn_tb1 values ( 1601482263000 , 1531 , 1531 , 3 , 'b1531' );
+insert into pa_tn_tb1 values ( 1601482264000 , 1568 , 1568 , 4 , 'b1568' );
+insert into pa_tn_tb1 values ( 1601482265000 , 1605 , 1605 , 5 , 'b1605' );
+insert into pa_tn_tb1 values ( 1601482266000 , 1642 , 1642 , 6 , 'b1642' );
+insert into pa_tn_tb1 values ( 1601482267000 , 1679 , 1679 , 7 , 'b1679' );
+insert into pa_tn_tb1 values ( 1601482268000 , 1716 , 1716 , 8 , 'b1716' );
+insert into pa_tn_tb1 values ( 1601482269000 , 1753 , 1753 , 9 , 'b1753' );
+insert into pa_tn_tb1 values ( 1601482270000 , 1790 , 1790 , 0 , 'b1790' );
+insert into pa_tn_tb1 values ( 1601482271000 , 1827 , 1827 , 1 , 'b1827' );
+insert into pa_tn_tb1 values ( 1601482272000 , 1864 , 1864 , 2 , 'b1864' );
+insert into pa_tn_tb1 values ( 1601482273000 , 1901 , 1901 , 3 , 'b1901' );
+insert into pa_tn_tb1 values ( 1601482274000 , 1938 , 1938 , 4 , 'b1938' );
+insert into pa_tn_tb1 values ( 1601482275000 , 1975 , 1975 , 5 , 'b1975' );
+insert into pa_tn_tb1 values ( 1601482276000 , 1012 , 1012 , 6 , 'b1012' );
+insert into pa_tn_tb1 values ( 1601482277000 , 1049 , 1049 , 7 , 'b1049' );
+insert into pa_tn_tb1 values ( 1601482278000 , 1086 , 1086 , 8 , 'b1086' );
+insert into pa_tn_tb1 values ( 1601482279000 , 1123 , 1123 , 9 , 'b1123' );
+insert into pa_tn_tb1 values ( 1601482280000 , 1160 , 1160 , 0 , 'b1160' );
+insert into pa_tn_tb1 values ( 1601482281000 , 1197 , 1197 , 1 , 'b1197' );
+insert into pa_tn_tb1 values ( 1601482282000 , 1234 , 1234 , 2 , 'b1234' );
+insert into pa_tn_tb1 values ( 1601482283000 , 1271 , 1271 , 3 , 'b1271' );
+insert into pa_tn_tb1 values ( 1601482284000 , 1308 , 1308 , 4 , 'b1308' );
+insert into pa_tn_tb1 values ( 1601482285000 , 1345 , 1345 , 5 , 'b1345' );
+insert into pa_tn_tb1 values ( 1601482286000 , 1382 , 1382 , 6 , 'b1382' );
+insert into pa_tn_tb1 values ( 1601482287000 , 1419 , 1419 , 7 , 'b1419' );
+insert into pa_tn_tb1 values ( 1601482288000 , 1456 , 1456 , 8 , 'b1456' );
+insert into pa_tn_tb1 values ( 1601482289000 , 1493 , 1493 , 9 , 'b1493' );
+insert into pa_tn_tb1 values ( 1601482290000 , 1530 , 1530 , 0 , 'b1530' );
+insert into pa_tn_tb1 values ( 1601482291000 , 1567 , 1567 , 1 , 'b1567' );
+insert into pa_tn_tb1 values ( 1601482292000 , 1604 , 1604 , 2 , 'b1604' );
+insert into pa_tn_tb1 values ( 1601482293000 , 1641 , 1641 , 3 , 'b1641' );
+insert into pa_tn_tb1 values ( 1601482294000 , 1678 , 1678 , 4 , 'b1678' );
+insert into pa_tn_tb1 values ( 1601482295000 , 1715 , 1715 , 5 , 'b1715' );
+insert into pa_tn_tb1 values ( 1601482296000 , 1752 , 1752 , 6 , 'b1752' );
+insert into pa_tn_tb1 values ( 1601482297000 , 1789 , 1789 , 7 , 'b1789' );
+insert into pa_tn_tb1 values ( 1601482298000 , 1826 , 1826 , 8 , 'b1826' );
+insert into pa_tn_tb1 values ( 1601482299000 , 1863 , 1863 , 9 , 'b1863' );
+insert into pa_tn_tb1 values ( 1601482300000 , 1900 , NULL , 0 , 'b1900' );
+insert into pa_tn_tb1 values ( 1601482301000 , 1937 , 1937 , 1 , 'b1937' );
+insert into pa_tn_tb1 values ( 1601482302000 , 1974 , 1974 , 2 , 'b1974' );
+insert into pa_tn_tb1 values ( 1601482303000 , 1011 , 1011 , 3 , 'b1011' );
+insert into pa_tn_tb1 values ( 1601482304000 , 1048 , 1048 , 4 , 'b1048' );
+insert into pa_tn_tb1 values ( 1601482305000 , 1085 , 1085 , 5 , 'b1085' );
+insert into pa_tn_tb1 values ( 1601482306000 , 1122 , 1122 , 6 , 'b1122' );
+insert into pa_tn_tb1 values ( 1601482307000 , 1159 , 1159 , 7 , 'b1159' );
+insert into pa_tn_tb1 values ( 1601482308000 , 1196 , 1196 , 8 , 'b1196' );
+insert into pa_tn_tb1 values ( 1601482309000 , 1233 , 1233 , 9 , 'b1233' );
+insert into pa_tn_tb1 values ( 1601482310000 , 1270 , 1270 , 0 , 'b1270' );
+insert into pa_tn_tb1 values ( 1601482311000 , 1307 , 1307 , 1 , 'b1307' );
+insert into pa_tn_tb1 values ( 1601482312000 , 1344 , 1344 , 2 , 'b1344' );
+insert into pa_tn_tb1 values ( 1601482313000 , 1381 , 1381 , 3 , 'b1381' );
+insert into pa_tn_tb1 values ( 1601482314000 , 1418 , 1418 , 4 , 'b1418' );
+insert into pa_tn_tb1 values ( 1601482315000 , 1455 , 1455 , 5 , 'b1455' );
+insert into pa_tn_tb1 values ( 1601482316000 , 1492 , 1492 , 6 , 'b1492' );
+insert into pa_tn_tb1 values ( 1601482317000 , 1529 , 1529 , 7 , 'b1529' );
+insert into pa_tn_tb1 values ( 1601482318000 , 1566 , 1566 , 8 , 'b1566' );
+insert into pa_tn_tb1 values ( 1601482319000 , 1603 , 1603 , 9 , 'b1603' );
+insert into pa_tn_tb1 values ( 1601482320000 , 1640 , 1640 , 0 , 'b1640' );
+insert into pa_tn_tb1 values ( 1601482321000 , 1677 , 1677 , 1 , 'b1677' );
+insert into pa_tn_tb1 values ( 1601482322000 , 1714 , 1714 , 2 , 'b1714' );
+insert into pa_tn_tb1 values ( 1601482323000 , 1751 , 1751 , 3 , 'b1751' );
+insert into pa_tn_tb1 values ( 1601482324000 , 1788 , 1788 , 4 , 'b1788' );
+insert into pa_tn_tb1 values ( 1601482325000 , 1825 , 1825 , 5 , 'b1825' );
+insert into pa_tn_tb1 values ( 1601482326000 , 1862 , 1862 , 6 , 'b1862' );
+insert into pa_tn_tb1 values ( 1601482327000 , 1899 , 1899 , 7 , 'b1899' );
+insert into pa_tn_tb1 values ( 1601482328000 , 1936 , 1936 , 8 , 'b1936' );
+insert into pa_tn_tb1 values ( 1601482329000 , 1973 , 1973 , 9 , 'b1973' );
+insert into pa_tn_tb1 values ( 1601482330000 , 1010 , 1010 , 0 , 'b1010' );
+insert into pa_tn_tb1 values ( 1601482331000 , 1047 , 1047 , 1 , 'b1047' );
+insert into pa_tn_tb1 values ( 1601482332000 , 1084 , 1084 , 2 , 'b1084' );
+insert into pa_tn_tb1 values ( 1601482333000 , 1121 , 1121 , 3 , 'b1121' );
+insert into pa_tn_tb1 values ( 1601482334000 , 1158 , 1158 , 4 , 'b1158' );
+insert into pa_tn_tb1 values ( 1601482335000 , 1195 , 1195 , 5 , 'b1195' );
+insert into pa_tn_tb1 values ( 1601482336000 , 1232 , 1232 , 6 , 'b1232' );
+insert into pa_tn_tb1 values ( 1601482337000 , 1269 , 1269 , 7 , 'b1269' );
+insert into pa_tn_tb1 values ( 1601482338000 , 1306 , 1306 , 8 , 'b1306' );
+insert into pa_tn_tb1 values ( 1601482339000 , 1343 , 1343 , 9 , 'b1343' );
+insert into pa_tn_tb1 values ( 1601482340000 , 1380 , 1380 , 0 , 'b1380' );
+insert into pa_tn_tb1 values ( 1601482341000 , 1417 , 1417 , 1 , 'b1417' );
+insert into pa_tn_tb1 values ( 1601482342000 , 1454 , 1454 , 2 , 'b1454' );
+insert into pa_tn_tb1 values ( 1601482343000 , 1491 , 1491 , 3 , 'b1491' );
+insert into pa_tn_tb1 values ( 1601482344000 , 1528 , 1528 , 4 , 'b1528' );
+insert into pa_tn_tb1 values ( 1601482345000 , 1565 , 1565 , 5 , 'b1565' );
+insert into pa_tn_tb1 values ( 1601482346000 , 1602 , 1602 , 6 , 'b1602' );
+insert into pa_tn_tb1 values ( 1601482347000 , 1639 , 1639 , 7 , 'b1639' );
+insert into pa_tn_tb1 values ( 1601482348000 , 1676 , 1676 , 8 , 'b1676' );
+insert into pa_tn_tb1 values ( 1601482349000 , 1713 , 1713 , 9 , 'b1713' );
+insert into pa_tn_tb1 values ( 1601482350000 , 1750 , NULL , 0 , 'b1750' );
+insert into pa_tn_tb1 values ( 1601482351000 , 1787 , 1787 , 1 , 'b1787' );
+insert into pa_tn_tb1 values ( 1601482352000 , 1824 , 1824 , 2 , 'b1824' );
+insert into pa_tn_tb1 values ( 1601482353000 , 1861 , 1861 , 3 , 'b1861' );
+insert into pa_tn_tb1 values ( 1601482354000 , 1898 , 1898 , 4 , 'b1898' );
+insert into pa_tn_tb1 values ( 1601482355000 , 1935 , 1935 , 5 , 'b1935' );
+insert into pa_tn_tb1 values ( 1601482356000 , 1972 , 1972 , 6 , 'b1972' );
+insert into pa_tn_tb1 values ( 1601482357000 , 1009 , 1009 , 7 , 'b1009' );
+insert into pa_tn_tb1 values ( 1601482358000 , 1046 , 1046 , 8 , 'b1046' );
+insert into pa_tn_tb1 values ( 1601482359000 , 1083 , 1083 , 9 , 'b1083' );
+insert into pa_tn_tb1 values ( 1601482360000 , 1120 , 1120 , 0 , 'b1120' );
+insert into pa_tn_tb1 values ( 1601482361000 , 1157 , 1157 , 1 , 'b1157' );
+insert into pa_tn_tb1 values ( 1601482362000 , 1194 , 1194 , 2 , 'b1194' );
+insert into pa_tn_tb1 values ( 1601482363000 , 1231 , 1231 , 3 , 'b1231' );
+insert into pa_tn_tb1 values ( 1601482364000 , 1268 , 1268 , 4 , 'b1268' );
+insert into pa_tn_tb1 values ( 1601482365000 , 1305 , 1305 , 5 , 'b1305' );
+insert into pa_tn_tb1 values ( 1601482366000 , 1342 , 1342 , 6 , 'b1342' );
+insert into pa_tn_tb1 values ( 1601482367000 , 1379 , 1379 , 7 , 'b1379' );
+insert into pa_tn_tb1 values ( 1601482368000 , 1416 , 1416 , 8 , 'b1416' );
+insert into pa_tn_tb1 values ( 1601482369000 , 1453 , 1453 , 9 , 'b1453' );
+insert into pa_tn_tb1 values ( 1601482370000 , 1490 , 1490 , 0 , 'b1490' );
+insert into pa_tn_tb1 values ( 1601482371000 , 1527 , 1527 , 1 , 'b1527' );
+insert into pa_tn_tb1 values ( 1601482372000 , 1564 , 1564 , 2 , 'b1564' );
+insert into pa_tn_tb1 values ( 1601482373000 , 1601 , 1601 , 3 , 'b1601' );
+insert into pa_tn_tb1 values ( 1601482374000 , 1638 , 1638 , 4 , 'b1638' );
+insert into pa_tn_tb1 values ( 1601482375000 , 1675 , 1675 , 5 , 'b1675' );
+insert into pa_tn_tb1 values ( 1601482376000 , 1712 , 1712 , 6 , 'b1712' );
+insert into pa_tn_tb1 values ( 1601482377000 , 1749 , 1749 , 7 , 'b1749' );
+insert into pa_tn_tb1 values ( 1601482378000 , 1786 , 1786 , 8 , 'b1786' );
+insert into pa_tn_tb1 values ( 1601482379000 , 1823 , 1823 , 9 , 'b1823' );
+insert into pa_tn_tb1 values ( 1601482380000 , 1860 , 1860 , 0 , 'b1860' );
+insert into pa_tn_tb1 values ( 1601482381000 , 1897 , 1897 , 1 , 'b1897' );
+insert into pa_tn_tb1 values ( 1601482382000 , 1934 , 1934 , 2 , 'b1934' );
+insert into pa_tn_tb1 values ( 1601482383000 , 1971 , 1971 , 3 , 'b1971' );
+insert into pa_tn_tb1 values ( 1601482384000 , 1008 , 1008 , 4 , 'b1008' );
+insert into pa_tn_tb1 values ( 1601482385000 , 1045 , 1045 , 5 , 'b1045' );
+insert into pa_tn_tb1 values ( 1601482386000 , 1082 , 1082 , 6 , 'b1082' );
+insert into pa_tn_tb1 values ( 1601482387000 , 1119 , 1119 , 7 , 'b1119' );
+insert into pa_tn_tb1 values ( 1601482388000 , 1156 , 1156 , 8 , 'b1156' );
+insert into pa_tn_tb1 values ( 1601482389000 , 1193 , 1193 , 9 , 'b1193' );
+insert into pa_tn_tb1 values ( 1601482390000 , 1230 , 1230 , 0 , 'b1230' );
+insert into pa_tn_tb1 values ( 1601482391000 , 1267 , 1267 , 1 , 'b1267' );
+insert into pa_tn_tb1 values ( 1601482392000 , 1304 , 1304 , 2 , 'b1304' );
+insert into pa_tn_tb1 values ( 1601482393000 , 1341 , 1341 , 3 , 'b1341' );
+insert into pa_tn_tb1 values ( 1601482394000 , 1378 , 1378 , 4 , 'b1378' );
+insert into pa_tn_tb1 values ( 1601482395000 , 1415 , 1415 , 5 , 'b1415' );
+insert into pa_tn_tb1 values ( 1601482396000 , 1452 , 1452 , 6 , 'b1452' );
+insert into pa_tn_tb1 values ( 1601482397000 , 1489 , 1489 , 7 , 'b1489' );
+insert into pa_tn_tb1 values ( 1601482398000 , 1526 , 1526 , 8 , 'b1526' );
+insert into pa_tn_tb1 values ( 1601482399000 , 1563 , 1563 , 9 , 'b1563' );
+insert into pa_tn_tb1 values ( 1601482400000 , 1600 , NULL , 0 , 'b1600' );
+insert into pa_tn_tb1 values ( 1601482401000 , 1637 , 1637 , 1 , 'b1637' );
+insert into pa_tn_tb1 values ( 1601482402000 , 1674 , 1674 , 2 , 'b1674' );
+insert into pa_tn_tb1 values ( 1601482403000 , 1711 , 1711 , 3 , 'b1711' );
+insert into pa_tn_tb1 values ( 1601482404000 , 1748 , 1748 , 4 , 'b1748' );
+insert into pa_tn_tb1 values ( 1601482405000 , 1785 , 1785 , 5 , 'b1785' );
+insert into pa_tn_tb1 values ( 1601482406000 , 1822 , 1822 , 6 , 'b1822' );
+insert into pa_tn_tb1 values ( 1601482407000 , 1859 , 1859 , 7 , 'b1859' );
+insert into pa_tn_tb1 values ( 1601482408000 , 1896 , 1896 , 8 , 'b1896' );
+insert into pa_tn_tb1 values ( 1601482409000 , 1933 , 1933 , 9 , 'b1933' );
+insert into pa_tn_tb1 values ( 1601482410000 , 1970 , 1970 , 0 , 'b1970' );
+insert into pa_tn_tb1 values ( 1601482411000 , 1007 , 1007 , 1 , 'b1007' );
+insert into pa_tn_tb1 values ( 1601482412000 , 1044 , 1044 , 2 , 'b1044' );
+insert into pa_tn_tb1 values ( 1601482413000 , 1081 , 1081 , 3 , 'b1081' );
+insert into pa_tn_tb1 values ( 1601482414000 , 1118 , 1118 , 4 , 'b1118' );
+insert into pa_tn_tb1 values ( 1601482415000 , 1155 , 1155 , 5 , 'b1155' );
+insert into pa_tn_tb1 values ( 1601482416000 , 1192 , 1192 , 6 , 'b1192' );
+insert into pa_tn_tb1 values ( 1601482417000 , 1229 , 1229 , 7 , 'b1229' );
+insert into pa_tn_tb1 values ( 1601482418000 , 1266 , 1266 , 8 , 'b1266' );
+insert into pa_tn_tb1 values ( 1601482419000 , 1303 , 1303 , 9 , 'b1303' );
+insert into pa_tn_tb1 values ( 1601482420000 , 1340 , 1340 , 0 , 'b1340' );
+insert into pa_tn_tb1 values ( 1601482421000 , 1377 , 1377 , 1 , 'b1377' );
+insert into pa_tn_tb1 values ( 1601482422000 , 1414 , 1414 , 2 , 'b1414' );
+insert into pa_tn_tb1 values ( 1601482423000 , 1451 , 1451 , 3 , 'b1451' );
+insert into pa_tn_tb1 values ( 1601482424000 , 1488 , 1488 , 4 , 'b1488' );
+insert into pa_tn_tb1 values ( 1601482425000 , 1525 , 1525 , 5 , 'b1525' );
+insert into pa_tn_tb1 values ( 1601482426000 , 1562 , 1562 , 6 , 'b1562' );
+insert into pa_tn_tb1 values ( 1601482427000 , 1599 , 1599 , 7 , 'b1599' );
+insert into pa_tn_tb1 values ( 1601482428000 , 1636 , 1636 , 8 , 'b1636' );
+insert into pa_tn_tb1 values ( 1601482429000 , 1673 , 1673 , 9 , 'b1673' );
+insert into pa_tn_tb1 values ( 1601482430000 , 1710 , 1710 , 0 , 'b1710' );
+insert into pa_tn_tb1 values ( 1601482431000 , 1747 , 1747 , 1 , 'b1747' );
+insert into pa_tn_tb1 values ( 1601482432000 , 1784 , 1784 , 2 , 'b1784' );
+insert into pa_tn_tb1 values ( 1601482433000 , 1821 , 1821 , 3 , 'b1821' );
+insert into pa_tn_tb1 values ( 1601482434000 , 1858 , 1858 , 4 , 'b1858' );
+insert into pa_tn_tb1 values ( 1601482435000 , 1895 , 1895 , 5 , 'b1895' );
+insert into pa_tn_tb1 values ( 1601482436000 , 1932 , 1932 , 6 , 'b1932' );
+insert into pa_tn_tb1 values ( 1601482437000 , 1969 , 1969 , 7 , 'b1969' );
+insert into pa_tn_tb1 values ( 1601482438000 , 1006 , 1006 , 8 , 'b1006' );
+insert into pa_tn_tb1 values ( 1601482439000 , 1043 , 1043 , 9 , 'b1043' );
+insert into pa_tn_tb1 values ( 1601482440000 , 1080 , 1080 , 0 , 'b1080' );
+insert into pa_tn_tb1 values ( 1601482441000 , 1117 , 1117 , 1 , 'b1117' );
+insert into pa_tn_tb1 values ( 1601482442000 , 1154 , 1154 , 2 , 'b1154' );
+insert into pa_tn_tb1 values ( 1601482443000 , 1191 , 1191 , 3 , 'b1191' );
+insert into pa_tn_tb1 values ( 1601482444000 , 1228 , 1228 , 4 , 'b1228' );
+insert into pa_tn_tb1 values ( 1601482445000 , 1265 , 1265 , 5 , 'b1265' );
+insert into pa_tn_tb1 values ( 1601482446000 , 1302 , 1302 , 6 , 'b1302' );
+insert into pa_tn_tb1 values ( 1601482447000 , 1339 , 1339 , 7 , 'b1339' );
+insert into pa_tn_tb1 values ( 1601482448000 , 1376 , 1376 , 8 , 'b1376' );
+insert into pa_tn_tb1 values ( 1601482449000 , 1413 , 1413 , 9 , 'b1413' );
+insert into pa_tn_tb1 values ( 1601482450000 , 1450 , NULL , 0 , 'b1450' );
+insert into pa_tn_tb1 values ( 1601482451000 , 1487 , 1487 , 1 , 'b1487' );
+insert into pa_tn_tb1 values ( 1601482452000 , 1524 , 1524 , 2 , 'b1524' );
+insert into pa_tn_tb1 values ( 1601482453000 , 1561 , 1561 , 3 , 'b1561' );
+insert into pa_tn_tb1 values ( 1601482454000 , 1598 , 1598 , 4 , 'b1598' );
+insert into pa_tn_tb1 values ( 1601482455000 , 1635 , 1635 , 5 , 'b1635' );
+insert into pa_tn_tb1 values ( 1601482456000 , 1672 , 1672 , 6 , 'b1672' );
+insert into pa_tn_tb1 values ( 1601482457000 , 1709 , 1709 , 7 , 'b1709' );
+insert into pa_tn_tb1 values ( 1601482458000 , 1746 , 1746 , 8 , 'b1746' );
+insert into pa_tn_tb1 values ( 1601482459000 , 1783 , 1783 , 9 , 'b1783' );
+insert into pa_tn_tb1 values ( 1601482460000 , 1820 , 1820 , 0 , 'b1820' );
+insert into pa_tn_tb1 values ( 1601482461000 , 1857 , 1857 , 1 , 'b1857' );
+insert into pa_tn_tb1 values ( 1601482462000 , 1894 , 1894 , 2 , 'b1894' );
+insert into pa_tn_tb1 values ( 1601482463000 , 1931 , 1931 , 3 , 'b1931' );
+insert into pa_tn_tb1 values ( 1601482464000 , 1968 , 1968 , 4 , 'b1968' );
+insert into pa_tn_tb1 values ( 1601482465000 , 1005 , 1005 , 5 , 'b1005' );
+insert into pa_tn_tb1 values ( 1601482466000 , 1042 , 1042 , 6 , 'b1042' );
+insert into pa_tn_tb1 values ( 1601482467000 , 1079 , 1079 , 7 , 'b1079' );
+insert into pa_tn_tb1 values ( 1601482468000 , 1116 , 1116 , 8 , 'b1116' );
+insert into pa_tn_tb1 values ( 1601482469000 , 1153 , 1153 , 9 , 'b1153' );
+insert into pa_tn_tb1 values ( 1601482470000 , 1190 , 1190 , 0 , 'b1190' );
+insert into pa_tn_tb1 values ( 1601482471000 , 1227 , 1227 , 1 , 'b1227' );
+insert into pa_tn_tb1 values ( 1601482472000 , 1264 , 1264 , 2 , 'b1264' );
+insert into pa_tn_tb1 values ( 1601482473000 , 1301 , 1301 , 3 , 'b1301' );
+insert into pa_tn_tb1 values ( 1601482474000 , 1338 , 1338 , 4 , 'b1338' );
+insert into pa_tn_tb1 values ( 1601482475000 , 1375 , 1375 , 5 , 'b1375' );
+insert into pa_tn_tb1 values ( 1601482476000 , 1412 , 1412 , 6 , 'b1412' );
+insert into pa_tn_tb1 values ( 1601482477000 , 1449 , 1449 , 7 , 'b1449' );
+insert into pa_tn_tb1 values ( 1601482478000 , 1486 , 1486 , 8 , 'b1486' );
+insert into pa_tn_tb1 values ( 1601482479000 , 1523 , 1523 , 9 , 'b1523' );
+insert into pa_tn_tb1 values ( 1601482480000 , 1560 , 1560 , 0 , 'b1560' );
+insert into pa_tn_tb1 values ( 1601482481000 , 1597 , 1597 , 1 , 'b1597' );
+insert into pa_tn_tb1 values ( 1601482482000 , 1634 , 1634 , 2 , 'b1634' );
+insert into pa_tn_tb1 values ( 1601482483000 , 1671 , 1671 , 3 , 'b1671' );
+insert into pa_tn_tb1 values ( 1601482484000 , 1708 , 1708 , 4 , 'b1708' );
+insert into pa_tn_tb1 values ( 1601482485000 , 1745 , 1745 , 5 , 'b1745' );
+insert into pa_tn_tb1 values ( 1601482486000 , 1782 , 1782 , 6 , 'b1782' );
+insert into pa_tn_tb1 values ( 1601482487000 , 1819 , 1819 , 7 , 'b1819' );
+insert into pa_tn_tb1 values ( 1601482488000 , 1856 , 1856 , 8 , 'b1856' );
+insert into pa_tn_tb1 values ( 1601482489000 , 1893 , 1893 , 9 , 'b1893' );
+insert into pa_tn_tb1 values ( 1601482490000 , 1930 , 1930 , 0 , 'b1930' );
+insert into pa_tn_tb1 values ( 1601482491000 , 1967 , 1967 , 1 , 'b1967' );
+insert into pa_tn_tb1 values ( 1601482492000 , 1004 , 1004 , 2 , 'b1004' );
+insert into pa_tn_tb1 values ( 1601482493000 , 1041 , 1041 , 3 , 'b1041' );
+insert into pa_tn_tb1 values ( 1601482494000 , 1078 , 1078 , 4 , 'b1078' );
+insert into pa_tn_tb1 values ( 1601482495000 , 1115 , 1115 , 5 , 'b1115' );
+insert into pa_tn_tb1 values ( 1601482496000 , 1152 , 1152 , 6 , 'b1152' );
+insert into pa_tn_tb1 values ( 1601482497000 , 1189 , 1189 , 7 , 'b1189' );
+insert into pa_tn_tb1 values ( 1601482498000 , 1226 , 1226 , 8 , 'b1226' );
+insert into pa_tn_tb1 values ( 1601482499000 , 1263 , 1263 , 9 , 'b1263' );
+insert into pa_tn_tb1 values ( 1601482500000 , 1300 , NULL , 0 , 'b1300' );
+insert into pa_tn_tb1 values ( 1601482501000 , 1337 , 1337 , 1 , 'b1337' );
+insert into pa_tn_tb1 values ( 1601482502000 , 1374 , 1374 , 2 , 'b1374' );
+insert into pa_tn_tb1 values ( 1601482503000 , 1411 , 1411 , 3 , 'b1411' );
+insert into pa_tn_tb1 values ( 1601482504000 , 1448 , 1448 , 4 , 'b1448' );
+insert into pa_tn_tb1 values ( 1601482505000 , 1485 , 1485 , 5 , 'b1485' );
+insert into pa_tn_tb1 values ( 1601482506000 , 1522 , 1522 , 6 , 'b1522' );
+insert into pa_tn_tb1 values ( 1601482507000 , 1559 , 1559 , 7 , 'b1559' );
+insert into pa_tn_tb1 values ( 1601482508000 , 1596 , 1596 , 8 , 'b1596' );
+insert into pa_tn_tb1 values ( 1601482509000 , 1633 , 1633 , 9 , 'b1633' );
+insert into pa_tn_tb1 values ( 1601482510000 , 1670 , 1670 , 0 , 'b1670' );
+insert into pa_tn_tb1 values ( 1601482511000 , 1707 , 1707 , 1 , 'b1707' );
+insert into pa_tn_tb1 values ( 1601482512000 , 1744 , 1744 , 2 , 'b1744' );
+insert into pa_tn_tb1 values ( 1601482513000 , 1781 , 1781 , 3 , 'b1781' );
+insert into pa_tn_tb1 values ( 1601482514000 , 1818 , 1818 , 4 , 'b1818' );
+insert into pa_tn_tb1 values ( 1601482515000 , 1855 , 1855 , 5 , 'b1855' );
+insert into pa_tn_tb1 values ( 1601482516000 , 1892 , 1892 , 6 , 'b1892' );
+insert into pa_tn_tb1 values ( 1601482517000 , 1929 , 1929 , 7 , 'b1929' );
+insert into pa_tn_tb1 values ( 1601482518000 , 1966 , 1966 , 8 , 'b1966' );
+insert into pa_tn_tb1 values ( 1601482519000 , 1003 , 1003 , 9 , 'b1003' );
+insert into pa_tn_tb1 values ( 1601482520000 , 1040 , 1040 , 0 , 'b1040' );
+insert into pa_tn_tb1 values ( 1601482521000 , 1077 , 1077 , 1 , 'b1077' );
+insert into pa_tn_tb1 values ( 1601482522000 , 1114 , 1114 , 2 , 'b1114' );
+insert into pa_tn_tb1 values ( 1601482523000 , 1151 , 1151 , 3 , 'b1151' );
+insert into pa_tn_tb1 values ( 1601482524000 , 1188 , 1188 , 4 , 'b1188' );
+insert into pa_tn_tb1 values ( 1601482525000 , 1225 , 1225 , 5 , 'b1225' );
+insert into pa_tn_tb1 values ( 1601482526000 , 1262 , 1262 , 6 , 'b1262' );
+insert into pa_tn_tb1 values ( 1601482527000 , 1299 , 1299 , 7 , 'b1299' );
+insert into pa_tn_tb1 values ( 1601482528000 , 1336 , 1336 , 8 , 'b1336' );
+insert into pa_tn_tb1 values ( 1601482529000 , 1373 , 1373 , 9 , 'b1373' );
+insert into pa_tn_tb1 values ( 1601482530000 , 1410 , 1410 , 0 , 'b1410' );
+insert into pa_tn_tb1 values ( 1601482531000 , 1447 , 1447 , 1 , 'b1447' );
+insert into pa_tn_tb1 values ( 1601482532000 , 1484 , 1484 , 2 , 'b1484' );
+insert into pa_tn_tb1 values ( 1601482533000 , 1521 , 1521 , 3 , 'b1521' );
+insert into pa_tn_tb1 values ( 1601482534000 , 1558 , 1558 , 4 , 'b1558' );
+insert into pa_tn_tb1 values ( 1601482535000 , 1595 , 1595 , 5 , 'b1595' );
+insert into pa_tn_tb1 values ( 1601482536000 , 1632 , 1632 , 6 , 'b1632' );
+insert into pa_tn_tb1 values ( 1601482537000 , 1669 , 1669 , 7 , 'b1669' );
+insert into pa_tn_tb1 values ( 1601482538000 , 1706 , 1706 , 8 , 'b1706' );
+insert into pa_tn_tb1 values ( 1601482539000 , 1743 , 1743 , 9 , 'b1743' );
+insert into pa_tn_tb1 values ( 1601482540000 , 1780 , 1780 , 0 , 'b1780' );
+insert into pa_tn_tb1 values ( 1601482541000 , 1817 , 1817 , 1 , 'b1817' );
+insert into pa_tn_tb1 values ( 1601482542000 , 1854 , 1854 , 2 , 'b1854' );
+insert into pa_tn_tb1 values ( 1601482543000 , 1891 , 1891 , 3 , 'b1891' );
+insert into pa_tn_tb1 values ( 1601482544000 , 1928 , 1928 , 4 , 'b1928' );
+insert into pa_tn_tb1 values ( 1601482545000 , 1965 , 1965 , 5 , 'b1965' );
+insert into pa_tn_tb1 values ( 1601482546000 , 1002 , 1002 , 6 , 'b1002' );
+insert into pa_tn_tb1 values ( 1601482547000 , 1039 , 1039 , 7 , 'b1039' );
+insert into pa_tn_tb1 values ( 1601482548000 , 1076 , 1076 , 8 , 'b1076' );
+insert into pa_tn_tb1 values ( 1601482549000 , 1113 , 1113 , 9 , 'b1113' );
+insert into pa_tn_tb1 values ( 1601482550000 , 1150 , NULL , 0 , 'b1150' );
+insert into pa_tn_tb1 values ( 1601482551000 , 1187 , 1187 , 1 , 'b1187' );
+insert into pa_tn_tb1 values ( 1601482552000 , 1224 , 1224 , 2 , 'b1224' );
+insert into pa_tn_tb1 values ( 1601482553000 , 1261 , 1261 , 3 , 'b1261' );
+insert into pa_tn_tb1 values ( 1601482554000 , 1298 , 1298 , 4 , 'b1298' );
+insert into pa_tn_tb1 values ( 1601482555000 , 1335 , 1335 , 5 , 'b1335' );
+insert into pa_tn_tb1 values ( 1601482556000 , 1372 , 1372 , 6 , 'b1372' );
+insert into pa_tn_tb1 values ( 1601482557000 , 1409 , 1409 , 7 , 'b1409' );
+insert into pa_tn_tb1 values ( 1601482558000 , 1446 , 1446 , 8 , 'b1446' );
+insert into pa_tn_tb1 values ( 1601482559000 , 1483 , 1483 , 9 , 'b1483' );
+insert into pa_tn_tb1 values ( 1601482560000 , 1520 , 1520 , 0 , 'b1520' );
+insert into pa_tn_tb1 values ( 1601482561000 , 1557 , 1557 , 1 , 'b1557' );
+insert into pa_tn_tb1 values ( 1601482562000 , 1594 , 1594 , 2 , 'b1594' );
+insert into pa_tn_tb1 values ( 1601482563000 , 1631 , 1631 , 3 , 'b1631' );
+insert into pa_tn_tb1 values ( 1601482564000 , 1668 , 1668 , 4 , 'b1668' );
+insert into pa_tn_tb1 values ( 1601482565000 , 1705 , 1705 , 5 , 'b1705' );
+insert into pa_tn_tb1 values ( 1601482566000 , 1742 , 1742 , 6 , 'b1742' );
+insert into pa_tn_tb1 values ( 1601482567000 , 1779 , 1779 , 7 , 'b1779' );
+insert into pa_tn_tb1 values ( 1601482568000 , 1816 , 1816 , 8 , 'b1816' );
+insert into pa_tn_tb1 values ( 1601482569000 , 1853 , 1853 , 9 , 'b1853' );
+insert into pa_tn_tb1 values ( 1601482570000 , 1890 , 1890 , 0 , 'b1890' );
+insert into pa_tn_tb1 values ( 1601482571000 , 1927 , 1927 , 1 , 'b1927' );
+insert into pa_tn_tb1 values ( 1601482572000 , 1964 , 1964 , 2 , 'b1964' );
+insert into pa_tn_tb1 values ( 1601482573000 , 1001 , 1001 , 3 , 'b1001' );
+insert into pa_tn_tb1 values ( 1601482574000 , 1038 , 1038 , 4 , 'b1038' );
+insert into pa_tn_tb1 values ( 1601482575000 , 1075 , 1075 , 5 , 'b1075' );
+insert into pa_tn_tb1 values ( 1601482576000 , 1112 , 1112 , 6 , 'b1112' );
+insert into pa_tn_tb1 values ( 1601482577000 , 1149 , 1149 , 7 , 'b1149' );
+insert into pa_tn_tb1 values ( 1601482578000 , 1186 , 1186 , 8 , 'b1186' );
+insert into pa_tn_tb1 values ( 1601482579000 , 1223 , 1223 , 9 , 'b1223' );
+insert into pa_tn_tb1 values ( 1601482580000 , 1260 , 1260 , 0 , 'b1260' );
+insert into pa_tn_tb1 values ( 1601482581000 , 1297 , 1297 , 1 , 'b1297' );
+insert into pa_tn_tb1 values ( 1601482582000 , 1334 , 1334 , 2 , 'b1334' );
+insert into pa_tn_tb1 values ( 1601482583000 , 1371 , 1371 , 3 , 'b1371' );
+insert into pa_tn_tb1 values ( 1601482584000 , 1408 , 1408 , 4 , 'b1408' );
+insert into pa_tn_tb1 values ( 1601482585000 , 1445 , 1445 , 5 , 'b1445' );
+insert into pa_tn_tb1 values ( 1601482586000 , 1482 , 1482 , 6 , 'b1482' );
+insert into pa_tn_tb1 values ( 1601482587000 , 1519 , 1519 , 7 , 'b1519' );
+insert into pa_tn_tb1 values ( 1601482588000 , 1556 , 1556 , 8 , 'b1556' );
+insert into pa_tn_tb1 values ( 1601482589000 , 1593 , 1593 , 9 , 'b1593' );
+insert into pa_tn_tb1 values ( 1601482590000 , 1630 , 1630 , 0 , 'b1630' );
+insert into pa_tn_tb1 values ( 1601482591000 , 1667 , 1667 , 1 , 'b1667' );
+insert into pa_tn_tb1 values ( 1601482592000 , 1704 , 1704 , 2 , 'b1704' );
+insert into pa_tn_tb1 values ( 1601482593000 , 1741 , 1741 , 3 , 'b1741' );
+insert into pa_tn_tb1 values ( 1601482594000 , 1778 , 1778 , 4 , 'b1778' );
+insert into pa_tn_tb1 values ( 1601482595000 , 1815 , 1815 , 5 , 'b1815' );
+insert into pa_tn_tb1 values ( 1601482596000 , 1852 , 1852 , 6 , 'b1852' );
+insert into pa_tn_tb1 values ( 1601482597000 , 1889 , 1889 , 7 , 'b1889' );
+insert into pa_tn_tb1 values ( 1601482598000 , 1926 , 1926 , 8 , 'b1926' );
+insert into pa_tn_tb1 values ( 1601482599000 , 1963 , 1963 , 9 , 'b1963' );
+select * from (select ts, c1, c4 from pa_tn_tb0 ) order by c1 limit 3;
+select * from (select ts, c1 from pa_tn_tb0 ) order by c1 desc limit 3 offset 10;
+select * from (select ts, c1 from pa_tn_tb0 ) order by c1 desc limit 100 offset 995;
+select * from (select ts, c1 from pa_tn_tb0 ) order by c1 limit 10 offset 1000;
+select * from (select ts, c2 from pa_tn_tb0 ) order by c2 limit 3 offset 18;
+select * from (select ts, c2 from pa_tn_tb0 ) order by c2 desc limit 2 offset 979;
+select * from (select ts, c3 from pa_tn_tb0 ) order by c3 limit 4 offset 98;
+select * from (select ts, c1, t1 from pa_tn_mt0 ) order by c1 desc limit 2;
+select * from (select ts, c1, t1 from pa_tn_mt0 ) order by c1 limit 3 offset 999;
+select * from (select ts, c4 from pa_tn_mt0 ) order by c4 desc limit 2 offset 1;
+select * from (select ts, c2 from pa_tn_mt0 where t1 = 1 ) order by c2 limit 1 offset 20;
+drop database pa_tn_db0;
+show databases;
+# cd /root/repo/tests/script; sh/exec.sh -n dnode1 -s stop -x SIGINT;